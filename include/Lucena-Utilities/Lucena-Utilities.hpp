@@ -59,12 +59,17 @@
 
 #include <Lucena-Utilities/lulConcurrencyTypes.hpp>
 #include <Lucena-Utilities/lulEndian.hpp>
+#include <Lucena-Utilities/lulErrorHandlers.hpp>
+#include <Lucena-Utilities/lulFormat.hpp>
 #include <Lucena-Utilities/lulIterator.hpp>
 #include <Lucena-Utilities/lulMemoryTypes.hpp>
 #include <Lucena-Utilities/lulPackaging.hpp>
+#include <Lucena-Utilities/lulRope.hpp>
 #include <Lucena-Utilities/lulTime.hpp>
 #include <Lucena-Utilities/lulTypes.hpp>
 #include <Lucena-Utilities/lulTypeTraits.hpp>
+#include <Lucena-Utilities/lulUnicodeIterator.hpp>
+#include <Lucena-Utilities/lulUnicodeLiterals.hpp>
 #include <Lucena-Utilities/lulUtilities.hpp>
 #include <Lucena-Utilities/lulVersion.hpp>
 
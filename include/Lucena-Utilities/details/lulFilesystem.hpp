@@ -731,7 +731,7 @@ struct _PathCVT {
 
 	static void __append_range(std::string& __dest, _ECharT const* __b,
 							 _ECharT const* __e) {
-	_Narrower()(back_inserter(__dest), __b, __e);
+	_Narrower().__append(__dest, __b, __e);
 	}
 
 	template <class _Iter>
@@ -740,7 +740,7 @@ struct _PathCVT {
 	if (__b == __e)
 		return;
 	std::basic_string<_ECharT> __tmp(__b, __e);
-	_Narrower()(back_inserter(__dest), __tmp.data(),
+	_Narrower().__append(__dest, __tmp.data(),
 				__tmp.data() + __tmp.length());
 	}
 
@@ -753,7 +753,7 @@ struct _PathCVT {
 	std::basic_string<_ECharT> __tmp;
 	for (; *__b != __sentinal; ++__b)
 		__tmp.push_back(*__b);
-	_Narrower()(std::back_inserter(__dest), __tmp.data(),
+	_Narrower().__append(__dest, __tmp.data(),
 				__tmp.data() + __tmp.length());
 	}
 
@@ -1055,7 +1055,7 @@ public:
 	using _Str = std::basic_string<_ECharT, _Traits, _Allocator>;
 	_Str __s(__a);
 	__s.reserve(__pn_.size());
-	_CVT()(back_inserter(__s), __pn_.data(), __pn_.data() + __pn_.size());
+	_CVT().__append(__s, __pn_.data(), __pn_.data() + __pn_.size());
 	return __s;
 	}
 
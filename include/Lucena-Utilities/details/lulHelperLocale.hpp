@@ -18,6 +18,8 @@
 	* removal of some unneeded preprocessor tests and attributes
 	* renaming of various macros to use LUL versions
 	* renaming of system-reserved symbols
+	* the UTF-16 and UTF-32 helpers use the library’s own transcoders instead
+	of std::codecvt, and can append straight to a string
 
 ------------------------------------------------------------------------------*/
 
@@ -31,14 +33,34 @@
 #endif
 
 //	std
-#include <locale>
+#include <cstddef>
+#include <string>
 
 
 LUL_begin_v_namespace
 
 namespace stdproxy { namespace details {
 
-[[noreturn]] LUL_VIS_DEFINE void __throw_runtime_error(const char*);
+// Unlike libc++, the UTF-16 and UTF-32 conversions below don’t go through
+// std::codecvt one character at a time; they hand whole runs of input to the
+// library’s block transcoders, and copy the output out a chunk at a time.
+// Each of these chunk functions converts as much of [__b, __e) as fits in
+// [__buf, __buf + __n), stopping on a code point boundary, advances __b past
+// the input consumed, and returns the number of code units written. Invalid
+// input throws std::runtime_error, as the codecvt versions did.
+
+LUL_VIS_DEFINE size_t __narrow_to_utf8_chunk(const char16_t*& __b, const char16_t* __e,
+                                             char* __buf, size_t __n);
+LUL_VIS_DEFINE size_t __narrow_to_utf8_chunk(const char32_t*& __b, const char32_t* __e,
+                                             char* __buf, size_t __n);
+LUL_VIS_DEFINE size_t __widen_from_utf8_chunk(const char*& __b, const char* __e,
+                                              char16_t* __buf, size_t __n);
+LUL_VIS_DEFINE size_t __widen_from_utf8_chunk(const char*& __b, const char* __e,
+                                              char32_t* __buf, size_t __n);
+
+// Big enough that ASCII runs are copied out in bulk, small enough to live on
+// the stack.
+const size_t __utf8_chunk_size = 256;
 
 template <size_t _Np>
 struct __narrow_to_utf8
@@ -60,74 +82,67 @@ struct __narrow_to_utf8<8>
             *__s = *__wb;
         return __s;
     }
-};
 
-template <>
-struct __narrow_to_utf8<16>
-    : public std::codecvt<char16_t, char, std::mbstate_t>
-{
+    template <class _CharT, class _Traits, class _Allocator>
     LUL_VIS_ALWAYS_INLINE
-    __narrow_to_utf8() : std::codecvt<char16_t, char, std::mbstate_t>(1) {}
-
-    ~__narrow_to_utf8();
+    void
+    __append(std::basic_string<char, _Traits, _Allocator>& __dest,
+             const _CharT* __wb, const _CharT* __we) const
+    {
+        __dest.append(__wb, __we);
+    }
+};
 
+// __UCharT is the Unicode character type that _CharT is reinterpreted as;
+// this is how wchar_t is handled.
+template <class _UCharT>
+struct __narrow_to_utf8_chunked
+{
     template <class _OutputIterator, class _CharT>
     LUL_VIS_ALWAYS_INLINE
     _OutputIterator
     operator()(_OutputIterator __s, const _CharT* __wb, const _CharT* __we) const
     {
-        result __r = ok;
-        std::mbstate_t __mb;
-        while (__wb < __we && __r != error)
+        static_assert(sizeof(_CharT) == sizeof(_UCharT), "wrong character size");
+        const _UCharT* __b = reinterpret_cast<const _UCharT*>(__wb);
+        const _UCharT* __e = reinterpret_cast<const _UCharT*>(__we);
+        char __buf[__utf8_chunk_size];
+        while (__b < __e)
         {
-            const int __sz = 32;
-            char __buf[__sz];
-            char* __bn;
-            const char16_t* __wn = (const char16_t*)__wb;
-            __r = do_out(__mb, (const char16_t*)__wb, (const char16_t*)__we, __wn,
-                         __buf, __buf+__sz, __bn);
-            if (__r == codecvt_base::error || __wn == (const char16_t*)__wb)
-                __throw_runtime_error("locale not supported");
-            for (const char* __p = __buf; __p < __bn; ++__p, ++__s)
+            size_t __n = __narrow_to_utf8_chunk(__b, __e, __buf, __utf8_chunk_size);
+            for (const char* __p = __buf; __p < __buf + __n; ++__p, ++__s)
                 *__s = *__p;
-            __wb = (const _CharT*)__wn;
         }
         return __s;
     }
+
+    // Appending straight to a string skips the output iterator, so each
+    // chunk is copied in one go.
+    template <class _CharT, class _Traits, class _Allocator>
+    LUL_VIS_ALWAYS_INLINE
+    void
+    __append(std::basic_string<char, _Traits, _Allocator>& __dest,
+             const _CharT* __wb, const _CharT* __we) const
+    {
+        static_assert(sizeof(_CharT) == sizeof(_UCharT), "wrong character size");
+        const _UCharT* __b = reinterpret_cast<const _UCharT*>(__wb);
+        const _UCharT* __e = reinterpret_cast<const _UCharT*>(__we);
+        char __buf[__utf8_chunk_size];
+        while (__b < __e)
+            __dest.append(__buf, __narrow_to_utf8_chunk(__b, __e, __buf, __utf8_chunk_size));
+    }
 };
 
 template <>
-struct __narrow_to_utf8<32>
-    : public std::codecvt<char32_t, char, std::mbstate_t>
+struct __narrow_to_utf8<16>
+    : public __narrow_to_utf8_chunked<char16_t>
 {
-    LUL_VIS_ALWAYS_INLINE
-    __narrow_to_utf8() : std::codecvt<char32_t, char, std::mbstate_t>(1) {}
-
-    ~__narrow_to_utf8();
+};
 
-    template <class _OutputIterator, class _CharT>
-    LUL_VIS_ALWAYS_INLINE
-    _OutputIterator
-    operator()(_OutputIterator __s, const _CharT* __wb, const _CharT* __we) const
-    {
-        result __r = ok;
-        std::mbstate_t __mb;
-        while (__wb < __we && __r != error)
-        {
-            const int __sz = 32;
-            char __buf[__sz];
-            char* __bn;
-            const char32_t* __wn = (const char32_t*)__wb;
-            __r = do_out(__mb, (const char32_t*)__wb, (const char32_t*)__we, __wn,
-                         __buf, __buf+__sz, __bn);
-            if (__r == codecvt_base::error || __wn == (const char32_t*)__wb)
-                __throw_runtime_error("locale not supported");
-            for (const char* __p = __buf; __p < __bn; ++__p, ++__s)
-                *__s = *__p;
-            __wb = (const _CharT*)__wn;
-        }
-        return __s;
-    }
+template <>
+struct __narrow_to_utf8<32>
+    : public __narrow_to_utf8_chunked<char32_t>
+{
 };
 
 template <size_t _Np>
@@ -150,76 +165,63 @@ struct __widen_from_utf8<8>
             *__s = *__nb;
         return __s;
     }
-};
 
-template <>
-struct __widen_from_utf8<16>
-    : public std::codecvt<char16_t, char, std::mbstate_t>
-{
+    template <class _CharT, class _Traits, class _Allocator>
     LUL_VIS_ALWAYS_INLINE
-    __widen_from_utf8() : std::codecvt<char16_t, char, std::mbstate_t>(1) {}
-
-    ~__widen_from_utf8();
+    void
+    __append(std::basic_string<_CharT, _Traits, _Allocator>& __dest,
+             const char* __nb, const char* __ne) const
+    {
+        __dest.append(__nb, __ne);
+    }
+};
 
+template <class _UCharT>
+struct __widen_from_utf8_chunked
+{
     template <class _OutputIterator>
     LUL_VIS_ALWAYS_INLINE
     _OutputIterator
     operator()(_OutputIterator __s, const char* __nb, const char* __ne) const
     {
-        result __r = ok;
-        std::mbstate_t __mb;
-        while (__nb < __ne && __r != error)
+        _UCharT __buf[__utf8_chunk_size];
+        while (__nb < __ne)
         {
-            const int __sz = 32;
-            char16_t __buf[__sz];
-            char16_t* __bn;
-            const char* __nn = __nb;
-            __r = do_in(__mb, __nb, __ne - __nb > __sz ? __nb+__sz : __ne, __nn,
-                        __buf, __buf+__sz, __bn);
-            if (__r == codecvt_base::error || __nn == __nb)
-                __throw_runtime_error("locale not supported");
-            for (const char16_t* __p = __buf; __p < __bn; ++__p, ++__s)
+            size_t __n = __widen_from_utf8_chunk(__nb, __ne, __buf, __utf8_chunk_size);
+            for (const _UCharT* __p = __buf; __p < __buf + __n; ++__p, ++__s)
                 *__s = (wchar_t)*__p;
-            __nb = __nn;
         }
         return __s;
     }
-};
 
-template <>
-struct __widen_from_utf8<32>
-    : public std::codecvt<char32_t, char, std::mbstate_t>
-{
+    template <class _CharT, class _Traits, class _Allocator>
     LUL_VIS_ALWAYS_INLINE
-    __widen_from_utf8() : std::codecvt<char32_t, char, std::mbstate_t>(1) {}
-
-    ~__widen_from_utf8();
-
-    template <class _OutputIterator>
-    LUL_VIS_ALWAYS_INLINE
-    _OutputIterator
-    operator()(_OutputIterator __s, const char* __nb, const char* __ne) const
+    void
+    __append(std::basic_string<_CharT, _Traits, _Allocator>& __dest,
+             const char* __nb, const char* __ne) const
     {
-        result __r = ok;
-        std::mbstate_t __mb;
-        while (__nb < __ne && __r != error)
+        static_assert(sizeof(_CharT) == sizeof(_UCharT), "wrong character size");
+        _UCharT __buf[__utf8_chunk_size];
+        while (__nb < __ne)
         {
-            const int __sz = 32;
-            char32_t __buf[__sz];
-            char32_t* __bn;
-            const char* __nn = __nb;
-            __r = do_in(__mb, __nb, __ne - __nb > __sz ? __nb+__sz : __ne, __nn,
-                        __buf, __buf+__sz, __bn);
-            if (__r == codecvt_base::error || __nn == __nb)
-                __throw_runtime_error("locale not supported");
-            for (const char32_t* __p = __buf; __p < __bn; ++__p, ++__s)
-                *__s = (wchar_t)*__p;
-            __nb = __nn;
+            size_t __n = __widen_from_utf8_chunk(__nb, __ne, __buf, __utf8_chunk_size);
+            __dest.append(reinterpret_cast<const _CharT*>(__buf), __n);
         }
-        return __s;
     }
 };
 
+template <>
+struct __widen_from_utf8<16>
+    : public __widen_from_utf8_chunked<char16_t>
+{
+};
+
+template <>
+struct __widen_from_utf8<32>
+    : public __widen_from_utf8_chunked<char32_t>
+{
+};
+
 } } // namespace details, namespace stdproxy
 
 LUL_end_v_namespace
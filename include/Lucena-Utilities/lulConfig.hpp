@@ -397,6 +397,23 @@ LUL_end_v_namespace
 //		LUL_CONFIG_std_variant_supported
 
 
+//	Parallel Unicode processing
+//	Validating or transcoding a UTF-8 string that is at least
+//	LUL_CONFIG_parallel_threshold bytes long is split across multiple threads,
+//	up to LUL_CONFIG_parallel_thread_limit of them; a limit of 0 means to use
+//	as many threads as the hardware supports, and a limit of 1 disables
+//	parallel processing altogether. These are only the defaults; both can be
+//	changed at runtime with Set_Parallel_Threshold and
+//	Set_Parallel_Thread_Limit.
+#ifndef LUL_CONFIG_parallel_threshold
+	#define LUL_CONFIG_parallel_threshold		(32 * 1024 * 1024)
+#endif
+
+#ifndef LUL_CONFIG_parallel_thread_limit
+	#define LUL_CONFIG_parallel_thread_limit	0
+#endif
+
+
 //	Diagnostic flag for indicating that we’d like to test the build environment
 //	for feature availbility. If this is defined, the tests are performed and
 //	the results are displayed as compile-time warnings. It is assumed that both
@@ -0,0 +1,252 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“ErrorHandlers.hpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+#pragma once
+
+
+//	std
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <memory>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulTypes.hpp>
+
+
+LUL_begin_v_namespace
+
+
+/*------------------------------------------------------------------------------
+	Error Constants
+*/
+
+//	Handlers that have to discard Status objects post one of these in the
+//	STRING_GROUP_messages domain (i.e., as a warning) to say how many were
+//	lost.
+constexpr StatusCode STATUS_CODE_overflow	{STATUS_CODE_signal - 1};
+
+//	Handlers that suppress repeated Status objects post one of these in the
+//	STRING_GROUP_messages domain to say how many times one was repeated.
+constexpr StatusCode STATUS_CODE_repeated	{STATUS_CODE_signal - 2};
+
+
+/*------------------------------------------------------------------------------
+	AsyncErrorHandler
+
+	An AsyncErrorHandler takes Status objects off the posting thread and hands
+	them to in_target on a background thread of its own, so that posting an
+	error never waits on in_target’s I/O; if in_target is nullptr, a plain
+	ErrorHandler is used, which writes to std::cerr. Post simply moves its
+	argument into a bounded lock-free queue with room for in_capacity entries
+	(rounded up to a power of 2), which any number of threads may post to at
+	once. Since Status objects are cheap to move, and usually don’t allocate,
+	posting one is normally just a few atomic operations.
+
+	in_overflow decides what happens when the queue is full:
+
+		Overflow::Drop		the Status is discarded.
+		Overflow::Count		the Status is discarded, but the number that were
+							discarded is posted to in_target, as a
+							STATUS_CODE_overflow warning, as soon as the queue
+							has drained.
+		Overflow::Block		Post waits for room in the queue.
+
+	Either way, Dropped returns the total number of Status objects discarded.
+
+	Flush waits until everything that has been posted so far has been handed
+	to in_target, and then flushes in_target; Finalize flushes whichever
+	handler is installed, so nothing is lost at shutdown. Destroying the
+	handler drains the queue, too.
+
+	A typical setup is simply:
+
+		ErrorHandler::Get (std::make_unique <AsyncErrorHandler>());
+*/
+
+class AsyncErrorHandler
+	:	public ErrorHandler
+{
+	public:
+		enum class Overflow : uint8_t
+		{
+			Drop,
+			Count,
+			Block
+		};
+
+		explicit				AsyncErrorHandler (
+									ErrorHandlerUnq			in_target = ErrorHandlerUnq{},
+									std::size_t				in_capacity = 1024,
+									Overflow				in_overflow = Overflow::Count);
+
+								AsyncErrorHandler (const AsyncErrorHandler &) = delete;
+
+								~AsyncErrorHandler() override;
+
+		AsyncErrorHandler &		operator = (const AsyncErrorHandler &) = delete;
+
+
+		void					Post (Status in_status) override;
+		void					Flush() override;
+
+		std::size_t				Dropped() const noexcept;
+
+
+	private:
+		struct Queue;
+
+		std::unique_ptr <Queue>	_queue;
+};
+
+
+/*------------------------------------------------------------------------------
+	FlightRecorder
+
+	A FlightRecorder keeps the last in_depth Status objects posted by each
+	thread (rounded up to a power of 2) in memory, so that a detailed error
+	history is available in production without paying for any log I/O. Each
+	thread gets a fixed-size ring of its own the first time it posts, so
+	recording a Status never contends with other threads: it takes one atomic
+	increment, for the sequence number, plus copying the domain, code, file,
+	function, line, and up to k_message_size - 1 bytes of the message (cut
+	at a character boundary). Only the head of a chain is recorded. If
+	in_target isn’t nullptr, each Status is passed along to it, as well.
+
+	A thread’s ring lives as long as the FlightRecorder, so the history of
+	threads that have since exited is kept, too; a ring is taken over by any
+	later thread that happens to get the same std::thread::id.
+
+	Dump writes the recorded history, oldest first, one thread at a time, by
+	way of in_write; every Status is prefixed by its sequence number, so the
+	threads’ histories can be interleaved again if need be. It neither
+	allocates nor takes any locks, and simply skips anything that’s being
+	overwritten as it reads, so it may be called at any time, including from
+	a crash handler, as long as in_write is safe to call there, too (e.g., it
+	calls write(2)). The std::ostream overload is more convenient otherwise.
+
+		auto recorder = std::make_unique <FlightRecorder> (
+			64, std::make_unique <AsyncErrorHandler>());
+		auto history = recorder.get();
+
+		ErrorHandler::Get (std::move (recorder));
+		...
+		history->Dump (std::cerr);
+*/
+
+class FlightRecorder
+	:	public ErrorHandler
+{
+	public:
+		static constexpr std::size_t	k_message_size	{96};
+
+		using DumpFunc = void (*) (
+			const char *			in_text,
+			std::size_t				in_size,
+			void *					in_context);
+
+		explicit				FlightRecorder (
+									std::size_t				in_depth = 64,
+									ErrorHandlerUnq			in_target = ErrorHandlerUnq{});
+
+								FlightRecorder (const FlightRecorder &) = delete;
+
+								~FlightRecorder() override;
+
+		FlightRecorder &		operator = (const FlightRecorder &) = delete;
+
+
+		void					Post (Status in_status) override;
+		void					Flush() override;
+
+		void					Dump (
+									DumpFunc				in_write,
+									void *					in_context) const noexcept;
+
+		void					Dump (
+									std::ostream &			out_stream) const;
+
+
+	private:
+		struct Recorder;
+
+		std::unique_ptr <Recorder>	_recorder;
+};
+
+
+/*------------------------------------------------------------------------------
+	ThrottledErrorHandler
+
+	A ThrottledErrorHandler keeps an error storm - say, every request failing
+	the same way because some dependency is down - from turning into a CPU
+	and I/O storm. It passes Status objects along to in_target, but treats
+	all those with the same domain, code, file, and line as repeats of one
+	another, and only lets in_burst of them through at once, and another one
+	every in_interval after that; if in_target is nullptr, a plain
+	ErrorHandler is used, which writes to std::cerr. The first occurrence
+	always goes through.
+
+	The rest are suppressed, and simply counted. The next time one is let
+	through, it is preceded by a STATUS_CODE_repeated warning, with the same
+	file, function, and line, that says how many times it was repeated in
+	the meantime; Flush posts any such counts that are still pending, so
+	Finalize does, too. So, with the default settings, a storm comes out as
+	its first Status, followed by about one summary and one sample a second.
+
+	The counts are kept in a lock-free hash table with room for in_capacity
+	different kinds of Status (rounded up to a power of 2); entries are never
+	removed, since the set of places that post errors is small and fixed. A
+	suppressed post costs a hash, a read of the clock, and two atomic
+	operations on the entry, and never allocates. Should the table fill up,
+	any further kinds of Status are passed along unthrottled. File names are
+	compared by address, as __FILE__ is a string literal; kinds are
+	identified by a 64-bit hash, so two could, in principle, be conflated.
+
+		ErrorHandler::Get (std::make_unique <ThrottledErrorHandler> (
+			std::make_unique <AsyncErrorHandler>()));
+*/
+
+class ThrottledErrorHandler
+	:	public ErrorHandler
+{
+	public:
+		explicit				ThrottledErrorHandler (
+									ErrorHandlerUnq			in_target = ErrorHandlerUnq{},
+									std::size_t				in_burst = 1,
+									std::chrono::nanoseconds	in_interval = std::chrono::seconds {1},
+									std::size_t				in_capacity = 1024);
+
+								ThrottledErrorHandler (const ThrottledErrorHandler &) = delete;
+
+								~ThrottledErrorHandler() override;
+
+		ThrottledErrorHandler &	operator = (const ThrottledErrorHandler &) = delete;
+
+
+		void					Post (Status in_status) override;
+		void					Flush() override;
+
+
+	private:
+		struct Table;
+
+		std::unique_ptr <Table>	_table;
+};
+
+
+/*----------------------------------------------------------------------------*/
+
+LUL_end_v_namespace
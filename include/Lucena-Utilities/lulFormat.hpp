@@ -0,0 +1,268 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“Format.hpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+#pragma once
+
+
+//	std
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulTypes.hpp>
+
+
+LUL_begin_v_namespace
+
+
+/*------------------------------------------------------------------------------
+	Type-Safe Formatting
+
+	Format_To, Format_String, and Formatted_Size are a type-safe alternative to
+	VA_To_String. Each {} in in_format is replaced by the next argument,
+	formatted according to its own type, so an argument can never be
+	misinterpreted the way a mismatched printf conversion would be; {{ and }}
+	stand for literal braces.
+
+	The number of placeholders is checked against the number of arguments
+	with LUL_Assert_, i.e., in debug builds only. In other builds,
+	placeholders beyond the last argument are left empty, and arguments
+	beyond the last placeholder are ignored. Count_Placeholders is constexpr,
+	so a literal format can be checked at compile time, too:
+
+		static_assert (Count_Placeholders ("{} of {}") == 2);
+
+	Arguments may be bools, chars, integers, enums (formatted as their
+	underlying values), floating point values (formatted as with %g), C
+	strings, std::strings, string_views, U8Strings, InternedStrings, and
+	pointers; anything else is rejected at compile time. Note that char16_t,
+	char32_t, and wchar_t are deliberately rejected, rather than being
+	formatted as the integers they technically are.
+
+	Format_To writes as much of the result as will fit into out_buffer, null-
+	terminating it unless in_buffer_size is 0, and returns the length of the
+	complete result, as snprintf does; passing nullptr and 0 simply measures
+	the result. Format_String measures the result first, and then formats
+	straight into the string it returns, so nothing is ever truncated, and
+	nothing is allocated but the string itself.
+*/
+
+class FormatArg
+{
+	public:
+		enum class Kind : uint8_t
+		{
+			None,
+			Bool,
+			Char,
+			Signed,
+			Unsigned,
+			Float,
+			Pointer,
+			String
+		};
+
+								FormatArg() noexcept
+									:	_kind {Kind::None},
+										_unsigned {0}
+								{ }
+
+		template <typename T>
+								FormatArg (
+									const T &				in_value) noexcept;
+
+		Kind					_kind;
+
+		union
+		{
+			long long			_signed;
+			unsigned long long	_unsigned;
+			double				_float;
+			const void *		_pointer;
+			std::string_view	_string;
+		};
+};
+
+
+/*------------------------------------------------------------------------------
+*/
+
+template <typename T>
+FormatArg::FormatArg (
+	const T &				in_value) noexcept
+	:	_kind {Kind::None},
+		_unsigned {0}
+{
+	using type = std::decay_t <T>;
+
+	if constexpr (std::is_same_v <type, bool>)
+	{
+		_kind = Kind::Bool;
+		_unsigned = in_value;
+	}
+	else if constexpr (std::is_same_v <type, char>)
+	{
+		_kind = Kind::Char;
+		_unsigned = static_cast <unsigned char> (in_value);
+	}
+	else if constexpr (std::is_same_v <type, wchar_t> or std::is_same_v <type, char16_t> or
+		std::is_same_v <type, char32_t>)
+	{
+		static_assert (!std::is_same_v <T, T>, "Format_To only supports UTF-8 text");
+	}
+	else if constexpr (std::is_enum_v <type>)
+	{
+		*this = FormatArg {static_cast <std::underlying_type_t <type>> (in_value)};
+	}
+	else if constexpr (std::is_integral_v <type> and std::is_signed_v <type>)
+	{
+		_kind = Kind::Signed;
+		_signed = in_value;
+	}
+	else if constexpr (std::is_integral_v <type>)
+	{
+		_kind = Kind::Unsigned;
+		_unsigned = in_value;
+	}
+	else if constexpr (std::is_floating_point_v <type>)
+	{
+		_kind = Kind::Float;
+		_float = static_cast <double> (in_value);
+	}
+	else if constexpr (std::is_array_v <T> and
+		(std::is_same_v <type, const char *> or std::is_same_v <type, char *>))
+	{
+		_kind = Kind::String;
+		_string = std::string_view {in_value};
+	}
+	else if constexpr (std::is_same_v <type, const char *> or std::is_same_v <type, char *>)
+	{
+		_kind = Kind::String;
+		_string = in_value ? std::string_view {in_value} : std::string_view {"(null)"};
+	}
+	else if constexpr (std::is_same_v <type, U8String> or std::is_same_v <type, InternedString>)
+	{
+		_kind = Kind::String;
+		_string = in_value.Get_StringView();
+	}
+	else if constexpr (std::is_convertible_v <const T &, std::string_view>)
+	{
+		_kind = Kind::String;
+		_string = in_value;
+	}
+	else if constexpr (std::is_pointer_v <type> or std::is_null_pointer_v <type>)
+	{
+		_kind = Kind::Pointer;
+		_pointer = in_value;
+	}
+	else
+	{
+		static_assert (!std::is_same_v <T, T>, "unsupported argument type for Format_To");
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Return the number of {} placeholders in in_format, following the same
+	rules as Format_To.
+*/
+
+constexpr std::size_t
+Count_Placeholders (
+	std::string_view		in_format) noexcept
+{
+	std::size_t nrv = 0;
+
+	for (std::size_t i = 0; (i + 1) < in_format.size(); ++i)
+	{
+		auto c = in_format [i];
+		auto following = in_format [i + 1];
+
+		if ((c == '{') and (following == '}'))
+		{
+			++nrv;
+			++i;
+		}
+		else if (((c == '{') or (c == '}')) and (following == c))
+		{
+			++i;
+		}
+	}
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Format_Args_To does the actual work for the templates below.
+*/
+
+std::size_t
+Format_Args_To (
+	char *					out_buffer,
+	std::size_t				in_buffer_size,
+	std::string_view		in_format,
+	const FormatArg *		in_args,
+	std::size_t				in_count) noexcept;
+
+
+//	The leading FormatArg in each of these simply keeps the array from being
+//	empty when there are no arguments.
+template <typename ...ARGS>
+std::size_t
+Format_To (
+	char *					out_buffer,
+	std::size_t				in_buffer_size,
+	std::string_view		in_format,
+	const ARGS &			...in_args) noexcept
+{
+	const FormatArg args [] {FormatArg{}, FormatArg {in_args}...};
+
+	return Format_Args_To (out_buffer, in_buffer_size, in_format, args + 1, sizeof... (ARGS));
+}
+
+
+template <typename ...ARGS>
+std::size_t
+Formatted_Size (
+	std::string_view		in_format,
+	const ARGS &			...in_args) noexcept
+{
+	return Format_To (nullptr, 0, in_format, in_args...);
+}
+
+
+template <typename ...ARGS>
+std::string
+Format_String (
+	std::string_view		in_format,
+	const ARGS &			...in_args)
+{
+	const FormatArg args [] {FormatArg{}, FormatArg {in_args}...};
+	auto size = Format_Args_To (nullptr, 0, in_format, args + 1, sizeof... (ARGS));
+	auto nrv = std::string (size, '\0');
+
+	(void) Format_Args_To (nrv.data(), size + 1, in_format, args + 1, sizeof... (ARGS));
+
+	return nrv;
+}
+
+
+/*----------------------------------------------------------------------------*/
+
+LUL_end_v_namespace
@@ -26,10 +26,14 @@
 LUL_begin_v_namespace
 
 namespace details {
+	//	When reverse is handed an lvalue, T is a reference type and we simply
+	//	refer to the original; when it is handed a temporary, such as a range
+	//	returned from a function, T is a value type and we hold on to it so
+	//	that it lives as long as the wrapper does.
 	template <typename T>
 	struct reverse_wrapper
 	{
-		T & iterable;
+		T iterable;
 
 		LUL_VIS_ALWAYS_INLINE
 		constexpr auto begin() noexcept (
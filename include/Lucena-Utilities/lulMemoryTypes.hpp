@@ -19,6 +19,7 @@
 #include <memory>
 #include <tuple>
 #include <type_traits>
+#include <utility>
 
 
 //	lul
@@ -227,6 +228,94 @@ make_sized_buffer (
 }
 
 
+/*------------------------------------------------------------------------------
+	Adopt_String
+
+	Wrap in_size code units at in_data in a string wrapper (e.g., U8String)
+	without copying them; in_deleter is called on in_data once the wrapper is
+	done with it. Stateless deleters, such as raw_deleter, cost nothing extra;
+	others are moved to the heap to live alongside the wrapper. Should that
+	fail, in_data is deleted before the exception propagates, so the buffer
+	is never leaked. See the discussion of foreign buffers in lulTypes.hpp.
+
+	The second form takes over a buffer held by a unique_ptr, e.g., one made
+	by make_buffer.
+*/
+
+template <typename STRING_T, typename DELETER = raw_deleter <typename STRING_T::char_type>>
+STRING_T
+Adopt_String (
+	typename STRING_T::char_type *	in_data,
+	typename STRING_T::size_type	in_size,
+	DELETER					in_deleter = DELETER{})
+{
+	using char_type = typename STRING_T::char_type;
+
+	if constexpr (std::is_empty_v <DELETER> and std::is_default_constructible_v <DELETER>)
+	{
+		return STRING_T {in_data, in_size,
+			[] (void *, char_type * in_buffer) noexcept { DELETER{} (in_buffer); }, nullptr};
+	}
+	else
+	{
+		DELETER * deleter = nullptr;
+
+		try
+		{
+			deleter = new DELETER {std::move (in_deleter)};
+		}
+		catch (...)
+		{
+			in_deleter (in_data);
+			throw;
+		}
+
+		return STRING_T {in_data, in_size,
+			[] (void * in_context, char_type * in_buffer) noexcept
+			{
+				auto deleter = static_cast <DELETER *> (in_context);
+
+				(*deleter) (in_buffer);
+				delete deleter;
+			},
+			deleter};
+	}
+}
+
+
+template <typename STRING_T, typename DELETER>
+STRING_T
+Adopt_String (
+	std::unique_ptr <typename STRING_T::char_type, DELETER>	in_buffer,
+	typename STRING_T::size_type	in_size)
+{
+	auto deleter = DELETER {in_buffer.get_deleter()};
+
+	return Adopt_String <STRING_T> (in_buffer.release(), in_size, std::move (deleter));
+}
+
+
+/*------------------------------------------------------------------------------
+	Borrow_String
+
+	Wrap in_size code units at in_data in a string wrapper without copying
+	them or taking ownership of them; in_data must outlive the wrapper, and
+	any wrappers it is moved into.
+*/
+
+template <typename STRING_T>
+STRING_T
+Borrow_String (
+	const typename STRING_T::char_type *	in_data,
+	typename STRING_T::size_type	in_size)
+{
+	using char_type = typename STRING_T::char_type;
+
+	return Adopt_String <STRING_T> (const_cast <char_type *> (in_data), in_size,
+		null_deleter <char_type>{});
+}
+
+
 /*----------------------------------------------------------------------------*/
 
 LUL_end_v_namespace
@@ -90,6 +90,10 @@
 	particular build, such as “Carbon” or “WinAPI”.
 
 	LUL_PACKAGING_prefix is a naming prefix used by files in this project.
+
+	The string values are all UTF-8 literals; where another encoding is
+	needed, LUL_UTF16_Literal_ and its siblings in lulUnicodeLiterals.hpp
+	will convert them at compile time.
 */
 
 #if defined (LUL_CONFIG_debug) && LUL_CONFIG_debug
@@ -0,0 +1,195 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“Rope.hpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+#pragma once
+
+
+//	std
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulTypes.hpp>
+
+
+LUL_begin_v_namespace
+
+
+/*------------------------------------------------------------------------------
+	U8Rope
+
+	A U8Rope is a UTF-8 string built for assembling large amounts of text. Its
+	contents are written once into fixed-size chunks, which are never moved
+	or reallocated, and are then stitched together by a balanced tree of
+	pieces of those chunks. So appending never copies what came before,
+	inserting, erasing, and slicing take logarithmic time no matter how long
+	the rope is, and copying a rope, or appending one rope to another, shares
+	the chunks rather than copying them. Chunks come from a per-thread pool,
+	so a rope that is built and thrown away over and over doesn’t keep going
+	back to the heap.
+
+	Append accepts UTF-16, UTF-32, and wide strings as well; these are
+	transcoded straight into the chunks, with invalid sequences replaced as
+	with the string conversions in lulUtilities.hpp. Positions and counts are
+	always in bytes, and are clamped to the size of the rope; it is up to the
+	caller to keep them on code point boundaries.
+
+	The contents can be read without flattening them: For_Each_Segment passes
+	each contiguous piece, in order, to in_visitor, which can be anything
+	callable as void (std::string_view), and Get_Segments returns the same
+	pieces in a vector (e.g., to build an iovec array for writev). The
+	string_views are only valid until the rope is next modified or destroyed.
+	Flatten copies the whole rope into a U8String, and Copy copies part of it
+	into a caller-supplied buffer.
+
+	Ropes that share chunks can be used on different threads at the same time,
+	but as with the standard containers, a single rope must not be modified
+	while it is being accessed from another thread.
+*/
+
+struct RopeChunk;
+struct RopeNode;
+
+class U8Rope
+{
+	public:
+		using char_type = char;
+		using size_type = std::size_t;
+		using Visitor = void (*) (void *, std::string_view);
+
+		static constexpr size_type npos {static_cast <size_type> (-1)};
+
+								U8Rope() noexcept;
+								U8Rope (const U8Rope &) noexcept;
+								U8Rope (U8Rope &&) noexcept;
+								explicit U8Rope (std::string_view);
+								~U8Rope() noexcept;
+
+		U8Rope &				operator = (const U8Rope &) noexcept;
+		U8Rope &				operator = (U8Rope &&) noexcept;
+
+
+		//	accessors
+		size_type				size() const noexcept;
+		bool					empty() const noexcept		{ return 0 == size(); }
+		char_type				At (size_type in_pos) const noexcept;
+
+
+		//	modifiers
+		U8Rope &				Append (std::string_view in_string);
+		U8Rope &				Append (const char * in_string);
+		U8Rope &				Append (const std::string & in_string);
+		U8Rope &				Append (const U8String & in_string);
+		U8Rope &				Append (std::u16string_view in_string);
+		U8Rope &				Append (std::u32string_view in_string);
+		U8Rope &				Append (std::wstring_view in_string);
+		U8Rope &				Append (const U8Rope & in_rope);
+
+		void					Insert (
+									size_type				in_pos,
+									std::string_view		in_string);
+
+		void					Insert (
+									size_type				in_pos,
+									const U8Rope &			in_rope);
+
+		void					Erase (
+									size_type				in_pos,
+									size_type				in_count = npos);
+
+		void					Clear() noexcept;
+
+
+		//	operations
+		U8Rope					Slice (
+									size_type				in_pos,
+									size_type				in_count = npos) const;
+
+		size_type				Copy (
+									size_type				in_pos,
+									size_type				in_count,
+									char_type *				out_buffer) const noexcept;
+
+		U8String				Flatten() const;
+
+		std::vector <std::string_view> Get_Segments() const;
+
+		template <typename VISITOR>
+		void					For_Each_Segment (
+									VISITOR &&				in_visitor) const;
+
+		void					For_Each_Segment (
+									Visitor					in_visitor,
+									void *					in_context) const;
+
+
+	private:
+		template <typename VISITOR>
+		static void				Call_Visitor (
+									void *					in_context,
+									std::string_view		in_segment);
+
+		void					Flush_Tail();
+
+		bool					Extend_Tail (
+									std::string_view &		io_string) noexcept;
+
+		template <typename CHAR_T>
+		void					Append_Transcoded (
+									std::basic_string_view <CHAR_T>	in_string);
+
+		RopeNode *				Store (
+									std::string_view		in_string);
+
+		//	_root is the tree of pieces; the tail is a piece at the end of the
+		//	rope that is still being appended to, and isn’t in the tree yet.
+		RopeNode *				_root;
+		RopeChunk *				_tail_chunk;
+		size_type				_tail_offset;
+		size_type				_tail_size;
+};
+
+
+/*------------------------------------------------------------------------------
+	The templated For_Each_Segment simply forwards to the Visitor-based
+	version; see UTF8StreamDecoder.
+*/
+
+template <typename VISITOR>
+void
+U8Rope::Call_Visitor (
+	void *					in_context,
+	std::string_view		in_segment)
+{
+	(*static_cast <VISITOR *> (in_context)) (in_segment);
+}
+
+
+template <typename VISITOR>
+void
+U8Rope::For_Each_Segment (
+	VISITOR &&				in_visitor) const
+{
+	For_Each_Segment (&Call_Visitor <std::remove_reference_t <VISITOR>>,
+		const_cast <void *> (static_cast <const void *> (&in_visitor)));
+}
+
+
+/*----------------------------------------------------------------------------*/
+
+LUL_end_v_namespace
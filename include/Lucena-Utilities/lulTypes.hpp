@@ -81,11 +81,20 @@ constexpr StatusCode STATUS_CODE_signal		{std::numeric_limits <StatusCode>::max(
 	ErrorHandler. The default behavior is to make a copy of the argument; if
 	the caller has no further need of it, it is fine to move the original,
 	instead, at the call site.
+
+	Get returns the installed handler. The first non-null in_handler passed
+	to it is installed, and kept for the life of the process; until then, a
+	default handler that writes each Status to std::cerr is returned. Get is
+	safe to call from any thread. Flush makes sure that everything posted so
+	far has been written out; Finalize flushes the installed handler. See
+	lulErrorHandlers.hpp for handlers that don’t post synchronously.
 */
 
 class ErrorHandler
 {
 	public:
+		virtual					~ErrorHandler() = default;
+
 		static
 		ErrorHandler *			Get (
 									ErrorHandlerUnq in_handler =
@@ -93,6 +102,7 @@ class ErrorHandler
 
 
 		virtual void			Post (Status);
+		virtual void			Flush();
 };
 
 
@@ -104,9 +114,9 @@ class ErrorHandler
 	locale is set to UTF-8. We make an effort to guarantee that this assumption
 	remains valid.
 
-	The types here are effectively string_views with storage; they wrap the
-	equivalent std::basic_string types. Wrappers are used because it’s unsafe 
-	to operate on std::basic_strings that have been passed across module 
+	The types here are effectively string_views with storage; they stand in
+	for the equivalent std::basic_string types. Wrappers are used because it’s
+	unsafe to operate on std::basic_strings that have been passed across module 
 	boundaries since there’s no guarantee that the local string implementation 
 	will match that of the string source. The string wrappers deal with this by 
 	providing opaque objects which can be handed off to other functions or 
@@ -119,12 +129,32 @@ class ErrorHandler
 	would no longer be guaranteed to always work. This way, the implementation
 	is always available, so we can offer a minimum functionality guarantee.
 
-	Finally, note that the use of a unique_ptr member means that we have to
-	explicitly define the UXXString destructor or provide Det as a complete
-	type. Once again, the special member function cascade rears its ugly head:
-	we’re forced to explicitly define everything because we define the
-	destructor. More specifically, we can’t default anything since all the
-	definitions have to be in the same place.
+	Each wrapper stores its string in a layout that we define ourselves, so it
+	can safely be inspected inline, while everything that allocates or frees
+	is out-of-line; this keeps every heap buffer in the hands of the library’s
+	allocator, wherever the wrapper itself happens to be manipulated. Short
+	strings are stored within the object itself, so empty and short strings
+	never allocate; longer ones are stored in a single heap buffer owned by
+	the wrapper. Either way, _data always points at the string, so
+	Get_StringView and c_str need no branches.
+
+	A wrapper can also hold a foreign buffer, e.g., a memory-mapped file or a
+	network buffer, without copying it. The Releaser constructor adopts
+	in_data, and calls in_release (in_context, in_data) once the wrapper is
+	done with it; Adopt_String and Borrow_String in lulMemoryTypes.hpp build
+	the Releaser from a deleter such as raw_deleter, or null_deleter for a
+	buffer that is merely borrowed. A foreign buffer is never written to:
+	assigning to the wrapper releases it and switches to storage of its own,
+	and copying the wrapper copies the string. Strings short enough to be
+	stored locally are simply copied, and their buffers released right away.
+	Our own strings are always null-terminated, but a foreign string is only
+	null-terminated if its buffer was, so c_str should only be used on an
+	adopted string when that is known to be the case.
+
+	Moving a wrapper never allocates. Constructing one from a std::basic_string
+	rvalue doesn’t copy the characters either, unless the string is short:
+	the std::basic_string is moved into one of our own, whose buffer we
+	adopt, so large payloads can be handed over without being copied.
 
 	VERME There is a minor potential issue here since we grab our type aliases
 	for the wrappers from the types we’re wrapping; if a client implementation
@@ -147,30 +177,54 @@ class U8String
 	public:
 		using char_type = typename std::string::value_type;
 		using size_type = typename std::string::size_type;
+		using Releaser = void (*) (void *, char_type *) noexcept;
 
 								U8String (const char_type * = u8"");
 								U8String (const U8String &);
-								U8String (U8String &&);
+								U8String (U8String &&) noexcept;
 								U8String (const char_type *, size_type);
+								U8String (char_type *, size_type, Releaser, void *) noexcept;
 								U8String (const std::string &);
 								U8String (std::string &&);
 								U8String (std::string_view);
 								~U8String() noexcept;
 
 		U8String &				operator = (const U8String &);
-		U8String &				operator = (U8String &&);
+		U8String &				operator = (U8String &&) noexcept;
 		U8String &				operator = (std::string_view);
 		U8String &				operator = (const std::string &);
 		U8String &				operator = (std::string &&);
 		U8String &				operator = (const char_type *);
 
-		std::string_view		Get_StringView() const;
-		const char_type *		c_str() const;
+		std::string_view		Get_StringView() const noexcept	{ return {_data, _size}; }
+		const char_type *		c_str() const noexcept			{ return _data; }
 
 
 	private:
-		struct Det;
-		std::unique_ptr <Det>	_d;
+		template <typename> friend struct StringStorage;
+
+		static constexpr size_type k_local_capacity {
+			(2 * sizeof (void *)) / sizeof (char_type) - 1};
+
+		char_type *				_data;
+		size_type				_size;
+
+		struct Heap
+		{
+			Releaser			_release;
+
+			union
+			{
+				size_type		_capacity;
+				void *			_context;
+			};
+		};
+
+		union
+		{
+			Heap				_heap;
+			char_type			_local [k_local_capacity + 1];
+		};
 };
 
 class U16String
@@ -178,30 +232,54 @@ class U16String
 	public:
 		using char_type = typename std::u16string::value_type;
 		using size_type = typename std::u16string::size_type;
+		using Releaser = void (*) (void *, char_type *) noexcept;
 
 								U16String (const char_type * = u"");
 								U16String (const U16String &);
-								U16String (U16String &&);
+								U16String (U16String &&) noexcept;
 								U16String (const char_type *, size_type);
+								U16String (char_type *, size_type, Releaser, void *) noexcept;
 								U16String (const std::u16string &);
 								U16String (std::u16string &&);
 								U16String (std::u16string_view);
 								~U16String() noexcept;
 
 		U16String &				operator = (const U16String &);
-		U16String &				operator = (U16String &&);
+		U16String &				operator = (U16String &&) noexcept;
 		U16String &				operator = (std::u16string_view);
 		U16String &				operator = (const std::u16string &);
 		U16String &				operator = (std::u16string &&);
 		U16String &				operator = (const char_type *);
 
-		std::u16string_view		Get_StringView() const;
-		const char_type *		c_str() const;
+		std::u16string_view		Get_StringView() const noexcept	{ return {_data, _size}; }
+		const char_type *		c_str() const noexcept			{ return _data; }
 
 
 	private:
-		struct Det;
-		std::unique_ptr <Det>	_d;
+		template <typename> friend struct StringStorage;
+
+		static constexpr size_type k_local_capacity {
+			(2 * sizeof (void *)) / sizeof (char_type) - 1};
+
+		char_type *				_data;
+		size_type				_size;
+
+		struct Heap
+		{
+			Releaser			_release;
+
+			union
+			{
+				size_type		_capacity;
+				void *			_context;
+			};
+		};
+
+		union
+		{
+			Heap				_heap;
+			char_type			_local [k_local_capacity + 1];
+		};
 };
 
 class U32String
@@ -209,30 +287,54 @@ class U32String
 	public:
 		using char_type = typename std::u32string::value_type;
 		using size_type = typename std::u32string::size_type;
+		using Releaser = void (*) (void *, char_type *) noexcept;
 
 								U32String (const char_type * = U"");
 								U32String (const U32String &);
-								U32String (U32String &&);
+								U32String (U32String &&) noexcept;
 								U32String (const char_type *, size_type);
+								U32String (char_type *, size_type, Releaser, void *) noexcept;
 								U32String (const std::u32string &);
 								U32String (std::u32string &&);
 								U32String (std::u32string_view);
 								~U32String() noexcept;
 
 		U32String &				operator = (const U32String &);
-		U32String &				operator = (U32String &&);
+		U32String &				operator = (U32String &&) noexcept;
 		U32String &				operator = (std::u32string_view);
 		U32String &				operator = (const std::u32string &);
 		U32String &				operator = (std::u32string &&);
 		U32String &				operator = (const char_type *);
 
-		std::u32string_view		Get_StringView() const;
-		const char_type *		c_str() const;
+		std::u32string_view		Get_StringView() const noexcept	{ return {_data, _size}; }
+		const char_type *		c_str() const noexcept			{ return _data; }
 
 
 	private:
-		struct Det;
-		std::unique_ptr <Det>	_d;
+		template <typename> friend struct StringStorage;
+
+		static constexpr size_type k_local_capacity {
+			(2 * sizeof (void *)) / sizeof (char_type) - 1};
+
+		char_type *				_data;
+		size_type				_size;
+
+		struct Heap
+		{
+			Releaser			_release;
+
+			union
+			{
+				size_type		_capacity;
+				void *			_context;
+			};
+		};
+
+		union
+		{
+			Heap				_heap;
+			char_type			_local [k_local_capacity + 1];
+		};
 };
 
 class WString
@@ -240,32 +342,272 @@ class WString
 	public:
 		using char_type = typename std::wstring::value_type;
 		using size_type = typename std::wstring::size_type;
+		using Releaser = void (*) (void *, char_type *) noexcept;
 
 								WString (const char_type * = L"");
 								WString (const WString &);
-								WString (WString &&);
+								WString (WString &&) noexcept;
 								WString (const char_type *, size_type);
+								WString (char_type *, size_type, Releaser, void *) noexcept;
 								WString (const std::wstring &);
 								WString (std::wstring &&);
 								WString (std::wstring_view);
 								~WString() noexcept;
 
 		WString &				operator = (const WString &);
-		WString &				operator = (WString &&);
+		WString &				operator = (WString &&) noexcept;
 		WString &				operator = (std::wstring_view);
 		WString &				operator = (const std::wstring &);
 		WString &				operator = (std::wstring &&);
 		WString &				operator = (const char_type *);
 
-		std::wstring_view		Get_StringView() const;
-		const char_type *		c_str() const;
+		std::wstring_view		Get_StringView() const noexcept	{ return {_data, _size}; }
+		const char_type *		c_str() const noexcept			{ return _data; }
+
+
+	private:
+		template <typename> friend struct StringStorage;
+
+		static constexpr size_type k_local_capacity {
+			(2 * sizeof (void *)) / sizeof (char_type) - 1};
+
+		char_type *				_data;
+		size_type				_size;
+
+		struct Heap
+		{
+			Releaser			_release;
+
+			union
+			{
+				size_type		_capacity;
+				void *			_context;
+			};
+		};
+
+		union
+		{
+			Heap				_heap;
+			char_type			_local [k_local_capacity + 1];
+		};
+};
+
+
+/*------------------------------------------------------------------------------
+	Shared String Types
+
+	These are immutable counterparts to the string wrappers which share their
+	contents rather than copying them, so copying one is as cheap as bumping
+	an atomic reference count, no matter how long the string is; this makes
+	them the right choice for strings that get handed around between threads.
+	The count and the string live in a single heap allocation, which is freed
+	when the last copy goes away; the empty string needs no allocation at
+	all. Everything but the accessors is defined out-of-line, for the same
+	reasons as with the wrappers. Converting to or from a wrapper copies the
+	string.
+*/
+
+struct SharedStringHeader;
+
+class SharedU8String
+{
+	public:
+		using char_type = typename U8String::char_type;
+		using size_type = typename U8String::size_type;
+
+								SharedU8String() noexcept;
+								SharedU8String (const SharedU8String &) noexcept;
+								SharedU8String (SharedU8String &&) noexcept;
+								SharedU8String (const char_type *);
+								SharedU8String (const char_type *, size_type);
+								SharedU8String (const std::string &);
+								SharedU8String (std::string_view);
+		explicit				SharedU8String (const U8String &);
+								~SharedU8String() noexcept;
+
+		SharedU8String &		operator = (const SharedU8String &) noexcept;
+		SharedU8String &		operator = (SharedU8String &&) noexcept;
+
+		explicit				operator U8String() const;
+
+		std::string_view		Get_StringView() const noexcept	{ return {_data, _size}; }
+		const char_type *		c_str() const noexcept			{ return _data; }
+
+
+	private:
+		template <typename> friend struct SharedStringStorage;
+
+		SharedStringHeader *	_header;
+		const char_type *		_data;
+		size_type				_size;
+};
+
+class SharedU16String
+{
+	public:
+		using char_type = typename U16String::char_type;
+		using size_type = typename U16String::size_type;
+
+								SharedU16String() noexcept;
+								SharedU16String (const SharedU16String &) noexcept;
+								SharedU16String (SharedU16String &&) noexcept;
+								SharedU16String (const char_type *);
+								SharedU16String (const char_type *, size_type);
+								SharedU16String (const std::u16string &);
+								SharedU16String (std::u16string_view);
+		explicit				SharedU16String (const U16String &);
+								~SharedU16String() noexcept;
+
+		SharedU16String &		operator = (const SharedU16String &) noexcept;
+		SharedU16String &		operator = (SharedU16String &&) noexcept;
+
+		explicit				operator U16String() const;
+
+		std::u16string_view		Get_StringView() const noexcept	{ return {_data, _size}; }
+		const char_type *		c_str() const noexcept			{ return _data; }
+
+
+	private:
+		template <typename> friend struct SharedStringStorage;
+
+		SharedStringHeader *	_header;
+		const char_type *		_data;
+		size_type				_size;
+};
+
+class SharedU32String
+{
+	public:
+		using char_type = typename U32String::char_type;
+		using size_type = typename U32String::size_type;
+
+								SharedU32String() noexcept;
+								SharedU32String (const SharedU32String &) noexcept;
+								SharedU32String (SharedU32String &&) noexcept;
+								SharedU32String (const char_type *);
+								SharedU32String (const char_type *, size_type);
+								SharedU32String (const std::u32string &);
+								SharedU32String (std::u32string_view);
+		explicit				SharedU32String (const U32String &);
+								~SharedU32String() noexcept;
+
+		SharedU32String &		operator = (const SharedU32String &) noexcept;
+		SharedU32String &		operator = (SharedU32String &&) noexcept;
+
+		explicit				operator U32String() const;
+
+		std::u32string_view		Get_StringView() const noexcept	{ return {_data, _size}; }
+		const char_type *		c_str() const noexcept			{ return _data; }
+
+
+	private:
+		template <typename> friend struct SharedStringStorage;
+
+		SharedStringHeader *	_header;
+		const char_type *		_data;
+		size_type				_size;
+};
+
+
+/*------------------------------------------------------------------------------
+	Interned Strings
+
+	Intern returns a handle to the one copy of in_string kept in a global,
+	process-wide pool, adding it to the pool if it isn’t there already; this
+	is safe to call from any thread. Since equal strings always get the same
+	handle, comparing handles is just a pointer comparison, and Hash returns
+	a hash of the string that was computed once, up front. Find_Interned is
+	the same, except that it never adds anything, and returns an empty handle
+	if in_string was never interned.
+
+	Interned strings are never freed, so the string_views and C strings that
+	handles return stay valid for the life of the process; only intern
+	strings that are bound to recur, like paths, identifiers, and fixed
+	messages, and not ones built on the fly. The empty string is represented
+	by an empty handle, which is what default-constructed handles are.
+
+	The pool is split into shards chosen by hash, each with its own lock and
+	table, so threads rarely contend; lookups of strings that are already in
+	the pool only ever take a shard’s lock in shared mode.
+*/
+
+struct InternedEntry
+{
+	std::size_t				_hash;
+	std::size_t				_size;
+	const char *			_data;
+};
+
+class InternedString
+{
+	public:
+		constexpr				InternedString() noexcept
+									:	_entry {nullptr}
+								{	}
+
+		explicit constexpr		InternedString (
+									const InternedEntry *	in_entry) noexcept
+									:	_entry {in_entry}
+								{	}
+
+		std::string_view		Get_StringView() const noexcept
+								{
+									return _entry ?
+										std::string_view {_entry->_data, _entry->_size} :
+											std::string_view{};
+								}
+
+		const char *			c_str() const noexcept
+								{
+									return _entry ? _entry->_data : "";
+								}
+
+		std::size_t				Hash() const noexcept
+								{
+									return _entry ? _entry->_hash : 0;
+								}
+
+		bool					empty() const noexcept		{ return !_entry; }
+
+		friend bool				operator == (
+									InternedString			in_lhs,
+									InternedString			in_rhs) noexcept
+								{
+									return in_lhs._entry == in_rhs._entry;
+								}
+
+		friend bool				operator != (
+									InternedString			in_lhs,
+									InternedString			in_rhs) noexcept
+								{
+									return in_lhs._entry != in_rhs._entry;
+								}
 
 
 	private:
-		struct Det;
-		std::unique_ptr <Det>	_d;
+		const InternedEntry *	_entry;
 };
 
+InternedString
+Intern (
+	std::string_view		in_string);
+
+InternedString
+Intern (
+	const char *			in_string);
+
+InternedString
+Intern (
+	const std::string &		in_string);
+
+InternedString
+Intern (
+	const U8String &		in_string);
+
+InternedString
+Find_Interned (
+	std::string_view		in_string);
+
 
 /*------------------------------------------------------------------------------
 	Status
@@ -273,23 +615,57 @@ class WString
 	All special member functions are defined out-of-line since Status is an
 	incomplete type without a definition for MessageBlock.
 
+	MessageBlocks are immutable once shared, and are reference-counted, so
+	copying a Status - however long its chain - is just a matter of bumping
+	a count, and a Status can be handed to several consumers cheaply. Chain
+	appends to the end of the chain, copying only those MessageBlocks along
+	the way that are shared with another Status; Prepend puts a Status in
+	front of the chain instead, and never copies any of it. Next returns a
+	pointer to the next Status in the chain, which may be shared, and so is
+	read-only.
+
 	APIME We don’t use default arguments for the constructors since the
 	internal representation of MessageBlock may differ depending on the
 	number and type of arguments; it’s more efficient to select from different
 	signatures at compile-time than make comparisons at runtime.
+
+	A std::string rvalue, such as the result of VA_To_String or
+	Format_String, is moved into the Status rather than copied. A message
+	passed in as an InternedString is referred to rather than copied, so
+	messages that recur can be interned once and then posted over and over
+	at no cost beyond the Status itself.
+
+	Everything but the message text and the rest of the chain is stored in
+	the Status itself, so a Status with no message, an empty one, a
+	StaticMessage, or an InternedString never allocates; only messages that
+	have to be copied, and chains, are kept in a MessageBlock on the heap.
+	LUL_Make_Status_ passes a lone string literal as a StaticMessage, so most
+	of the Status objects created by the error macros are allocation-free.
 */
 
 class Status;
 
+struct StaticMessage
+{
+	//	in_message must outlive every Status made from it; this is the case
+	//	for string literals.
+	explicit constexpr		StaticMessage (
+								const char *			in_message) noexcept
+								:	_message {in_message}
+							{	}
+
+	const char *			_message;
+};
+
 using StatusUnq = std::unique_ptr <Status>;
-using StatusReq = LUL_::stdproxy::optional <Status *>;
+using StatusReq = LUL_::stdproxy::optional <const Status *>;
 
 class Status
 {
 	public:
 		//	constructors
 								Status() noexcept;
-								Status (const Status &);
+								Status (const Status &) noexcept;
 								Status (Status &&) noexcept;
 								Status (
 									StringGroup				in_domain,
@@ -305,11 +681,26 @@ class Status
 									StatusCode				in_code,
 									const std::string &		in_message);
 
+								Status (
+									StringGroup				in_domain,
+									StatusCode				in_code,
+									std::string &&			in_message);
+
 								Status (
 									StringGroup				in_domain,
 									StatusCode				in_code,
 									std::string_view		in_message);
 
+								Status (
+									StringGroup				in_domain,
+									StatusCode				in_code,
+									InternedString			in_message);
+
+								Status (
+									StringGroup				in_domain,
+									StatusCode				in_code,
+									StaticMessage			in_message) noexcept;
+
 								Status (
 									StringGroup				in_domain,
 									StatusCode				in_code,
@@ -326,6 +717,14 @@ class Status
 									const char *			in_function,
 									int						in_line);
 
+								Status (
+									StringGroup				in_domain,
+									StatusCode				in_code,
+									std::string &&			in_message,
+									const char *			in_file,
+									const char *			in_function,
+									int						in_line);
+
 								Status (
 									StringGroup				in_domain,
 									StatusCode				in_code,
@@ -334,11 +733,27 @@ class Status
 									const char *			in_function,
 									int						in_line);
 
+								Status (
+									StringGroup				in_domain,
+									StatusCode				in_code,
+									InternedString			in_message,
+									const char *			in_file,
+									const char *			in_function,
+									int						in_line);
+
+								Status (
+									StringGroup				in_domain,
+									StatusCode				in_code,
+									StaticMessage			in_message,
+									const char *			in_file,
+									const char *			in_function,
+									int						in_line) noexcept;
+
 								~Status();
 
 
 		//	assignment
-		Status &				operator = (const Status &);
+		Status &				operator = (const Status &) noexcept;
 		Status &				operator = (Status &&) noexcept;
 
 
@@ -354,8 +769,8 @@ class Status
 
 
 		//	tests
-		inline bool				Success() const noexcept	{ return !_det; }
-		inline bool				Error() const noexcept		{ return !!_det; }
+		inline bool				Success() const noexcept	{ return !_message; }
+		inline bool				Error() const noexcept		{ return !!_message; }
 		bool					Warning() const noexcept;
 		bool					Passed() const noexcept;
 		bool					Failed() const noexcept;
@@ -371,12 +786,29 @@ class Status
 
 		//	actions
 		bool					Chain (Status) noexcept;
+		bool					Prepend (Status) noexcept;
 
 
 	private:
 		struct MessageBlock;
 
-		std::unique_ptr <MessageBlock> _det { };
+		void					Copy_Message (
+									std::string				in_message);
+
+		bool					Owns_Message() const noexcept;
+
+		void					Unshare();
+
+		//	_message is null if and only if this is a success Status; otherwise,
+		//	it points at the message, which may be in _det.
+		const char *			_message {nullptr};
+		const char *			_file {nullptr};
+		const char *			_function {nullptr};
+		StringGroup				_domain {STRING_GROUP_messages};
+		StatusCode				_code {STATUS_CODE_none};
+		int						_line {0};
+
+		MessageBlock *			_det {nullptr};
 };
 
 
@@ -944,6 +1376,9 @@ struct PtrLess
 
 /*------------------------------------------------------------------------------
 	Free Functions
+
+	VA_To_String formats its arguments printf-style, and never truncates the
+	result. See lulFormat.hpp for a type-safe alternative.
 */
 
 std::string
@@ -952,6 +1387,32 @@ VA_To_String (
 	...);
 
 
+/*------------------------------------------------------------------------------
+	Make_Status_Message turns the message arguments of LUL_Make_Status_ into
+	a Status message: a lone string literal is used as-is, as a StaticMessage,
+	while a format with arguments is passed on to VA_To_String.
+*/
+
+template <std::size_t N>
+constexpr StaticMessage
+Make_Status_Message (
+	const char				(&in_message) [N]) noexcept
+{
+	return StaticMessage {in_message};
+}
+
+
+template <typename ARG, typename ...ARGS>
+std::string
+Make_Status_Message (
+	const char *			in_format,
+	const ARG &				in_arg,
+	const ARGS &			...in_args)
+{
+	return VA_To_String (in_format, in_arg, in_args...);
+}
+
+
 /*----------------------------------------------------------------------------*/
 
 LUL_end_v_namespace
@@ -997,17 +1458,20 @@ LUL_end_v_namespace
 	the user pass around raw pointers. This is attractive in a way, but the
 	danger is that we’d just end up duplicating most of the machinery of
 	shared_ptrs (retain counts or similar lifetime management to determine when
-	it’s safe to delete a Status payload) only spread around. For now, we’ll
-	just go with the current implementation and see what issues crop up in
-	practice.
+	it’s safe to delete a Status payload) only spread around. For now, the
+	payload is an immutable MessageBlock with an intrusive reference count, a
+	layout we control, which makes copies cheap without the ABI issue; we’ll
+	see what issues crop up in practice.
 */
 
 //	Helper Macros
 #define LUL_Code_Stamp_															\
 	__FILE__, __func__, __LINE__
 
+//	Note that a message with no arguments is not run through VA_To_String,
+//	so it is used verbatim (e.g., “%%” is not collapsed to “%”).
 #define LUL_Make_Status_(group_, id_, ...)										\
-	LUL_v_::Status (group_, id_, LUL_v_::VA_To_String ("" __VA_ARGS__),			\
+	LUL_v_::Status (group_, id_, LUL_v_::Make_Status_Message ("" __VA_ARGS__),	\
 		LUL_Code_Stamp_)
 
 #define LUL_First_Argument_(...) 												\
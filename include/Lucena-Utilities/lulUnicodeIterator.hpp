@@ -0,0 +1,460 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“UnicodeIterator.hpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+#pragma once
+
+
+//	std
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <type_traits>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+
+
+LUL_begin_v_namespace
+
+
+/*------------------------------------------------------------------------------
+	Code Points
+
+	Decode_Code_Point decodes the sequence starting at io_index and advances
+	io_index past it; an invalid sequence is decoded as a Unicode replacement
+	character, and is consumed exactly as it would be by the string
+	conversions, so the two always agree on where each code point starts.
+	Find_Previous_Code_Point returns the index of the start of the sequence
+	that ends at in_index, which must itself be the start of a sequence (or
+	the end of the string).
+*/
+
+char32_t
+Decode_Code_Point (
+	std::string_view		in_string,
+	std::size_t &			io_index) noexcept;
+
+char32_t
+Decode_Code_Point (
+	std::u16string_view		in_string,
+	std::size_t &			io_index) noexcept;
+
+char32_t
+Decode_Code_Point (
+	std::u32string_view		in_string,
+	std::size_t &			io_index) noexcept;
+
+std::size_t
+Find_Previous_Code_Point (
+	std::string_view		in_string,
+	std::size_t				in_index) noexcept;
+
+std::size_t
+Find_Previous_Code_Point (
+	std::u16string_view		in_string,
+	std::size_t				in_index) noexcept;
+
+std::size_t
+Find_Previous_Code_Point (
+	std::u32string_view		in_string,
+	std::size_t				in_index) noexcept;
+
+
+/*------------------------------------------------------------------------------
+	Grapheme Clusters
+
+	These find the extended grapheme cluster boundaries defined by UAX #29
+	that immediately follow or precede in_index, which must itself be a
+	boundary (or the end of the string). The Grapheme_Cluster_Break property
+	is looked up in tables generated from the Unicode Character Database.
+*/
+
+std::size_t
+Find_Next_Grapheme_Break (
+	std::string_view		in_string,
+	std::size_t				in_index) noexcept;
+
+std::size_t
+Find_Next_Grapheme_Break (
+	std::u16string_view		in_string,
+	std::size_t				in_index) noexcept;
+
+std::size_t
+Find_Next_Grapheme_Break (
+	std::u32string_view		in_string,
+	std::size_t				in_index) noexcept;
+
+std::size_t
+Find_Previous_Grapheme_Break (
+	std::string_view		in_string,
+	std::size_t				in_index) noexcept;
+
+std::size_t
+Find_Previous_Grapheme_Break (
+	std::u16string_view		in_string,
+	std::size_t				in_index) noexcept;
+
+std::size_t
+Find_Previous_Grapheme_Break (
+	std::u32string_view		in_string,
+	std::size_t				in_index) noexcept;
+
+
+/*------------------------------------------------------------------------------
+	Iterators
+
+	CodePointIterator and GraphemeIterator are bidirectional iterators over a
+	UTF-8, UTF-16, or UTF-32 string_view; the former yields each code point
+	in turn, and the latter yields each grapheme cluster as a string_view
+	into the original string. Neither ever allocates, and Index returns the
+	position of the current element in the original string, in code units.
+
+	Both yield their elements by value, so std::reverse_iterator can safely
+	be layered on top of them; TextRange does exactly that for rbegin and
+	rend, which means that the ranges returned by Code_Points and Graphemes
+	can be handed to reverse (see lulIterator.hpp) directly:
+
+		for (auto code_point : reverse (Code_Points (text))) ...
+
+	As with any string_view, the underlying string must outlive the
+	iterators. Iterators are only comparable if they refer to the same
+	string.
+*/
+
+template <typename CHAR_T>
+class CodePointIterator
+{
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = char32_t;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = char32_t;
+		using string_view_type = std::basic_string_view <CHAR_T>;
+
+		constexpr CodePointIterator() noexcept
+			:	_string {},
+				_index {0},
+				_next {0},
+				_code {0}
+		{ }
+
+		CodePointIterator (string_view_type in_string, std::size_t in_index) noexcept
+			:	_string {in_string},
+				_index {in_index},
+				_next {in_index},
+				_code {0}
+		{
+			Decode();
+		}
+
+		reference operator*() const noexcept
+		{
+			return _code;
+		}
+
+		CodePointIterator & operator++() noexcept
+		{
+			_index = _next;
+			Decode();
+
+			return *this;
+		}
+
+		CodePointIterator operator++ (int) noexcept
+		{
+			auto nrv = *this;
+
+			++*this;
+
+			return nrv;
+		}
+
+		CodePointIterator & operator--() noexcept
+		{
+			_index = Find_Previous_Code_Point (_string, _index);
+			Decode();
+
+			return *this;
+		}
+
+		CodePointIterator operator-- (int) noexcept
+		{
+			auto nrv = *this;
+
+			--*this;
+
+			return nrv;
+		}
+
+		std::size_t Index() const noexcept
+		{
+			return _index;
+		}
+
+		string_view_type Code_Units() const noexcept
+		{
+			return _string.substr (_index, _next - _index);
+		}
+
+		friend bool operator== (
+			const CodePointIterator &	in_lhs,
+			const CodePointIterator &	in_rhs) noexcept
+		{
+			return in_lhs._index == in_rhs._index;
+		}
+
+		friend bool operator!= (
+			const CodePointIterator &	in_lhs,
+			const CodePointIterator &	in_rhs) noexcept
+		{
+			return in_lhs._index != in_rhs._index;
+		}
+
+
+	private:
+		//	ASCII is decoded inline, since it’s by far the most common case.
+		void Decode() noexcept
+		{
+			using unit_type = std::make_unsigned_t <CHAR_T>;
+
+			if (_index >= _string.size())
+			{
+				_next = _string.size();
+			}
+			else if (static_cast <unit_type> (_string [_index]) < 0x80u)
+			{
+				_code = static_cast <unit_type> (_string [_index]);
+				_next = _index + 1;
+			}
+			else
+			{
+				_next = _index;
+				_code = Decode_Code_Point (_string, _next);
+			}
+		}
+
+		string_view_type		_string;
+		std::size_t				_index;
+		std::size_t				_next;
+		char32_t				_code;
+};
+
+
+template <typename CHAR_T>
+class GraphemeIterator
+{
+	public:
+		using iterator_category = std::bidirectional_iterator_tag;
+		using value_type = std::basic_string_view <CHAR_T>;
+		using difference_type = std::ptrdiff_t;
+		using pointer = void;
+		using reference = std::basic_string_view <CHAR_T>;
+		using string_view_type = std::basic_string_view <CHAR_T>;
+
+		constexpr GraphemeIterator() noexcept
+			:	_string {},
+				_index {0},
+				_next {0}
+		{ }
+
+		GraphemeIterator (string_view_type in_string, std::size_t in_index) noexcept
+			:	_string {in_string},
+				_index {in_index},
+				_next {Find_Next_Grapheme_Break (in_string, in_index)}
+		{ }
+
+		reference operator*() const noexcept
+		{
+			return _string.substr (_index, _next - _index);
+		}
+
+		GraphemeIterator & operator++() noexcept
+		{
+			_index = _next;
+			_next = Find_Next_Grapheme_Break (_string, _index);
+
+			return *this;
+		}
+
+		GraphemeIterator operator++ (int) noexcept
+		{
+			auto nrv = *this;
+
+			++*this;
+
+			return nrv;
+		}
+
+		GraphemeIterator & operator--() noexcept
+		{
+			_next = _index;
+			_index = Find_Previous_Grapheme_Break (_string, _index);
+
+			return *this;
+		}
+
+		GraphemeIterator operator-- (int) noexcept
+		{
+			auto nrv = *this;
+
+			--*this;
+
+			return nrv;
+		}
+
+		std::size_t Index() const noexcept
+		{
+			return _index;
+		}
+
+		friend bool operator== (
+			const GraphemeIterator &	in_lhs,
+			const GraphemeIterator &	in_rhs) noexcept
+		{
+			return in_lhs._index == in_rhs._index;
+		}
+
+		friend bool operator!= (
+			const GraphemeIterator &	in_lhs,
+			const GraphemeIterator &	in_rhs) noexcept
+		{
+			return in_lhs._index != in_rhs._index;
+		}
+
+
+	private:
+		string_view_type		_string;
+		std::size_t				_index;
+		std::size_t				_next;
+};
+
+
+/*------------------------------------------------------------------------------
+	Ranges
+*/
+
+template <typename ITERATOR>
+class TextRange
+{
+	public:
+		using iterator = ITERATOR;
+		using const_iterator = ITERATOR;
+		using reverse_iterator = std::reverse_iterator <ITERATOR>;
+		using const_reverse_iterator = std::reverse_iterator <ITERATOR>;
+		using string_view_type = typename ITERATOR::string_view_type;
+
+		constexpr explicit TextRange (string_view_type in_string) noexcept
+			:	_string {in_string}
+		{ }
+
+		iterator begin() const noexcept
+		{
+			return iterator {_string, 0};
+		}
+
+		iterator end() const noexcept
+		{
+			return iterator {_string, _string.size()};
+		}
+
+		reverse_iterator rbegin() const noexcept
+		{
+			return reverse_iterator {end()};
+		}
+
+		reverse_iterator rend() const noexcept
+		{
+			return reverse_iterator {begin()};
+		}
+
+		constexpr bool empty() const noexcept
+		{
+			return _string.empty();
+		}
+
+		constexpr string_view_type String() const noexcept
+		{
+			return _string;
+		}
+
+
+	private:
+		string_view_type		_string;
+};
+
+
+template <typename CHAR_T>
+using CodePointRange = TextRange <CodePointIterator <CHAR_T>>;
+
+template <typename CHAR_T>
+using GraphemeRange = TextRange <GraphemeIterator <CHAR_T>>;
+
+
+/*------------------------------------------------------------------------------
+	These are overloaded rather than templated so that anything that
+	converts to one of the string_view types can be passed in directly.
+*/
+
+inline CodePointRange <char>
+Code_Points (
+	std::string_view		in_string) noexcept
+{
+	return CodePointRange <char> {in_string};
+}
+
+
+inline CodePointRange <char16_t>
+Code_Points (
+	std::u16string_view		in_string) noexcept
+{
+	return CodePointRange <char16_t> {in_string};
+}
+
+
+inline CodePointRange <char32_t>
+Code_Points (
+	std::u32string_view		in_string) noexcept
+{
+	return CodePointRange <char32_t> {in_string};
+}
+
+
+inline GraphemeRange <char>
+Graphemes (
+	std::string_view		in_string) noexcept
+{
+	return GraphemeRange <char> {in_string};
+}
+
+
+inline GraphemeRange <char16_t>
+Graphemes (
+	std::u16string_view		in_string) noexcept
+{
+	return GraphemeRange <char16_t> {in_string};
+}
+
+
+inline GraphemeRange <char32_t>
+Graphemes (
+	std::u32string_view		in_string) noexcept
+{
+	return GraphemeRange <char32_t> {in_string};
+}
+
+
+/*----------------------------------------------------------------------------*/
+
+LUL_end_v_namespace
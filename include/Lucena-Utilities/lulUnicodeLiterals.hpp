@@ -0,0 +1,573 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“UnicodeLiterals.hpp”
+	Copyright © 2010-2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+#pragma once
+
+
+//	std
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+
+
+LUL_begin_v_namespace
+
+namespace uc {
+
+
+/*------------------------------------------------------------------------------
+	Constants
+*/
+
+const char32_t			CODE_POINT_replacement				(0x0000FFFDu);
+
+
+/*------------------------------------------------------------------------------
+	Code Point Classification
+
+	These are all constexpr, so that the encoders and decoders below can be
+	used at compile time; they are shared with the run-time conversions in
+	lulUtilities.hpp, so the two always agree.
+*/
+
+/*------------------------------------------------------------------------------
+	Return true if the code point lies in the Basic Multilingual Plane (BMP)
+	[U+0, U+FFFF].
+*/
+
+constexpr bool Is_In_BMP (
+	char32_t				cp)
+{
+	return (cp < 0x00010000u);
+}
+
+
+/*------------------------------------------------------------------------------
+	Unicode noncharacters are code points within the Unicode range that are
+	never used in character encoding. These values may have special meanings in
+	other contexts (e.g., 0xfffe is used as the Byte Order Marker (BOM)).
+
+	Code points that are noncharacters include:
+		- the last two code points on each plane (U+__FFFE, U+__FFFF)
+		- [U+FDD0, U+FDEF]
+*/
+
+constexpr bool Is_Nonchar (
+	char32_t				cp)
+{
+	return (
+		(cp >= 0xFDD0u) &&
+		((cp <= 0xFDEFu) || ((cp & 0xFFFEu) == 0xFFFEu)) &&
+		(cp <= 0x10FFFFu));
+}
+
+
+/*------------------------------------------------------------------------------
+	Code points that are not valid characters include:
+		- single surrogate code points [U+D800, U+DFFF]
+		- the last two code points on each plane (U+__FFFE, U+__FFFF)
+		- [U+FDD0, U+FDEF]
+		- values outside the Unicode range [U+0000, U+10FFFF]
+*/
+
+constexpr bool Is_Char (
+	char32_t				cp)
+{
+	return (
+		(cp < 0xD800u) ||
+		((cp > 0xDFFFu) &&
+		(cp <= 0x10FFFFu) &&
+		!Is_Nonchar (cp)));
+}
+
+
+/*------------------------------------------------------------------------------
+	Unicode surrogates are in the range [U+D800, U+DFFF].
+*/
+
+template <typename CHAR_T>
+constexpr bool Is_Surrogate (
+	CHAR_T					cp)
+{
+	return ((static_cast <uint32_t> (cp) & 0xFFFFF800u) == 0x0000D800u);
+}
+
+
+/*------------------------------------------------------------------------------
+	Unicode lead surrogates are in the range [U+D800, U+DBFF].
+*/
+
+template <typename CHAR_T>
+constexpr bool Is_Lead_Surrogate (
+	CHAR_T					cp)
+{
+	return ((static_cast <uint32_t> (cp) & 0xFFFFFC00u) == 0x0000D800u);
+}
+
+
+/*------------------------------------------------------------------------------
+	Unicode trail surrogates are in the range [U+DC00, U+DFFF].
+*/
+
+template <typename CHAR_T>
+constexpr bool Is_Trail_Surrogate (
+	CHAR_T					cp)
+{
+	return ((static_cast <uint32_t> (cp) & 0xFFFFFC00u) == 0x0000DC00u);
+}
+
+
+/*------------------------------------------------------------------------------
+	ASCII bytes are in the range [0x00, 0x7F].
+*/
+
+constexpr bool UTF8_Is_ASCII (
+	uint8_t					b)
+{
+	return ((b & 0x80) == 0x00);
+}
+
+
+/*------------------------------------------------------------------------------
+	UTF-8 lead bytes are in the range [0xC0, 0xFD].
+*/
+
+constexpr bool UTF8_Is_Lead_Byte (
+	uint8_t					b)
+{
+	return ((b ^ 0x3E) > 0xC1);
+}
+
+
+/*------------------------------------------------------------------------------
+	UTF-8 trail bytes are in the range [0x80, 0xBF].
+*/
+
+constexpr bool UTF8_Is_Trail_Byte (
+	uint8_t					b)
+{
+	return (b & 0xC0) == 0x80;
+}
+
+
+/*------------------------------------------------------------------------------
+	Return the number of trail bytes that follow a lead byte, or 0 if it
+	can’t start a sequence in Unicode; this is the same as looking up
+	UTF8_count_trail_bytes, but can be done at compile time.
+*/
+
+constexpr std::size_t UTF8_Trail_Count (
+	uint8_t					b)
+{
+	return (b < 0xC0) ? 0 : (b < 0xE0) ? 1 : (b < 0xF0) ? 2 : (b < 0xF5) ? 3 : 0;
+}
+
+
+/*------------------------------------------------------------------------------
+	Return the smallest code point that needs tc trail bytes, i.e., the
+	smallest one that a sequence of that length may legally encode; this is
+	the same as UTF8_code_point_range [tc][0].
+*/
+
+constexpr char32_t UTF8_Minimum_Code_Point (
+	std::size_t				tc)
+{
+	return (0 == tc) ? 0x00000000u : (1 == tc) ? 0x00000080u :
+		(2 == tc) ? 0x00000800u : 0x00010000u;
+}
+
+
+/*------------------------------------------------------------------------------
+	Mask off the part of a lead byte that doesn’t actually contain encoded
+	information. tc is the number of trail bytes.
+*/
+
+constexpr char32_t UTF8_Decode_Lead_Byte (
+	uint8_t					b,
+	std::size_t				tc)
+{
+	return (b & ((1 << (6 - tc)) - 1));
+}
+
+
+/*------------------------------------------------------------------------------
+	Mask off the part of a trail byte that doesn’t actually contain encoded
+	information; since all trail bytes have the form (b10xxxxxx), we mask out
+	the top two bits to get the real data. Slide the data already in cp over by
+	6 bits, and insert the new 6 bits of data from the trail byte.
+*/
+
+constexpr char32_t UTF8_Decode_Trail_Byte (
+	uint8_t					b,
+	char32_t				cp)
+{
+	return (cp << 6) | (b & 0x3f);
+}
+
+
+/*------------------------------------------------------------------------------
+	Decoding
+
+	Decode one sequence at a time from in_string, starting at io_index, and
+	return the decoded code point in out_code. io_index is left pointing just
+	past the sequence. If the sequence is invalid, false is returned, and the
+	value of out_code is undefined; in the case of UTF-8, io_index is then
+	advanced past any trail bytes that follow, so that a bad sequence is
+	consolidated into a single bogus code point. Code points are validated as
+	Unicode characters, so surrogates and noncharacters are rejected.
+*/
+
+constexpr bool UTF_Decode (
+	std::string_view		in_string,
+	std::size_t &			io_index,
+	char32_t &				out_code)
+{
+	if (io_index >= in_string.size())
+	{
+		//	parameter error
+		return false;
+	}
+
+	auto cur = static_cast <uint8_t> (in_string [io_index++]);
+
+	//	Check if we’re within ASCII range; if so, we’re done.
+	if (UTF8_Is_ASCII (cur))
+	{
+		//	[U+0000, U+007F]	0xxxxxxx	always valid
+		out_code = cur;
+		return true;
+	}
+
+	//	Make sure we have a lead byte, since this is a multibyte sequence, and
+	//	enough string left to accommodate all our supposed trail bytes.
+	auto trail_count = UTF8_Trail_Count (cur);
+
+	if (trail_count and ((io_index + trail_count) <= in_string.size()))
+	{
+		//	Mask off the part of the lead byte that doesn’t actually contain
+		//	encoded information.
+		auto code = UTF8_Decode_Lead_Byte (cur, trail_count);
+		auto valid = true;
+
+		for (std::size_t i = 0; valid and (i < trail_count); ++i)
+		{
+			auto trail_byte = static_cast <uint8_t> (in_string [io_index]);
+
+			//	If it’s not a trail byte, it’s the start of the next sequence
+			//	popping up early and unexpectedly. Only increment once we’ve
+			//	consumed a valid byte.
+			valid = UTF8_Is_Trail_Byte (trail_byte);
+
+			if (valid)
+			{
+				code = UTF8_Decode_Trail_Byte (trail_byte, code);
+				++io_index;
+			}
+		}
+
+		//	UTF-8 requires that a given code point be represented by the
+		//	simplest possible sequence.
+		if (valid and (code >= UTF8_Minimum_Code_Point (trail_count)))
+		{
+			out_code = code;
+			return Is_Char (code);
+		}
+
+		if (!valid) return false;
+	}
+
+
+	//	We get here whenever we encounter an illegal sequence and want to
+	//	spill bytes until we get to something that looks valid before
+	//	exiting.
+	while ((io_index < in_string.size()) and
+		UTF8_Is_Trail_Byte (static_cast <uint8_t> (in_string [io_index])))
+	{
+		++io_index;
+	}
+
+	return false;
+}
+
+
+/*------------------------------------------------------------------------------
+	Note that wchar_t arrays will be automatically handled here if wchar_t is
+	16 bits.
+*/
+
+constexpr bool UTF_Decode (
+	std::u16string_view		in_string,
+	std::size_t &			io_index,
+	char32_t &				out_code)
+{
+	if (io_index >= in_string.size())
+	{
+		//	parameter error
+		return false;
+	}
+
+	auto char1 = in_string [io_index++];
+
+	if (!Is_Surrogate (char1))
+	{
+		//	Not a surrogate, just one 16-bit word. Note that we still need to
+		//	verify that this is a valid Unicode code point.
+		out_code = char1;
+		return Is_Char (out_code);
+	}
+
+	if (!Is_Lead_Surrogate (char1) or (io_index >= in_string.size()) or
+		!Is_Trail_Surrogate (in_string [io_index]))
+	{
+		//	Orphaned surrogate, or invalid surrogate pair
+		return false;
+	}
+
+	//	Valid surrogate pair. Each surrogate contributes 10 bits to the final
+	//	value, which will be in Unicode supplementary space [U+10000,
+	//	U+10FFFF]. 0x035FDC00u is derived from (0x0000D800u << 10) +
+	//	0x0000DC00u - 0x00010000u.
+	out_code = (static_cast <char32_t> (char1) << 10) +
+		(static_cast <char32_t> (in_string [io_index++]) - 0x035FDC00u);
+
+	return Is_Char (out_code);
+}
+
+
+/*------------------------------------------------------------------------------
+	Note that wchar_t arrays will be automatically handled here if wchar_t is
+	32 bits.
+*/
+
+constexpr bool UTF_Decode (
+	std::u32string_view		in_string,
+	std::size_t &			io_index,
+	char32_t &				out_code)
+{
+	//	A char is always consumed, so io_index is always incremented.
+	return (io_index < in_string.size()) ?
+		Is_Char (out_code = in_string [io_index++]) : false;
+}
+
+
+/*------------------------------------------------------------------------------
+	Encoding
+
+	Encode in_code, which must be a valid Unicode character, into out_buffer,
+	and return the number of code units written; out_buffer must have room
+	for 4 chars, 2 char16_ts, or 1 char32_t, as appropriate. UTF_Length
+	returns the same count without writing anything.
+*/
+
+constexpr std::size_t UTF_Encode (
+	char32_t				in_code,
+	char *					out_buffer)
+{
+	if (in_code < UTF8_Minimum_Code_Point (1))
+	{
+		//	1-byte sequence in [U+0000, U+007F]
+		out_buffer [0] = static_cast <char> (in_code);
+		return 1;
+	}
+
+	if (in_code < UTF8_Minimum_Code_Point (2))
+	{
+		//	2-byte sequence in [U+0080, U+07FF]; the lead byte has a 3-bit
+		//	marker and 5 data bits, and each trail byte has a 2-bit marker and
+		//	6 data bits.
+		out_buffer [0] = static_cast <char> ((in_code >> 6) | 0xC0);
+		out_buffer [1] = static_cast <char> ((in_code & 0x3F) | 0x80);
+		return 2;
+	}
+
+	if (in_code < UTF8_Minimum_Code_Point (3))
+	{
+		//	3-byte sequence in [U+0800, U+FFFF]; the lead byte has a 4-bit
+		//	marker and 4 data bits.
+		out_buffer [0] = static_cast <char> ((in_code >> 12) | 0xE0);
+		out_buffer [1] = static_cast <char> (((in_code >> 6) & 0x3F) | 0x80);
+		out_buffer [2] = static_cast <char> ((in_code & 0x3F) | 0x80);
+		return 3;
+	}
+
+	//	4-byte sequence in [U+10000, U+10FFFF]; the lead byte has a 5-bit
+	//	marker and 3 data bits.
+	out_buffer [0] = static_cast <char> ((in_code >> 18) | 0xF0);
+	out_buffer [1] = static_cast <char> (((in_code >> 12) & 0x3F) | 0x80);
+	out_buffer [2] = static_cast <char> (((in_code >> 6) & 0x3F) | 0x80);
+	out_buffer [3] = static_cast <char> ((in_code & 0x3F) | 0x80);
+	return 4;
+}
+
+
+constexpr std::size_t UTF_Encode (
+	char32_t				in_code,
+	char16_t *				out_buffer)
+{
+	if (Is_In_BMP (in_code))
+	{
+		//	The code point is in the BMP and can be encoded as 1 character.
+		out_buffer [0] = static_cast <char16_t> (in_code);
+		return 1;
+	}
+
+	//	Non-BMP characters are encoded as a surrogate pair, each with a 6-bit
+	//	marker and 10 data bits.
+	out_buffer [0] = static_cast <char16_t> ((in_code >> 10) + 0xD7C0u);
+	out_buffer [1] = static_cast <char16_t> ((in_code & 0x3FFu) | 0xDC00u);
+	return 2;
+}
+
+
+constexpr std::size_t UTF_Encode (
+	char32_t				in_code,
+	char32_t *				out_buffer)
+{
+	out_buffer [0] = in_code;
+	return 1;
+}
+
+
+constexpr std::size_t UTF_Encode (
+	char32_t				in_code,
+	wchar_t *				out_buffer)
+{
+	#if LUL_TYPE_WCHAR_T_IS_16_BITS
+		if (!Is_In_BMP (in_code))
+		{
+			out_buffer [0] = static_cast <wchar_t> ((in_code >> 10) + 0xD7C0u);
+			out_buffer [1] = static_cast <wchar_t> ((in_code & 0x3FFu) | 0xDC00u);
+			return 2;
+		}
+	#endif
+
+	out_buffer [0] = static_cast <wchar_t> (in_code);
+	return 1;
+}
+
+
+template <typename CHAR_T>
+constexpr std::size_t UTF_Length (
+	char32_t				in_code)
+{
+	if constexpr (sizeof (CHAR_T) == 1)
+	{
+		return (in_code < UTF8_Minimum_Code_Point (1)) ? 1 :
+			(in_code < UTF8_Minimum_Code_Point (2)) ? 2 :
+			(in_code < UTF8_Minimum_Code_Point (3)) ? 3 : 4;
+	}
+	else if constexpr (sizeof (CHAR_T) == 2)
+	{
+		return Is_In_BMP (in_code) ? 1 : 2;
+	}
+	else
+	{
+		return 1;
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Literals
+
+	Transcode_Literal converts a UTF-8 string literal (e.g., one of the
+	LUL_PACKAGING_xxx strings) to UTF-16, UTF-32, or wide characters at
+	compile time, returning a std::array of the converted code units followed
+	by a null terminator; invalid sequences are replaced, exactly as with
+	UTF8_to_UTF16 and its siblings. Transcoded_Size computes the number of
+	code units beforehand, which is needed to size the array. Since both have
+	to see the literal, the macros below are the easiest way to use them:
+
+		constexpr auto k_product_name = LUL_UTF16_Literal_ (LUL_PACKAGING_product_name);
+
+		std::u16string_view name {k_product_name.data(), k_product_name.size() - 1};
+
+	The whole conversion is folded into the constant, so nothing is left to
+	do at run time.
+
+	APIME A string literal operator template would be the natural interface
+	here, but those are only available as an extension prior to C++20.
+*/
+
+template <typename CHAR_T, std::size_t N>
+constexpr std::size_t Transcoded_Size (
+	const char				(&in_string) [N])
+{
+	auto view = std::string_view {in_string, N - 1};
+	std::size_t index = 0;
+	std::size_t nrv = 0;
+
+	while (index < view.size())
+	{
+		char32_t code_point = 0;
+
+		if (!UTF_Decode (view, index, code_point)) code_point = CODE_POINT_replacement;
+
+		nrv += UTF_Length <CHAR_T> (code_point);
+	}
+
+
+	return nrv;
+}
+
+
+template <typename CHAR_T, std::size_t M, std::size_t N>
+constexpr std::array <CHAR_T, M + 1> Transcode_Literal (
+	const char				(&in_string) [N])
+{
+	auto nrv = std::array <CHAR_T, M + 1>{};
+	auto view = std::string_view {in_string, N - 1};
+	std::size_t index = 0;
+	std::size_t out_index = 0;
+
+	while (index < view.size())
+	{
+		char32_t code_point = 0;
+
+		if (!UTF_Decode (view, index, code_point)) code_point = CODE_POINT_replacement;
+
+		out_index += UTF_Encode (code_point, &nrv [out_index]);
+	}
+
+
+	return nrv;
+}
+
+}	//	namespace uc
+
+
+/*----------------------------------------------------------------------------*/
+
+LUL_end_v_namespace
+
+
+/*------------------------------------------------------------------------------
+	Macros
+*/
+
+#define LUL_UTF16_Literal_(_pLiteral_)											\
+	(LUL_v_::uc::Transcode_Literal <char16_t,									\
+		LUL_v_::uc::Transcoded_Size <char16_t> (_pLiteral_)> (_pLiteral_))
+
+#define LUL_UTF32_Literal_(_pLiteral_)											\
+	(LUL_v_::uc::Transcode_Literal <char32_t,									\
+		LUL_v_::uc::Transcoded_Size <char32_t> (_pLiteral_)> (_pLiteral_))
+
+#define LUL_Wide_Literal_(_pLiteral_)											\
+	(LUL_v_::uc::Transcode_Literal <wchar_t,									\
+		LUL_v_::uc::Transcoded_Size <wchar_t> (_pLiteral_)> (_pLiteral_))
@@ -18,11 +18,15 @@
 
 
 //	std
+#include <cstddef>
+#include <string>
 #include <string_view>
+#include <type_traits>
 
 
 //	lul
 #include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulSpanWrapper.hpp>
 #include <Lucena-Utilities/lulTypes.hpp>
 
 
@@ -63,6 +67,168 @@ bool
 Verify_String (
 	std::u32string_view		in_string);
 
+bool
+Is_ASCII (
+	std::string_view		in_string);
+
+bool
+Is_ASCII (
+	std::u16string_view		in_string);
+
+bool
+Is_ASCII (
+	std::u32string_view		in_string);
+
+
+/*------------------------------------------------------------------------------
+	Normalization
+
+	Normalize puts in_string into the given Unicode normalization form, as
+	defined by UAX #15. If in_string is already normalized, which is almost
+	always the case in practice, it is returned as-is and nothing is copied;
+	otherwise, the normalized string is written to out_buffer, and a view of
+	out_buffer is returned. Either way, the result is only valid for as long
+	as both in_string and out_buffer are, and in_string must not refer to
+	out_buffer itself. Invalid sequences are replaced with the Unicode
+	replacement character, as with the string conversions.
+
+	Is_Normalized returns true if in_string is already in the given
+	normalization form. Both functions start with the quick check algorithm,
+	which decides most strings in a single pass without allocating; the
+	rare string that it can’t decide is normalized to find out.
+*/
+
+enum class NormalizationForm
+{
+	NFC,
+	NFD,
+	NFKC,
+	NFKD
+};
+
+bool
+Is_Normalized (
+	std::string_view		in_string,
+	NormalizationForm		in_form);
+
+bool
+Is_Normalized (
+	std::u16string_view		in_string,
+	NormalizationForm		in_form);
+
+bool
+Is_Normalized (
+	std::u32string_view		in_string,
+	NormalizationForm		in_form);
+
+std::string_view
+Normalize (
+	std::string_view		in_string,
+	NormalizationForm		in_form,
+	std::string &			out_buffer);
+
+std::u16string_view
+Normalize (
+	std::u16string_view		in_string,
+	NormalizationForm		in_form,
+	std::u16string &		out_buffer);
+
+std::u32string_view
+Normalize (
+	std::u32string_view		in_string,
+	NormalizationForm		in_form,
+	std::u32string &		out_buffer);
+
+
+/*------------------------------------------------------------------------------
+	Case Folding
+
+	Case_Fold returns in_string with the full case folding from the Unicode
+	Character Database applied, so that, e.g., “Straße” and “STRASSE” both
+	fold to “strasse”. This is the standard way to make strings compare
+	equal regardless of case; note that it is locale-independent, and that
+	it doesn’t normalize anything along the way. Invalid sequences are
+	replaced with the Unicode replacement character, as with the string
+	conversions.
+
+	Compare_Folded and Hash_Folded give the same results as comparing or
+	hashing the folded strings would, but fold on the fly and never build a
+	folded copy of either string. Compare_Folded returns a value less than,
+	equal to, or greater than zero as in_lhs sorts before, the same as, or
+	after in_rhs, comparing code point by code point. Hash_Folded hashes
+	the UTF-8 encoding of the folded string, so a string hashes the same no
+	matter which encoding it comes in; it is meant for hash tables keyed on
+	case-insensitive strings, and not for anything that must be stable from
+	one release to the next.
+*/
+
+std::string
+Case_Fold (
+	std::string_view		in_string);
+
+std::u16string
+Case_Fold (
+	std::u16string_view		in_string);
+
+std::u32string
+Case_Fold (
+	std::u32string_view		in_string);
+
+int
+Compare_Folded (
+	std::string_view		in_lhs,
+	std::string_view		in_rhs) noexcept;
+
+int
+Compare_Folded (
+	std::u16string_view		in_lhs,
+	std::u16string_view		in_rhs) noexcept;
+
+int
+Compare_Folded (
+	std::u32string_view		in_lhs,
+	std::u32string_view		in_rhs) noexcept;
+
+std::size_t
+Hash_Folded (
+	std::string_view		in_string) noexcept;
+
+std::size_t
+Hash_Folded (
+	std::u16string_view		in_string) noexcept;
+
+std::size_t
+Hash_Folded (
+	std::u32string_view		in_string) noexcept;
+
+
+/*------------------------------------------------------------------------------
+	Parallel Processing
+
+	Verify_String and the conversions from UTF-8 to UTF-16, UTF-32, and wide
+	strings split very large inputs into pieces at code point boundaries and
+	process the pieces concurrently; the results are identical to those of
+	processing the whole string on one thread. Inputs shorter than the
+	threshold (in bytes) are always processed on the calling thread, and no
+	more than the thread limit will ever be used; a limit of 0 means to use as
+	many threads as the hardware supports. The defaults are set by
+	LUL_CONFIG_parallel_threshold and LUL_CONFIG_parallel_thread_limit.
+*/
+
+std::size_t
+Get_Parallel_Threshold();
+
+void
+Set_Parallel_Threshold (
+	std::size_t				in_threshold);
+
+std::size_t
+Get_Parallel_Thread_Limit();
+
+void
+Set_Parallel_Thread_Limit (
+	std::size_t				in_thread_limit);
+
 
 /*------------------------------------------------------------------------------
 	String Conversions
@@ -167,6 +333,337 @@ Wide_to_UTF32 (
 	bool *					out_clean = nullptr);
 
 
+/*------------------------------------------------------------------------------
+	Buffer Conversions
+
+	Each string conversion above has an overload that writes into a
+	caller-supplied buffer instead of allocating a new string, so that hot
+	paths can transcode into stack or arena memory. Invalid sequences are
+	replaced just as they are above. If the buffer fills up, conversion stops
+	on a code point boundary, and the caller can pick up where it left off
+	with the rest of the input. The Transcoded Lengths functions below can be
+	used to size a buffer that is guaranteed to be big enough.
+
+	consumed is the number of input code units that were converted, and
+	produced is the number of output code units that were written.
+	error_index is the index in the input of the first invalid sequence, or
+	npos if there wasn’t one, in which case the conversion was clean.
+*/
+
+struct TranscodeResult
+{
+	static constexpr std::size_t npos {static_cast <std::size_t> (-1)};
+
+	std::size_t				consumed;
+	std::size_t				produced;
+	std::size_t				error_index;
+};
+
+TranscodeResult
+UTF8_to_Wide (
+	std::string_view		in_string,
+	stdproxy::span <wchar_t>	out_buffer);
+
+TranscodeResult
+UTF8_to_UTF16 (
+	std::string_view		in_string,
+	stdproxy::span <char16_t>	out_buffer);
+
+TranscodeResult
+UTF8_to_UTF32 (
+	std::string_view		in_string,
+	stdproxy::span <char32_t>	out_buffer);
+
+TranscodeResult
+UTF16_to_Wide (
+	std::u16string_view		in_string,
+	stdproxy::span <wchar_t>	out_buffer);
+
+TranscodeResult
+UTF16_to_UTF8 (
+	std::u16string_view		in_string,
+	stdproxy::span <char>	out_buffer);
+
+TranscodeResult
+UTF16_to_UTF32 (
+	std::u16string_view		in_string,
+	stdproxy::span <char32_t>	out_buffer);
+
+TranscodeResult
+UTF32_to_Wide (
+	std::u32string_view		in_string,
+	stdproxy::span <wchar_t>	out_buffer);
+
+TranscodeResult
+UTF32_to_UTF8 (
+	std::u32string_view		in_string,
+	stdproxy::span <char>	out_buffer);
+
+TranscodeResult
+UTF32_to_UTF16 (
+	std::u32string_view		in_string,
+	stdproxy::span <char16_t>	out_buffer);
+
+TranscodeResult
+Wide_to_UTF8 (
+	std::wstring_view		in_string,
+	stdproxy::span <char>	out_buffer);
+
+TranscodeResult
+Wide_to_UTF16 (
+	std::wstring_view		in_string,
+	stdproxy::span <char16_t>	out_buffer);
+
+TranscodeResult
+Wide_to_UTF32 (
+	std::wstring_view		in_string,
+	stdproxy::span <char32_t>	out_buffer);
+
+
+/*------------------------------------------------------------------------------
+	Transcoded Lengths
+
+	Each of these returns the exact length, in code units of the destination
+	encoding, of the string that the corresponding conversion function above
+	would return for in_string. Invalid sequences are counted as the
+	replacement characters that stand in for them. These are cheap relative
+	to the conversions themselves, and are meant for sizing buffers up front.
+*/
+
+std::size_t
+UTF8_Length_As_Wide (
+	std::string_view		in_string);
+
+std::size_t
+UTF8_Length_As_UTF16 (
+	std::string_view		in_string);
+
+std::size_t
+UTF8_Length_As_UTF32 (
+	std::string_view		in_string);
+
+std::size_t
+UTF16_Length_As_Wide (
+	std::u16string_view		in_string);
+
+std::size_t
+UTF16_Length_As_UTF8 (
+	std::u16string_view		in_string);
+
+std::size_t
+UTF16_Length_As_UTF32 (
+	std::u16string_view		in_string);
+
+std::size_t
+UTF32_Length_As_Wide (
+	std::u32string_view		in_string);
+
+std::size_t
+UTF32_Length_As_UTF8 (
+	std::u32string_view		in_string);
+
+std::size_t
+UTF32_Length_As_UTF16 (
+	std::u32string_view		in_string);
+
+std::size_t
+Wide_Length_As_UTF8 (
+	std::wstring_view		in_string);
+
+std::size_t
+Wide_Length_As_UTF16 (
+	std::wstring_view		in_string);
+
+std::size_t
+Wide_Length_As_UTF32 (
+	std::wstring_view		in_string);
+
+
+/*------------------------------------------------------------------------------
+	Stream Decoders
+
+	The string conversions above expect the whole string up front, so a
+	sequence that is split across the boundary between two chunks of input
+	(e.g., two reads from a socket or file) would be reported as invalid. The
+	stream decoders instead carry any partial sequence over from one call to
+	Feed to the next, so input can be decoded piecemeal, as it arrives, in
+	constant memory. The results are identical to those of decoding the
+	concatenated chunks all at once: each invalid sequence is replaced by a
+	single U+FFFD, even if it straddles a chunk boundary.
+
+	Decoded code points are passed to in_sink in batches, as a
+	std::u32string_view that is only valid for the duration of the call; in_sink
+	can be anything that is callable as void (std::u32string_view). Feed and
+	Finish return false if any replacement characters were emitted during the
+	call, and true otherwise.
+
+	Call Finish at the end of the input to flush out a dangling partial
+	sequence, which will be replaced by U+FFFD. Finish also resets the decoder
+	so that it can be re-used for a new stream; Reset does the same, but
+	silently discards any partial sequence.
+*/
+
+class UTF8StreamDecoder
+{
+	public:
+		using Sink = void (*) (void *, std::u32string_view);
+
+								UTF8StreamDecoder() noexcept;
+
+		template <typename SINK>
+		bool					Feed (
+									std::string_view		in_chunk,
+									SINK &&					in_sink);
+
+		template <typename SINK>
+		bool					Finish (
+									SINK &&					in_sink);
+
+		bool					Feed (
+									std::string_view		in_chunk,
+									Sink					in_sink,
+									void *					in_context);
+
+		bool					Finish (
+									Sink					in_sink,
+									void *					in_context);
+
+		void					Reset() noexcept;
+		bool					Is_Pending() const noexcept;
+
+
+	private:
+		template <typename SINK>
+		static void				Call_Sink (
+									void *					in_context,
+									std::u32string_view		in_code_points);
+
+		char32_t *				Put_Byte (
+									unsigned char			in_byte,
+									char32_t *				io_out,
+									bool &					io_clean) noexcept;
+
+		unsigned char			_pending [4];
+		std::size_t				_pending_size;
+		std::size_t				_trail_count;
+		bool					_spilling;
+};
+
+class UTF16StreamDecoder
+{
+	public:
+		using Sink = void (*) (void *, std::u32string_view);
+
+								UTF16StreamDecoder() noexcept;
+
+		template <typename SINK>
+		bool					Feed (
+									std::u16string_view		in_chunk,
+									SINK &&					in_sink);
+
+		template <typename SINK>
+		bool					Finish (
+									SINK &&					in_sink);
+
+		bool					Feed (
+									std::u16string_view		in_chunk,
+									Sink					in_sink,
+									void *					in_context);
+
+		bool					Finish (
+									Sink					in_sink,
+									void *					in_context);
+
+		void					Reset() noexcept;
+		bool					Is_Pending() const noexcept;
+
+
+	private:
+		template <typename SINK>
+		static void				Call_Sink (
+									void *					in_context,
+									std::u32string_view		in_code_points);
+
+		char32_t *				Put_Unit (
+									char16_t				in_unit,
+									char32_t *				io_out,
+									bool &					io_clean) noexcept;
+
+		char16_t				_lead;
+		bool					_pending;
+};
+
+
+/*------------------------------------------------------------------------------
+	The templated Feed and Finish simply forward to the Sink-based versions,
+	which do all the work out-of-line. Call_Sink recovers the type of the
+	sink from the opaque context pointer.
+*/
+
+template <typename SINK>
+void
+UTF8StreamDecoder::Call_Sink (
+	void *					in_context,
+	std::u32string_view		in_code_points)
+{
+	(*static_cast <SINK *> (in_context)) (in_code_points);
+}
+
+
+template <typename SINK>
+void
+UTF16StreamDecoder::Call_Sink (
+	void *					in_context,
+	std::u32string_view		in_code_points)
+{
+	(*static_cast <SINK *> (in_context)) (in_code_points);
+}
+
+
+template <typename SINK>
+bool
+UTF8StreamDecoder::Feed (
+	std::string_view		in_chunk,
+	SINK &&					in_sink)
+{
+	return Feed (in_chunk,
+		&Call_Sink <std::remove_reference_t <SINK>>,
+		const_cast <void *> (static_cast <const void *> (&in_sink)));
+}
+
+
+template <typename SINK>
+bool
+UTF8StreamDecoder::Finish (
+	SINK &&					in_sink)
+{
+	return Finish (&Call_Sink <std::remove_reference_t <SINK>>,
+		const_cast <void *> (static_cast <const void *> (&in_sink)));
+}
+
+
+template <typename SINK>
+bool
+UTF16StreamDecoder::Feed (
+	std::u16string_view		in_chunk,
+	SINK &&					in_sink)
+{
+	return Feed (in_chunk,
+		&Call_Sink <std::remove_reference_t <SINK>>,
+		const_cast <void *> (static_cast <const void *> (&in_sink)));
+}
+
+
+template <typename SINK>
+bool
+UTF16StreamDecoder::Finish (
+	SINK &&					in_sink)
+{
+	return Finish (&Call_Sink <std::remove_reference_t <SINK>>,
+		const_cast <void *> (static_cast <const void *> (&in_sink)));
+}
+
+
 /*------------------------------------------------------------------------------
 	String Width
 
@@ -187,8 +684,38 @@ Wide_to_UTF32 (
 	there is no equivalent functionality under Windows, and a trivial port is
 	complicated by the differing widths of wchar_t under POSIX and Windows. The
 	solution is a wc[s]width-alike family of functions that accept UTF-X chars.
+
+	Char_Width returns the number of cells the code point takes up: 0 for
+	combining marks and other zero-width characters, 2 for East Asian Wide
+	and Fullwidth characters, and 1 for everything else. Control characters,
+	surrogates, noncharacters, and anything beyond U+10FFFF return -1. Unlike
+	wcwidth, the result does not depend on the current locale.
+
+	String_Width returns the sum of the widths of the code points in the
+	string, or -1 if any of them is not printable, just like wcswidth. An
+	invalid sequence counts as a single Unicode replacement character, as it
+	would if the string were converted. The widths are looked up in tables
+	generated from the Unicode Character Database, so each lookup takes
+	constant time.
 */
 
+int
+Char_Width (
+	char32_t				in_code);
+
+std::ptrdiff_t
+String_Width (
+	std::string_view		in_string);
+
+std::ptrdiff_t
+String_Width (
+	std::u16string_view		in_string);
+
+std::ptrdiff_t
+String_Width (
+	std::u32string_view		in_string);
+
+
 /*----------------------------------------------------------------------------*/
 
 LUL_end_v_namespace
@@ -31,11 +31,14 @@ LUL_begin_v_namespace
 
 
 /*------------------------------------------------------------------------------
-	NOP.
+	Flush the installed ErrorHandler, so that nothing still queued in an
+	AsyncErrorHandler is lost at shutdown.
 */
 
 bool Finalize()
 {
+	ErrorHandler::Get()->Flush();
+
 	return true;
 }
 
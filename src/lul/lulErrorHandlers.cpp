@@ -0,0 +1,1106 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“ErrorHandlers.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <ostream>
+#include <thread>
+#include <utility>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulErrorHandlers.hpp>
+#include <Lucena-Utilities/lulFormat.hpp>
+#include <Lucena-Utilities/lulTypes.hpp>
+#include <Lucena-Utilities/lulUnicodeLiterals.hpp>
+
+#include "lulConfig_priv.hpp"
+
+
+LUL_begin_v_namespace
+
+
+namespace {
+
+
+/*------------------------------------------------------------------------------
+	Constants
+*/
+
+//	Keeps the producers’ and the consumer’s counters on separate cache lines.
+constexpr std::size_t	k_cache_line_size					{64};
+
+//	Room for a FlightRecorder entry’s message plus its file and function.
+constexpr std::size_t	k_dump_buffer_size					{1024};
+
+//	ThrottledErrorHandler table keys; real keys are never less than 2.
+constexpr std::uint64_t	k_slot_empty						{0};
+constexpr std::uint64_t	k_slot_busy							{1};
+
+//	How far the ThrottledErrorHandler table is searched for a key before
+//	giving up on it.
+constexpr std::size_t	k_max_probes						{16};
+
+
+/*------------------------------------------------------------------------------
+	Each thread remembers the last ring it recorded into, and the
+	FlightRecorder it belongs to. Recorders are identified by serial number,
+	rather than by address, so a stale entry can never be mistaken for a
+	current one.
+*/
+
+std::atomic <std::uint64_t>	g_recorder_serial {0};
+
+struct RingCache
+{
+	std::uint64_t			_recorder;
+	void *					_ring;
+};
+
+thread_local RingCache t_ring_cache {0, nullptr};
+
+
+/*------------------------------------------------------------------------------
+	Return in_size rounded up to a power of 2, and at least 2.
+*/
+
+std::size_t
+Round_Up_Capacity (
+	std::size_t				in_size) noexcept
+{
+	std::size_t nrv = 2;
+
+	while (nrv < in_size) nrv <<= 1;
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	The splitmix64 finalizer.
+*/
+
+std::uint64_t
+Mix (
+	std::uint64_t			in_value) noexcept
+{
+	in_value = (in_value ^ (in_value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+	in_value = (in_value ^ (in_value >> 27)) * 0x94D049BB133111EBULL;
+
+	return in_value ^ (in_value >> 31);
+}
+
+
+/*------------------------------------------------------------------------------
+	Return the key that identifies repeats of in_status.
+*/
+
+std::uint64_t
+Status_Key (
+	const Status &			in_status) noexcept
+{
+	auto nrv = (static_cast <std::uint64_t> (in_status.Domain()) << 32) ^ in_status.Code();
+
+	nrv = Mix (nrv ^ reinterpret_cast <std::uintptr_t> (in_status.File()));
+	nrv = Mix (nrv ^ static_cast <std::uint32_t> (in_status.Line()));
+
+	return (nrv < 2) ? (nrv + 2) : nrv;
+}
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+	AsyncErrorHandler::Queue
+
+	This is a bounded multi-producer queue in the style of Dmitry Vyukov’s:
+	each slot carries a sequence number that says whether it’s ready to be
+	written (sequence == position) or read (sequence == position + 1) on the
+	current lap around the ring, so producers only contend on _head, and the
+	single consumer - the drain thread - doesn’t need to contend at all.
+
+	The mutex and condition variables are only used for sleeping. The drain
+	thread sleeps when the queue is empty, after setting _sleeping; producers
+	only take the mutex to wake it if they see _sleeping. Each side stores,
+	fences, and then loads, so at least one of them is bound to see the
+	other’s store, and no wakeup is ever missed. Blocked producers and Flush
+	wait on _progress in much the same way.
+
+	Drops that are to be reported are tallied in _counted, and the drain
+	thread keeps _reported in step with it once they have been posted; both
+	only ever grow, so Flush can tell whether a report is still owed. A drop
+	wakes the drain thread just as a push does, since the queue may have
+	drained by the time it happens.
+*/
+
+struct AsyncErrorHandler::Queue
+{
+	struct Slot
+	{
+		std::atomic <std::size_t>	_sequence;
+		alignas (Status) unsigned char	_storage [sizeof (Status)];
+	};
+
+
+							Queue (
+								ErrorHandlerUnq			in_target,
+								std::size_t				in_capacity,
+								Overflow				in_overflow);
+
+	bool					Try_Push (
+								Status &				io_status) noexcept;
+
+	bool					Try_Pop (
+								Status &				out_status) noexcept;
+
+	bool					Has_Work() const noexcept;
+	bool					Has_Report() const noexcept;
+	bool					Has_Room() const noexcept;
+
+	void					Deliver (
+								Status					in_status) noexcept;
+
+	void					Run() noexcept;
+
+
+	ErrorHandlerUnq			_target;
+	std::unique_ptr <Slot []>	_slots;
+	std::size_t				_mask;
+	Overflow				_overflow;
+
+	alignas (k_cache_line_size) std::atomic <std::size_t>	_head {0};
+	alignas (k_cache_line_size) std::size_t	_tail {0};
+	std::atomic <std::size_t>	_flushed {0};
+
+	std::atomic <std::size_t>	_dropped {0};
+	std::atomic <std::size_t>	_counted {0};
+	std::atomic <std::size_t>	_reported {0};
+	std::atomic <std::size_t>	_blocked {0};
+	std::atomic <bool>		_sleeping {false};
+	std::atomic <bool>		_stopping {false};
+
+	std::mutex				_mutex;
+	std::condition_variable	_work;
+	std::condition_variable	_progress;
+	std::thread				_thread;
+};
+
+
+/*------------------------------------------------------------------------------
+*/
+
+AsyncErrorHandler::Queue::Queue (
+	ErrorHandlerUnq			in_target,
+	std::size_t				in_capacity,
+	Overflow				in_overflow)
+	:	_target {in_target ? std::move (in_target) : std::make_unique <ErrorHandler>()},
+		_slots {std::make_unique <Slot []> (Round_Up_Capacity (in_capacity))},
+		_mask {Round_Up_Capacity (in_capacity) - 1},
+		_overflow {in_overflow}
+{
+	for (std::size_t i = 0; i <= _mask; ++i)
+	{
+		_slots [i]._sequence.store (i, std::memory_order_relaxed);
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Claim the slot at _head, if it’s free, and move io_status into it;
+	io_status is left alone if the queue is full.
+*/
+
+bool
+AsyncErrorHandler::Queue::Try_Push (
+	Status &				io_status) noexcept
+{
+	auto position = _head.load (std::memory_order_relaxed);
+	Slot * slot = nullptr;
+
+	for (;;)
+	{
+		slot = &_slots [position & _mask];
+
+		auto sequence = slot->_sequence.load (std::memory_order_acquire);
+		auto difference = static_cast <std::intptr_t> (sequence - position);
+
+		if (0 == difference)
+		{
+			if (_head.compare_exchange_weak (position, position + 1,
+				std::memory_order_relaxed))
+			{
+				break;
+			}
+		}
+		else if (difference < 0)
+		{
+			//	The slot still holds a Status from the previous lap.
+			return false;
+		}
+		else
+		{
+			position = _head.load (std::memory_order_relaxed);
+		}
+	}
+
+	new (slot->_storage) Status {std::move (io_status)};
+	slot->_sequence.store (position + 1, std::memory_order_release);
+
+	return true;
+}
+
+
+/*------------------------------------------------------------------------------
+	Only ever called by the drain thread.
+*/
+
+bool
+AsyncErrorHandler::Queue::Try_Pop (
+	Status &				out_status) noexcept
+{
+	auto & slot = _slots [_tail & _mask];
+
+	if (slot._sequence.load (std::memory_order_acquire) != (_tail + 1))
+	{
+		return false;
+	}
+
+	auto status = std::launder (reinterpret_cast <Status *> (slot._storage));
+
+	out_status = std::move (*status);
+	status->~Status();
+
+	slot._sequence.store (_tail + _mask + 1, std::memory_order_release);
+	++_tail;
+
+	return true;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+AsyncErrorHandler::Queue::Has_Work() const noexcept
+{
+	return _slots [_tail & _mask]._sequence.load (std::memory_order_acquire) ==
+		(_tail + 1);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+AsyncErrorHandler::Queue::Has_Report() const noexcept
+{
+	return _counted.load (std::memory_order_acquire) !=
+		_reported.load (std::memory_order_relaxed);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+AsyncErrorHandler::Queue::Has_Room() const noexcept
+{
+	auto position = _head.load (std::memory_order_relaxed);
+
+	return _slots [position & _mask]._sequence.load (std::memory_order_acquire) ==
+		position;
+}
+
+
+/*------------------------------------------------------------------------------
+	There’s nowhere to report a failure in the error handler itself, so it’s
+	simply swallowed.
+*/
+
+void
+AsyncErrorHandler::Queue::Deliver (
+	Status					in_status) noexcept
+{
+	try
+	{
+		_target->Post (std::move (in_status));
+	}
+	catch (...)
+	{
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	The body of the drain thread. It keeps going until it has been asked to
+	stop and the queue is empty, so nothing posted before the handler is
+	destroyed is lost. in_target is flushed every time the queue runs dry,
+	and _flushed is brought up to date, which is what Flush waits on.
+*/
+
+void
+AsyncErrorHandler::Queue::Run() noexcept
+{
+	auto status = Status{};
+	auto delivered = false;
+
+	for (;;)
+	{
+		while (Try_Pop (status))
+		{
+			Deliver (std::move (status));
+			delivered = true;
+
+			std::atomic_thread_fence (std::memory_order_seq_cst);
+
+			if (_blocked.load (std::memory_order_relaxed))
+			{
+				std::lock_guard <std::mutex> lock {_mutex};
+
+				_progress.notify_all();
+			}
+		}
+
+		auto counted = _counted.load (std::memory_order_acquire);
+		auto reported = _reported.load (std::memory_order_relaxed);
+
+		if (counted != reported)
+		{
+			try
+			{
+				Deliver (Status {STRING_GROUP_messages, STATUS_CODE_overflow,
+					Format_String ("{} error messages were dropped", counted - reported)});
+				delivered = true;
+			}
+			catch (...)
+			{
+			}
+		}
+
+		if (delivered)
+		{
+			try
+			{
+				_target->Flush();
+			}
+			catch (...)
+			{
+			}
+
+			delivered = false;
+		}
+
+		auto lock = std::unique_lock <std::mutex> {_mutex};
+
+		_flushed.store (_tail, std::memory_order_release);
+		_reported.store (counted, std::memory_order_release);
+		_progress.notify_all();
+
+		if (_stopping.load (std::memory_order_acquire) and !Has_Work() and !Has_Report()) break;
+
+		_sleeping.store (true, std::memory_order_relaxed);
+		std::atomic_thread_fence (std::memory_order_seq_cst);
+
+		_work.wait (lock, [this] {
+			return Has_Work() or Has_Report() or _stopping.load (std::memory_order_acquire); });
+
+		_sleeping.store (false, std::memory_order_relaxed);
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+AsyncErrorHandler::AsyncErrorHandler (
+	ErrorHandlerUnq			in_target,
+	std::size_t				in_capacity,
+	Overflow				in_overflow)
+	:	_queue {std::make_unique <Queue> (std::move (in_target), in_capacity,
+			in_overflow)}
+{
+	_queue->_thread = std::thread {[queue = _queue.get()] { queue->Run(); }};
+}
+
+
+/*------------------------------------------------------------------------------
+	The drain thread empties the queue before it exits.
+*/
+
+AsyncErrorHandler::~AsyncErrorHandler()
+{
+	{
+		std::lock_guard <std::mutex> lock {_queue->_mutex};
+
+		_queue->_stopping.store (true, std::memory_order_release);
+		_queue->_work.notify_one();
+	}
+
+	_queue->_thread.join();
+}
+
+
+/*------------------------------------------------------------------------------
+	A Status posted from the drain thread itself (i.e., by in_target) can’t
+	wait for room, since only the drain thread can make any; it’s dropped
+	and counted instead. Either a push or a counted drop wakes the drain
+	thread if it’s asleep.
+*/
+
+void
+AsyncErrorHandler::Post (
+	Status					in_status)
+{
+	auto & queue = *_queue;
+
+	while (!queue.Try_Push (in_status))
+	{
+		if ((Overflow::Block != queue._overflow) or
+			(std::this_thread::get_id() == queue._thread.get_id()))
+		{
+			queue._dropped.fetch_add (1, std::memory_order_relaxed);
+
+			if (Overflow::Drop == queue._overflow) return;
+
+			queue._counted.fetch_add (1, std::memory_order_release);
+			break;
+		}
+
+		auto lock = std::unique_lock <std::mutex> {queue._mutex};
+
+		queue._blocked.fetch_add (1, std::memory_order_relaxed);
+		std::atomic_thread_fence (std::memory_order_seq_cst);
+
+		queue._progress.wait (lock, [&queue] { return queue.Has_Room(); });
+
+		queue._blocked.fetch_sub (1, std::memory_order_relaxed);
+	}
+
+	std::atomic_thread_fence (std::memory_order_seq_cst);
+
+	if (queue._sleeping.load (std::memory_order_relaxed))
+	{
+		std::lock_guard <std::mutex> lock {queue._mutex};
+
+		queue._work.notify_one();
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Everything claimed before _head was read is delivered and flushed by the
+	drain thread before _flushed catches up to it, and any drops counted
+	before then are reported before _reported catches up to _counted.
+*/
+
+void
+AsyncErrorHandler::Flush()
+{
+	auto & queue = *_queue;
+
+	if (std::this_thread::get_id() == queue._thread.get_id())
+	{
+		queue._target->Flush();
+		return;
+	}
+
+	auto target = queue._head.load (std::memory_order_acquire);
+	auto counted = queue._counted.load (std::memory_order_acquire);
+	auto lock = std::unique_lock <std::mutex> {queue._mutex};
+
+	queue._work.notify_one();
+	queue._progress.wait (lock, [&queue, target, counted] {
+		return (queue._flushed.load (std::memory_order_acquire) >= target) and
+			(queue._reported.load (std::memory_order_acquire) >= counted); });
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+AsyncErrorHandler::Dropped() const noexcept
+{
+	return _queue->_dropped.load (std::memory_order_relaxed);
+}
+
+
+/*------------------------------------------------------------------------------
+	FlightRecorder::Recorder
+
+	Each record is guarded by its sequence number, seqlock-style: the owning
+	thread zeroes it before writing the rest, and stores the new one
+	afterwards, so Dump can tell that a record changed while it was being
+	copied, and skip it. The rest of the record is made of relaxed atomics,
+	too - the message is stored a word at a time - so that Dump reading it
+	while it’s being written is merely a torn read, which the sequence number
+	catches, rather than a data race. Rings are only ever added to the list,
+	with a CAS, and only freed along with the Recorder, so Dump can walk it
+	at any time.
+*/
+
+struct FlightRecorder::Recorder
+{
+	using Word = std::uint64_t;
+
+	static constexpr std::size_t	k_message_words	{k_message_size / sizeof (Word)};
+
+	static_assert (0 == (k_message_size % sizeof (Word)),
+		"k_message_size must be a whole number of words");
+
+	struct Record
+	{
+		std::atomic <std::uint64_t>	_sequence {0};
+		std::atomic <StringGroup>	_domain {STRING_GROUP_messages};
+		std::atomic <StatusCode>	_code {STATUS_CODE_none};
+		std::atomic <int>		_line {0};
+		std::atomic <bool>		_truncated {false};
+		std::atomic <const char *>	_file {nullptr};
+		std::atomic <const char *>	_function {nullptr};
+		std::atomic <Word>		_message [k_message_words] {};
+	};
+
+	struct Ring
+	{
+		std::thread::id			_thread;
+		std::size_t				_index;
+		Ring *					_link;
+		std::atomic <std::size_t>	_next {0};
+		std::unique_ptr <Record []>	_records;
+	};
+
+
+							Recorder (
+								std::size_t				in_depth,
+								ErrorHandlerUnq			in_target);
+
+							~Recorder();
+
+	Ring &					Thread_Ring();
+
+	void					Record_Status (
+								const Status &			in_status);
+
+	void					Dump_Ring (
+								const Ring &			in_ring,
+								DumpFunc				in_write,
+								void *					in_context) const noexcept;
+
+
+	ErrorHandlerUnq			_target;
+	std::size_t				_mask;
+	std::uint64_t			_serial;
+	std::atomic <Ring *>	_rings {nullptr};
+	std::atomic <std::size_t>	_ring_count {0};
+	alignas (k_cache_line_size) std::atomic <std::uint64_t>	_sequence {0};
+};
+
+
+/*------------------------------------------------------------------------------
+*/
+
+FlightRecorder::Recorder::Recorder (
+	std::size_t				in_depth,
+	ErrorHandlerUnq			in_target)
+	:	_target {std::move (in_target)},
+		_mask {Round_Up_Capacity (in_depth) - 1},
+		_serial {g_recorder_serial.fetch_add (1, std::memory_order_relaxed) + 1}
+{
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+FlightRecorder::Recorder::~Recorder()
+{
+	auto ring = _rings.load (std::memory_order_acquire);
+
+	while (ring)
+	{
+		delete std::exchange (ring, ring->_link);
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Return the calling thread’s ring, creating it on the thread’s first post.
+	Only the calling thread could have created a ring with its id, so there’s
+	no race between finding one and adding one.
+*/
+
+FlightRecorder::Recorder::Ring &
+FlightRecorder::Recorder::Thread_Ring()
+{
+	if (t_ring_cache._recorder == _serial)
+	{
+		return *static_cast <Ring *> (t_ring_cache._ring);
+	}
+
+	auto thread = std::this_thread::get_id();
+	auto head = _rings.load (std::memory_order_acquire);
+	auto nrv = head;
+
+	while (nrv and (nrv->_thread != thread)) nrv = nrv->_link;
+
+	if (!nrv)
+	{
+		auto ring = std::make_unique <Ring>();
+
+		ring->_thread = thread;
+		ring->_index = _ring_count.fetch_add (1, std::memory_order_relaxed);
+		ring->_link = head;
+		ring->_records = std::make_unique <Record []> (_mask + 1);
+
+		while (!_rings.compare_exchange_weak (ring->_link, ring.get(),
+			std::memory_order_release, std::memory_order_relaxed))
+		{
+		}
+
+		nrv = ring.release();
+	}
+
+	t_ring_cache = RingCache {_serial, nrv};
+
+	return *nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	The message is copied a byte at a time, since its length isn’t known,
+	and only as much of it as fits is of interest, anyway; it’s then stored
+	a word at a time, up to and including the word with the terminator.
+*/
+
+void
+FlightRecorder::Recorder::Record_Status (
+	const Status &			in_status)
+{
+	auto & ring = Thread_Ring();
+	auto position = ring._next.load (std::memory_order_relaxed);
+	auto & record = ring._records [position & _mask];
+
+	record._sequence.store (0, std::memory_order_relaxed);
+	std::atomic_thread_fence (std::memory_order_release);
+
+	record._domain.store (in_status.Domain(), std::memory_order_relaxed);
+	record._code.store (in_status.Code(), std::memory_order_relaxed);
+	record._line.store (in_status.Line(), std::memory_order_relaxed);
+	record._file.store (in_status.File(), std::memory_order_relaxed);
+	record._function.store (in_status.Function(), std::memory_order_relaxed);
+
+	auto message = in_status.Message();
+	char text [k_message_size] {};
+	std::size_t length = 0;
+	auto truncated = false;
+
+	if (message)
+	{
+		while (message [length] and (length < (k_message_size - 1)))
+		{
+			text [length] = message [length];
+			++length;
+		}
+
+		truncated = (message [length] != '\0');
+
+		if (truncated)
+		{
+			while (length and uc::UTF8_Is_Trail_Byte (
+				static_cast <uint8_t> (message [length]))) text [--length] = '\0';
+		}
+	}
+
+	record._truncated.store (truncated, std::memory_order_relaxed);
+
+	for (std::size_t i = 0; i <= (length / sizeof (Word)); ++i)
+	{
+		Word word;
+
+		std::memcpy (&word, text + (i * sizeof (Word)), sizeof (Word));
+		record._message [i].store (word, std::memory_order_relaxed);
+	}
+
+	record._sequence.store (_sequence.fetch_add (1, std::memory_order_relaxed) + 1,
+		std::memory_order_release);
+	ring._next.store (position + 1, std::memory_order_release);
+}
+
+
+/*------------------------------------------------------------------------------
+	Everything is formatted into a buffer on the stack, so nothing here
+	allocates.
+*/
+
+void
+FlightRecorder::Recorder::Dump_Ring (
+	const Ring &			in_ring,
+	DumpFunc				in_write,
+	void *					in_context) const noexcept
+{
+	char buffer [k_dump_buffer_size];
+	auto next = in_ring._next.load (std::memory_order_acquire);
+	auto size = Format_To (buffer, sizeof (buffer), "Thread {}:\n", in_ring._index);
+
+	in_write (buffer, std::min (size, sizeof (buffer) - 1), in_context);
+
+	for (std::size_t i = 0; i <= _mask; ++i)
+	{
+		const auto & record = in_ring._records [(next + i) & _mask];
+		auto sequence = record._sequence.load (std::memory_order_acquire);
+
+		if (!sequence) continue;
+
+		auto domain = record._domain.load (std::memory_order_relaxed);
+		auto code = record._code.load (std::memory_order_relaxed);
+		auto line = record._line.load (std::memory_order_relaxed);
+		auto truncated = record._truncated.load (std::memory_order_relaxed);
+		auto file = record._file.load (std::memory_order_relaxed);
+		auto function = record._function.load (std::memory_order_relaxed);
+		char message [k_message_size];
+
+		for (std::size_t w = 0; w < k_message_words; ++w)
+		{
+			auto word = record._message [w].load (std::memory_order_relaxed);
+
+			std::memcpy (message + (w * sizeof (Word)), &word, sizeof (Word));
+		}
+
+		message [k_message_size - 1] = '\0';
+
+		std::atomic_thread_fence (std::memory_order_acquire);
+
+		if (record._sequence.load (std::memory_order_relaxed) != sequence) continue;
+
+		size = Format_To (buffer, sizeof (buffer),
+			"\t#{} (Domain: {}, Code: {}): {}{}\n\t\t{}, {}: {}\n",
+			sequence, domain, code, static_cast <const char *> (message),
+			truncated ? "..." : "", file, function, line);
+
+		in_write (buffer, std::min (size, sizeof (buffer) - 1), in_context);
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+FlightRecorder::FlightRecorder (
+	std::size_t				in_depth,
+	ErrorHandlerUnq			in_target)
+	:	_recorder {std::make_unique <Recorder> (in_depth, std::move (in_target))}
+{
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+FlightRecorder::~FlightRecorder() = default;
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+FlightRecorder::Post (
+	Status					in_status)
+{
+	_recorder->Record_Status (in_status);
+
+	if (_recorder->_target) _recorder->_target->Post (std::move (in_status));
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+FlightRecorder::Flush()
+{
+	if (_recorder->_target) _recorder->_target->Flush();
+}
+
+
+/*------------------------------------------------------------------------------
+	Rings are listed newest first, so they’re dumped in reverse order of
+	creation; the thread numbers make that plain enough.
+*/
+
+void
+FlightRecorder::Dump (
+	DumpFunc				in_write,
+	void *					in_context) const noexcept
+{
+	for (auto ring = _recorder->_rings.load (std::memory_order_acquire); ring;
+		ring = ring->_link)
+	{
+		_recorder->Dump_Ring (*ring, in_write, in_context);
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+FlightRecorder::Dump (
+	std::ostream &			out_stream) const
+{
+	Dump ([] (const char * in_text, std::size_t in_size, void * in_context) {
+			static_cast <std::ostream *> (in_context)->write (in_text,
+				static_cast <std::streamsize> (in_size));
+		}, &out_stream);
+}
+
+
+/*------------------------------------------------------------------------------
+	ThrottledErrorHandler::Table
+
+	An open-addressed table, with linear probing. A thread claims an empty
+	slot by swapping in k_slot_busy, fills in the rest of it, and then
+	publishes the key; anyone else looking for a key waits out a busy slot,
+	since it may be claimed for the very same key.
+
+	Each slot’s token bucket is kept as a single “theoretical arrival time,”
+	as in the generic cell rate algorithm: a Status is let through if that
+	time is no more than _burst_window in the future, and letting it through
+	moves the time one interval on from now, or from where it was, whichever
+	is later. Times are in nanoseconds since the table was made, so a new
+	slot starts with a full bucket.
+*/
+
+struct ThrottledErrorHandler::Table
+{
+	struct alignas (k_cache_line_size) Slot
+	{
+		std::atomic <std::uint64_t>	_key {k_slot_empty};
+		std::atomic <std::int64_t>	_arrival {0};
+		std::atomic <std::uint64_t>	_suppressed {0};
+		StringGroup				_domain {STRING_GROUP_messages};
+		StatusCode				_code {STATUS_CODE_none};
+		int						_line {0};
+		const char *			_file {nullptr};
+		const char *			_function {nullptr};
+	};
+
+
+							Table (
+								ErrorHandlerUnq			in_target,
+								std::size_t				in_burst,
+								std::chrono::nanoseconds	in_interval,
+								std::size_t				in_capacity);
+
+	Slot *					Find_Slot (
+								const Status &			in_status) noexcept;
+
+	bool					Take_Token (
+								Slot &					io_slot) noexcept;
+
+	void					Post_Repeats (
+								Slot &					io_slot);
+
+
+	ErrorHandlerUnq			_target;
+	std::int64_t			_interval;
+	std::int64_t			_burst_window;
+	std::chrono::steady_clock::time_point	_epoch;
+	std::size_t				_mask;
+	std::unique_ptr <Slot []>	_slots;
+};
+
+
+/*------------------------------------------------------------------------------
+*/
+
+ThrottledErrorHandler::Table::Table (
+	ErrorHandlerUnq			in_target,
+	std::size_t				in_burst,
+	std::chrono::nanoseconds	in_interval,
+	std::size_t				in_capacity)
+	:	_target {in_target ? std::move (in_target) : std::make_unique <ErrorHandler>()},
+		_interval {std::max <std::int64_t> (in_interval.count(), 1)},
+		_burst_window {_interval * static_cast <std::int64_t> (std::max <std::size_t> (in_burst, 1) - 1)},
+		_epoch {std::chrono::steady_clock::now()},
+		_mask {Round_Up_Capacity (in_capacity) - 1},
+		_slots {std::make_unique <Slot []> (_mask + 1)}
+{
+}
+
+
+/*------------------------------------------------------------------------------
+	Return the slot for in_status’s kind, claiming one if need be, or nullptr
+	if there’s no room for it.
+*/
+
+ThrottledErrorHandler::Table::Slot *
+ThrottledErrorHandler::Table::Find_Slot (
+	const Status &			in_status) noexcept
+{
+	auto key = Status_Key (in_status);
+
+	for (std::size_t i = 0; (i <= _mask) and (i < k_max_probes); ++i)
+	{
+		auto & slot = _slots [(key + i) & _mask];
+		auto current = slot._key.load (std::memory_order_acquire);
+
+		if ((k_slot_empty == current) and slot._key.compare_exchange_strong (current,
+			k_slot_busy, std::memory_order_acquire))
+		{
+			slot._domain = in_status.Domain();
+			slot._code = in_status.Code();
+			slot._line = in_status.Line();
+			slot._file = in_status.File();
+			slot._function = in_status.Function();
+			slot._key.store (key, std::memory_order_release);
+
+			return &slot;
+		}
+
+		while (k_slot_busy == current)
+		{
+			std::this_thread::yield();
+			current = slot._key.load (std::memory_order_acquire);
+		}
+
+		if (key == current) return &slot;
+	}
+
+	return nullptr;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+ThrottledErrorHandler::Table::Take_Token (
+	Slot &					io_slot) noexcept
+{
+	auto now = std::chrono::duration_cast <std::chrono::nanoseconds> (
+		std::chrono::steady_clock::now() - _epoch).count();
+	auto arrival = io_slot._arrival.load (std::memory_order_relaxed);
+
+	for (;;)
+	{
+		auto start = std::max (arrival, now);
+
+		if ((start - now) > _burst_window) return false;
+
+		if (io_slot._arrival.compare_exchange_weak (arrival, start + _interval,
+			std::memory_order_relaxed))
+		{
+			return true;
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+ThrottledErrorHandler::Table::Post_Repeats (
+	Slot &					io_slot)
+{
+	if (auto count = io_slot._suppressed.exchange (0, std::memory_order_relaxed))
+	{
+		_target->Post (Status {STRING_GROUP_messages, STATUS_CODE_repeated,
+			Format_String ("(Domain: {}, Code: {}) repeated {} times",
+				io_slot._domain, io_slot._code, count),
+			io_slot._file, io_slot._function, io_slot._line});
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+ThrottledErrorHandler::ThrottledErrorHandler (
+	ErrorHandlerUnq			in_target,
+	std::size_t				in_burst,
+	std::chrono::nanoseconds	in_interval,
+	std::size_t				in_capacity)
+	:	_table {std::make_unique <Table> (std::move (in_target), in_burst,
+			in_interval, in_capacity)}
+{
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+ThrottledErrorHandler::~ThrottledErrorHandler() = default;
+
+
+/*------------------------------------------------------------------------------
+	Successes aren’t throttled, as they aren’t errors in the first place.
+*/
+
+void
+ThrottledErrorHandler::Post (
+	Status					in_status)
+{
+	auto & table = *_table;
+	auto slot = in_status.Error() ? table.Find_Slot (in_status) : nullptr;
+
+	if (slot)
+	{
+		if (!table.Take_Token (*slot))
+		{
+			slot->_suppressed.fetch_add (1, std::memory_order_relaxed);
+			return;
+		}
+
+		table.Post_Repeats (*slot);
+	}
+
+	table._target->Post (std::move (in_status));
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+ThrottledErrorHandler::Flush()
+{
+	auto & table = *_table;
+
+	for (std::size_t i = 0; i <= table._mask; ++i)
+	{
+		auto & slot = table._slots [i];
+
+		if (slot._key.load (std::memory_order_acquire) > k_slot_busy)
+		{
+			table.Post_Repeats (slot);
+		}
+	}
+
+	table._target->Flush();
+}
+
+
+/*----------------------------------------------------------------------------*/
+
+LUL_end_v_namespace
@@ -0,0 +1,209 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“Format.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <algorithm>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string_view>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulFormat.hpp>
+
+#include "lulConfig_priv.hpp"
+
+
+LUL_begin_v_namespace
+
+
+namespace {
+
+
+/*------------------------------------------------------------------------------
+	Writes into a buffer that may be too small, or missing altogether, while
+	keeping track of how long the result would have been. There is always
+	room for the null terminator, unless there’s no buffer at all.
+*/
+
+class FormatWriter
+{
+	public:
+		FormatWriter (
+			char *					out_buffer,
+			std::size_t				in_buffer_size) noexcept
+			:	_buffer {in_buffer_size ? out_buffer : nullptr},
+				_capacity {_buffer ? (in_buffer_size - 1) : 0},
+				_length {0}
+		{ }
+
+		void Write (
+			std::string_view		in_string) noexcept
+		{
+			if (_length < _capacity)
+			{
+				std::memcpy (_buffer + _length, in_string.data(),
+					std::min (in_string.size(), _capacity - _length));
+			}
+
+			_length += in_string.size();
+		}
+
+		std::size_t Finish() noexcept
+		{
+			if (_buffer) _buffer [std::min (_length, _capacity)] = '\0';
+
+			return _length;
+		}
+
+
+	private:
+		char *					_buffer;
+		std::size_t				_capacity;
+		std::size_t				_length;
+};
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+Write_Arg (
+	FormatWriter &			io_writer,
+	const FormatArg &		in_arg) noexcept
+{
+	char buffer [32];
+
+	switch (in_arg._kind)
+	{
+		case FormatArg::Kind::None:
+			break;
+
+		case FormatArg::Kind::Bool:
+			io_writer.Write (in_arg._unsigned ? "true" : "false");
+			break;
+
+		case FormatArg::Kind::Char:
+			buffer [0] = static_cast <char> (in_arg._unsigned);
+			io_writer.Write ({buffer, 1});
+			break;
+
+		case FormatArg::Kind::Signed:
+		{
+			auto result = std::to_chars (buffer, buffer + sizeof (buffer), in_arg._signed);
+
+			io_writer.Write ({buffer, static_cast <std::size_t> (result.ptr - buffer)});
+			break;
+		}
+
+		case FormatArg::Kind::Unsigned:
+		{
+			auto result = std::to_chars (buffer, buffer + sizeof (buffer), in_arg._unsigned);
+
+			io_writer.Write ({buffer, static_cast <std::size_t> (result.ptr - buffer)});
+			break;
+		}
+
+		case FormatArg::Kind::Float:
+		{
+			auto length = LUL_STDC99::snprintf (buffer, sizeof (buffer), "%g", in_arg._float);
+
+			if (length > 0)
+			{
+				io_writer.Write ({buffer, std::min (static_cast <std::size_t> (length),
+					sizeof (buffer) - 1)});
+			}
+
+			break;
+		}
+
+		case FormatArg::Kind::Pointer:
+		{
+			auto result = std::to_chars (buffer, buffer + sizeof (buffer),
+				reinterpret_cast <uintptr_t> (in_arg._pointer), 16);
+
+			io_writer.Write ("0x");
+			io_writer.Write ({buffer, static_cast <std::size_t> (result.ptr - buffer)});
+			break;
+		}
+
+		case FormatArg::Kind::String:
+			io_writer.Write (in_arg._string);
+			break;
+	}
+}
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+	Runs of plain text are written in one go; a brace that isn’t part of a
+	placeholder or an escape is just plain text. A format whose placeholders
+	don’t match its arguments is a programming error, so it’s only caught in
+	debug builds.
+*/
+
+std::size_t
+Format_Args_To (
+	char *					out_buffer,
+	std::size_t				in_buffer_size,
+	std::string_view		in_format,
+	const FormatArg *		in_args,
+	std::size_t				in_count) noexcept
+{
+	auto writer = FormatWriter {out_buffer, in_buffer_size};
+	std::size_t next = 0;
+	std::size_t i = 0;
+
+	while (i < in_format.size())
+	{
+		auto c = in_format [i];
+		auto following = ((i + 1) < in_format.size()) ? in_format [i + 1] : '\0';
+
+		if ((c == '{') and (following == '}'))
+		{
+			if (next < in_count) Write_Arg (writer, in_args [next]);
+
+			++next;
+			i += 2;
+
+			continue;
+		}
+
+		if (((c == '{') or (c == '}')) and (following == c))
+		{
+			writer.Write ({&in_format [i], 1});
+			i += 2;
+
+			continue;
+		}
+
+		auto end = std::min (in_format.find_first_of ("{}", i + 1), in_format.size());
+
+		writer.Write (in_format.substr (i, end - i));
+		i = end;
+	}
+
+	LUL_Assert_ (next == in_count);
+
+	return writer.Finish();
+}
+
+
+/*----------------------------------------------------------------------------*/
+
+LUL_end_v_namespace
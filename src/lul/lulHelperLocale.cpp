@@ -16,18 +16,24 @@
 
 
 //	std
-#include <exception>
-#include <locale>
+#include <algorithm>
+#include <cstddef>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <type_traits>
 
 
 //	lul
 #include <Lucena-Utilities/lulConfig.hpp>
 #include <Lucena-Utilities/lulFeatureSetup.hpp>
+#include <Lucena-Utilities/lulUnicodeLiterals.hpp>
+#include <Lucena-Utilities/lulUtilities.hpp>
 
 #include <Lucena-Utilities/details/lulHelperLocale.hpp>
 
 #include "lulConfig_priv.hpp"
+#include "lulUnicodeKernels_priv.hpp"
 
 
 LUL_begin_v_namespace
@@ -38,29 +44,101 @@ namespace stdproxy::details {
 */
 
 // __throw_runtime_error
-[[maybe_unused]] [[noreturn]] static void __throw_runtime_error(const std::string &msg)
+[[noreturn]] static void __throw_runtime_error(const std::string &msg)
 {
     throw std::runtime_error(msg);
 }
 
-// __narrow_to_utf8<16>
-__narrow_to_utf8<16>::~__narrow_to_utf8()
+/*------------------------------------------------------------------------------
+	The chunk functions all work the same way: the block transcoders stop on
+	a code point boundary when __buf fills up, so we can simply hand them the
+	rest of the input every time, and let them tell us how far they got.
+
+	The block transcoders follow the library’s Is_Char rules, and so replace
+	noncharacters, too; but file names may legitimately contain those, and
+	std::codecvt accepts them, so only surrogates, values past U+10FFFF, and
+	malformed sequences are errors here. When the transcoder reports an
+	error, we redo the clean part before it, and then decode the offending
+	sequence ourselves: a well-formed noncharacter is copied through as-is,
+	and anything else throws.
+*/
+
+template <class _InCharT, class _OutCharT>
+static TranscodeResult __transcode_block(std::basic_string_view<_InCharT> __in,
+                                         _OutCharT* __buf, size_t __n) noexcept
+{
+    if constexpr (std::is_same_v<_InCharT, char>)
+        return uc::UTF8_Widen(__in, __buf, __n);
+    else
+        return uc::UTF_Narrow(__in, __buf, __n);
+}
+
+template <class _InCharT, class _OutCharT>
+static size_t __transcode_chunk(const _InCharT*& __b, const _InCharT* __e,
+                                _OutCharT* __buf, size_t __n)
+{
+    const std::basic_string_view<_InCharT> __in(__b, static_cast<size_t>(__e - __b));
+    auto __r = __transcode_block(__in, __buf, __n);
+
+    if (__r.error_index != TranscodeResult::npos)
+    {
+        const size_t __error = __r.error_index;
+
+        __r = __transcode_block(__in.substr(0, __error), __buf, __n);
+
+        if (__r.consumed == __error)
+        {
+            size_t __i = __error;
+            char32_t __cp = 0xFFFFFFFFu;
+            _OutCharT __encoded[4];
+
+            (void) uc::UTF_Decode(__in, __i, __cp);
+
+            if (!uc::Is_Nonchar(__cp))
+                __throw_runtime_error("locale not supported");
+
+            const size_t __size = uc::UTF_Encode(__cp, __encoded);
+
+            if (__n - __r.produced >= __size)
+            {
+                std::copy(__encoded, __encoded + __size, __buf + __r.produced);
+                __r.consumed = __i;
+                __r.produced += __size;
+            }
+        }
+    }
+
+    if (__r.consumed == 0)
+        __throw_runtime_error("locale not supported");
+
+    __b += __r.consumed;
+    return __r.produced;
+}
+
+// __narrow_to_utf8_chunk
+size_t __narrow_to_utf8_chunk(const char16_t*& __b, const char16_t* __e,
+                              char* __buf, size_t __n)
 {
+    return __transcode_chunk(__b, __e, __buf, __n);
 }
 
-// __narrow_to_utf8<32>
-__narrow_to_utf8<32>::~__narrow_to_utf8()
+size_t __narrow_to_utf8_chunk(const char32_t*& __b, const char32_t* __e,
+                              char* __buf, size_t __n)
 {
+    return __transcode_chunk(__b, __e, __buf, __n);
 }
 
-// __widen_from_utf8<16>
-__widen_from_utf8<16>::~__widen_from_utf8()
+// __widen_from_utf8_chunk
+size_t __widen_from_utf8_chunk(const char*& __b, const char* __e,
+                               char16_t* __buf, size_t __n)
 {
+    return __transcode_chunk(__b, __e, __buf, __n);
 }
 
-// __widen_from_utf8<32>
-__widen_from_utf8<32>::~__widen_from_utf8()
+size_t __widen_from_utf8_chunk(const char*& __b, const char* __e,
+                               char32_t* __buf, size_t __n)
 {
+    return __transcode_chunk(__b, __e, __buf, __n);
 }
 
 
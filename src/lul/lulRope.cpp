@@ -0,0 +1,1043 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“Rope.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+	The tree is a treap: a binary tree of pieces in string order, which is
+	also a heap on a random priority assigned to each node, which keeps it
+	balanced with high probability. Each node records the total size of its
+	subtree, so positions can be found by descending from the root, and
+	Split and Merge are both logarithmic.
+
+	Nodes are reference-counted and are never modified while they’re shared,
+	so ropes can share whole subtrees; Split and Merge copy a shared node
+	before changing it, and modify it in place otherwise, which is the usual
+	case when a rope is being built up by one owner.
+
+	Chunks are reference-counted, too, and are append-only: bytes are never
+	changed once they’ve been written, so pieces can refer to them freely.
+	_used records how much of a chunk has been handed out; a rope can only
+	extend its tail in place if nothing has been written past it, which it
+	checks and claims in one atomic step, since copies of a rope share its
+	tail chunk.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulRope.hpp>
+#include <Lucena-Utilities/lulTypes.hpp>
+
+#include "lulConfig_priv.hpp"
+#include "lulUnicodeKernels_priv.hpp"
+
+
+LUL_begin_v_namespace
+
+
+namespace {
+
+
+/*------------------------------------------------------------------------------
+	Constants
+*/
+
+//	The size of each chunk, including its header.
+constexpr std::size_t	k_chunk_size						{4096};
+
+//	The most chunks each thread will hold on to for re-use.
+constexpr std::size_t	k_pool_limit						{64};
+
+//	The longest sequence UTF_Narrow can produce for one code point; we don’t
+//	bother transcoding into less room than this.
+constexpr std::size_t	k_max_sequence						{4};
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+	Types
+*/
+
+struct RopeChunk
+{
+	static constexpr std::size_t k_capacity {k_chunk_size -
+		(2 * sizeof (std::atomic <std::size_t>)) - sizeof (RopeChunk *)};
+
+	std::atomic <std::size_t>	_count;
+	std::atomic <std::size_t>	_used;
+	RopeChunk *				_next;
+	char					_data [k_capacity];
+};
+
+
+struct RopeNode
+{
+	std::atomic <std::size_t>	_count;
+	RopeNode *				_left;
+	RopeNode *				_right;
+	RopeChunk *				_chunk;
+	std::size_t				_offset;
+	std::size_t				_length;
+	std::size_t				_size;
+	uint32_t				_priority;
+};
+
+
+namespace {
+
+
+/*------------------------------------------------------------------------------
+	Chunk Pool
+
+	Each thread keeps a free list of chunks. t_chunk_pool is trivially
+	destructible, so it stays usable even after the thread’s other
+	thread_local objects have been destroyed, e.g., by ropes with static
+	storage duration; once ChunkPoolCleanup has freed the pool, chunks are
+	simply deleted.
+*/
+
+struct ChunkPool
+{
+	RopeChunk *				_head;
+	std::size_t				_count;
+	bool					_closed;
+};
+
+thread_local ChunkPool t_chunk_pool {nullptr, 0, false};
+
+
+struct ChunkPoolCleanup
+{
+	~ChunkPoolCleanup()
+	{
+		while (t_chunk_pool._head)
+		{
+			auto chunk = t_chunk_pool._head;
+
+			t_chunk_pool._head = chunk->_next;
+			delete chunk;
+		}
+
+		t_chunk_pool._count = 0;
+		t_chunk_pool._closed = true;
+	}
+};
+
+thread_local ChunkPoolCleanup t_chunk_pool_cleanup;
+
+
+/*------------------------------------------------------------------------------
+	Return an empty chunk, with a reference count of 1.
+*/
+
+RopeChunk *
+Get_Chunk()
+{
+	auto nrv = t_chunk_pool._head;
+
+	if (nrv)
+	{
+		t_chunk_pool._head = nrv->_next;
+		--t_chunk_pool._count;
+	}
+	else
+	{
+		nrv = new RopeChunk;
+	}
+
+	nrv->_count.store (1, std::memory_order_relaxed);
+	nrv->_used.store (0, std::memory_order_relaxed);
+	nrv->_next = nullptr;
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+Retain_Chunk (
+	RopeChunk *				in_chunk) noexcept
+{
+	if (in_chunk) in_chunk->_count.fetch_add (1, std::memory_order_relaxed);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+Release_Chunk (
+	RopeChunk *				in_chunk) noexcept
+{
+	if (!in_chunk or (1 != in_chunk->_count.fetch_sub (1, std::memory_order_acq_rel)))
+	{
+		return;
+	}
+
+	if (t_chunk_pool._closed or (t_chunk_pool._count >= k_pool_limit))
+	{
+		delete in_chunk;
+		return;
+	}
+
+	//	Make sure the cleanup object exists in this thread.
+	(void) &t_chunk_pool_cleanup;
+
+	in_chunk->_next = t_chunk_pool._head;
+	t_chunk_pool._head = in_chunk;
+	++t_chunk_pool._count;
+}
+
+
+/*------------------------------------------------------------------------------
+	Nodes
+*/
+
+uint32_t
+Next_Priority() noexcept
+{
+	//	xorshift32; the quality hardly matters, so long as it’s not ordered.
+	thread_local uint32_t t_state {0x9E3779B9u};
+
+	t_state ^= t_state << 13;
+	t_state ^= t_state >> 17;
+	t_state ^= t_state << 5;
+
+	return t_state;
+}
+
+
+inline std::size_t
+Size (
+	const RopeNode *		in_node) noexcept
+{
+	return in_node ? in_node->_size : 0;
+}
+
+
+inline void
+Update (
+	RopeNode *				io_node) noexcept
+{
+	io_node->_size = Size (io_node->_left) + io_node->_length + Size (io_node->_right);
+}
+
+
+inline RopeNode *
+Retain (
+	RopeNode *				in_node) noexcept
+{
+	if (in_node) in_node->_count.fetch_add (1, std::memory_order_relaxed);
+
+	return in_node;
+}
+
+
+void
+Release (
+	RopeNode *				in_node) noexcept
+{
+	if (!in_node or (1 != in_node->_count.fetch_sub (1, std::memory_order_acq_rel)))
+	{
+		return;
+	}
+
+	Release (in_node->_left);
+	Release (in_node->_right);
+	Release_Chunk (in_node->_chunk);
+
+	delete in_node;
+}
+
+
+/*------------------------------------------------------------------------------
+	Make a node for the given piece; it takes over the references to
+	in_left and in_right, and adds one to in_chunk.
+*/
+
+RopeNode *
+Make_Node (
+	RopeNode *				in_left,
+	RopeNode *				in_right,
+	RopeChunk *				in_chunk,
+	std::size_t				in_offset,
+	std::size_t				in_length,
+	uint32_t				in_priority)
+{
+	auto nrv = new RopeNode {{1}, in_left, in_right, in_chunk, in_offset, in_length,
+		0, in_priority};
+
+	Retain_Chunk (in_chunk);
+	Update (nrv);
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Return a node that we own outright, with the same contents as in_node,
+	whose reference we take over.
+*/
+
+RopeNode *
+Unshare (
+	RopeNode *				in_node)
+{
+	if (1 == in_node->_count.load (std::memory_order_acquire)) return in_node;
+
+	auto nrv = Make_Node (Retain (in_node->_left), Retain (in_node->_right),
+		in_node->_chunk, in_node->_offset, in_node->_length, in_node->_priority);
+
+	Release (in_node);
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Split in_node, whose reference we take over, into the trees holding the
+	first in_pos bytes and the rest. A piece that straddles in_pos is split
+	in two.
+*/
+
+std::pair <RopeNode *, RopeNode *>
+Split (
+	RopeNode *				in_node,
+	std::size_t				in_pos)
+{
+	if (!in_node) return {nullptr, nullptr};
+	if (0 == in_pos) return {nullptr, in_node};
+	if (in_pos >= in_node->_size) return {in_node, nullptr};
+
+	auto node = Unshare (in_node);
+	auto left_size = Size (node->_left);
+
+	if (in_pos <= left_size)
+	{
+		auto [left, right] = Split (node->_left, in_pos);
+
+		node->_left = right;
+		Update (node);
+
+		return {left, node};
+	}
+
+	if (in_pos >= (left_size + node->_length))
+	{
+		auto [left, right] = Split (node->_right, in_pos - left_size - node->_length);
+
+		node->_right = left;
+		Update (node);
+
+		return {node, right};
+	}
+
+	auto head = in_pos - left_size;
+	auto tail = Make_Node (nullptr, node->_right, node->_chunk, node->_offset + head,
+		node->_length - head, node->_priority);
+
+	node->_right = nullptr;
+	node->_length = head;
+	Update (node);
+
+	return {node, tail};
+}
+
+
+/*------------------------------------------------------------------------------
+	Concatenate in_left and in_right, whose references we take over.
+*/
+
+RopeNode *
+Merge (
+	RopeNode *				in_left,
+	RopeNode *				in_right)
+{
+	if (!in_left) return in_right;
+	if (!in_right) return in_left;
+
+	if (in_left->_priority >= in_right->_priority)
+	{
+		auto nrv = Unshare (in_left);
+
+		nrv->_right = Merge (nrv->_right, in_right);
+		Update (nrv);
+
+		return nrv;
+	}
+
+	auto nrv = Unshare (in_right);
+
+	nrv->_left = Merge (in_left, nrv->_left);
+	Update (nrv);
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+Visit (
+	const RopeNode *		in_node,
+	U8Rope::Visitor			in_visitor,
+	void *					in_context)
+{
+	if (!in_node) return;
+
+	Visit (in_node->_left, in_visitor, in_context);
+
+	in_visitor (in_context, std::string_view {in_node->_chunk->_data + in_node->_offset,
+		in_node->_length});
+
+	Visit (in_node->_right, in_visitor, in_context);
+}
+
+
+/*------------------------------------------------------------------------------
+	Copy up to in_count bytes starting at in_pos within the tree to
+	out_buffer, skipping over subtrees that lie entirely outside the range,
+	and return the number of bytes copied.
+*/
+
+std::size_t
+Copy_Range (
+	const RopeNode *		in_node,
+	std::size_t				in_pos,
+	std::size_t				in_count,
+	char *					out_buffer) noexcept
+{
+	if (!in_node or (0 == in_count) or (in_pos >= in_node->_size)) return 0;
+
+	std::size_t nrv = 0;
+	auto left_size = Size (in_node->_left);
+
+	if (in_pos < left_size)
+	{
+		nrv = Copy_Range (in_node->_left, in_pos, in_count, out_buffer);
+		in_pos = left_size;
+	}
+
+	auto offset = in_pos - left_size;
+
+	if ((nrv < in_count) and (offset < in_node->_length))
+	{
+		auto n = std::min (in_node->_length - offset, in_count - nrv);
+
+		std::memcpy (out_buffer + nrv, in_node->_chunk->_data + in_node->_offset + offset, n);
+		nrv += n;
+		in_pos += n;
+	}
+
+	if (nrv < in_count)
+	{
+		auto right_start = left_size + in_node->_length;
+
+		nrv += Copy_Range (in_node->_right, std::max (in_pos, right_start) - right_start,
+			in_count - nrv, out_buffer + nrv);
+	}
+
+	return nrv;
+}
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+*/
+
+U8Rope::U8Rope() noexcept
+	:	_root {nullptr},
+		_tail_chunk {nullptr},
+		_tail_offset {0},
+		_tail_size {0}
+{
+}
+
+
+/*------------------------------------------------------------------------------
+	Copies share everything, including the tail chunk.
+*/
+
+U8Rope::U8Rope (
+	const U8Rope &			a) noexcept
+	:	_root {Retain (a._root)},
+		_tail_chunk {a._tail_chunk},
+		_tail_offset {a._tail_offset},
+		_tail_size {a._tail_size}
+{
+	Retain_Chunk (_tail_chunk);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+U8Rope::U8Rope (
+	U8Rope &&				a) noexcept
+	:	_root {std::exchange (a._root, nullptr)},
+		_tail_chunk {std::exchange (a._tail_chunk, nullptr)},
+		_tail_offset {std::exchange (a._tail_offset, 0)},
+		_tail_size {std::exchange (a._tail_size, 0)}
+{
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+U8Rope::U8Rope (
+	std::string_view		s)
+	:	U8Rope{}
+{
+	Append (s);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+U8Rope::~U8Rope() noexcept
+{
+	Release (_root);
+	Release_Chunk (_tail_chunk);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+U8Rope &
+U8Rope::operator = (
+	const U8Rope &			a) noexcept
+{
+	auto copy = U8Rope {a};
+
+	std::swap (_root, copy._root);
+	std::swap (_tail_chunk, copy._tail_chunk);
+	std::swap (_tail_offset, copy._tail_offset);
+	std::swap (_tail_size, copy._tail_size);
+
+	return *this;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+U8Rope &
+U8Rope::operator = (
+	U8Rope &&				a) noexcept
+{
+	if (this != &a)
+	{
+		Clear();
+
+		_root = std::exchange (a._root, nullptr);
+		_tail_chunk = std::exchange (a._tail_chunk, nullptr);
+		_tail_offset = std::exchange (a._tail_offset, 0);
+		_tail_size = std::exchange (a._tail_size, 0);
+	}
+
+	return *this;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+auto
+U8Rope::size() const noexcept -> size_type
+{
+	return Size (_root) + _tail_size;
+}
+
+
+/*------------------------------------------------------------------------------
+	in_pos must be less than size().
+*/
+
+auto
+U8Rope::At (
+	size_type				in_pos) const noexcept -> char_type
+{
+	auto node = static_cast <const RopeNode *> (_root);
+
+	if (in_pos >= Size (node))
+	{
+		return _tail_chunk->_data [_tail_offset + (in_pos - Size (node))];
+	}
+
+	while (true)
+	{
+		auto left_size = Size (node->_left);
+
+		if (in_pos < left_size)
+		{
+			node = node->_left;
+		}
+		else if (in_pos < (left_size + node->_length))
+		{
+			return node->_chunk->_data [node->_offset + (in_pos - left_size)];
+		}
+		else
+		{
+			in_pos -= left_size + node->_length;
+			node = node->_right;
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Most appends land here, and simply copy into the tail chunk.
+*/
+
+U8Rope &
+U8Rope::Append (
+	std::string_view		in_string)
+{
+	while (!in_string.empty())
+	{
+		if (Extend_Tail (in_string)) continue;
+
+		Flush_Tail();
+		Release_Chunk (_tail_chunk);
+
+		_tail_chunk = nullptr;
+		_tail_chunk = Get_Chunk();
+		_tail_offset = 0;
+	}
+
+	return *this;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+U8Rope &
+U8Rope::Append (
+	const char *			in_string)
+{
+	return Append (in_string ? std::string_view {in_string} : std::string_view{});
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+U8Rope &
+U8Rope::Append (
+	const std::string &		in_string)
+{
+	return Append (std::string_view {in_string});
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+U8Rope &
+U8Rope::Append (
+	const U8String &		in_string)
+{
+	return Append (in_string.Get_StringView());
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+U8Rope &
+U8Rope::Append (
+	std::u16string_view		in_string)
+{
+	Append_Transcoded (in_string);
+
+	return *this;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+U8Rope &
+U8Rope::Append (
+	std::u32string_view		in_string)
+{
+	Append_Transcoded (in_string);
+
+	return *this;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+U8Rope &
+U8Rope::Append (
+	std::wstring_view		in_string)
+{
+	Append_Transcoded (in_string);
+
+	return *this;
+}
+
+
+/*------------------------------------------------------------------------------
+	Appending a rope to itself is fine, since we take our own references to
+	its contents first.
+*/
+
+U8Rope &
+U8Rope::Append (
+	const U8Rope &			in_rope)
+{
+	auto other = U8Rope {in_rope};
+
+	other.Flush_Tail();
+	Flush_Tail();
+
+	_root = Merge (_root, std::exchange (other._root, nullptr));
+
+	return *this;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+U8Rope::Insert (
+	size_type				in_pos,
+	std::string_view		in_string)
+{
+	if (in_pos >= size())
+	{
+		Append (in_string);
+		return;
+	}
+
+	auto middle = Store (in_string);
+	auto [left, right] = Split (_root, in_pos);
+
+	_root = Merge (Merge (left, middle), right);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+U8Rope::Insert (
+	size_type				in_pos,
+	const U8Rope &			in_rope)
+{
+	auto other = U8Rope {in_rope};
+
+	other.Flush_Tail();
+	Flush_Tail();
+
+	auto [left, right] = Split (_root, std::min (in_pos, size()));
+
+	_root = Merge (Merge (left, std::exchange (other._root, nullptr)), right);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+U8Rope::Erase (
+	size_type				in_pos,
+	size_type				in_count)
+{
+	Flush_Tail();
+
+	auto [left, rest] = Split (_root, in_pos);
+	auto [middle, right] = Split (rest, in_count);
+
+	Release (middle);
+
+	_root = Merge (left, right);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+U8Rope::Clear() noexcept
+{
+	Release (_root);
+	Release_Chunk (_tail_chunk);
+
+	_root = nullptr;
+	_tail_chunk = nullptr;
+	_tail_offset = 0;
+	_tail_size = 0;
+}
+
+
+/*------------------------------------------------------------------------------
+	The slice keeps our tail chunk, so it can go on appending to it if we
+	don’t get there first.
+*/
+
+U8Rope
+U8Rope::Slice (
+	size_type				in_pos,
+	size_type				in_count) const
+{
+	auto nrv = U8Rope {*this};
+
+	nrv.Flush_Tail();
+
+	auto [left, rest] = Split (nrv._root, in_pos);
+	auto [middle, right] = Split (rest, in_count);
+
+	Release (left);
+	Release (right);
+
+	nrv._root = middle;
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+auto
+U8Rope::Copy (
+	size_type				in_pos,
+	size_type				in_count,
+	char_type *				out_buffer) const noexcept -> size_type
+{
+	auto tree_size = Size (_root);
+	auto nrv = Copy_Range (_root, in_pos, in_count, out_buffer);
+
+	if ((nrv < in_count) and _tail_size)
+	{
+		auto offset = std::max (in_pos, tree_size) - tree_size;
+
+		if (offset < _tail_size)
+		{
+			auto n = std::min (_tail_size - offset, in_count - nrv);
+
+			std::memcpy (out_buffer + nrv, _tail_chunk->_data + _tail_offset + offset, n);
+			nrv += n;
+		}
+	}
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+U8String
+U8Rope::Flatten() const
+{
+	auto buffer = std::string (size(), '\0');
+
+	(void) Copy (0, npos, buffer.data());
+
+	return U8String {std::move (buffer)};
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::vector <std::string_view>
+U8Rope::Get_Segments() const
+{
+	auto nrv = std::vector <std::string_view>{};
+
+	For_Each_Segment ([&nrv] (std::string_view in_segment)
+		{
+			nrv.push_back (in_segment);
+		});
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+U8Rope::For_Each_Segment (
+	Visitor					in_visitor,
+	void *					in_context) const
+{
+	Visit (_root, in_visitor, in_context);
+
+	if (_tail_size)
+	{
+		in_visitor (in_context, std::string_view {_tail_chunk->_data + _tail_offset,
+			_tail_size});
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Move the tail into the tree; appending can pick up again right after it
+	in the same chunk.
+*/
+
+void
+U8Rope::Flush_Tail()
+{
+	if (0 == _tail_size) return;
+
+	auto leaf = Make_Node (nullptr, nullptr, _tail_chunk, _tail_offset, _tail_size,
+		Next_Priority());
+
+	_root = Merge (_root, leaf);
+	_tail_offset += _tail_size;
+	_tail_size = 0;
+}
+
+
+/*------------------------------------------------------------------------------
+	Copy as much of io_string as will fit into the tail chunk, right after
+	the tail, and remove it from io_string. Returns false if nothing could be
+	copied, either because the chunk is full, or because a copy of this rope
+	has already claimed the space after the tail.
+*/
+
+bool
+U8Rope::Extend_Tail (
+	std::string_view &		io_string) noexcept
+{
+	if (!_tail_chunk) return false;
+
+	auto end = _tail_offset + _tail_size;
+	auto count = std::min (RopeChunk::k_capacity - end, io_string.size());
+	auto expected = end;
+
+	if ((0 == count) or
+		!_tail_chunk->_used.compare_exchange_strong (expected, end + count,
+			std::memory_order_acq_rel))
+	{
+		return false;
+	}
+
+	std::memcpy (_tail_chunk->_data + end, io_string.data(), count);
+	_tail_size += count;
+	io_string.remove_prefix (count);
+
+	return true;
+}
+
+
+/*------------------------------------------------------------------------------
+	Since we can’t know up front how many bytes the transcoder will produce,
+	we claim the rest of the tail chunk, and then hand back what it didn’t
+	use; the transcoder always stops on a code point boundary.
+*/
+
+template <typename CHAR_T>
+void
+U8Rope::Append_Transcoded (
+	std::basic_string_view <CHAR_T>	in_string)
+{
+	while (!in_string.empty())
+	{
+		if (_tail_chunk)
+		{
+			auto end = _tail_offset + _tail_size;
+			auto room = RopeChunk::k_capacity - end;
+			auto expected = end;
+
+			if ((room >= k_max_sequence) and
+				_tail_chunk->_used.compare_exchange_strong (expected, RopeChunk::k_capacity,
+					std::memory_order_acq_rel))
+			{
+				auto result = uc::UTF_Narrow (in_string, _tail_chunk->_data + end, room);
+
+				_tail_chunk->_used.store (end + result.produced, std::memory_order_release);
+				_tail_size += result.produced;
+				in_string.remove_prefix (result.consumed);
+
+				if (result.consumed) continue;
+			}
+		}
+
+		Flush_Tail();
+		Release_Chunk (_tail_chunk);
+
+		_tail_chunk = nullptr;
+		_tail_chunk = Get_Chunk();
+		_tail_offset = 0;
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Write in_string into the tail chunk (and fresh chunks, as needed), just
+	as Append would, but return the pieces as a separate tree instead of
+	adding them to the rope.
+*/
+
+RopeNode *
+U8Rope::Store (
+	std::string_view		in_string)
+{
+	Flush_Tail();
+
+	RopeNode * nrv = nullptr;
+
+	while (!in_string.empty())
+	{
+		if (Extend_Tail (in_string))
+		{
+			nrv = Merge (nrv, Make_Node (nullptr, nullptr, _tail_chunk, _tail_offset,
+				_tail_size, Next_Priority()));
+
+			_tail_offset += _tail_size;
+			_tail_size = 0;
+
+			continue;
+		}
+
+		Release_Chunk (_tail_chunk);
+
+		_tail_chunk = nullptr;
+		_tail_chunk = Get_Chunk();
+		_tail_offset = 0;
+	}
+
+	return nrv;
+}
+
+
+/*----------------------------------------------------------------------------*/
+
+LUL_end_v_namespace
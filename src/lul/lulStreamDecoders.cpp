@@ -0,0 +1,505 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“StreamDecoders.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+	The stream decoders split each chunk into three parts: a head, which
+	finishes off whatever sequence was left over from the previous chunk; a
+	body, which is handed off wholesale to the bulk transcoders; and a tail,
+	which might hold the start of a sequence that continues in the next chunk.
+	The head and tail are run through a byte-at-a-time (or unit-at-a-time)
+	state machine that mirrors UTF_Decode exactly, so that the output never
+	depends on where the chunk boundaries fall.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <cstddef>
+#include <string_view>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulUtilities.hpp>
+
+#include "lulConfig_priv.hpp"
+#include "lulUnicodeKernels_priv.hpp"
+#include "lulUnicodeUtilities_priv.hpp"
+
+
+LUL_begin_v_namespace
+
+
+namespace {
+
+
+/*------------------------------------------------------------------------------
+	Constants
+*/
+
+//	The number of code points we collect before handing them off to the sink;
+//	this is also the size of the output buffer for the bulk transcoders. It
+//	should comfortably exceed the minimum that the vector kernels need in
+//	order to run at all.
+constexpr std::size_t	k_batch_size						{256};
+
+
+/*------------------------------------------------------------------------------
+	These let Batch::Put_Body treat both decoders uniformly.
+*/
+
+TranscodeResult
+Decode_Body (
+	std::string_view		in_string,
+	char32_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	return uc::UTF8_Widen (in_string, out_buffer, in_buffer_size);
+}
+
+
+TranscodeResult
+Decode_Body (
+	std::u16string_view		in_string,
+	char32_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	return uc::UTF_Convert (in_string, out_buffer, in_buffer_size);
+}
+
+
+/*------------------------------------------------------------------------------
+	Batch collects decoded code points on the stack and passes them on to the
+	sink once there are enough of them to be worth the call. Reserve always
+	returns room for at least 2 code points, which is the most that a single
+	call to Put_Byte or Put_Unit can emit.
+*/
+
+class Batch
+{
+	public:
+		using Sink = UTF8StreamDecoder::Sink;
+
+		Batch (Sink in_sink, void * in_context) noexcept
+			:	_sink {in_sink},
+				_context {in_context},
+				_size {0}
+		{ }
+
+		char32_t * Reserve()
+		{
+			if (_size > (k_batch_size - 2)) Flush();
+
+			return _buffer + _size;
+		}
+
+		void Commit (char32_t * in_end) noexcept
+		{
+			_size = static_cast <std::size_t> (in_end - _buffer);
+		}
+
+		template <typename T>
+		void Put_Body (T in_string, bool & io_clean)
+		{
+			while (!in_string.empty())
+			{
+				Flush();
+
+				auto result = Decode_Body (in_string, _buffer, k_batch_size);
+
+				if (TranscodeResult::npos != result.error_index) io_clean = false;
+
+				_size = result.produced;
+				in_string.remove_prefix (result.consumed);
+			}
+		}
+
+		void Flush()
+		{
+			if (_size)
+			{
+				_sink (_context, std::u32string_view {_buffer, _size});
+				_size = 0;
+			}
+		}
+
+
+	private:
+		Sink					_sink;
+		void *					_context;
+		std::size_t				_size;
+		char32_t				_buffer [k_batch_size];
+};
+
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+*/
+
+UTF8StreamDecoder::UTF8StreamDecoder() noexcept
+	:	_pending {},
+		_pending_size {0},
+		_trail_count {0},
+		_spilling {false}
+{
+}
+
+
+/*------------------------------------------------------------------------------
+	The head of the chunk is run through Put_Byte until the state left over
+	from the previous chunk is resolved. This usually takes no more than 3
+	bytes, but a bad sequence can be followed by an arbitrarily long run of
+	trail bytes, all of which are consolidated into the replacement character
+	that was already emitted.
+
+	The body ends just before the last byte in the chunk that isn’t a trail
+	byte. Since it is followed in the stream by the start of a new sequence,
+	the bulk transcoder will decode it exactly as it would if it had the
+	whole stream to work with. What’s left is the tail, which is at most a
+	lead byte and a handful of trail bytes in well-formed input.
+*/
+
+bool
+UTF8StreamDecoder::Feed (
+	std::string_view		in_chunk,
+	Sink					in_sink,
+	void *					in_context)
+{
+	auto batch = Batch {in_sink, in_context};
+	auto bytes = reinterpret_cast <const unsigned char *> (in_chunk.data());
+	auto size = in_chunk.size();
+	auto index = std::size_t {0};
+	auto clean = true;
+
+	while ((index < size) and (_pending_size or _spilling))
+	{
+		batch.Commit (Put_Byte (bytes [index++], batch.Reserve(), clean));
+	}
+
+	auto tail = size;
+
+	while ((tail > index) and uc::UTF8_Is_Trail_Byte (bytes [tail - 1])) --tail;
+
+	if (tail > index)
+	{
+		--tail;
+		batch.Put_Body (in_chunk.substr (index, tail - index), clean);
+		index = tail;
+	}
+
+	while (index < size)
+	{
+		batch.Commit (Put_Byte (bytes [index++], batch.Reserve(), clean));
+	}
+
+	batch.Flush();
+
+
+	return clean;
+}
+
+
+/*------------------------------------------------------------------------------
+	A partial sequence at the end of the stream is replaced, just as it would
+	be by UTF_Decode.
+*/
+
+bool
+UTF8StreamDecoder::Finish (
+	Sink					in_sink,
+	void *					in_context)
+{
+	auto clean = (0 == _pending_size);
+
+	if (!clean)
+	{
+		auto code = uc::CODE_POINT_replacement;
+
+		in_sink (in_context, std::u32string_view {&code, 1});
+	}
+
+	Reset();
+
+
+	return clean;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+UTF8StreamDecoder::Reset() noexcept
+{
+	_pending_size = 0;
+	_trail_count = 0;
+	_spilling = false;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+UTF8StreamDecoder::Is_Pending() const noexcept
+{
+	return (0 != _pending_size);
+}
+
+
+/*------------------------------------------------------------------------------
+	Advance the state machine by one byte, writing whatever it decodes to
+	io_out, and return the new end of the output. This follows UTF_Decode
+	step for step; in particular, a bad sequence causes any trail bytes that
+	follow it to be spilled, except when it is a well-formed encoding of
+	something that isn’t a character (e.g., a surrogate), and a sequence that
+	is cut short by the start of another is replaced without consuming the
+	byte that interrupted it.
+*/
+
+char32_t *
+UTF8StreamDecoder::Put_Byte (
+	unsigned char			in_byte,
+	char32_t *				io_out,
+	bool &					io_clean) noexcept
+{
+	if (_pending_size)
+	{
+		if (uc::UTF8_Is_Trail_Byte (in_byte))
+		{
+			_pending [_pending_size++] = in_byte;
+
+			if (_pending_size <= _trail_count) return io_out;
+
+
+			//	The sequence is complete, so decode it, and make sure that it
+			//	is both the shortest possible encoding and a valid character.
+			auto code = uc::UTF8_Decode_Lead_Byte (_pending [0], _trail_count);
+
+			for (std::size_t i = 1; i < _pending_size; ++i)
+			{
+				code = uc::UTF8_Decode_Trail_Byte (_pending [i], code);
+			}
+
+			_pending_size = 0;
+
+			if (code < uc::UTF8_code_point_range [_trail_count][0])
+			{
+				_spilling = true;
+				code = uc::CODE_POINT_replacement;
+				io_clean = false;
+			}
+			else if (!uc::Is_Char (code))
+			{
+				code = uc::CODE_POINT_replacement;
+				io_clean = false;
+			}
+
+			*io_out++ = code;
+
+			return io_out;
+		}
+
+
+		//	The next sequence started early; replace the partial one, then
+		//	process in_byte as usual.
+		_pending_size = 0;
+		*io_out++ = uc::CODE_POINT_replacement;
+		io_clean = false;
+	}
+	else if (_spilling)
+	{
+		if (uc::UTF8_Is_Trail_Byte (in_byte)) return io_out;
+
+		_spilling = false;
+	}
+
+
+	if (uc::UTF8_Is_ASCII (in_byte))
+	{
+		*io_out++ = in_byte;
+	}
+	else if (uc::UTF8_Is_Lead_Byte (in_byte) and
+		(0 != (_trail_count = uc::UTF8_count_trail_bytes [in_byte])))
+	{
+		_pending [0] = in_byte;
+		_pending_size = 1;
+	}
+	else
+	{
+		//	An orphaned trail byte, or a lead byte that can’t start a valid
+		//	sequence.
+		_spilling = true;
+		*io_out++ = uc::CODE_POINT_replacement;
+		io_clean = false;
+	}
+
+
+	return io_out;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+UTF16StreamDecoder::UTF16StreamDecoder() noexcept
+	:	_lead {0},
+		_pending {false}
+{
+}
+
+
+/*------------------------------------------------------------------------------
+	This works just like UTF8StreamDecoder::Feed, except that the only thing
+	that can be carried over from one chunk to the next is a lead surrogate.
+*/
+
+bool
+UTF16StreamDecoder::Feed (
+	std::u16string_view		in_chunk,
+	Sink					in_sink,
+	void *					in_context)
+{
+	auto batch = Batch {in_sink, in_context};
+	auto size = in_chunk.size();
+	auto index = std::size_t {0};
+	auto clean = true;
+
+	while ((index < size) and _pending)
+	{
+		batch.Commit (Put_Unit (in_chunk [index++], batch.Reserve(), clean));
+	}
+
+	auto tail = size;
+
+	if ((tail > index) and uc::Is_Lead_Surrogate (in_chunk [tail - 1])) --tail;
+
+	batch.Put_Body (in_chunk.substr (index, tail - index), clean);
+	index = tail;
+
+	while (index < size)
+	{
+		batch.Commit (Put_Unit (in_chunk [index++], batch.Reserve(), clean));
+	}
+
+	batch.Flush();
+
+
+	return clean;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+UTF16StreamDecoder::Finish (
+	Sink					in_sink,
+	void *					in_context)
+{
+	auto clean = !_pending;
+
+	if (!clean)
+	{
+		auto code = uc::CODE_POINT_replacement;
+
+		in_sink (in_context, std::u32string_view {&code, 1});
+	}
+
+	Reset();
+
+
+	return clean;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+UTF16StreamDecoder::Reset() noexcept
+{
+	_lead = 0;
+	_pending = false;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+UTF16StreamDecoder::Is_Pending() const noexcept
+{
+	return _pending;
+}
+
+
+/*------------------------------------------------------------------------------
+	Advance the state machine by one code unit; see UTF8StreamDecoder::Put_Byte.
+	As with UTF_Decode, a lead surrogate that isn’t followed by a trail
+	surrogate is replaced without consuming the unit that follows it.
+*/
+
+char32_t *
+UTF16StreamDecoder::Put_Unit (
+	char16_t				in_unit,
+	char32_t *				io_out,
+	bool &					io_clean) noexcept
+{
+	if (_pending)
+	{
+		_pending = false;
+
+		if (uc::Is_Trail_Surrogate (in_unit))
+		{
+			//	See UTF_Decode for the derivation of the magic number.
+			auto code = (static_cast <char32_t> (_lead) << 10) +
+				(static_cast <char32_t> (in_unit) - 0x035FDC00u);
+
+			if (!uc::Is_Char (code))
+			{
+				code = uc::CODE_POINT_replacement;
+				io_clean = false;
+			}
+
+			*io_out++ = code;
+
+			return io_out;
+		}
+
+		*io_out++ = uc::CODE_POINT_replacement;
+		io_clean = false;
+	}
+
+
+	if (uc::Is_Lead_Surrogate (in_unit))
+	{
+		_lead = in_unit;
+		_pending = true;
+	}
+	else if (uc::Is_Char (in_unit))
+	{
+		*io_out++ = in_unit;
+	}
+	else
+	{
+		*io_out++ = uc::CODE_POINT_replacement;
+		io_clean = false;
+	}
+
+
+	return io_out;
+}
+
+
+/*----------------------------------------------------------------------------*/
+
+LUL_end_v_namespace
@@ -0,0 +1,314 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“StringPool.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+	This implements the global pool behind Intern. Each shard is an
+	open-addressed hash table of pointers to entries, probed linearly, with
+	the full hash kept in each entry so that probes rarely have to look at
+	the strings themselves. Entries are never freed, so they’re carved out of
+	large blocks instead of being allocated one at a time.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulConcurrencyTypes.hpp>
+#include <Lucena-Utilities/lulTypes.hpp>
+
+#include "lulConfig_priv.hpp"
+
+
+LUL_begin_v_namespace
+
+
+namespace {
+
+
+/*------------------------------------------------------------------------------
+	Constants
+*/
+
+//	The number of shards, as a power of 2; shards are selected using the top
+//	bits of the hash, and slots within a shard using the bottom bits.
+constexpr std::size_t	k_shard_bits						{6};
+constexpr std::size_t	k_shard_count						{std::size_t {1} << k_shard_bits};
+
+//	Each shard’s table starts out with this many slots, and doubles whenever
+//	it becomes half full.
+constexpr std::size_t	k_initial_slots						{64};
+
+//	Entries are carved out of blocks of this size; anything that wouldn’t fit
+//	comfortably in one gets a block of its own.
+constexpr std::size_t	k_block_size						{16 * 1024};
+
+
+/*------------------------------------------------------------------------------
+	Shard
+*/
+
+class Shard
+{
+	public:
+		//	Return the entry for in_string, or nullptr if there isn’t one.
+		const InternedEntry * Find (
+			std::string_view		in_string,
+			std::size_t				in_hash) const
+		{
+			auto lock = SharedLock {_mutex};
+
+			return Find_Locked (in_string, in_hash);
+		}
+
+		//	Return the entry for in_string, adding one if need be.
+		const InternedEntry * Insert (
+			std::string_view		in_string,
+			std::size_t				in_hash)
+		{
+			auto lock = ExclusiveLock {_mutex};
+
+			//	Someone else may have beaten us to it since we last looked.
+			if (auto nrv = Find_Locked (in_string, in_hash); nrv) return nrv;
+
+			if ((2 * (_count + 1)) > _slots.size()) Grow();
+
+			auto nrv = Make_Entry (in_string, in_hash);
+
+			Place (nrv);
+			++_count;
+
+			return nrv;
+		}
+
+
+	private:
+		const InternedEntry * Find_Locked (
+			std::string_view		in_string,
+			std::size_t				in_hash) const noexcept
+		{
+			if (_slots.empty()) return nullptr;
+
+			auto mask = _slots.size() - 1;
+
+			for (auto i = in_hash & mask; _slots [i]; i = (i + 1) & mask)
+			{
+				auto entry = _slots [i];
+
+				if ((entry->_hash == in_hash) and (entry->_size == in_string.size()) and
+					(0 == std::memcmp (entry->_data, in_string.data(), in_string.size())))
+				{
+					return entry;
+				}
+			}
+
+			return nullptr;
+		}
+
+		void Place (
+			const InternedEntry *	in_entry) noexcept
+		{
+			auto mask = _slots.size() - 1;
+			auto i = in_entry->_hash & mask;
+
+			while (_slots [i]) i = (i + 1) & mask;
+
+			_slots [i] = in_entry;
+		}
+
+		void Grow()
+		{
+			auto old_slots = std::vector <const InternedEntry *> (
+				_slots.empty() ? k_initial_slots : (2 * _slots.size()), nullptr);
+
+			old_slots.swap (_slots);
+
+			for (auto entry : old_slots)
+			{
+				if (entry) Place (entry);
+			}
+		}
+
+		//	The string is stored, null-terminated, right after its entry.
+		const InternedEntry * Make_Entry (
+			std::string_view		in_string,
+			std::size_t				in_hash)
+		{
+			constexpr auto k_align = alignof (InternedEntry);
+
+			auto size = (sizeof (InternedEntry) + in_string.size() + 1 + (k_align - 1)) &
+				~(k_align - 1);
+
+			if (size > (k_block_size / 4))
+			{
+				_blocks.push_back (std::make_unique <char []> (size));
+
+				return Construct_Entry (_blocks.back().get(), in_string, in_hash);
+			}
+
+			if (!_block or ((_block_used + size) > k_block_size))
+			{
+				_blocks.push_back (std::make_unique <char []> (k_block_size));
+				_block = _blocks.back().get();
+				_block_used = 0;
+			}
+
+			auto nrv = Construct_Entry (_block + _block_used, in_string, in_hash);
+
+			_block_used += size;
+
+			return nrv;
+		}
+
+		static const InternedEntry * Construct_Entry (
+			char *					in_memory,
+			std::string_view		in_string,
+			std::size_t				in_hash) noexcept
+		{
+			auto data = in_memory + sizeof (InternedEntry);
+
+			std::memcpy (data, in_string.data(), in_string.size());
+			data [in_string.size()] = '\0';
+
+			return new (in_memory) InternedEntry {in_hash, in_string.size(), data};
+		}
+
+		mutable SharedMutex		_mutex;
+		std::vector <const InternedEntry *> _slots;
+		std::size_t				_count {0};
+		std::vector <std::unique_ptr <char []>> _blocks;
+		char *					_block {nullptr};
+		std::size_t				_block_used {0};
+};
+
+
+/*------------------------------------------------------------------------------
+	The pool is deliberately leaked, so that interned strings remain valid
+	even while other static objects are being destroyed.
+*/
+
+Shard *
+Get_Shards()
+{
+	static auto s_shards = new Shard [k_shard_count];
+
+	return s_shards;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+inline std::size_t
+Hash_String (
+	std::string_view		in_string) noexcept
+{
+	return std::hash <std::string_view>{} (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+inline Shard &
+Get_Shard (
+	std::size_t				in_hash) noexcept
+{
+	return Get_Shards() [in_hash >> ((8 * sizeof (std::size_t)) - k_shard_bits)];
+}
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+	Most strings are interned far more often than they’re added, so we look
+	for them with the shard’s lock in shared mode before falling back to
+	exclusive mode.
+*/
+
+InternedString
+Intern (
+	std::string_view		in_string)
+{
+	if (in_string.empty()) return InternedString{};
+
+	auto hash = Hash_String (in_string);
+	auto & shard = Get_Shard (hash);
+
+	if (auto entry = shard.Find (in_string, hash); entry) return InternedString {entry};
+
+
+	return InternedString {shard.Insert (in_string, hash)};
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+InternedString
+Intern (
+	const char *			in_string)
+{
+	return Intern (in_string ? std::string_view {in_string} : std::string_view{});
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+InternedString
+Intern (
+	const std::string &		in_string)
+{
+	return Intern (std::string_view {in_string});
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+InternedString
+Intern (
+	const U8String &		in_string)
+{
+	return Intern (in_string.Get_StringView());
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+InternedString
+Find_Interned (
+	std::string_view		in_string)
+{
+	if (in_string.empty()) return InternedString{};
+
+	auto hash = Hash_String (in_string);
+
+
+	return InternedString {Get_Shard (hash).Find (in_string, hash)};
+}
+
+
+/*----------------------------------------------------------------------------*/
+
+LUL_end_v_namespace
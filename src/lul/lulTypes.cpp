@@ -12,17 +12,21 @@
 
 
 //	std
+#include <atomic>
 #include <cassert>
 #include <cstdarg>
 #include <iostream>
 #include <memory>
+#include <new>
 #include <string>
 #include <string_view>
 #include <type_traits>
+#include <utility>
 
 
 //	lul
 #include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulFormat.hpp>
 #include <Lucena-Utilities/lulMemoryTypes.hpp>
 #include <Lucena-Utilities/lulTypes.hpp>
 
@@ -36,13 +40,17 @@ LUL_begin_v_namespace
 	Constants
 */
 
-constexpr int k_max_string_length {4096};
+//	Formatted strings up to this long are produced in a single pass.
+constexpr std::size_t k_probe_string_length {256};
 
 
 /*------------------------------------------------------------------------------
-	Utility code to convert a va_list into a std::string. The new string is
-	created on the stack. If string creation fails, an empty string is
-	returned. This function does not throw.
+	Utility code to convert a va_list into a std::string. The first pass
+	formats into a small buffer on the stack, which is usually all we need;
+	if the result doesn’t fit, that pass still tells us exactly how long it
+	is, so the second pass formats straight into a string of that size. If
+	string creation fails, an empty string is returned. This function does
+	not throw.
 */
 
 std::string
@@ -50,96 +58,334 @@ VA_To_String (
 	const char *			in_format,
 	...)
 {
-	try
-	{
-		std::va_list			argument_list;
-		char					var_args[k_max_string_length];
-		int						chars_written;
+	std::va_list			argument_list;
+	std::va_list			probe_list;
+	char					buffer [k_probe_string_length];
+	std::string				nrv;
 
-		va_start (argument_list, in_format);
+	va_start (argument_list, in_format);
+	va_copy (probe_list, argument_list);
 
-		chars_written = LUL_STDC99::vsnprintf (
-			var_args,
-			k_max_string_length,
-			in_format,
-			argument_list);
+	auto chars_written = LUL_STDC99::vsnprintf (buffer, sizeof (buffer), in_format,
+		probe_list);
 
-		va_end (argument_list);
+	va_end (probe_list);
 
-		if ((chars_written > 0) and (chars_written <= k_max_string_length))
+	try
+	{
+		if (chars_written <= 0)
+		{
+			//	nothing to do; either it’s empty, or formatting failed
+		}
+		else if (static_cast <std::size_t> (chars_written) < sizeof (buffer))
+		{
+			nrv.assign (buffer, chars_written);
+		}
+		else
 		{
-			return std::string (var_args);
+			nrv.resize (chars_written);
+
+			(void) LUL_STDC99::vsnprintf (nrv.data(), nrv.size() + 1, in_format,
+				argument_list);
 		}
 	}
 
 	catch (...)
 	{
-		//	fall through
+		nrv.clear();
 	}
 
+	va_end (argument_list);
 
-	return std::string();
+
+	return nrv;
 }
 
 
 /*------------------------------------------------------------------------------
 	static
+
+	The installed handler is published through an atomic, so that Get never
+	needs a lock; the first thread to install one wins, and anyone else’s
+	in_handler is simply destroyed.
 */
 
 ErrorHandler *
 ErrorHandler::Get (
 	ErrorHandlerUnq			in_handler)
 {
-	static auto s_default_handler = ErrorHandlerUnq{};
-	static auto s_custom_handler = ErrorHandlerUnq {nullptr};
+	static auto s_default_handler = ErrorHandler{};
+	static auto s_custom_handler = std::atomic <ErrorHandler *> {nullptr};
+	static auto s_owned_handler = ErrorHandlerUnq {nullptr};
 
-	if (s_custom_handler)
+	if (auto nrv = s_custom_handler.load (std::memory_order_acquire))
 	{
-		return s_custom_handler.get();
+		return nrv;
 	}
 	
 	if (in_handler)
 	{
-		s_custom_handler = std::move (in_handler);
-		return s_custom_handler.get();
+		ErrorHandler * expected = nullptr;
+
+		if (s_custom_handler.compare_exchange_strong (expected, in_handler.get(),
+			std::memory_order_acq_rel, std::memory_order_acquire))
+		{
+			s_owned_handler = std::move (in_handler);
+			return s_owned_handler.get();
+		}
+
+		return expected;
 	}
 	
-	return s_default_handler.get();
+	return &s_default_handler;
 }
 
 
 /*------------------------------------------------------------------------------
-	This function should be overridden.
+	This function should be overridden. Each Status is written with a single
+	call, so that output from different threads doesn’t get interleaved, and
+	without flushing; std::cerr is unbuffered, anyway.
 */
 
 void
 ErrorHandler::Post (
 	Status					in_status)
 {
-	std::cerr <<
-		"(Domain: " << in_status.Domain() << ", " <<
-		"Code: " << in_status.Code() << "): " << std::endl <<
-		in_status.Message() << std::endl <<
-		in_status.File() << ", " <<
-		in_status.Function() << ": "<<
-		in_status.Line();
+	auto text = Format_String ("(Domain: {}, Code: {}): \n{}\n{}, {}: {}\n",
+		in_status.Domain(), in_status.Code(), in_status.Message(),
+		in_status.File(), in_status.Function(), in_status.Line());
+
+	std::cerr.write (text.data(), static_cast <std::streamsize> (text.size()));
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+ErrorHandler::Flush()
+{
+	std::cerr.flush();
 }
 
 
 /*------------------------------------------------------------------------------
+	StringStorage
+
+	The string wrappers all share the same representation, so they also share
+	this implementation of it. A wrapper is local when _data points at
+	_local, in which case its capacity is k_local_capacity. Otherwise, _data
+	points at a buffer elsewhere: if _heap._release is nullptr, it’s a heap
+	buffer of our own with room for _heap._capacity code units plus the null
+	terminator; if not, it’s a foreign buffer, which is never written to, and
+	which is handed back to _heap._release along with _heap._context when
+	we’re done with it.
 */
 
-struct U8String::Det
+template <typename STRING_T>
+struct StringStorage
 {
-	using char_type = typename U8String::char_type;
+	using char_type = typename STRING_T::char_type;
+	using size_type = typename STRING_T::size_type;
+	using traits_type = std::char_traits <char_type>;
+	using std_string_type = std::basic_string <char_type>;
+
+	static bool
+	Is_Local (
+		const STRING_T &		in_string) noexcept
+	{
+		return in_string._data == in_string._local;
+	}
+
+
+	static bool
+	Is_Foreign (
+		const STRING_T &		in_string) noexcept
+	{
+		return !Is_Local (in_string) and in_string._heap._release;
+	}
+
+
+	static void
+	Init (
+		STRING_T &				io_string) noexcept
+	{
+		io_string._data = io_string._local;
+		io_string._size = 0;
+		io_string._local [0] = char_type{};
+	}
+
+
+	static void
+	Release (
+		STRING_T &				io_string) noexcept
+	{
+		if (Is_Local (io_string)) return;
+
+		if (io_string._heap._release)
+		{
+			io_string._heap._release (io_string._heap._context, io_string._data);
+		}
+		else
+		{
+			delete [] io_string._data;
+		}
+	}
+
+
+	//	in_chars may point into io_string itself; note that if it does, it
+	//	must already fit, unless io_string is foreign.
+	static void
+	Assign (
+		STRING_T &				io_string,
+		const char_type *		in_chars,
+		size_type				in_size)
+	{
+		if (Is_Foreign (io_string))
+		{
+			auto heap = io_string._heap;
+			auto data = io_string._data;
+
+			if (in_size > STRING_T::k_local_capacity)
+			{
+				Allocate (io_string, in_chars, in_size);
+			}
+			else
+			{
+				traits_type::copy (io_string._local, in_chars, in_size);
+				io_string._data = io_string._local;
+			}
+
+			heap._release (heap._context, data);
+		}
+		else if (in_size > (Is_Local (io_string) ?
+			STRING_T::k_local_capacity : io_string._heap._capacity))
+		{
+			auto data = io_string._data;
+			auto local = Is_Local (io_string);
+
+			Allocate (io_string, in_chars, in_size);
+
+			if (!local) delete [] data;
+		}
+		else
+		{
+			traits_type::move (io_string._data, in_chars, in_size);
+		}
+
+		io_string._data [in_size] = char_type{};
+		io_string._size = in_size;
+	}
+
+
+	static void
+	Assign (
+		STRING_T &				io_string,
+		const char_type *		in_chars)
+	{
+		Assign (io_string, in_chars, in_chars ? traits_type::length (in_chars) : 0);
+	}
+
+
+	//	Point io_string at a new heap buffer holding a copy of in_chars; the
+	//	caller is responsible for whatever io_string held before, and for the
+	//	null terminator.
+	static void
+	Allocate (
+		STRING_T &				io_string,
+		const char_type *		in_chars,
+		size_type				in_size)
+	{
+		auto buffer = new char_type [in_size + 1];
+
+		traits_type::copy (buffer, in_chars, in_size);
+
+		io_string._data = buffer;
+		io_string._heap._release = nullptr;
+		io_string._heap._capacity = in_size;
+	}
+
+
+	//	io_string must not hold a buffer; in_release is always called
+	//	eventually, right away if the string is short enough to copy.
+	static void
+	Adopt (
+		STRING_T &				io_string,
+		char_type *				in_data,
+		size_type				in_size,
+		typename STRING_T::Releaser	in_release,
+		void *					in_context) noexcept
+	{
+		if (in_size > STRING_T::k_local_capacity)
+		{
+			io_string._data = in_data;
+			io_string._size = in_size;
+			io_string._heap._release = in_release;
+			io_string._heap._context = in_context;
+		}
+		else
+		{
+			Init (io_string);
+			traits_type::copy (io_string._local, in_data, in_size);
+			io_string._local [in_size] = char_type{};
+			io_string._size = in_size;
+
+			in_release (in_context, in_data);
+		}
+	}
+
+
+	//	io_string must not hold a buffer. Short strings are copied; longer
+	//	ones are moved into a std::basic_string of our own, whose buffer we
+	//	then adopt, so that the characters themselves are never copied.
+	static void
+	Adopt (
+		STRING_T &				io_string,
+		std_string_type &&		io_other)
+	{
+		if (io_other.size() <= STRING_T::k_local_capacity)
+		{
+			Init (io_string);
+			Assign (io_string, io_other.data(), io_other.size());
+		}
+		else
+		{
+			auto holder = new std_string_type {std::move (io_other)};
+
+			Adopt (io_string, holder->data(), holder->size(), &Release_Std_String, holder);
+		}
+	}
+
+
+	static void
+	Release_Std_String (
+		void *					in_context,
+		char_type *) noexcept
+	{
+		delete static_cast <std_string_type *> (in_context);
+	}
+
 
-	std::string _s;
+	//	io_string must not hold a buffer; io_other is left empty.
+	static void
+	Take (
+		STRING_T &				io_string,
+		STRING_T &				io_other) noexcept
+	{
+		if (Is_Local (io_other))
+		{
+			io_string._data = io_string._local;
+			traits_type::copy (io_string._local, io_other._local, io_other._size + 1);
+		}
+		else
+		{
+			io_string._data = io_other._data;
+			io_string._heap = io_other._heap;
+		}
 
-	Det (const char_type * s) : _s {s} { }
-	Det (const char_type * s, size_type n) : _s {s, n} { }
-	Det (const std::string & s) : _s {s} { }
-	Det (std::string && s) : _s {std::move (s)} { }
-	Det (std::string_view s) : _s {s} { }
+		io_string._size = io_other._size;
+		Init (io_other);
+	}
 };
 
 
@@ -148,8 +394,9 @@ struct U8String::Det
 
 U8String::U8String (
 	const U8String &		a)
-	:	_d {std::make_unique <U8String::Det> (a._d->_s)}
 {
+	StringStorage <U8String>::Init (*this);
+	StringStorage <U8String>::Assign (*this, a._data, a._size);
 }
 
 
@@ -157,9 +404,9 @@ U8String::U8String (
 */
 
 U8String::U8String (
-	U8String &&				a)
-	:	_d {std::move (a._d)}
+	U8String &&				a) noexcept
 {
+	StringStorage <U8String>::Take (*this, a);
 }
 
 
@@ -168,8 +415,9 @@ U8String::U8String (
 
 U8String::U8String (
 	const char_type *		s)
-	:	_d {std::make_unique <U8String::Det> (s)}
 {
+	StringStorage <U8String>::Init (*this);
+	StringStorage <U8String>::Assign (*this, s);
 }
 
 
@@ -179,8 +427,22 @@ U8String::U8String (
 U8String::U8String (
 	const char_type *		s,
 	size_type				n)
-	:	_d {std::make_unique <U8String::Det> (s, n)}
 {
+	StringStorage <U8String>::Init (*this);
+	StringStorage <U8String>::Assign (*this, s, n);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+U8String::U8String (
+	char_type *				s,
+	size_type				n,
+	Releaser				in_release,
+	void *					in_context) noexcept
+{
+	StringStorage <U8String>::Adopt (*this, s, n, in_release, in_context);
 }
 
 
@@ -189,8 +451,9 @@ U8String::U8String (
 
 U8String::U8String (
 	const std::string &		s)
-	:	_d {std::make_unique <Det> (s)}
 {
+	StringStorage <U8String>::Init (*this);
+	StringStorage <U8String>::Assign (*this, s.data(), s.size());
 }
 
 
@@ -199,8 +462,8 @@ U8String::U8String (
 
 U8String::U8String (
 	std::string &&			s)
-	:	_d {std::make_unique <Det> (std::move (s))}
 {
+	StringStorage <U8String>::Adopt (*this, std::move (s));
 }
 
 
@@ -209,8 +472,9 @@ U8String::U8String (
 
 U8String::U8String (
 	std::string_view		s)
-	:	_d {std::make_unique <Det> (s)}
 {
+	StringStorage <U8String>::Init (*this);
+	StringStorage <U8String>::Assign (*this, s.data(), s.size());
 }
 
 
@@ -219,6 +483,7 @@ U8String::U8String (
 
 U8String::~U8String() noexcept
 {
+	StringStorage <U8String>::Release (*this);
 }
 
 
@@ -229,7 +494,7 @@ U8String &
 U8String::operator = (
 	const U8String &		a)
 {
-	_d = std::make_unique <U8String::Det> (a._d->_s);
+	StringStorage <U8String>::Assign (*this, a._data, a._size);
 	return *this;
 }
 
@@ -239,9 +504,14 @@ U8String::operator = (
 
 U8String &
 U8String::operator = (
-	U8String &&				a)
+	U8String &&				a) noexcept
 {
-	_d = std::move (a._d);
+	if (this != &a)
+	{
+		StringStorage <U8String>::Release (*this);
+		StringStorage <U8String>::Take (*this, a);
+	}
+
 	return *this;
 }
 
@@ -253,7 +523,7 @@ U8String &
 U8String::operator = (
 	std::string_view		s)
 {
-	_d = std::make_unique <U8String::Det> (s);
+	StringStorage <U8String>::Assign (*this, s.data(), s.size());
 	return *this;
 }
 
@@ -265,7 +535,7 @@ U8String &
 U8String::operator = (
 	const std::string &		s)
 {
-	_d = std::make_unique <U8String::Det> (s);
+	StringStorage <U8String>::Assign (*this, s.data(), s.size());
 	return *this;
 }
 
@@ -277,7 +547,11 @@ U8String &
 U8String::operator = (
 	std::string &&			s)
 {
-	_d = std::make_unique <U8String::Det> (std::move (s));
+	auto temp = U8String {std::move (s)};
+
+	StringStorage <U8String>::Release (*this);
+	StringStorage <U8String>::Take (*this, temp);
+
 	return *this;
 }
 
@@ -289,7 +563,7 @@ U8String &
 U8String::operator = (
 	const char_type *		s)
 {
-	_d = std::make_unique <U8String::Det> (s);
+	StringStorage <U8String>::Assign (*this, s);
 	return *this;
 }
 
@@ -297,47 +571,21 @@ U8String::operator = (
 /*------------------------------------------------------------------------------
 */
 
-std::string_view
-U8String::Get_StringView() const
-{
-	return std::string_view {_d->_s};
-}
-
-
-/*------------------------------------------------------------------------------
-*/
-
-auto
-U8String::c_str() const -> const char_type *
+U16String::U16String (
+	const U16String &		a)
 {
-	return _d->_s.c_str();
+	StringStorage <U16String>::Init (*this);
+	StringStorage <U16String>::Assign (*this, a._data, a._size);
 }
 
 
-/*------------------------------------------------------------------------------
-*/
-
-struct U16String::Det
-{
-	using char_type = typename U16String::char_type;
-
-	std::u16string _s;
-
-	Det (const char_type * s) : _s {s} { }
-	Det (const char_type * s, size_type n) : _s {s, n} { }
-	Det (const std::u16string & s) : _s {s} { }
-	Det (std::u16string && s) : _s {std::move (s)} { }
-	Det (std::u16string_view s) : _s {s} { }
-};
-
-
 /*------------------------------------------------------------------------------
 */
 
 U16String::U16String (
-	const U16String &		a)
-	:	_d {std::make_unique <U16String::Det> (a._d->_s)}
+	U16String &&			a) noexcept
 {
+	StringStorage <U16String>::Take (*this, a);
 }
 
 
@@ -345,9 +593,10 @@ U16String::U16String (
 */
 
 U16String::U16String (
-	U16String &&			a)
-	:	_d {std::move (a._d)}
+	const char_type *		s)
 {
+	StringStorage <U16String>::Init (*this);
+	StringStorage <U16String>::Assign (*this, s);
 }
 
 
@@ -355,9 +604,11 @@ U16String::U16String (
 */
 
 U16String::U16String (
-	const char_type *		s)
-	:	_d {std::make_unique <U16String::Det> (s)}
+	const char_type *		s,
+	size_type				n)
 {
+	StringStorage <U16String>::Init (*this);
+	StringStorage <U16String>::Assign (*this, s, n);
 }
 
 
@@ -365,10 +616,12 @@ U16String::U16String (
 */
 
 U16String::U16String (
-	const char_type *		s,
-	size_type				n)
-	:	_d {std::make_unique <U16String::Det> (s, n)}
+	char_type *				s,
+	size_type				n,
+	Releaser				in_release,
+	void *					in_context) noexcept
 {
+	StringStorage <U16String>::Adopt (*this, s, n, in_release, in_context);
 }
 
 
@@ -377,8 +630,9 @@ U16String::U16String (
 
 U16String::U16String (
 	const std::u16string &	s)
-	:	_d {std::make_unique <Det> (s)}
 {
+	StringStorage <U16String>::Init (*this);
+	StringStorage <U16String>::Assign (*this, s.data(), s.size());
 }
 
 
@@ -387,8 +641,8 @@ U16String::U16String (
 
 U16String::U16String (
 	std::u16string &&		s)
-	:	_d {std::make_unique <Det> (std::move (s))}
 {
+	StringStorage <U16String>::Adopt (*this, std::move (s));
 }
 
 
@@ -397,8 +651,9 @@ U16String::U16String (
 
 U16String::U16String (
 	std::u16string_view		s)
-	:	_d {std::make_unique <Det> (s)}
 {
+	StringStorage <U16String>::Init (*this);
+	StringStorage <U16String>::Assign (*this, s.data(), s.size());
 }
 
 
@@ -407,6 +662,7 @@ U16String::U16String (
 
 U16String::~U16String() noexcept
 {
+	StringStorage <U16String>::Release (*this);
 }
 
 
@@ -417,7 +673,7 @@ U16String &
 U16String::operator = (
 	const U16String &		a)
 {
-	_d = std::make_unique <U16String::Det> (a._d->_s);
+	StringStorage <U16String>::Assign (*this, a._data, a._size);
 	return *this;
 }
 
@@ -427,9 +683,14 @@ U16String::operator = (
 
 U16String &
 U16String::operator = (
-	U16String &&			a)
+	U16String &&			a) noexcept
 {
-	_d = std::move (a._d);
+	if (this != &a)
+	{
+		StringStorage <U16String>::Release (*this);
+		StringStorage <U16String>::Take (*this, a);
+	}
+
 	return *this;
 }
 
@@ -441,7 +702,7 @@ U16String &
 U16String::operator = (
 	std::u16string_view		s)
 {
-	_d = std::make_unique <U16String::Det> (s);
+	StringStorage <U16String>::Assign (*this, s.data(), s.size());
 	return *this;
 }
 
@@ -453,7 +714,7 @@ U16String &
 U16String::operator = (
 	const std::u16string &	s)
 {
-	_d = std::make_unique <U16String::Det> (s);
+	StringStorage <U16String>::Assign (*this, s.data(), s.size());
 	return *this;
 }
 
@@ -465,7 +726,11 @@ U16String &
 U16String::operator = (
 	std::u16string &&		s)
 {
-	_d = std::make_unique <U16String::Det> (std::move (s));
+	auto temp = U16String {std::move (s)};
+
+	StringStorage <U16String>::Release (*this);
+	StringStorage <U16String>::Take (*this, temp);
+
 	return *this;
 }
 
@@ -477,7 +742,7 @@ U16String &
 U16String::operator = (
 	const char_type *		s)
 {
-	_d = std::make_unique <U16String::Det> (s);
+	StringStorage <U16String>::Assign (*this, s);
 	return *this;
 }
 
@@ -485,47 +750,21 @@ U16String::operator = (
 /*------------------------------------------------------------------------------
 */
 
-std::u16string_view
-U16String::Get_StringView() const
-{
-	return std::u16string_view {_d->_s};
-}
-
-
-/*------------------------------------------------------------------------------
-*/
-
-auto
-U16String::c_str() const -> const char_type *
+U32String::U32String (
+	const U32String &		a)
 {
-	return _d->_s.c_str();
+	StringStorage <U32String>::Init (*this);
+	StringStorage <U32String>::Assign (*this, a._data, a._size);
 }
 
 
-/*------------------------------------------------------------------------------
-*/
-
-struct U32String::Det
-{
-	using char_type = typename U32String::char_type;
-
-	std::u32string _s;
-
-	Det (const char_type * s) : _s {s} { }
-	Det (const char_type * s, size_type n) : _s {s, n} { }
-	Det (const std::u32string & s) : _s {s} { }
-	Det (std::u32string && s) : _s {std::move (s)} { }
-	Det (std::u32string_view s) : _s {s} { }
-};
-
-
 /*------------------------------------------------------------------------------
 */
 
 U32String::U32String (
-	const U32String &		a)
-	:	_d {std::make_unique <U32String::Det> (a._d->_s)}
+	U32String &&			a) noexcept
 {
+	StringStorage <U32String>::Take (*this, a);
 }
 
 
@@ -533,9 +772,10 @@ U32String::U32String (
 */
 
 U32String::U32String (
-	U32String &&				a)
-	:	_d {std::move (a._d)}
+	const char_type *		s)
 {
+	StringStorage <U32String>::Init (*this);
+	StringStorage <U32String>::Assign (*this, s);
 }
 
 
@@ -543,9 +783,11 @@ U32String::U32String (
 */
 
 U32String::U32String (
-	const char_type *		s)
-	:	_d {std::make_unique <U32String::Det> (s)}
+	const char_type *		s,
+	size_type				n)
 {
+	StringStorage <U32String>::Init (*this);
+	StringStorage <U32String>::Assign (*this, s, n);
 }
 
 
@@ -553,10 +795,12 @@ U32String::U32String (
 */
 
 U32String::U32String (
-	const char_type *		s,
-	size_type				n)
-	:	_d {std::make_unique <U32String::Det> (s, n)}
+	char_type *				s,
+	size_type				n,
+	Releaser				in_release,
+	void *					in_context) noexcept
 {
+	StringStorage <U32String>::Adopt (*this, s, n, in_release, in_context);
 }
 
 
@@ -565,8 +809,9 @@ U32String::U32String (
 
 U32String::U32String (
 	const std::u32string &	s)
-	:	_d {std::make_unique <Det> (s)}
 {
+	StringStorage <U32String>::Init (*this);
+	StringStorage <U32String>::Assign (*this, s.data(), s.size());
 }
 
 
@@ -575,8 +820,8 @@ U32String::U32String (
 
 U32String::U32String (
 	std::u32string &&		s)
-	:	_d {std::make_unique <Det> (std::move (s))}
 {
+	StringStorage <U32String>::Adopt (*this, std::move (s));
 }
 
 
@@ -585,8 +830,9 @@ U32String::U32String (
 
 U32String::U32String (
 	std::u32string_view		s)
-	:	_d {std::make_unique <Det> (s)}
 {
+	StringStorage <U32String>::Init (*this);
+	StringStorage <U32String>::Assign (*this, s.data(), s.size());
 }
 
 
@@ -595,6 +841,7 @@ U32String::U32String (
 
 U32String::~U32String() noexcept
 {
+	StringStorage <U32String>::Release (*this);
 }
 
 
@@ -605,7 +852,7 @@ U32String &
 U32String::operator = (
 	const U32String &		a)
 {
-	_d = std::make_unique <U32String::Det> (a._d->_s);
+	StringStorage <U32String>::Assign (*this, a._data, a._size);
 	return *this;
 }
 
@@ -615,9 +862,14 @@ U32String::operator = (
 
 U32String &
 U32String::operator = (
-	U32String &&				a)
+	U32String &&			a) noexcept
 {
-	_d = std::move (a._d);
+	if (this != &a)
+	{
+		StringStorage <U32String>::Release (*this);
+		StringStorage <U32String>::Take (*this, a);
+	}
+
 	return *this;
 }
 
@@ -629,7 +881,7 @@ U32String &
 U32String::operator = (
 	std::u32string_view		s)
 {
-	_d = std::make_unique <U32String::Det> (s);
+	StringStorage <U32String>::Assign (*this, s.data(), s.size());
 	return *this;
 }
 
@@ -641,7 +893,7 @@ U32String &
 U32String::operator = (
 	const std::u32string &	s)
 {
-	_d = std::make_unique <U32String::Det> (s);
+	StringStorage <U32String>::Assign (*this, s.data(), s.size());
 	return *this;
 }
 
@@ -653,7 +905,11 @@ U32String &
 U32String::operator = (
 	std::u32string &&		s)
 {
-	_d = std::make_unique <U32String::Det> (std::move (s));
+	auto temp = U32String {std::move (s)};
+
+	StringStorage <U32String>::Release (*this);
+	StringStorage <U32String>::Take (*this, temp);
+
 	return *this;
 }
 
@@ -665,7 +921,7 @@ U32String &
 U32String::operator = (
 	const char_type *		s)
 {
-	_d = std::make_unique <U32String::Det> (s);
+	StringStorage <U32String>::Assign (*this, s);
 	return *this;
 }
 
@@ -673,47 +929,21 @@ U32String::operator = (
 /*------------------------------------------------------------------------------
 */
 
-std::u32string_view
-U32String::Get_StringView() const
-{
-	return std::u32string_view {_d->_s};
-}
-
-
-/*------------------------------------------------------------------------------
-*/
-
-auto
-U32String::c_str() const -> const char_type *
+WString::WString (
+	const WString &			a)
 {
-	return _d->_s.c_str();
+	StringStorage <WString>::Init (*this);
+	StringStorage <WString>::Assign (*this, a._data, a._size);
 }
 
 
-/*------------------------------------------------------------------------------
-*/
-
-struct WString::Det
-{
-	using char_type = typename WString::char_type;
-
-	std::wstring _s;
-
-	Det (const char_type * s) : _s {s} { }
-	Det (const char_type * s, size_type n) : _s {s, n} { }
-	Det (const std::wstring & s) : _s {s} { }
-	Det (std::wstring && s) : _s {std::move (s)} { }
-	Det (std::wstring_view s) : _s {s} { }
-};
-
-
 /*------------------------------------------------------------------------------
 */
 
 WString::WString (
-	const WString &			a)
-	:	_d {std::make_unique <WString::Det> (a._d->_s)}
+	WString &&				a) noexcept
 {
+	StringStorage <WString>::Take (*this, a);
 }
 
 
@@ -721,9 +951,10 @@ WString::WString (
 */
 
 WString::WString (
-	WString &&				a)
-	:	_d {std::move (a._d)}
+	const char_type *		s)
 {
+	StringStorage <WString>::Init (*this);
+	StringStorage <WString>::Assign (*this, s);
 }
 
 
@@ -731,9 +962,11 @@ WString::WString (
 */
 
 WString::WString (
-	const char_type *		s)
-	:	_d {std::make_unique <WString::Det> (s)}
+	const char_type *		s,
+	size_type				n)
 {
+	StringStorage <WString>::Init (*this);
+	StringStorage <WString>::Assign (*this, s, n);
 }
 
 
@@ -741,10 +974,12 @@ WString::WString (
 */
 
 WString::WString (
-	const char_type *		s,
-	size_type				n)
-	:	_d {std::make_unique <WString::Det> (s, n)}
+	char_type *				s,
+	size_type				n,
+	Releaser				in_release,
+	void *					in_context) noexcept
 {
+	StringStorage <WString>::Adopt (*this, s, n, in_release, in_context);
 }
 
 
@@ -753,8 +988,9 @@ WString::WString (
 
 WString::WString (
 	const std::wstring &	s)
-	:	_d {std::make_unique <Det> (s)}
 {
+	StringStorage <WString>::Init (*this);
+	StringStorage <WString>::Assign (*this, s.data(), s.size());
 }
 
 
@@ -763,8 +999,8 @@ WString::WString (
 
 WString::WString (
 	std::wstring &&			s)
-	:	_d {std::make_unique <Det> (std::move (s))}
 {
+	StringStorage <WString>::Adopt (*this, std::move (s));
 }
 
 
@@ -773,8 +1009,9 @@ WString::WString (
 
 WString::WString (
 	std::wstring_view		s)
-	:	_d {std::make_unique <Det> (s)}
 {
+	StringStorage <WString>::Init (*this);
+	StringStorage <WString>::Assign (*this, s.data(), s.size());
 }
 
 
@@ -783,6 +1020,7 @@ WString::WString (
 
 WString::~WString() noexcept
 {
+	StringStorage <WString>::Release (*this);
 }
 
 
@@ -793,7 +1031,7 @@ WString &
 WString::operator = (
 	const WString &			a)
 {
-	_d = std::make_unique <WString::Det> (a._d->_s);
+	StringStorage <WString>::Assign (*this, a._data, a._size);
 	return *this;
 }
 
@@ -803,9 +1041,14 @@ WString::operator = (
 
 WString &
 WString::operator = (
-	WString &&				a)
+	WString &&				a) noexcept
 {
-	_d = std::move (a._d);
+	if (this != &a)
+	{
+		StringStorage <WString>::Release (*this);
+		StringStorage <WString>::Take (*this, a);
+	}
+
 	return *this;
 }
 
@@ -817,7 +1060,7 @@ WString &
 WString::operator = (
 	std::wstring_view		s)
 {
-	_d = std::make_unique <WString::Det> (s);
+	StringStorage <WString>::Assign (*this, s.data(), s.size());
 	return *this;
 }
 
@@ -829,7 +1072,7 @@ WString &
 WString::operator = (
 	const std::wstring &	s)
 {
-	_d = std::make_unique <WString::Det> (s);
+	StringStorage <WString>::Assign (*this, s.data(), s.size());
 	return *this;
 }
 
@@ -841,7 +1084,11 @@ WString &
 WString::operator = (
 	std::wstring &&			s)
 {
-	_d = std::make_unique <WString::Det> (std::move (s));
+	auto temp = WString {std::move (s)};
+
+	StringStorage <WString>::Release (*this);
+	StringStorage <WString>::Take (*this, temp);
+
 	return *this;
 }
 
@@ -853,156 +1100,671 @@ WString &
 WString::operator = (
 	const char_type *		s)
 {
-	_d = std::make_unique <WString::Det> (s);
+	StringStorage <WString>::Assign (*this, s);
 	return *this;
 }
 
 
 /*------------------------------------------------------------------------------
-*/
-
-std::wstring_view
-WString::Get_StringView() const
-{
-	return std::wstring_view {_d->_s};
-}
+	SharedStringStorage
 
+	The shared strings all share the same representation, too. The header is
+	followed immediately by the null-terminated string, all in one block; a
+	null _header means the empty string, in which case _data points at a
+	static null terminator.
 
-/*------------------------------------------------------------------------------
+	As with std::shared_ptr, adding a reference can be relaxed, since the
+	caller must already hold one, but dropping one has to synchronize with
+	every other release so that the last one out sees all prior accesses
+	before freeing the block.
 */
 
-auto
-WString::c_str() const -> const char_type *
+struct SharedStringHeader
 {
-	return _d->_s.c_str();
-}
-
+	std::atomic <std::size_t>	_count;
+};
 
-/*------------------------------------------------------------------------------
-	Status::MessageBlock
-*/
 
-struct Status::MessageBlock
+template <typename STRING_T>
+struct SharedStringStorage
 {
-	std::string				_message;
-	const char *			_file;
-	const char *			_function;
-	StringGroup				_domain;
-	StatusCode				_code;
-	int						_line;
-	
-	StatusUnq				_next {};
-
-
-	inline					MessageBlock (
-								StringGroup				in_domain,
-								StatusCode				in_code,
-								const std::string &		in_message,
-								const char *			in_file,
-								const char *			in_function,
-								int						in_line)
-								:	_message {in_message},
-									_file {in_file},
-									_function {in_function},
-									_domain {in_domain},
-									_code {in_code},
-									_line {in_line}
-							{	}
-
-							MessageBlock (
-								const MessageBlock &	in_mb)
-								:	_message {in_mb._message},
-									_file {in_mb._file},
-									_function {in_mb._function},
-									_domain {in_mb._domain},
-									_code {in_mb._code},
-									_line {in_mb._line}
-							{
-								_next = in_mb._next ?
-									std::make_unique <Status> (*in_mb._next)
-										: StatusUnq{};
-							}
-				
-							MessageBlock (MessageBlock &&) noexcept = default;
-
-							~MessageBlock() = default;
-
-	MessageBlock &			operator = (
-								const MessageBlock &	in_mb)
-							{
-								_message = in_mb._message;
-								_file = in_mb._file;
-								_function = in_mb._function;
-								_domain = in_mb._domain;
-								_code = in_mb._code;
-								_line = in_mb._line;
-								_next = in_mb._next ?
-									std::make_unique <Status> (*in_mb._next)
-										: StatusUnq{};
-								
-								return *this;
-							}
-	
-	MessageBlock &			operator = (MessageBlock &&) noexcept = default;
-};
+	using char_type = typename STRING_T::char_type;
+	using size_type = typename STRING_T::size_type;
+	using traits_type = std::char_traits <char_type>;
 
+	static_assert (alignof (SharedStringHeader) >= alignof (char_type));
 
-/*------------------------------------------------------------------------------
-	Effectively defaulted; this must be here since the destructor definition
-	must be here.
-*/
+	static void
+	Init (
+		STRING_T &				io_string) noexcept
+	{
+		static const char_type s_empty {};
 
-Status::Status() noexcept
-{
-}
+		io_string._header = nullptr;
+		io_string._data = &s_empty;
+		io_string._size = 0;
+	}
 
 
-/*------------------------------------------------------------------------------
-	Perform a recursive deep-copy.
-*/
+	//	io_string must be empty.
+	static void
+	Create (
+		STRING_T &				io_string,
+		const char_type *		in_chars,
+		size_type				in_size)
+	{
+		if (0 == in_size) return;
 
-Status::Status (
-	const Status &			other) 
-	:	_det {other._det ?
-			std::make_unique <MessageBlock> (*other._det) :
-				std::unique_ptr <MessageBlock>{}}
-{
-}
+		auto block = static_cast <char *> (::operator new (
+			sizeof (SharedStringHeader) + ((in_size + 1) * sizeof (char_type))));
+		auto header = new (block) SharedStringHeader {{1}};
+		auto data = reinterpret_cast <char_type *> (block + sizeof (SharedStringHeader));
 
+		traits_type::copy (data, in_chars, in_size);
+		data [in_size] = char_type{};
 
-/*------------------------------------------------------------------------------
-	other._det will be automatically reset.
-*/
+		io_string._header = header;
+		io_string._data = data;
+		io_string._size = in_size;
+	}
 
-Status::Status (
-	Status &&				other) noexcept
-	:	_det {std::move (other._det)}
-{
-}
 
+	static void
+	Create (
+		STRING_T &				io_string,
+		const char_type *		in_chars)
+	{
+		Create (io_string, in_chars, in_chars ? traits_type::length (in_chars) : 0);
+	}
 
-/*------------------------------------------------------------------------------
-*/
 
-Status::Status (
-	StringGroup				in_domain,
-	StatusCode				in_code)
-	:	_det {std::make_unique <MessageBlock> (in_domain, in_code, "",
-			"", "", 0)}
-{
-}
+	static void
+	Retain (
+		const STRING_T &		in_string) noexcept
+	{
+		if (in_string._header)
+		{
+			in_string._header->_count.fetch_add (1, std::memory_order_relaxed);
+		}
+	}
+
+
+	static void
+	Release (
+		STRING_T &				io_string) noexcept
+	{
+		auto header = io_string._header;
+
+		if (header and (1 == header->_count.fetch_sub (1, std::memory_order_acq_rel)))
+		{
+			header->~SharedStringHeader();
+			::operator delete (header);
+		}
+	}
+
+
+	static void
+	Share (
+		STRING_T &				io_string,
+		const STRING_T &		in_other) noexcept
+	{
+		Retain (in_other);
+
+		io_string._header = in_other._header;
+		io_string._data = in_other._data;
+		io_string._size = in_other._size;
+	}
+
+
+	//	io_other is left empty.
+	static void
+	Take (
+		STRING_T &				io_string,
+		STRING_T &				io_other) noexcept
+	{
+		io_string._header = io_other._header;
+		io_string._data = io_other._data;
+		io_string._size = io_other._size;
+
+		Init (io_other);
+	}
+};
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU8String::SharedU8String() noexcept
+{
+	SharedStringStorage <SharedU8String>::Init (*this);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU8String::SharedU8String (
+	const SharedU8String &	a) noexcept
+{
+	SharedStringStorage <SharedU8String>::Share (*this, a);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU8String::SharedU8String (
+	SharedU8String &&		a) noexcept
+{
+	SharedStringStorage <SharedU8String>::Take (*this, a);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU8String::SharedU8String (
+	const char_type *		s)
+{
+	SharedStringStorage <SharedU8String>::Init (*this);
+	SharedStringStorage <SharedU8String>::Create (*this, s);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU8String::SharedU8String (
+	const char_type *		s,
+	size_type				n)
+{
+	SharedStringStorage <SharedU8String>::Init (*this);
+	SharedStringStorage <SharedU8String>::Create (*this, s, n);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU8String::SharedU8String (
+	const std::string &		s)
+{
+	SharedStringStorage <SharedU8String>::Init (*this);
+	SharedStringStorage <SharedU8String>::Create (*this, s.data(), s.size());
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU8String::SharedU8String (
+	std::string_view		s)
+{
+	SharedStringStorage <SharedU8String>::Init (*this);
+	SharedStringStorage <SharedU8String>::Create (*this, s.data(), s.size());
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU8String::SharedU8String (
+	const U8String &		s)
+{
+	auto view = s.Get_StringView();
+
+	SharedStringStorage <SharedU8String>::Init (*this);
+	SharedStringStorage <SharedU8String>::Create (*this, view.data(), view.size());
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU8String::~SharedU8String() noexcept
+{
+	SharedStringStorage <SharedU8String>::Release (*this);
+}
+
+
+/*------------------------------------------------------------------------------
+	Retaining a first makes self-assignment safe.
+*/
+
+SharedU8String &
+SharedU8String::operator = (
+	const SharedU8String &	a) noexcept
+{
+	SharedStringStorage <SharedU8String>::Retain (a);
+	SharedStringStorage <SharedU8String>::Release (*this);
+
+	_header = a._header;
+	_data = a._data;
+	_size = a._size;
+
+	return *this;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU8String &
+SharedU8String::operator = (
+	SharedU8String &&		a) noexcept
+{
+	if (this != &a)
+	{
+		SharedStringStorage <SharedU8String>::Release (*this);
+		SharedStringStorage <SharedU8String>::Take (*this, a);
+	}
+
+	return *this;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU8String::operator U8String() const
+{
+	return U8String {_data, _size};
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU16String::SharedU16String() noexcept
+{
+	SharedStringStorage <SharedU16String>::Init (*this);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU16String::SharedU16String (
+	const SharedU16String &	a) noexcept
+{
+	SharedStringStorage <SharedU16String>::Share (*this, a);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU16String::SharedU16String (
+	SharedU16String &&		a) noexcept
+{
+	SharedStringStorage <SharedU16String>::Take (*this, a);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU16String::SharedU16String (
+	const char_type *		s)
+{
+	SharedStringStorage <SharedU16String>::Init (*this);
+	SharedStringStorage <SharedU16String>::Create (*this, s);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU16String::SharedU16String (
+	const char_type *		s,
+	size_type				n)
+{
+	SharedStringStorage <SharedU16String>::Init (*this);
+	SharedStringStorage <SharedU16String>::Create (*this, s, n);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU16String::SharedU16String (
+	const std::u16string &	s)
+{
+	SharedStringStorage <SharedU16String>::Init (*this);
+	SharedStringStorage <SharedU16String>::Create (*this, s.data(), s.size());
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU16String::SharedU16String (
+	std::u16string_view		s)
+{
+	SharedStringStorage <SharedU16String>::Init (*this);
+	SharedStringStorage <SharedU16String>::Create (*this, s.data(), s.size());
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU16String::SharedU16String (
+	const U16String &		s)
+{
+	auto view = s.Get_StringView();
+
+	SharedStringStorage <SharedU16String>::Init (*this);
+	SharedStringStorage <SharedU16String>::Create (*this, view.data(), view.size());
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU16String::~SharedU16String() noexcept
+{
+	SharedStringStorage <SharedU16String>::Release (*this);
+}
+
+
+/*------------------------------------------------------------------------------
+	Retaining a first makes self-assignment safe.
+*/
+
+SharedU16String &
+SharedU16String::operator = (
+	const SharedU16String &	a) noexcept
+{
+	SharedStringStorage <SharedU16String>::Retain (a);
+	SharedStringStorage <SharedU16String>::Release (*this);
+
+	_header = a._header;
+	_data = a._data;
+	_size = a._size;
+
+	return *this;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU16String &
+SharedU16String::operator = (
+	SharedU16String &&		a) noexcept
+{
+	if (this != &a)
+	{
+		SharedStringStorage <SharedU16String>::Release (*this);
+		SharedStringStorage <SharedU16String>::Take (*this, a);
+	}
+
+	return *this;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU16String::operator U16String() const
+{
+	return U16String {_data, _size};
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU32String::SharedU32String() noexcept
+{
+	SharedStringStorage <SharedU32String>::Init (*this);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU32String::SharedU32String (
+	const SharedU32String &	a) noexcept
+{
+	SharedStringStorage <SharedU32String>::Share (*this, a);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU32String::SharedU32String (
+	SharedU32String &&		a) noexcept
+{
+	SharedStringStorage <SharedU32String>::Take (*this, a);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU32String::SharedU32String (
+	const char_type *		s)
+{
+	SharedStringStorage <SharedU32String>::Init (*this);
+	SharedStringStorage <SharedU32String>::Create (*this, s);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU32String::SharedU32String (
+	const char_type *		s,
+	size_type				n)
+{
+	SharedStringStorage <SharedU32String>::Init (*this);
+	SharedStringStorage <SharedU32String>::Create (*this, s, n);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU32String::SharedU32String (
+	const std::u32string &	s)
+{
+	SharedStringStorage <SharedU32String>::Init (*this);
+	SharedStringStorage <SharedU32String>::Create (*this, s.data(), s.size());
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU32String::SharedU32String (
+	std::u32string_view		s)
+{
+	SharedStringStorage <SharedU32String>::Init (*this);
+	SharedStringStorage <SharedU32String>::Create (*this, s.data(), s.size());
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU32String::SharedU32String (
+	const U32String &		s)
+{
+	auto view = s.Get_StringView();
+
+	SharedStringStorage <SharedU32String>::Init (*this);
+	SharedStringStorage <SharedU32String>::Create (*this, view.data(), view.size());
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU32String::~SharedU32String() noexcept
+{
+	SharedStringStorage <SharedU32String>::Release (*this);
+}
+
+
+/*------------------------------------------------------------------------------
+	Retaining a first makes self-assignment safe.
+*/
+
+SharedU32String &
+SharedU32String::operator = (
+	const SharedU32String &	a) noexcept
+{
+	SharedStringStorage <SharedU32String>::Retain (a);
+	SharedStringStorage <SharedU32String>::Release (*this);
+
+	_header = a._header;
+	_data = a._data;
+	_size = a._size;
+
+	return *this;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU32String &
+SharedU32String::operator = (
+	SharedU32String &&		a) noexcept
+{
+	if (this != &a)
+	{
+		SharedStringStorage <SharedU32String>::Release (*this);
+		SharedStringStorage <SharedU32String>::Take (*this, a);
+	}
+
+	return *this;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+SharedU32String::operator U32String() const
+{
+	return U32String {_data, _size};
+}
+
+
+/*------------------------------------------------------------------------------
+	Status::MessageBlock
+
+	This only holds what can’t be stored in the Status itself: a message that
+	had to be copied, and the rest of the chain. A MessageBlock is shared by
+	every copy of the Status that created it, and may only be modified while
+	_count is 1; see Status::Unshare.
+*/
+
+struct Status::MessageBlock
+{
+	std::atomic <std::size_t>	_count {1};
+	std::string				_message {};
+	Status					_next {};
+
+
+	static MessageBlock *
+	Retain (
+		MessageBlock *			in_block) noexcept
+	{
+		if (in_block) in_block->_count.fetch_add (1, std::memory_order_relaxed);
+
+		return in_block;
+	}
+
+
+	static void
+	Release (
+		MessageBlock *			in_block) noexcept
+	{
+		if (in_block and (1 == in_block->_count.fetch_sub (1, std::memory_order_acq_rel)))
+		{
+			delete in_block;
+		}
+	}
+};
+
+
+/*------------------------------------------------------------------------------
+	Effectively defaulted; this must be here since the destructor definition
+	must be here.
+*/
+
+Status::Status() noexcept
+{
+}
+
+
+/*------------------------------------------------------------------------------
+	The MessageBlock is shared, not copied, so the message stays put, and
+	_message remains valid as is.
+*/
+
+Status::Status (
+	const Status &			other) noexcept
+	:	_message {other._message},
+		_file {other._file},
+		_function {other._function},
+		_domain {other._domain},
+		_code {other._code},
+		_line {other._line},
+		_det {MessageBlock::Retain (other._det)}
+{
+}
+
+
+/*------------------------------------------------------------------------------
+	other is left as a success Status; the accessors ignore the rest of its
+	fields. An owned message stays put in the MessageBlock, so _message
+	remains valid as is.
+*/
+
+Status::Status (
+	Status &&				other) noexcept
+	:	_message {std::exchange (other._message, nullptr)},
+		_file {other._file},
+		_function {other._function},
+		_domain {other._domain},
+		_code {other._code},
+		_line {other._line},
+		_det {std::exchange (other._det, nullptr)}
+{
+}
 
 
 /*------------------------------------------------------------------------------
 */
 
+Status::Status (
+	StringGroup				in_domain,
+	StatusCode				in_code)
+	:	_message {""},
+		_file {""},
+		_function {""},
+		_domain {in_domain},
+		_code {in_code}
+{
+}
+
+
+/*------------------------------------------------------------------------------
+	We can’t know how long in_message will be around, so it has to be copied.
+*/
+
 Status::Status (
 	StringGroup				in_domain,
 	StatusCode				in_code,
 	const char *			in_message)
-	:	_det {std::make_unique <MessageBlock> (in_domain, in_code, in_message,
-			"", "", 0)}
+	:	Status {in_domain, in_code}
 {
+	Copy_Message (in_message);
 }
 
 
@@ -1013,9 +1775,24 @@ Status::Status (
 	StringGroup				in_domain,
 	StatusCode				in_code,
 	const std::string &		in_message)
-	:	_det {std::make_unique <MessageBlock> (in_domain, in_code, in_message,
-			"", "", 0)}
+	:	Status {in_domain, in_code}
+{
+	Copy_Message (in_message);
+}
+
+
+/*------------------------------------------------------------------------------
+	The message is moved rather than copied, e.g., when it has just been
+	formatted.
+*/
+
+Status::Status (
+	StringGroup				in_domain,
+	StatusCode				in_code,
+	std::string &&			in_message)
+	:	Status {in_domain, in_code}
 {
+	Copy_Message (std::move (in_message));
 }
 
 
@@ -1026,9 +1803,36 @@ Status::Status (
 	StringGroup				in_domain,
 	StatusCode				in_code,
 	std::string_view		in_message)
-	:	_det {std::make_unique <MessageBlock> (in_domain, in_code,
-			static_cast <std::string> (in_message), "", "", 0)}
+	:	Status {in_domain, in_code}
+{
+	Copy_Message (static_cast <std::string> (in_message));
+}
+
+
+/*------------------------------------------------------------------------------
+	Interned strings are never freed, so we can simply point at it.
+*/
+
+Status::Status (
+	StringGroup				in_domain,
+	StatusCode				in_code,
+	InternedString			in_message)
+	:	Status {in_domain, in_code}
+{
+	_message = in_message.c_str();
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+Status::Status (
+	StringGroup				in_domain,
+	StatusCode				in_code,
+	StaticMessage			in_message) noexcept
+	:	Status {in_domain, in_code}
 {
+	if (in_message._message) _message = in_message._message;
 }
 
 
@@ -1042,9 +1846,11 @@ Status::Status (
 	const char *			in_file,
 	const char *			in_function,
 	int						in_line)
-	:	_det {std::make_unique <MessageBlock> (in_domain, in_code, in_message,
-			in_file, in_function, in_line)}
+	:	Status {in_domain, in_code, in_message}
 {
+	_file = in_file;
+	_function = in_function;
+	_line = in_line;
 }
 
 
@@ -1058,9 +1864,29 @@ Status::Status (
 	const char *			in_file,
 	const char *			in_function,
 	int						in_line)
-	:	_det {std::make_unique <MessageBlock> (in_domain, in_code, in_message,
-			in_file, in_function, in_line)}
+	:	Status {in_domain, in_code, in_message}
 {
+	_file = in_file;
+	_function = in_function;
+	_line = in_line;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+Status::Status (
+	StringGroup				in_domain,
+	StatusCode				in_code,
+	std::string &&			in_message,
+	const char *			in_file,
+	const char *			in_function,
+	int						in_line)
+	:	Status {in_domain, in_code, std::move (in_message)}
+{
+	_file = in_file;
+	_function = in_function;
+	_line = in_line;
 }
 
 
@@ -1074,10 +1900,47 @@ Status::Status (
 	const char *			in_file,
 	const char *			in_function,
 	int						in_line)
-	:	_det {std::make_unique <MessageBlock> (in_domain, in_code,
-			static_cast <std::string> (in_message), in_file, in_function,
-				in_line)}
+	:	Status {in_domain, in_code, in_message}
+{
+	_file = in_file;
+	_function = in_function;
+	_line = in_line;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+Status::Status (
+	StringGroup				in_domain,
+	StatusCode				in_code,
+	InternedString			in_message,
+	const char *			in_file,
+	const char *			in_function,
+	int						in_line)
+	:	Status {in_domain, in_code, in_message}
 {
+	_file = in_file;
+	_function = in_function;
+	_line = in_line;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+Status::Status (
+	StringGroup				in_domain,
+	StatusCode				in_code,
+	StaticMessage			in_message,
+	const char *			in_file,
+	const char *			in_function,
+	int						in_line) noexcept
+	:	Status {in_domain, in_code, in_message}
+{
+	_file = in_file;
+	_function = in_function;
+	_line = in_line;
 }
 
 
@@ -1087,43 +1950,118 @@ Status::Status (
 
 Status::~Status()
 {
+	MessageBlock::Release (_det);
 }
 
 
 /*------------------------------------------------------------------------------
-	Perform a recursive deep-copy.
+	Retaining other’s MessageBlock first makes self-assignment safe.
 */
 
 Status &
 Status::operator = (
-	const Status &			other)
+	const Status &			other) noexcept
 {
-	_det = other._det ?
-		std::make_unique <MessageBlock> (*other._det) :
-			std::unique_ptr <MessageBlock>{};
+	MessageBlock::Retain (other._det);
+	MessageBlock::Release (_det);
+
+	_message = other._message;
+	_file = other._file;
+	_function = other._function;
+	_domain = other._domain;
+	_code = other._code;
+	_line = other._line;
+	_det = other._det;
 
 	return *this;
 }
 
 
 /*------------------------------------------------------------------------------
-	other._det will be automatically reset.
+	other is left as a success Status.
 */
 
 Status &
 Status::operator = (
 	Status &&				other) noexcept
 {
-	_det = std::move (other._det);
+	if (this != &other)
+	{
+		_message = std::exchange (other._message, nullptr);
+		_file = other._file;
+		_function = other._function;
+		_domain = other._domain;
+		_code = other._code;
+		_line = other._line;
+
+		MessageBlock::Release (_det);
+		_det = std::exchange (other._det, nullptr);
+	}
 
 	return *this;
 }
 
 
 /*------------------------------------------------------------------------------
-	Only Status objects that represent errors can be chained; if in_status has
-	no _det, we return false. However, if in_status has _det and we don’t, we
-	take it over.
+	An empty message is stored as a literal, so that it doesn’t need a
+	MessageBlock.
+*/
+
+void
+Status::Copy_Message (
+	std::string				in_message)
+{
+	if (in_message.empty()) return;
+
+	Unshare();
+
+	_det->_message = std::move (in_message);
+	_message = _det->_message.c_str();
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+Status::Owns_Message() const noexcept
+{
+	return _det and (_message == _det->_message.c_str());
+}
+
+
+/*------------------------------------------------------------------------------
+	Make sure we have a MessageBlock of our own that can be modified,
+	copying the shared one, if need be. The copy shares the rest of the
+	chain with the original.
+*/
+
+void
+Status::Unshare()
+{
+	if (_det and (1 == _det->_count.load (std::memory_order_acquire))) return;
+
+	auto block = std::make_unique <MessageBlock>();
+
+	if (_det)
+	{
+		block->_message = _det->_message;
+		block->_next = _det->_next;
+
+		if (Owns_Message()) _message = block->_message.c_str();
+
+		MessageBlock::Release (_det);
+	}
+
+	_det = block.release();
+}
+
+
+/*------------------------------------------------------------------------------
+	Only Status objects that represent errors can be chained; if in_status is
+	a success, we return false. However, if in_status is an error and we
+	aren’t, we take it over. Note that MessageBlocks on the way to the end of
+	the chain are copied if they are shared, since they can’t be modified.
 */
 
 bool
@@ -1135,22 +2073,45 @@ Status::Chain (
 		return false;
 	}
 	
-	if (_det)
+	if (Success())
 	{
-		if (_det->_next)
-		{
-			return _det->_next->Chain (std::move (in_status));
-		}
-		else
-		{
-			_det->_next = std::make_unique <Status> (std::move (in_status));
-		}
+		*this = std::move (in_status);
+
+		return true;
 	}
-	else
+
+	Unshare();
+
+	if (_det->_next.Error())
 	{
-		_det = std::move (in_status._det);
+		return _det->_next.Chain (std::move (in_status));
 	}
-	
+
+	_det->_next = std::move (in_status);
+
+	return true;
+}
+
+
+/*------------------------------------------------------------------------------
+	This is the reverse of Chain: in_status ends up at the head of the chain,
+	followed by the chain we had. Our chain is passed along as is, so nothing
+	in it is copied.
+*/
+
+bool
+Status::Prepend (
+	Status					in_status) noexcept
+{
+	if (in_status.Success())
+	{
+		return false;
+	}
+
+	if (Error()) (void) in_status.Chain (std::move (*this));
+
+	*this = std::move (in_status);
+
 	return true;
 }
 
@@ -1161,7 +2122,7 @@ Status::Chain (
 StatusCode
 Status::Code() const noexcept
 {
-	return _det ? _det->_code : STATUS_CODE_none;
+	return Error() ? _code : STATUS_CODE_none;
 }
 
 
@@ -1171,7 +2132,7 @@ Status::Code() const noexcept
 StringGroup
 Status::Domain() const noexcept
 {
-	return _det ? _det->_domain : STRING_GROUP_messages;
+	return Error() ? _domain : STRING_GROUP_messages;
 }
 
 
@@ -1186,11 +2147,11 @@ Status::Domain() const noexcept
 bool
 Status::Failed() const noexcept
 {
-	return _det ?
-		((_det->_next and _det->_next->Failed()) or
-			((STATUS_CODE_none != _det->_code) and
-				((STRING_GROUP_messages != _det->_domain) or
-					(STATUS_CODE_signal == _det->_code)))) :
+	return Error() ?
+		((Next() and (*Next())->Failed()) or
+			((STATUS_CODE_none != _code) and
+				((STRING_GROUP_messages != _domain) or
+					(STATUS_CODE_signal == _code)))) :
 		false;
 }
 
@@ -1201,7 +2162,7 @@ Status::Failed() const noexcept
 const char *
 Status::File() const noexcept
 {
-	return _det ? _det->_file : nullptr;
+	return Error() ? _file : nullptr;
 }
 
 
@@ -1211,7 +2172,7 @@ Status::File() const noexcept
 const char *
 Status::Function() const noexcept
 {
-	return _det ? _det->_function : nullptr;
+	return Error() ? _function : nullptr;
 }
 
 
@@ -1221,7 +2182,7 @@ Status::Function() const noexcept
 int
 Status::Line() const noexcept
 {
-	return _det ? _det->_line : 0;
+	return Error() ? _line : 0;
 }
 
 
@@ -1231,7 +2192,7 @@ Status::Line() const noexcept
 const char *
 Status::Message() const noexcept
 {
-	return _det ? _det->_message.c_str() : nullptr;
+	return _message;
 }
 
 
@@ -1241,27 +2202,26 @@ Status::Message() const noexcept
 StatusReq
 Status::Next() const noexcept
 {
-	return (_det and _det->_next) ? StatusReq {_det->_next.get()} : StatusReq{};
+	return (_det and _det->_next.Error()) ? StatusReq {&_det->_next} : StatusReq{};
 }
 
 
 /*------------------------------------------------------------------------------
 	Anything in the STRING_GROUP_messages domain or with a code of
 	STATUS_CODE_none is not a runtime error (not including STATUS_CODE_signal, 
-	which is immediately fatal). Note that the absence of a details structure 
-	implies an all-clear status, so that’s an automatic pass. Also note that we 
-	recurse the entire Status chain in case there’s a failure buried under one 
-	or more warnings.
+	which is immediately fatal). Note that a success Status is an automatic
+	pass. Also note that we recurse the entire Status chain in case there’s a
+	failure buried under one or more warnings.
 */
 
 bool
 Status::Passed() const noexcept
 {
-	return _det ?
-		((!_det->_next or _det->_next->Passed()) and
-		(((STRING_GROUP_messages == _det->_domain) and
-			(STATUS_CODE_signal != _det->_code)) or
-				(STATUS_CODE_none == _det->_code))):
+	return Error() ?
+		((!Next() or (*Next())->Passed()) and
+		(((STRING_GROUP_messages == _domain) and
+			(STATUS_CODE_signal != _code)) or
+				(STATUS_CODE_none == _code))):
 		true;
 }
 
@@ -1276,10 +2236,10 @@ Status::Passed() const noexcept
 bool
 Status::Signal() const noexcept
 {
-	return _det ?
-		((_det->_next and _det->_next->Signal()) or
-		((STRING_GROUP_messages == _det->_domain) and
-			(STATUS_CODE_signal == _det->_code))) :
+	return Error() ?
+		((Next() and (*Next())->Signal()) or
+		((STRING_GROUP_messages == _domain) and
+			(STATUS_CODE_signal == _code))) :
 		false;
 }
 
@@ -1295,11 +2255,11 @@ Status::Signal() const noexcept
 bool
 Status::Warning() const noexcept
 {
-	return _det ?
-		((_det->_next and _det->_next->Warning()) or
-		((STRING_GROUP_messages == _det->_domain) and
-			(STATUS_CODE_none != _det->_code) and
-				(STATUS_CODE_signal != _det->_code))) :
+	return Error() ?
+		((Next() and (*Next())->Warning()) or
+		((STRING_GROUP_messages == _domain) and
+			(STATUS_CODE_none != _code) and
+				(STATUS_CODE_signal != _code))) :
 		false;
 }
 
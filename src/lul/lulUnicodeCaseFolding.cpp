@@ -0,0 +1,489 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“UnicodeCaseFolding.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+	Folding is done one code point at a time through the generated tables,
+	except for runs of ASCII in UTF-8 strings, which are handed off to the
+	kernels in bulk. Comparing and hashing read the folded code points
+	straight out of the tables as they go, so neither ever has to build the
+	folded string.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulUtilities.hpp>
+
+#include "lulConfig_priv.hpp"
+#include "lulUnicodeKernels_priv.hpp"
+#include "lulUnicodeUtilities_priv.hpp"
+
+
+LUL_begin_v_namespace
+
+
+namespace {
+
+
+/*------------------------------------------------------------------------------
+	The number of code units folded at a time when folding ASCII in bulk;
+	this is the size of a buffer on the stack.
+*/
+
+const std::size_t		ASCII_chunk_size			(256);
+
+
+/*------------------------------------------------------------------------------
+	Reads the folded code points of a string one at a time. A code point that
+	folds to more than one is handed out piecemeal from the table; pending
+	refers to whatever is left of it.
+*/
+
+template <typename CHAR_T>
+class FoldReader
+{
+	public:
+		using string_view_type = std::basic_string_view <CHAR_T>;
+
+		explicit FoldReader (string_view_type in_string) noexcept
+			:	_string {in_string},
+				_index {0},
+				_pending {}
+		{ }
+
+		bool Next (char32_t & out_code) noexcept
+		{
+			if (!_pending.empty())
+			{
+				out_code = _pending.front();
+				_pending.remove_prefix (1);
+
+				return true;
+			}
+
+			if (_index >= _string.size()) return false;
+
+			auto unit = static_cast <std::make_unsigned_t <CHAR_T>> (_string [_index]);
+
+			if (unit < 0x80u)
+			{
+				out_code = ((unit >= 'A') and (unit <= 'Z')) ? (unit + ('a' - 'A')) : unit;
+				++_index;
+
+				return true;
+			}
+
+			if (!uc::UTF_Decode (_string, _index, out_code))
+			{
+				out_code = uc::CODE_POINT_replacement;
+			}
+
+			if (auto folding = uc::Case_Folding (out_code); !folding.empty())
+			{
+				out_code = folding.front();
+				_pending = folding.substr (1);
+			}
+
+			return true;
+		}
+
+		//	True if the next code unit is ASCII, and nothing is pending.
+		bool At_ASCII() const noexcept
+		{
+			return _pending.empty() and (_index < _string.size()) and
+				(static_cast <std::make_unsigned_t <CHAR_T>> (_string [_index]) < 0x80u);
+		}
+
+		string_view_type Rest() const noexcept
+		{
+			return _string.substr (_index);
+		}
+
+		void Skip (std::size_t in_count) noexcept
+		{
+			_index += in_count;
+		}
+
+
+	private:
+		string_view_type		_string;
+		std::size_t				_index;
+		std::u32string_view		_pending;
+};
+
+
+/*------------------------------------------------------------------------------
+	Streaming hash over a sequence of bytes. Words are mixed in with the
+	multiply-and-rotate step from FxHash, which is about as cheap as a
+	reasonable hash gets, and the result goes through the MurmurHash3
+	finalizer to make up for its weak avalanche. Bytes are buffered until a
+	whole word is available, so the result only depends on the bytes, and not
+	on how they were split up between calls to Update.
+*/
+
+class FoldHasher
+{
+	public:
+		FoldHasher() noexcept
+			:	_hash {0},
+				_length {0},
+				_count {0},
+				_block {}
+		{ }
+
+		void Update (const char * in_data, std::size_t in_size) noexcept
+		{
+			_length += in_size;
+
+			if (_count)
+			{
+				auto n = std::min (in_size, sizeof (_block) - _count);
+
+				std::memcpy (_block + _count, in_data, n);
+				_count += n;
+				in_data += n;
+				in_size -= n;
+
+				if (_count < sizeof (_block)) return;
+
+				Mix (_block);
+				_count = 0;
+			}
+
+			for (; in_size >= sizeof (_block); in_data += sizeof (_block), in_size -= sizeof (_block))
+			{
+				Mix (in_data);
+			}
+
+			std::memcpy (_block, in_data, in_size);
+			_count = in_size;
+		}
+
+		std::size_t Finish() noexcept
+		{
+			if (_count)
+			{
+				std::memset (_block + _count, 0, sizeof (_block) - _count);
+				Mix (_block);
+			}
+
+			auto nrv = Mix_Word (_hash, _length);
+
+			nrv ^= nrv >> 33;
+			nrv *= 0xFF51AFD7ED558CCDu;
+			nrv ^= nrv >> 33;
+			nrv *= 0xC4CEB9FE1A85EC53u;
+			nrv ^= nrv >> 33;
+
+			return static_cast <std::size_t> (nrv);
+		}
+
+
+	private:
+		static uint64_t Mix_Word (uint64_t in_hash, uint64_t in_word) noexcept
+		{
+			return (((in_hash << 5) | (in_hash >> 59)) ^ in_word) * 0x517CC1B727220A95u;
+		}
+
+		void Mix (const void * in_data) noexcept
+		{
+			uint64_t word;
+
+			std::memcpy (&word, in_data, sizeof (word));
+			_hash = Mix_Word (_hash, word);
+		}
+
+		uint64_t				_hash;
+		uint64_t				_length;
+		std::size_t				_count;
+		char					_block [8];
+};
+
+
+/*------------------------------------------------------------------------------
+	Write the UTF-8 encoding of in_code, which must be a valid code point, to
+	out_buffer, and return its length.
+*/
+
+std::size_t
+Encode_UTF8 (
+	char32_t				in_code,
+	char *					out_buffer) noexcept
+{
+	if (in_code < 0x80u)
+	{
+		out_buffer [0] = static_cast <char> (in_code);
+
+		return 1;
+	}
+
+	if (in_code < 0x800u)
+	{
+		out_buffer [0] = static_cast <char> (0xC0u | (in_code >> 6));
+		out_buffer [1] = static_cast <char> (0x80u | (in_code & 0x3Fu));
+
+		return 2;
+	}
+
+	if (in_code < 0x10000u)
+	{
+		out_buffer [0] = static_cast <char> (0xE0u | (in_code >> 12));
+		out_buffer [1] = static_cast <char> (0x80u | ((in_code >> 6) & 0x3Fu));
+		out_buffer [2] = static_cast <char> (0x80u | (in_code & 0x3Fu));
+
+		return 3;
+	}
+
+	out_buffer [0] = static_cast <char> (0xF0u | (in_code >> 18));
+	out_buffer [1] = static_cast <char> (0x80u | ((in_code >> 12) & 0x3Fu));
+	out_buffer [2] = static_cast <char> (0x80u | ((in_code >> 6) & 0x3Fu));
+	out_buffer [3] = static_cast <char> (0x80u | (in_code & 0x3Fu));
+
+	return 4;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+template <typename CHAR_T>
+std::basic_string <CHAR_T>
+Case_Fold_Impl (
+	std::basic_string_view <CHAR_T>	in_string)
+{
+	auto nrv = std::basic_string <CHAR_T>{};
+	auto reader = FoldReader <CHAR_T> {in_string};
+	char32_t code_point;
+
+	nrv.reserve (in_string.size());
+
+	while (true)
+	{
+		if constexpr (std::is_same_v <CHAR_T, char>)
+		{
+			if (reader.At_ASCII())
+			{
+				char buffer [ASCII_chunk_size];
+				auto run = uc::ASCII_Fold (reader.Rest(), buffer, sizeof (buffer));
+
+				nrv.append (buffer, run);
+				reader.Skip (run);
+
+				continue;
+			}
+		}
+
+		if (!reader.Next (code_point)) break;
+
+		(void) uc::UTF_Encode (code_point, nrv);
+	}
+
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Whenever both strings are sitting at ASCII, we let the kernel skip over
+	as much as it can before going back to comparing code point by code
+	point; since ASCII code units always start a sequence, this can never
+	leave either string in the middle of one.
+*/
+
+template <typename CHAR_T>
+int
+Compare_Folded_Impl (
+	std::basic_string_view <CHAR_T>	in_lhs,
+	std::basic_string_view <CHAR_T>	in_rhs) noexcept
+{
+	auto lhs = FoldReader <CHAR_T> {in_lhs};
+	auto rhs = FoldReader <CHAR_T> {in_rhs};
+
+	while (true)
+	{
+		if constexpr (std::is_same_v <CHAR_T, char>)
+		{
+			if (lhs.At_ASCII() and rhs.At_ASCII())
+			{
+				auto run = uc::ASCII_Fold_Mismatch (lhs.Rest(), rhs.Rest());
+
+				lhs.Skip (run);
+				rhs.Skip (run);
+			}
+		}
+
+		char32_t lhs_code;
+		char32_t rhs_code;
+		auto have_lhs = lhs.Next (lhs_code);
+		auto have_rhs = rhs.Next (rhs_code);
+
+		if (!have_lhs or !have_rhs) return static_cast <int> (have_lhs) - static_cast <int> (have_rhs);
+		if (lhs_code != rhs_code) return (lhs_code < rhs_code) ? -1 : 1;
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+template <typename CHAR_T>
+std::size_t
+Hash_Folded_Impl (
+	std::basic_string_view <CHAR_T>	in_string) noexcept
+{
+	auto hasher = FoldHasher{};
+	auto reader = FoldReader <CHAR_T> {in_string};
+	char32_t code_point;
+
+	while (true)
+	{
+		if constexpr (std::is_same_v <CHAR_T, char>)
+		{
+			if (reader.At_ASCII())
+			{
+				char buffer [ASCII_chunk_size];
+				auto run = uc::ASCII_Fold (reader.Rest(), buffer, sizeof (buffer));
+
+				hasher.Update (buffer, run);
+				reader.Skip (run);
+
+				continue;
+			}
+		}
+
+		if (!reader.Next (code_point)) break;
+
+		char buffer [4];
+
+		hasher.Update (buffer, Encode_UTF8 (code_point, buffer));
+	}
+
+
+	return hasher.Finish();
+}
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::string
+Case_Fold (
+	std::string_view		in_string)
+{
+	return Case_Fold_Impl (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::u16string
+Case_Fold (
+	std::u16string_view		in_string)
+{
+	return Case_Fold_Impl (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::u32string
+Case_Fold (
+	std::u32string_view		in_string)
+{
+	return Case_Fold_Impl (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+int
+Compare_Folded (
+	std::string_view		in_lhs,
+	std::string_view		in_rhs) noexcept
+{
+	return Compare_Folded_Impl (in_lhs, in_rhs);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+int
+Compare_Folded (
+	std::u16string_view		in_lhs,
+	std::u16string_view		in_rhs) noexcept
+{
+	return Compare_Folded_Impl (in_lhs, in_rhs);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+int
+Compare_Folded (
+	std::u32string_view		in_lhs,
+	std::u32string_view		in_rhs) noexcept
+{
+	return Compare_Folded_Impl (in_lhs, in_rhs);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+Hash_Folded (
+	std::string_view		in_string) noexcept
+{
+	return Hash_Folded_Impl (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+Hash_Folded (
+	std::u16string_view		in_string) noexcept
+{
+	return Hash_Folded_Impl (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+Hash_Folded (
+	std::u32string_view		in_string) noexcept
+{
+	return Hash_Folded_Impl (in_string);
+}
+
+
+/*----------------------------------------------------------------------------*/
+
+LUL_end_v_namespace
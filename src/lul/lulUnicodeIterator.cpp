@@ -0,0 +1,454 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“UnicodeIterator.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <cstddef>
+#include <string_view>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulUnicodeIterator.hpp>
+
+#include "lulConfig_priv.hpp"
+#include "lulUnicodeUtilities_priv.hpp"
+
+
+LUL_begin_v_namespace
+
+
+namespace {
+
+using uc::GraphemeBreak;
+
+
+/*------------------------------------------------------------------------------
+	Decode the code point that ends at io_index, move io_index back to its
+	start, and return its Grapheme_Cluster_Break property.
+*/
+
+template <typename CHAR_T>
+GraphemeBreak
+Previous_Property (
+	std::basic_string_view <CHAR_T>	in_string,
+	std::size_t &			io_index) noexcept
+{
+	io_index = Find_Previous_Code_Point (in_string, io_index);
+
+	auto index = io_index;
+
+	return uc::Grapheme_Break_Property (Decode_Code_Point (in_string, index));
+}
+
+
+/*------------------------------------------------------------------------------
+	Return true if UAX #29 calls for a break between two code points with the
+	given properties, using only the rules that look at nothing else (GB3
+	through GB9b, and GB999). The rules that need more context, GB11 through
+	GB13, are handled by the callers.
+*/
+
+bool
+Is_Pair_Break (
+	GraphemeBreak			in_before,
+	GraphemeBreak			in_after) noexcept
+{
+	//	GB3
+	if ((GraphemeBreak::CR == in_before) and (GraphemeBreak::LF == in_after))
+	{
+		return false;
+	}
+
+	//	GB4, GB5
+	auto is_control = [] (GraphemeBreak p)
+	{
+		return (GraphemeBreak::CR == p) or (GraphemeBreak::LF == p) or
+			(GraphemeBreak::Control == p);
+	};
+
+	if (is_control (in_before) or is_control (in_after)) return true;
+
+	//	GB6, GB7, GB8
+	switch (in_before)
+	{
+		case GraphemeBreak::L:
+			if ((GraphemeBreak::L == in_after) or (GraphemeBreak::V == in_after) or
+				(GraphemeBreak::LV == in_after) or (GraphemeBreak::LVT == in_after))
+			{
+				return false;
+			}
+			break;
+
+		case GraphemeBreak::LV:
+		case GraphemeBreak::V:
+			if ((GraphemeBreak::V == in_after) or (GraphemeBreak::T == in_after))
+			{
+				return false;
+			}
+			break;
+
+		case GraphemeBreak::LVT:
+		case GraphemeBreak::T:
+			if (GraphemeBreak::T == in_after) return false;
+			break;
+
+		default:
+			break;
+	}
+
+	//	GB9, GB9a
+	if ((GraphemeBreak::Extend == in_after) or (GraphemeBreak::ZWJ == in_after) or
+		(GraphemeBreak::SpacingMark == in_after))
+	{
+		return false;
+	}
+
+	//	GB9b
+	if (GraphemeBreak::Prepend == in_before) return false;
+
+	//	GB999
+	return true;
+}
+
+
+/*------------------------------------------------------------------------------
+	Since in_index is a boundary, any emoji sequence (GB11) or pair of
+	regional indicators (GB12, GB13) that straddles a later position must
+	have started at or after in_index, so we can track them as we go instead
+	of having to look back.
+*/
+
+template <typename CHAR_T>
+std::size_t
+Find_Next_Grapheme_Break_Impl (
+	std::basic_string_view <CHAR_T>	in_string,
+	std::size_t				in_index) noexcept
+{
+	auto size = in_string.size();
+
+	if (in_index >= size) return size;
+
+	auto before = uc::Grapheme_Break_Property (Decode_Code_Point (in_string, in_index));
+
+	//	pictographic is true after ExtPict Extend*, and joined is true after
+	//	ExtPict Extend* ZWJ; odd_ri is true after an odd number of regional
+	//	indicators in a row.
+	auto pictographic = (GraphemeBreak::Extended_Pictographic == before);
+	auto joined = false;
+	auto odd_ri = (GraphemeBreak::Regional_Indicator == before);
+
+	while (in_index < size)
+	{
+		auto next = in_index;
+		auto after = uc::Grapheme_Break_Property (Decode_Code_Point (in_string, next));
+		bool is_break;
+
+		if ((GraphemeBreak::ZWJ == before) and
+			(GraphemeBreak::Extended_Pictographic == after))
+		{
+			//	GB11
+			is_break = !joined;
+		}
+		else if ((GraphemeBreak::Regional_Indicator == before) and
+			(GraphemeBreak::Regional_Indicator == after))
+		{
+			//	GB12, GB13
+			is_break = !odd_ri;
+		}
+		else
+		{
+			is_break = Is_Pair_Break (before, after);
+		}
+
+		if (is_break) break;
+
+		joined = pictographic and (GraphemeBreak::ZWJ == after);
+		pictographic = (GraphemeBreak::Extended_Pictographic == after) or
+			(pictographic and (GraphemeBreak::Extend == after));
+		odd_ri = (GraphemeBreak::Regional_Indicator == after) and !odd_ri;
+
+		before = after;
+		in_index = next;
+	}
+
+
+	return in_index;
+}
+
+
+/*------------------------------------------------------------------------------
+	Going backwards, we don’t know what came before, so GB11 and GB12/13 are
+	resolved by looking back from each candidate position. Emoji sequences
+	and runs of regional indicators are short in practice, so this costs
+	little.
+*/
+
+template <typename CHAR_T>
+std::size_t
+Find_Previous_Grapheme_Break_Impl (
+	std::basic_string_view <CHAR_T>	in_string,
+	std::size_t				in_index) noexcept
+{
+	if (0 == in_index) return 0;
+
+	auto index = in_index;
+	auto after = Previous_Property (in_string, index);
+
+	while (index > 0)
+	{
+		auto lookback = index;
+		auto before = Previous_Property (in_string, lookback);
+		bool is_break;
+
+		if ((GraphemeBreak::ZWJ == before) and
+			(GraphemeBreak::Extended_Pictographic == after))
+		{
+			//	GB11: skip back over Extend* and look for ExtPict.
+			auto p = GraphemeBreak::Other;
+
+			do
+			{
+				p = (lookback > 0) ?
+					Previous_Property (in_string, lookback) : GraphemeBreak::Other;
+			}
+			while (GraphemeBreak::Extend == p);
+
+			is_break = (GraphemeBreak::Extended_Pictographic != p);
+		}
+		else if ((GraphemeBreak::Regional_Indicator == before) and
+			(GraphemeBreak::Regional_Indicator == after))
+		{
+			//	GB12, GB13: break only after an even number of regional
+			//	indicators in a row.
+			std::size_t count = 1;
+
+			while ((lookback > 0) and
+				(GraphemeBreak::Regional_Indicator == Previous_Property (in_string, lookback)))
+			{
+				++count;
+			}
+
+			is_break = (0 == (count % 2));
+		}
+		else
+		{
+			is_break = Is_Pair_Break (before, after);
+		}
+
+		if (is_break) break;
+
+		index = Find_Previous_Code_Point (in_string, index);
+		after = before;
+	}
+
+
+	return index;
+}
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+*/
+
+char32_t
+Decode_Code_Point (
+	std::string_view		in_string,
+	std::size_t &			io_index) noexcept
+{
+	char32_t nrv;
+
+	return uc::UTF_Decode (in_string, io_index, nrv) ? nrv : uc::CODE_POINT_replacement;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+char32_t
+Decode_Code_Point (
+	std::u16string_view		in_string,
+	std::size_t &			io_index) noexcept
+{
+	char32_t nrv;
+
+	return uc::UTF_Decode (in_string, io_index, nrv) ? nrv : uc::CODE_POINT_replacement;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+char32_t
+Decode_Code_Point (
+	std::u32string_view		in_string,
+	std::size_t &			io_index) noexcept
+{
+	char32_t nrv;
+
+	return uc::UTF_Decode (in_string, io_index, nrv) ? nrv : uc::CODE_POINT_replacement;
+}
+
+
+/*------------------------------------------------------------------------------
+	Every byte that isn’t a trail byte starts a sequence of its own, since
+	UTF_Decode never consumes one as part of another sequence. So we back up
+	to the nearest one and decode forward from there until we reach in_index;
+	the last sequence we decode is the one we’re after. In well-formed text,
+	that’s always the first one, but an invalid sequence can drag along an
+	arbitrary number of trail bytes.
+*/
+
+std::size_t
+Find_Previous_Code_Point (
+	std::string_view		in_string,
+	std::size_t				in_index) noexcept
+{
+	if (0 == in_index) return 0;
+
+	auto start = in_index - 1;
+
+	while ((start > 0) and
+		uc::UTF8_Is_Trail_Byte (static_cast <uint8_t> (in_string [start])))
+	{
+		--start;
+	}
+
+	auto nrv = start;
+
+	while (start < in_index)
+	{
+		nrv = start;
+		(void) Decode_Code_Point (in_string, start);
+	}
+
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	A trail surrogate is only ever consumed along with the lead surrogate
+	right before it, and a lead surrogate is never consumed along with
+	anything before it, so one unit of lookback is all we need.
+*/
+
+std::size_t
+Find_Previous_Code_Point (
+	std::u16string_view		in_string,
+	std::size_t				in_index) noexcept
+{
+	if (0 == in_index) return 0;
+
+	auto nrv = in_index - 1;
+
+	if ((nrv > 0) and uc::Is_Trail_Surrogate (in_string [nrv]) and
+		uc::Is_Lead_Surrogate (in_string [nrv - 1]))
+	{
+		--nrv;
+	}
+
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+Find_Previous_Code_Point (
+	std::u32string_view		in_string,
+	std::size_t				in_index) noexcept
+{
+	(void) in_string;
+
+	return (in_index > 0) ? (in_index - 1) : 0;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+Find_Next_Grapheme_Break (
+	std::string_view		in_string,
+	std::size_t				in_index) noexcept
+{
+	return Find_Next_Grapheme_Break_Impl (in_string, in_index);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+Find_Next_Grapheme_Break (
+	std::u16string_view		in_string,
+	std::size_t				in_index) noexcept
+{
+	return Find_Next_Grapheme_Break_Impl (in_string, in_index);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+Find_Next_Grapheme_Break (
+	std::u32string_view		in_string,
+	std::size_t				in_index) noexcept
+{
+	return Find_Next_Grapheme_Break_Impl (in_string, in_index);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+Find_Previous_Grapheme_Break (
+	std::string_view		in_string,
+	std::size_t				in_index) noexcept
+{
+	return Find_Previous_Grapheme_Break_Impl (in_string, in_index);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+Find_Previous_Grapheme_Break (
+	std::u16string_view		in_string,
+	std::size_t				in_index) noexcept
+{
+	return Find_Previous_Grapheme_Break_Impl (in_string, in_index);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+Find_Previous_Grapheme_Break (
+	std::u32string_view		in_string,
+	std::size_t				in_index) noexcept
+{
+	return Find_Previous_Grapheme_Break_Impl (in_string, in_index);
+}
+
+
+/*----------------------------------------------------------------------------*/
+
+LUL_end_v_namespace
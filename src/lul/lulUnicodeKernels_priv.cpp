@@ -0,0 +1,2842 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“UnicodeKernels_priv.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+	The UTF-8 validator is an adaptation of the “lookup” algorithm described
+	by John Keiser and Daniel Lemire in “Validating UTF-8 In Less Than One
+	Instruction Per Byte” (Software: Practice and Experience, 2021), extended
+	to reject Unicode noncharacters so that it agrees with UTF_Decode.
+
+	The UTF-8 widening kernel follows the table-driven approach described by
+	Daniel Lemire and Wojciech Muła in “Transcoding Billions of Unicode
+	Characters per Second with SIMD Instructions” (Software: Practice and
+	Experience, 2022). It only ever sees input that the validator has already
+	accepted, which leaves all error handling to the scalar code.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <string_view>
+#include <type_traits>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulFeatureSetup.hpp>
+#include <Lucena-Utilities/lulTypes.hpp>
+
+#include "lulConfig_priv.hpp"
+#include "lulUnicodeKernels_priv.hpp"
+#include "lulUnicodeUtilities_priv.hpp"
+
+
+#ifdef LUL_TEMP_VEC_KERNELS
+	#error "LUL_TEMP_VEC_KERNELS should not be defined"
+#endif
+
+#if LUL_TARGET_VEC_AVX2 or LUL_TARGET_VEC_SSE42
+	#include <immintrin.h>
+
+	#define LUL_TEMP_VEC_KERNELS 1
+#else
+	#define LUL_TEMP_VEC_KERNELS 0
+#endif
+
+
+LUL_begin_v_namespace
+
+namespace uc {
+
+namespace {
+
+
+/*------------------------------------------------------------------------------
+	Scalar Kernels
+
+	These are the reference implementations; they also handle whatever is
+	left over once the vector kernels run out of whole blocks.
+*/
+
+/*------------------------------------------------------------------------------
+	Return the length of the run of ASCII code units (i.e., those below 0x80)
+	at the start of in_data, which is in_size code units long. CHAR_T may be
+	any of the character types; 8 bytes’ worth of code units are checked at a
+	time by masking off the bits that must be clear in an ASCII code unit,
+	which works regardless of byte order.
+*/
+
+template <typename CHAR_T>
+inline std::size_t
+ASCII_Prefix_Scalar (
+	const CHAR_T *			in_data,
+	std::size_t				in_size) noexcept
+{
+	constexpr std::size_t k_units {sizeof (uint64_t) / sizeof (CHAR_T)};
+	constexpr uint64_t k_mask {
+		(sizeof (CHAR_T) == 1) ? 0x8080808080808080u :
+		(sizeof (CHAR_T) == 2) ? 0xFF80FF80FF80FF80u :
+		0xFFFFFF80FFFFFF80u};
+
+	std::size_t nrv = 0;
+
+	for (; (nrv + k_units) <= in_size; nrv += k_units)
+	{
+		uint64_t word;
+
+		std::memcpy (&word, in_data + nrv, sizeof (word));
+
+		if (word & k_mask) break;
+	}
+
+	while ((nrv < in_size) and
+		(static_cast <std::make_unsigned_t <CHAR_T>> (in_data [nrv]) < 0x80u))
+	{
+		++nrv;
+	}
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Copy in_count ASCII code units from in_data to io_out, converting them to
+	OUT_T along the way, and advance io_out. Since ASCII is encoded the same
+	way in all the UTFs, this is all it takes to transcode an ASCII run; the
+	loop is simple enough for the compiler to vectorize.
+*/
+
+template <typename IN_T, typename OUT_T>
+inline void
+Copy_ASCII (
+	const IN_T *			in_data,
+	std::size_t				in_count,
+	OUT_T * &				io_out) noexcept
+{
+	for (std::size_t i = 0; i < in_count; ++i)
+	{
+		io_out [i] = static_cast <OUT_T> (in_data [i]);
+	}
+
+	io_out += in_count;
+}
+
+
+/*------------------------------------------------------------------------------
+	Return the case folding of the ASCII code unit in_unit; anything outside
+	A-Z folds to itself.
+*/
+
+inline char
+ASCII_Fold_Unit (
+	char					in_unit) noexcept
+{
+	return static_cast <char> (
+		((in_unit >= 'A') and (in_unit <= 'Z')) ? (in_unit + ('a' - 'A')) : in_unit);
+}
+
+
+/*------------------------------------------------------------------------------
+	Scalar counterparts to ASCII_Fold and ASCII_Fold_Mismatch, starting at
+	in_index.
+*/
+
+inline std::size_t
+ASCII_Fold_Scalar (
+	const char *			in_data,
+	std::size_t				in_size,
+	std::size_t				in_index,
+	char *					out_buffer) noexcept
+{
+	while ((in_index < in_size) and (static_cast <uint8_t> (in_data [in_index]) < 0x80u))
+	{
+		out_buffer [in_index] = ASCII_Fold_Unit (in_data [in_index]);
+		++in_index;
+	}
+
+	return in_index;
+}
+
+
+inline std::size_t
+ASCII_Fold_Mismatch_Scalar (
+	const char *			in_lhs,
+	const char *			in_rhs,
+	std::size_t				in_size,
+	std::size_t				in_index) noexcept
+{
+	while ((in_index < in_size) and
+		(static_cast <uint8_t> (in_lhs [in_index] | in_rhs [in_index]) < 0x80u) and
+		(ASCII_Fold_Unit (in_lhs [in_index]) == ASCII_Fold_Unit (in_rhs [in_index])))
+	{
+		++in_index;
+	}
+
+	return in_index;
+}
+
+
+/*------------------------------------------------------------------------------
+	Validate in_string starting from in_index, which must lie on a code point
+	boundary. Return the index of the first invalid sequence, or the string
+	size if there isn’t one.
+*/
+
+std::size_t
+UTF8_Valid_Prefix_Scalar (
+	std::string_view		in_string,
+	std::size_t				in_index) noexcept
+{
+	auto index = in_index;
+
+	while (index < in_string.size())
+	{
+		if (UTF8_Is_ASCII (static_cast <uint8_t> (in_string [index])))
+		{
+			index += ASCII_Prefix_Scalar (in_string.data() + index,
+				in_string.size() - index);
+
+			continue;
+		}
+
+		auto start = index;
+		char32_t code_point;
+
+		if (!UTF_Decode (in_string, index, code_point))
+		{
+			return start;
+		}
+	}
+
+	return in_string.size();
+}
+
+
+/*------------------------------------------------------------------------------
+	Given in_index, which may point into the middle of a sequence, back up to
+	the start of that sequence, examining no more than the three bytes that
+	precede in_index. If in_index already lies on a boundary, it is returned
+	unchanged. This is used to find a safe point at which to hand off from
+	the vector kernels to the scalar kernels.
+*/
+
+inline std::size_t
+UTF8_Sequence_Start (
+	std::string_view		in_string,
+	std::size_t				in_index) noexcept
+{
+	for (std::size_t i = 1; (i <= 3) and (i <= in_index); ++i)
+	{
+		auto b = static_cast <uint8_t> (in_string [in_index - i]);
+
+		if (b >= 0xC0u) return in_index - i;
+		if (!UTF8_Is_Trail_Byte (b)) break;
+	}
+
+	return in_index;
+}
+
+
+/*------------------------------------------------------------------------------
+	Decode one sequence from a string that is already known to be valid; no
+	checks of any kind are made. io_data is advanced past the sequence.
+*/
+
+inline char32_t
+UTF8_Decode_Valid (
+	const uint8_t *	&		io_data) noexcept
+{
+	char32_t code_point = *io_data++;
+
+	if (code_point < 0x80u)
+	{
+		return code_point;
+	}
+
+	if (code_point < 0xE0u)
+	{
+		code_point = ((code_point & 0x1Fu) << 6) | (io_data [0] & 0x3Fu);
+		io_data += 1;
+	}
+	else if (code_point < 0xF0u)
+	{
+		code_point = ((code_point & 0x0Fu) << 12) |
+			((io_data [0] & 0x3Fu) << 6) | (io_data [1] & 0x3Fu);
+		io_data += 2;
+	}
+	else
+	{
+		code_point = ((code_point & 0x07u) << 18) |
+			((io_data [0] & 0x3Fu) << 12) | ((io_data [1] & 0x3Fu) << 6) |
+				(io_data [2] & 0x3Fu);
+		io_data += 3;
+	}
+
+	return code_point;
+}
+
+
+/*------------------------------------------------------------------------------
+	Write a code point to io_out as UTF-16 or UTF-32, depending on the width
+	of CHAR_T, and advance io_out. Like UTF_Encode, we assume that in_code is
+	a valid Unicode character, but unlike UTF_Encode, we assume there is room
+	in the output buffer.
+*/
+
+template <typename CHAR_T>
+inline void
+Put_Code_Point (
+	char32_t				in_code,
+	CHAR_T * &				io_out) noexcept
+{
+	if constexpr (sizeof (CHAR_T) == sizeof (char16_t))
+	{
+		if (Is_In_BMP (in_code))
+		{
+			*io_out++ = static_cast <CHAR_T> (in_code);
+		}
+		else
+		{
+			*io_out++ = static_cast <CHAR_T> ((in_code >> 10) + 0xD7C0u);
+			*io_out++ = static_cast <CHAR_T> ((in_code & 0x3FFu) | 0xDC00u);
+		}
+	}
+	else
+	{
+		static_assert (sizeof (CHAR_T) == sizeof (char32_t),
+			"CHAR_T must be a 16- or 32-bit type");
+
+		*io_out++ = static_cast <CHAR_T> (in_code);
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Bounded variant of Put_Code_Point. If the encoded code point won’t fit
+	before in_out_end, nothing is written and false is returned.
+*/
+
+template <typename CHAR_T>
+inline bool
+Put_Code_Point (
+	char32_t				in_code,
+	CHAR_T * &				io_out,
+	const CHAR_T *			in_out_end) noexcept
+{
+	auto length = ((sizeof (CHAR_T) == sizeof (char16_t)) and !Is_In_BMP (in_code)) ? 2 : 1;
+
+	if ((in_out_end - io_out) < length) return false;
+
+	Put_Code_Point (in_code, io_out);
+
+	return true;
+}
+
+
+/*------------------------------------------------------------------------------
+	Scalar widener for [io_index, in_end), which must be valid UTF-8 ending
+	on a code point boundary. Return false if the output buffer fills up
+	first, in which case io_index is left at the first code point that
+	didn’t fit.
+*/
+
+template <typename CHAR_T>
+inline bool
+UTF8_Widen_Valid_Scalar (
+	std::string_view		in_string,
+	std::size_t &			io_index,
+	std::size_t				in_end,
+	CHAR_T * &				io_out,
+	const CHAR_T *			in_out_end) noexcept
+{
+	auto data = reinterpret_cast <const uint8_t *> (in_string.data());
+	auto cur = data + io_index;
+	auto end = data + in_end;
+	auto nrv = true;
+
+	while (cur < end)
+	{
+		auto start = cur;
+
+		if (*cur < 0x80u)
+		{
+			auto run = std::min (
+				ASCII_Prefix_Scalar (cur, static_cast <std::size_t> (end - cur)),
+				static_cast <std::size_t> (in_out_end - io_out));
+
+			if (0 == run)
+			{
+				nrv = false;
+				break;
+			}
+
+			Copy_ASCII (cur, run, io_out);
+			cur += run;
+
+			continue;
+		}
+
+		if (!Put_Code_Point (UTF8_Decode_Valid (cur), io_out, in_out_end))
+		{
+			cur = start;
+			nrv = false;
+			break;
+		}
+	}
+
+	io_index = static_cast <std::size_t> (cur - data);
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Return the number of bytes needed to encode in_code as UTF-8.
+*/
+
+inline std::size_t
+UTF8_Code_Point_Length (
+	char32_t				in_code) noexcept
+{
+	return std::size_t {1} + (in_code >= 0x80u) + (in_code >= 0x800u) +
+		(in_code >= 0x10000u);
+}
+
+
+/*------------------------------------------------------------------------------
+	Write a code point to io_out as UTF-8 and advance io_out. As with
+	Put_Code_Point, we assume in_code is a valid Unicode character and that
+	there is room in the output buffer.
+*/
+
+inline void
+Put_UTF8 (
+	char32_t				in_code,
+	char * &				io_out) noexcept
+{
+	if (in_code < 0x80u)
+	{
+		*io_out++ = static_cast <char> (in_code);
+	}
+	else if (in_code < 0x800u)
+	{
+		*io_out++ = static_cast <char> ((in_code >> 6) | 0xC0u);
+		*io_out++ = static_cast <char> ((in_code & 0x3Fu) | 0x80u);
+	}
+	else if (in_code < 0x10000u)
+	{
+		*io_out++ = static_cast <char> ((in_code >> 12) | 0xE0u);
+		*io_out++ = static_cast <char> (((in_code >> 6) & 0x3Fu) | 0x80u);
+		*io_out++ = static_cast <char> ((in_code & 0x3Fu) | 0x80u);
+	}
+	else
+	{
+		*io_out++ = static_cast <char> ((in_code >> 18) | 0xF0u);
+		*io_out++ = static_cast <char> (((in_code >> 12) & 0x3Fu) | 0x80u);
+		*io_out++ = static_cast <char> (((in_code >> 6) & 0x3Fu) | 0x80u);
+		*io_out++ = static_cast <char> ((in_code & 0x3Fu) | 0x80u);
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Bounded variant of Put_UTF8. If the encoded code point won’t fit before
+	in_out_end, nothing is written and false is returned.
+*/
+
+inline bool
+Put_UTF8 (
+	char32_t				in_code,
+	char * &				io_out,
+	const char *			in_out_end) noexcept
+{
+	if (static_cast <std::size_t> (in_out_end - io_out) <
+		UTF8_Code_Point_Length (in_code))
+	{
+		return false;
+	}
+
+	Put_UTF8 (in_code, io_out);
+
+	return true;
+}
+
+
+/*------------------------------------------------------------------------------
+	Decode one sequence at io_index with UTF_Decode and write it to io_out
+	with the bounded Put function for OUT_T, substituting U+FFFD if it’s
+	invalid and noting the location of the first such sequence in
+	io_error_index; out_valid indicates whether the sequence was valid.
+	Return false, leaving io_index alone, if the output buffer is full.
+*/
+
+template <typename IN_T, typename OUT_T>
+inline bool
+Transcode_One (
+	std::basic_string_view <IN_T>	in_string,
+	std::size_t &			io_index,
+	OUT_T * &				io_out,
+	const OUT_T *			in_out_end,
+	std::size_t &			io_error_index,
+	bool &					out_valid) noexcept
+{
+	auto start = io_index;
+	char32_t code_point;
+
+	out_valid = UTF_Decode (in_string, io_index, code_point);
+
+	if (!out_valid) code_point = CODE_POINT_replacement;
+
+	bool fits;
+
+	if constexpr (sizeof (OUT_T) == sizeof (char))
+	{
+		fits = Put_UTF8 (code_point, io_out, in_out_end);
+	}
+	else
+	{
+		fits = Put_Code_Point (code_point, io_out, in_out_end);
+	}
+
+	if (!fits)
+	{
+		io_index = start;
+		return false;
+	}
+
+	if (!out_valid and (TranscodeResult::npos == io_error_index))
+	{
+		io_error_index = start;
+	}
+
+	return true;
+}
+
+
+/*------------------------------------------------------------------------------
+	Scalar narrower for UTF-16 or UTF-32 input (as per CHAR_T), starting from
+	io_index, which must lie on a code point boundary. Sequences are decoded
+	until io_index reaches in_end; since a surrogate pair is consumed whole,
+	io_index may end up one past in_end. Return false if the output buffer
+	fills up first.
+*/
+
+template <typename CHAR_T>
+inline bool
+UTF_Narrow_Scalar (
+	std::basic_string_view <CHAR_T>	in_string,
+	std::size_t &			io_index,
+	std::size_t				in_end,
+	char * &				io_out,
+	const char *			in_out_end,
+	std::size_t &			io_error_index) noexcept
+{
+	while (io_index < in_end)
+	{
+		bool valid;
+
+		if (!Transcode_One (in_string, io_index, io_out, in_out_end,
+			io_error_index, valid))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+
+/*------------------------------------------------------------------------------
+	Counterpart to UTF_Narrow_Scalar that adds the number of bytes it would
+	have written to io_length instead of writing them.
+*/
+
+template <typename CHAR_T>
+inline void
+UTF_Narrow_Length_Scalar (
+	std::basic_string_view <CHAR_T>	in_string,
+	std::size_t &			io_index,
+	std::size_t				in_end,
+	std::size_t &			io_length) noexcept
+{
+	while (io_index < in_end)
+	{
+		char32_t code_point;
+
+		if (!UTF_Decode (in_string, io_index, code_point))
+		{
+			code_point = CODE_POINT_replacement;
+		}
+
+		io_length += UTF8_Code_Point_Length (code_point);
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Count the code points in [io_index, in_end) of a string that is known to
+	be valid UTF-8, along with how many of those lie outside the BMP (i.e.,
+	have 4-byte sequences).
+*/
+
+inline void
+UTF8_Count_Valid_Scalar (
+	std::string_view		in_string,
+	std::size_t &			io_index,
+	std::size_t				in_end,
+	std::size_t &			io_code_points,
+	std::size_t &			io_supplementary) noexcept
+{
+	for (; io_index < in_end; ++io_index)
+	{
+		auto b = static_cast <uint8_t> (in_string [io_index]);
+
+		io_code_points += !UTF8_Is_Trail_Byte (b);
+		io_supplementary += (b >= 0xF0u);
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Count the lead surrogates in [io_index, in_end) that are immediately
+	followed by a trail surrogate, since UTF_Decode consumes each of those as
+	a single sequence, along with how many of those pairs encode
+	noncharacters (U+nFFFE and U+nFFFF). Note that the trail surrogate may lie
+	past in_end.
+*/
+
+template <typename CHAR_T>
+inline void
+UTF16_Count_Pairs_Scalar (
+	std::basic_string_view <CHAR_T>	in_string,
+	std::size_t &			io_index,
+	std::size_t				in_end,
+	std::size_t &			io_pairs,
+	std::size_t &			io_nonchar_pairs) noexcept
+{
+	for (; io_index < in_end; ++io_index)
+	{
+		if (Is_Lead_Surrogate (in_string [io_index]) and
+			((io_index + 1) < in_string.size()) and
+			Is_Trail_Surrogate (in_string [io_index + 1]))
+		{
+			auto lead = static_cast <uint32_t> (in_string [io_index]);
+			auto trail = static_cast <uint32_t> (in_string [io_index + 1]);
+
+			++io_pairs;
+			io_nonchar_pairs += ((lead & 0x3Fu) == 0x3Fu) and
+				((trail & 0x3FEu) == 0x3FEu);
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Count the valid characters in [io_index, in_end) of a UTF-32 string that
+	lie outside the BMP.
+*/
+
+template <typename CHAR_T>
+inline void
+UTF32_Count_Supplementary_Scalar (
+	std::basic_string_view <CHAR_T>	in_string,
+	std::size_t &			io_index,
+	std::size_t				in_end,
+	std::size_t &			io_supplementary) noexcept
+{
+	for (; io_index < in_end; ++io_index)
+	{
+		auto code_point = static_cast <char32_t> (in_string [io_index]);
+
+		io_supplementary += !Is_In_BMP (code_point) and Is_Char (code_point);
+	}
+}
+
+
+#if LUL_TEMP_VEC_KERNELS
+
+/*------------------------------------------------------------------------------
+	Vector Primitives
+
+	A thin veneer over the intrinsics that lets us write each kernel once for
+	both the AVX2 (32-byte) and SSE4.2 (16-byte) instruction sets. Note that
+	shuffle-based table lookups operate on 128-bit lanes, so AVX2 tables are
+	simply the 16-byte tables broadcast to both lanes.
+*/
+
+#if LUL_TARGET_VEC_AVX2
+	using Vec = __m256i;
+
+	constexpr std::size_t k_vec_size {32};
+
+	inline Vec Vec_Load (const void * p)
+		{ return _mm256_loadu_si256 (static_cast <const __m256i *> (p)); }
+
+	inline void Vec_Store (void * p, Vec a)
+		{ _mm256_storeu_si256 (static_cast <__m256i *> (p), a); }
+
+	inline Vec Vec_Load_Table (const uint8_t * p)
+		{ return _mm256_broadcastsi128_si256 (
+			_mm_loadu_si128 (reinterpret_cast <const __m128i *> (p))); }
+
+	inline Vec Vec_Zero() { return _mm256_setzero_si256(); }
+	inline Vec Vec_Splat (uint8_t b) { return _mm256_set1_epi8 (static_cast <char> (b)); }
+	inline Vec Vec_Splat_16 (uint16_t w) { return _mm256_set1_epi16 (static_cast <short> (w)); }
+	inline Vec Vec_Splat_32 (uint32_t w) { return _mm256_set1_epi32 (static_cast <int> (w)); }
+
+	inline Vec Vec_And (Vec a, Vec b) { return _mm256_and_si256 (a, b); }
+	inline Vec Vec_Or (Vec a, Vec b) { return _mm256_or_si256 (a, b); }
+	inline Vec Vec_Xor (Vec a, Vec b) { return _mm256_xor_si256 (a, b); }
+	inline Vec Vec_Eq (Vec a, Vec b) { return _mm256_cmpeq_epi8 (a, b); }
+	inline Vec Vec_Max (Vec a, Vec b) { return _mm256_max_epu8 (a, b); }
+	inline Vec Vec_Min (Vec a, Vec b) { return _mm256_min_epu8 (a, b); }
+	inline Vec Vec_Sub (Vec a, Vec b) { return _mm256_sub_epi8 (a, b); }
+	inline Vec Vec_Sub_Sat (Vec a, Vec b) { return _mm256_subs_epu8 (a, b); }
+	inline Vec Vec_Lookup (Vec t, Vec i) { return _mm256_shuffle_epi8 (t, i); }
+
+	inline Vec Vec_Shr4 (Vec a)
+		{ return _mm256_and_si256 (_mm256_srli_epi16 (a, 4), Vec_Splat (0x0F)); }
+
+	//	Return a vector of the bytes N positions earlier in the stream than
+	//	those in a, pulling from b as needed.
+	template <int N>
+	inline Vec Vec_Prev (Vec a, Vec b)
+		{ return _mm256_alignr_epi8 (a,
+			_mm256_permute2x128_si256 (b, a, 0x21), 16 - N); }
+
+	inline bool Vec_Any (Vec a) { return !_mm256_testz_si256 (a, a); }
+	inline bool Vec_Is_ASCII (Vec a) { return 0 == _mm256_movemask_epi8 (a); }
+#else
+	using Vec = __m128i;
+
+	constexpr std::size_t k_vec_size {16};
+
+	inline Vec Vec_Load (const void * p)
+		{ return _mm_loadu_si128 (static_cast <const __m128i *> (p)); }
+
+	inline void Vec_Store (void * p, Vec a)
+		{ _mm_storeu_si128 (static_cast <__m128i *> (p), a); }
+
+	inline Vec Vec_Load_Table (const uint8_t * p)
+		{ return _mm_loadu_si128 (reinterpret_cast <const __m128i *> (p)); }
+
+	inline Vec Vec_Zero() { return _mm_setzero_si128(); }
+	inline Vec Vec_Splat (uint8_t b) { return _mm_set1_epi8 (static_cast <char> (b)); }
+	inline Vec Vec_Splat_16 (uint16_t w) { return _mm_set1_epi16 (static_cast <short> (w)); }
+	inline Vec Vec_Splat_32 (uint32_t w) { return _mm_set1_epi32 (static_cast <int> (w)); }
+
+	inline Vec Vec_And (Vec a, Vec b) { return _mm_and_si128 (a, b); }
+	inline Vec Vec_Or (Vec a, Vec b) { return _mm_or_si128 (a, b); }
+	inline Vec Vec_Xor (Vec a, Vec b) { return _mm_xor_si128 (a, b); }
+	inline Vec Vec_Eq (Vec a, Vec b) { return _mm_cmpeq_epi8 (a, b); }
+	inline Vec Vec_Max (Vec a, Vec b) { return _mm_max_epu8 (a, b); }
+	inline Vec Vec_Min (Vec a, Vec b) { return _mm_min_epu8 (a, b); }
+	inline Vec Vec_Sub (Vec a, Vec b) { return _mm_sub_epi8 (a, b); }
+	inline Vec Vec_Sub_Sat (Vec a, Vec b) { return _mm_subs_epu8 (a, b); }
+	inline Vec Vec_Lookup (Vec t, Vec i) { return _mm_shuffle_epi8 (t, i); }
+
+	inline Vec Vec_Shr4 (Vec a)
+		{ return _mm_and_si128 (_mm_srli_epi16 (a, 4), Vec_Splat (0x0F)); }
+
+	template <int N>
+	inline Vec Vec_Prev (Vec a, Vec b)
+		{ return _mm_alignr_epi8 (a, b, 16 - N); }
+
+	inline bool Vec_Any (Vec a) { return !_mm_testz_si128 (a, a); }
+	inline bool Vec_Is_ASCII (Vec a) { return 0 == _mm_movemask_epi8 (a); }
+#endif	//	LUL_TARGET_VEC_AVX2
+
+
+/*------------------------------------------------------------------------------
+	Vector counterpart to ASCII_Prefix_Scalar. Four vectors are checked at a
+	time, and then single vectors, stopping at the first one containing a
+	non-ASCII code unit; the return value is a whole number of vectors, and
+	the caller is expected to pin down the end of the run with the scalar
+	code.
+*/
+
+template <typename CHAR_T>
+inline Vec
+Vec_ASCII_Mask() noexcept
+{
+	if constexpr (sizeof (CHAR_T) == 1)
+	{
+		return Vec_Splat (0x80u);
+	}
+	else if constexpr (sizeof (CHAR_T) == 2)
+	{
+		return Vec_Splat_16 (0xFF80u);
+	}
+	else
+	{
+		return Vec_Splat_32 (0xFFFFFF80u);
+	}
+}
+
+
+template <typename CHAR_T>
+inline std::size_t
+ASCII_Prefix_Vec (
+	const CHAR_T *			in_data,
+	std::size_t				in_size) noexcept
+{
+	constexpr std::size_t k_units {k_vec_size / sizeof (CHAR_T)};
+
+	auto mask = Vec_ASCII_Mask <CHAR_T>();
+	std::size_t nrv = 0;
+
+	for (; (nrv + (4 * k_units)) <= in_size; nrv += (4 * k_units))
+	{
+		auto input = Vec_Or (
+			Vec_Or (Vec_Load (in_data + nrv), Vec_Load (in_data + nrv + k_units)),
+			Vec_Or (Vec_Load (in_data + nrv + (2 * k_units)),
+				Vec_Load (in_data + nrv + (3 * k_units))));
+
+		if (Vec_Any (Vec_And (input, mask))) break;
+	}
+
+	for (; (nrv + k_units) <= in_size; nrv += k_units)
+	{
+		if (Vec_Any (Vec_And (Vec_Load (in_data + nrv), mask))) break;
+	}
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Vector counterparts to ASCII_Fold_Scalar and ASCII_Fold_Mismatch_Scalar;
+	as with ASCII_Prefix_Vec, they stop at the first vector that needs a
+	closer look, and leave the rest to the scalar code. A byte is folded by
+	subtracting 'A', so that A-Z become 0-25 and everything else wraps
+	around to something larger, and then setting bit 5 of those that made
+	the cut.
+*/
+
+inline Vec
+Vec_ASCII_Fold (
+	Vec						in_input) noexcept
+{
+	auto offset = Vec_Sub (in_input, Vec_Splat ('A'));
+	auto is_upper = Vec_Eq (Vec_Min (offset, Vec_Splat ('Z' - 'A')), offset);
+
+	return Vec_Or (in_input, Vec_And (is_upper, Vec_Splat ('a' - 'A')));
+}
+
+
+inline std::size_t
+ASCII_Fold_Vec (
+	const char *			in_data,
+	std::size_t				in_size,
+	char *					out_buffer) noexcept
+{
+	std::size_t nrv = 0;
+
+	for (; (nrv + k_vec_size) <= in_size; nrv += k_vec_size)
+	{
+		auto input = Vec_Load (in_data + nrv);
+
+		if (!Vec_Is_ASCII (input)) break;
+
+		Vec_Store (out_buffer + nrv, Vec_ASCII_Fold (input));
+	}
+
+	return nrv;
+}
+
+
+inline std::size_t
+ASCII_Fold_Mismatch_Vec (
+	const char *			in_lhs,
+	const char *			in_rhs,
+	std::size_t				in_size) noexcept
+{
+	std::size_t nrv = 0;
+
+	for (; (nrv + k_vec_size) <= in_size; nrv += k_vec_size)
+	{
+		auto lhs = Vec_Load (in_lhs + nrv);
+		auto rhs = Vec_Load (in_rhs + nrv);
+
+		if (!Vec_Is_ASCII (Vec_Or (lhs, rhs))) break;
+		if (Vec_Any (Vec_Xor (Vec_ASCII_Fold (lhs), Vec_ASCII_Fold (rhs)))) break;
+	}
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	UTF-8 Validation Tables
+
+	Each error class gets a bit; a byte pair is in error if the bits selected
+	by the high nibble of the first byte, the low nibble of the first byte,
+	and the high nibble of the second byte have a bit in common.
+*/
+
+constexpr uint8_t k_too_short		{1 << 0};	//	11______ 0_______
+												//	11______ 11______
+constexpr uint8_t k_too_long		{1 << 1};	//	0_______ 10______
+constexpr uint8_t k_overlong_3		{1 << 2};	//	11100000 100_____
+constexpr uint8_t k_too_large		{1 << 3};	//	11110100 1001____
+												//	11110100 101_____
+												//	11110101 1001____
+												//	11110101 101_____
+												//	1111011_ 1001____
+												//	1111011_ 101_____
+												//	11111___ 1001____
+												//	11111___ 101_____
+constexpr uint8_t k_surrogate		{1 << 4};	//	11101101 101_____
+constexpr uint8_t k_overlong_2		{1 << 5};	//	1100000_ 10______
+constexpr uint8_t k_too_large_1000	{1 << 6};	//	11110101 1000____
+												//	1111011_ 1000____
+												//	11111___ 1000____
+constexpr uint8_t k_overlong_4		{1 << 6};	//	11110000 1000____
+constexpr uint8_t k_two_conts		{1 << 7};	//	10______ 10______
+
+constexpr uint8_t k_carry {k_too_short | k_too_long | k_two_conts};
+
+alignas (16) constexpr uint8_t
+k_byte_1_high [16] =
+{
+	//	0_______ ________	ASCII
+	k_too_long, k_too_long, k_too_long, k_too_long,
+	k_too_long, k_too_long, k_too_long, k_too_long,
+
+	//	10______ ________	continuation
+	k_two_conts, k_two_conts, k_two_conts, k_two_conts,
+
+	//	1100____ ________	2-byte lead
+	k_too_short | k_overlong_2,
+
+	//	1101____ ________	2-byte lead
+	k_too_short,
+
+	//	1110____ ________	3-byte lead
+	k_too_short | k_overlong_3 | k_surrogate,
+
+	//	1111____ ________	4+-byte lead
+	k_too_short | k_too_large | k_too_large_1000 | k_overlong_4
+};
+
+alignas (16) constexpr uint8_t
+k_byte_1_low [16] =
+{
+	//	____0000 ________
+	k_carry | k_overlong_3 | k_overlong_2 | k_overlong_4,
+
+	//	____0001 ________
+	k_carry | k_overlong_2,
+
+	//	____001_ ________
+	k_carry,
+	k_carry,
+
+	//	____0100 ________
+	k_carry | k_too_large,
+
+	//	____0101 ________
+	k_carry | k_too_large | k_too_large_1000,
+
+	//	____011_ ________
+	k_carry | k_too_large | k_too_large_1000,
+	k_carry | k_too_large | k_too_large_1000,
+
+	//	____1___ ________
+	k_carry | k_too_large | k_too_large_1000,
+	k_carry | k_too_large | k_too_large_1000,
+	k_carry | k_too_large | k_too_large_1000,
+	k_carry | k_too_large | k_too_large_1000,
+	k_carry | k_too_large | k_too_large_1000,
+
+	//	____1101 ________
+	k_carry | k_too_large | k_too_large_1000 | k_surrogate,
+
+	k_carry | k_too_large | k_too_large_1000,
+	k_carry | k_too_large | k_too_large_1000
+};
+
+alignas (16) constexpr uint8_t
+k_byte_2_high [16] =
+{
+	//	________ 0_______	ASCII
+	k_too_short, k_too_short, k_too_short, k_too_short,
+	k_too_short, k_too_short, k_too_short, k_too_short,
+
+	//	________ 1000____
+	k_too_long | k_overlong_2 | k_two_conts | k_overlong_3 |
+		k_too_large_1000 | k_overlong_4,
+
+	//	________ 1001____
+	k_too_long | k_overlong_2 | k_two_conts | k_overlong_3 | k_too_large,
+
+	//	________ 101_____
+	k_too_long | k_overlong_2 | k_two_conts | k_surrogate | k_too_large,
+	k_too_long | k_overlong_2 | k_two_conts | k_surrogate | k_too_large,
+
+	//	________ 11______	lead
+	k_too_short, k_too_short, k_too_short, k_too_short
+};
+
+//	If the last bytes of a block exceed these values, the block ends with an
+//	incomplete sequence (1111____ 111_____ 11______ in the last three bytes).
+alignas (16) constexpr uint8_t
+k_incomplete_max [32] =
+{
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+};
+
+
+/*------------------------------------------------------------------------------
+	Flag the structural errors that can be detected by looking at adjacent
+	byte pairs: overlong encodings, surrogates, values past U+10FFFF, and
+	continuation bytes in the wrong place (subject to the multibyte length
+	check below).
+*/
+
+inline Vec
+UTF8_Check_Special_Cases (
+	Vec						in_input,
+	Vec						in_prev1)
+{
+	auto byte_1_high = Vec_Lookup (
+		Vec_Load_Table (k_byte_1_high), Vec_Shr4 (in_prev1));
+
+	auto byte_1_low = Vec_Lookup (
+		Vec_Load_Table (k_byte_1_low), Vec_And (in_prev1, Vec_Splat (0x0F)));
+
+	auto byte_2_high = Vec_Lookup (
+		Vec_Load_Table (k_byte_2_high), Vec_Shr4 (in_input));
+
+	return Vec_And (Vec_And (byte_1_high, byte_1_low), byte_2_high);
+}
+
+
+/*------------------------------------------------------------------------------
+	The third and fourth bytes of 3- and 4-byte sequences must be
+	continuations; they’re the only places where two continuation bytes in a
+	row are legal. Any mismatch between “must be a continuation” and the
+	k_two_conts flag from the special case check is an error.
+*/
+
+inline Vec
+UTF8_Check_Multibyte_Lengths (
+	Vec						in_prev2,
+	Vec						in_prev3,
+	Vec						in_special_cases)
+{
+	//	Only 111_____ will be >= 0x80 after this.
+	auto is_third_byte = Vec_Sub_Sat (in_prev2, Vec_Splat (0xE0 - 0x80));
+
+	//	Only 1111____ will be >= 0x80 after this.
+	auto is_fourth_byte = Vec_Sub_Sat (in_prev3, Vec_Splat (0xF0 - 0x80));
+
+	auto must_be_continuation = Vec_And (
+		Vec_Or (is_third_byte, is_fourth_byte), Vec_Splat (0x80));
+
+	return Vec_Xor (must_be_continuation, in_special_cases);
+}
+
+
+/*------------------------------------------------------------------------------
+	Flag the final byte of any encoded noncharacter; UTF_Decode rejects these
+	(see Is_Char), so we must as well. This check is only meaningful for
+	structurally valid input, which is fine since any other input is already
+	in error. The noncharacters take the following forms:
+
+		[U+FDD0, U+FDEF]		11101111 10110111 10[01]_____
+		U+FFFE, U+FFFF			11101111 10111111 1011111_
+		U+nFFFE, U+nFFFF		11110___ 10__1111 10111111 1011111_
+*/
+
+inline Vec
+UTF8_Check_Noncharacters (
+	Vec						in_input,
+	Vec						in_prev1,
+	Vec						in_prev2,
+	Vec						in_prev3)
+{
+	auto prev2_is_ef = Vec_Eq (in_prev2, Vec_Splat (0xEF));
+
+	//	[U+FDD0, U+FDEF]
+	auto offset = Vec_Sub (in_input, Vec_Splat (0x90));
+	auto fdd0 = Vec_And (
+		Vec_And (prev2_is_ef, Vec_Eq (in_prev1, Vec_Splat (0xB7))),
+		Vec_Eq (Vec_Min (offset, Vec_Splat (0x1F)), offset));
+
+	//	U+nFFFE, U+nFFFF, including the BMP
+	auto prev3_is_lead_4 = Vec_Eq (
+		Vec_Max (in_prev3, Vec_Splat (0xF0)), in_prev3);
+	auto prev2_is_plane_end = Vec_Eq (
+		Vec_And (in_prev2, Vec_Splat (0x0F)), Vec_Splat (0x0F));
+	auto fffe = Vec_And (
+		Vec_And (
+			Vec_Eq (Vec_Or (in_input, Vec_Splat (0x01)), Vec_Splat (0xBF)),
+			Vec_Eq (in_prev1, Vec_Splat (0xBF))),
+		Vec_Or (prev2_is_ef, Vec_And (prev3_is_lead_4, prev2_is_plane_end)));
+
+	return Vec_Or (fdd0, fffe);
+}
+
+
+/*------------------------------------------------------------------------------
+	Vector validator; see UTF8_Valid_Prefix for details. Whole blocks are
+	checked with vector operations, and the tail is handed off to the scalar
+	validator. Note that error bits for a given byte are only ever set while
+	processing the block containing that byte, so when a block fails, all of
+	the preceding blocks are good up to the start of the sequence straddling
+	the boundary (if any).
+*/
+
+std::size_t
+UTF8_Valid_Prefix_Vec (
+	std::string_view		in_string) noexcept
+{
+	auto data = in_string.data();
+	auto size = in_string.size();
+	auto incomplete_max = Vec_Load (k_incomplete_max + 32 - k_vec_size);
+	auto prev_input = Vec_Zero();
+	auto prev_incomplete = Vec_Zero();
+	std::size_t index = 0;
+
+	for (; (index + k_vec_size) <= size; index += k_vec_size)
+	{
+		auto input = Vec_Load (data + index);
+		auto error = prev_incomplete;
+
+		if (Vec_Is_ASCII (input))
+		{
+			prev_incomplete = Vec_Zero();
+		}
+		else
+		{
+			auto prev1 = Vec_Prev <1> (input, prev_input);
+			auto prev2 = Vec_Prev <2> (input, prev_input);
+			auto prev3 = Vec_Prev <3> (input, prev_input);
+			auto special_cases = UTF8_Check_Special_Cases (input, prev1);
+
+			error = UTF8_Check_Multibyte_Lengths (prev2, prev3, special_cases);
+			error = Vec_Or (error,
+				UTF8_Check_Noncharacters (input, prev1, prev2, prev3));
+
+			prev_incomplete = Vec_Sub_Sat (input, incomplete_max);
+		}
+
+		if (Vec_Any (error))
+		{
+			return UTF8_Sequence_Start (in_string, index);
+		}
+
+		prev_input = input;
+	}
+
+	return UTF8_Valid_Prefix_Scalar (in_string,
+		UTF8_Sequence_Start (in_string, index));
+}
+
+
+/*------------------------------------------------------------------------------
+	UTF-8 Widening Tables
+
+	The widening kernel works on 12-byte windows of validated UTF-8. Given a
+	mask of which bytes in the window end a code point, it picks one of three
+	strategies, each of which gathers the bytes of a fixed number of code
+	points into fixed-width lanes with a single shuffle:
+
+		6 code points of 1-2 bytes each, gathered into 16-bit lanes
+		4 code points of 1-3 bytes each, gathered into 32-bit lanes
+		3 code points of 1-4 bytes each, gathered into 32-bit lanes
+
+	Bytes are gathered last-byte-first so that the payload bits line up the
+	same way regardless of sequence length. Since a shuffle pattern depends
+	only on the strategy and the lengths of the code points it gathers, there
+	are 2^6 + 3^4 + 4^3 = 209 patterns in all. k_index maps each of the 4096
+	possible end masks to a pattern and the number of bytes it consumes; a
+	pattern index of k_shuffle_count means the window isn’t valid UTF-8,
+	which can’t happen in practice since the input is validated first.
+
+	The tables are generated at compile-time rather than spelled out.
+*/
+
+constexpr std::size_t k_shuffle_2_base {0};
+constexpr std::size_t k_shuffle_3_base {64};
+constexpr std::size_t k_shuffle_4_base {64 + 81};
+constexpr std::size_t k_shuffle_count {64 + 81 + 64};
+
+constexpr uint8_t k_shuffle_zero {0x80};
+
+struct UTF8WidenTables
+{
+	uint8_t					shuffle [k_shuffle_count][16];
+	uint8_t					index [4096][2];
+};
+
+
+//	Fill in the shuffle pattern for in_count code points with the given
+//	lengths, using lanes of in_lane_size bytes.
+constexpr void
+Make_UTF8_Shuffle (
+	uint8_t *				out_shuffle,
+	const std::size_t *		in_lengths,
+	std::size_t				in_count,
+	std::size_t				in_lane_size)
+{
+	for (std::size_t i = 0; i < 16; ++i)
+	{
+		out_shuffle [i] = k_shuffle_zero;
+	}
+
+	std::size_t start = 0;
+
+	for (std::size_t cp = 0; cp < in_count; ++cp)
+	{
+		for (std::size_t b = 0; b < in_lengths [cp]; ++b)
+		{
+			out_shuffle [cp * in_lane_size + b] =
+				static_cast <uint8_t> (start + in_lengths [cp] - 1 - b);
+		}
+
+		start += in_lengths [cp];
+	}
+}
+
+
+constexpr UTF8WidenTables
+Make_UTF8_Widen_Tables()
+{
+	UTF8WidenTables nrv {};
+	std::size_t lengths [6] {};
+
+	//	The shuffle patterns are indexed by treating the code point lengths
+	//	(less one) as the digits of a number in base 2, 3, or 4.
+	for (std::size_t i = 0; i < 64; ++i)
+	{
+		for (std::size_t cp = 0; cp < 6; ++cp) lengths [cp] = 1 + ((i >> cp) & 1);
+		Make_UTF8_Shuffle (nrv.shuffle [k_shuffle_2_base + i], lengths, 6, 2);
+	}
+
+	for (std::size_t i = 0; i < 81; ++i)
+	{
+		for (std::size_t cp = 0, n = i; cp < 4; ++cp, n /= 3) lengths [cp] = 1 + (n % 3);
+		Make_UTF8_Shuffle (nrv.shuffle [k_shuffle_3_base + i], lengths, 4, 4);
+	}
+
+	for (std::size_t i = 0; i < 64; ++i)
+	{
+		for (std::size_t cp = 0; cp < 3; ++cp) lengths [cp] = 1 + ((i >> (2 * cp)) & 3);
+		Make_UTF8_Shuffle (nrv.shuffle [k_shuffle_4_base + i], lengths, 3, 4);
+	}
+
+	for (std::size_t mask = 0; mask < 4096; ++mask)
+	{
+		std::size_t ends [12] {};
+		std::size_t count = 0;
+
+		for (std::size_t b = 0; b < 12; ++b)
+		{
+			if (mask & (std::size_t {1} << b)) ends [count++] = b + 1;
+		}
+
+		//	Returns the digit-encoded lengths of the first n code points if
+		//	they all fit in the given base, or k_shuffle_count otherwise.
+		auto encode = [&ends, count] (std::size_t n, std::size_t base)
+		{
+			if (count < n) return k_shuffle_count;
+
+			std::size_t code = 0;
+
+			for (std::size_t cp = n; cp-- > 0; )
+			{
+				auto length = ends [cp] - ((cp > 0) ? ends [cp - 1] : 0);
+
+				if (length > base) return k_shuffle_count;
+				code = (code * base) + (length - 1);
+			}
+
+			return code;
+		};
+
+		auto shuffle = k_shuffle_count;
+		std::size_t consumed = 0;
+
+		if (auto code = encode (6, 2); code != k_shuffle_count)
+		{
+			shuffle = k_shuffle_2_base + code;
+			consumed = ends [5];
+		}
+		else if (code = encode (4, 3); code != k_shuffle_count)
+		{
+			shuffle = k_shuffle_3_base + code;
+			consumed = ends [3];
+		}
+		else if (code = encode (3, 4); code != k_shuffle_count)
+		{
+			shuffle = k_shuffle_4_base + code;
+			consumed = ends [2];
+		}
+
+		nrv.index [mask][0] = static_cast <uint8_t> (shuffle);
+		nrv.index [mask][1] = static_cast <uint8_t> (consumed);
+	}
+
+	return nrv;
+}
+
+alignas (16) constexpr UTF8WidenTables k_utf8_widen_tables {Make_UTF8_Widen_Tables()};
+
+
+/*------------------------------------------------------------------------------
+	Store 8 16-bit values from in_values as UTF-16 or UTF-32, as per CHAR_T.
+*/
+
+template <typename CHAR_T>
+inline void
+Store_16 (
+	__m128i					in_values,
+	CHAR_T *				out_data) noexcept
+{
+	auto out = reinterpret_cast <__m128i *> (out_data);
+
+	if constexpr (sizeof (CHAR_T) == sizeof (char16_t))
+	{
+		_mm_storeu_si128 (out, in_values);
+	}
+	else
+	{
+		_mm_storeu_si128 (out, _mm_cvtepu16_epi32 (in_values));
+		_mm_storeu_si128 (out + 1, _mm_cvtepu16_epi32 (
+			_mm_srli_si128 (in_values, 8)));
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Store 4 32-bit values from in_values as UTF-16 or UTF-32, as per CHAR_T.
+	The values must all lie in the BMP.
+*/
+
+template <typename CHAR_T>
+inline void
+Store_32 (
+	__m128i					in_values,
+	CHAR_T *				out_data) noexcept
+{
+	auto out = reinterpret_cast <__m128i *> (out_data);
+
+	if constexpr (sizeof (CHAR_T) == sizeof (char16_t))
+	{
+		_mm_storeu_si128 (out, _mm_packus_epi32 (in_values, in_values));
+	}
+	else
+	{
+		_mm_storeu_si128 (out, in_values);
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Widen one 16-byte block of valid UTF-8 starting at in_data, which must lie
+	on a code point boundary. in_next_is_start indicates whether the byte
+	following the block starts a new code point. Return the number of bytes
+	consumed, which is always at least 3 for valid input; io_out is advanced
+	past the output. Up to 16 code units may be written.
+*/
+
+template <typename CHAR_T>
+inline std::size_t
+UTF8_Widen_Block (
+	const char *			in_data,
+	bool					in_next_is_start,
+	CHAR_T * &				io_out) noexcept
+{
+	auto input = _mm_loadu_si128 (reinterpret_cast <const __m128i *> (in_data));
+
+	//	All ASCII; just zero-extend.
+	if (0 == _mm_movemask_epi8 (input))
+	{
+		Store_16 (_mm_cvtepu8_epi16 (input), io_out);
+		Store_16 (_mm_cvtepu8_epi16 (_mm_srli_si128 (input, 8)), io_out + 8);
+		io_out += 16;
+
+		return 16;
+	}
+
+	//	ASCII followed by something else; take the ASCII half on its own, as
+	//	that’s cheaper than the general case and catches the common pattern of
+	//	mostly-ASCII text with the occasional accented letter.
+	if (0 == (_mm_movemask_epi8 (input) & 0xFF))
+	{
+		Store_16 (_mm_cvtepu8_epi16 (input), io_out);
+		io_out += 8;
+
+		return 8;
+	}
+
+	//	Bit i of starts is set if byte i starts a code point, so bit i of ends
+	//	is set if byte i ends one.
+	auto continuations = _mm_cmplt_epi8 (input, _mm_set1_epi8 (-64));
+	auto starts = static_cast <unsigned> (
+		~_mm_movemask_epi8 (continuations)) & 0xFFFFu;
+	auto ends = (starts >> 1) & 0x0FFFu;
+
+	//	Eight 2-byte sequences, e.g., Cyrillic or Greek text.
+	if ((0x5555u == starts) and in_next_is_start)
+	{
+		auto swapped = _mm_shuffle_epi8 (input, _mm_setr_epi8 (
+			1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14));
+		auto low = _mm_and_si128 (swapped, _mm_set1_epi16 (0x007F));
+		auto high = _mm_and_si128 (swapped, _mm_set1_epi16 (0x1F00));
+
+		Store_16 (_mm_or_si128 (low, _mm_srli_epi16 (high, 2)), io_out);
+		io_out += 8;
+
+		return 16;
+	}
+
+	auto shuffle_index = k_utf8_widen_tables.index [ends][0];
+	auto consumed = k_utf8_widen_tables.index [ends][1];
+
+	if (shuffle_index >= k_shuffle_count)
+	{
+		//	Not valid UTF-8; this can’t happen, but be safe and let the
+		//	scalar code deal with it.
+		return 0;
+	}
+
+	auto shuffled = _mm_shuffle_epi8 (input, _mm_loadu_si128 (
+		reinterpret_cast <const __m128i *> (
+			k_utf8_widen_tables.shuffle [shuffle_index])));
+
+	if (shuffle_index < k_shuffle_3_base)
+	{
+		//	6 code points in 16-bit lanes: [last byte, lead byte or 0]
+		auto low = _mm_and_si128 (shuffled, _mm_set1_epi16 (0x007F));
+		auto high = _mm_and_si128 (shuffled, _mm_set1_epi16 (0x1F00));
+
+		Store_16 (_mm_or_si128 (low, _mm_srli_epi16 (high, 2)), io_out);
+		io_out += 6;
+	}
+	else if (shuffle_index < k_shuffle_4_base)
+	{
+		//	4 code points in 32-bit lanes: [last, middle, lead, 0]
+		auto low = _mm_and_si128 (shuffled, _mm_set1_epi32 (0x0000007F));
+		auto middle = _mm_and_si128 (shuffled, _mm_set1_epi32 (0x00003F00));
+		auto high = _mm_and_si128 (shuffled, _mm_set1_epi32 (0x000F0000));
+
+		Store_32 (_mm_or_si128 (_mm_or_si128 (low, _mm_srli_epi32 (middle, 2)),
+			_mm_srli_epi32 (high, 4)), io_out);
+		io_out += 4;
+	}
+	else
+	{
+		//	3 code points in 32-bit lanes: [last, third, second, lead]. When
+		//	the third byte from the end is a 3-byte lead, its marker leaves a
+		//	spurious bit that we clear using the bit just above it.
+		auto low = _mm_and_si128 (shuffled, _mm_set1_epi32 (0x0000007F));
+		auto middle = _mm_and_si128 (shuffled, _mm_set1_epi32 (0x00003F00));
+		auto upper = _mm_and_si128 (shuffled, _mm_set1_epi32 (0x003F0000));
+		auto correction = _mm_srli_epi32 (
+			_mm_and_si128 (shuffled, _mm_set1_epi32 (0x00400000)), 1);
+		auto high = _mm_and_si128 (shuffled, _mm_set1_epi32 (0x07000000));
+
+		upper = _mm_xor_si128 (upper, correction);
+
+		auto code_points = _mm_or_si128 (
+			_mm_or_si128 (low, _mm_srli_epi32 (middle, 2)),
+			_mm_or_si128 (_mm_srli_epi32 (upper, 4), _mm_srli_epi32 (high, 6)));
+
+		alignas (16) uint32_t buffer [4];
+
+		_mm_store_si128 (reinterpret_cast <__m128i *> (buffer), code_points);
+
+		for (std::size_t i = 0; i < 3; ++i)
+		{
+			Put_Code_Point (static_cast <char32_t> (buffer [i]), io_out);
+		}
+	}
+
+	return consumed;
+}
+
+
+/*------------------------------------------------------------------------------
+	Vector widener for [io_index, in_end), which must be valid UTF-8 ending
+	on a code point boundary. Whatever doesn’t fit in a whole block, or
+	would let a block overrun in_out_end, is left for the scalar widener.
+*/
+
+template <typename CHAR_T>
+inline void
+UTF8_Widen_Valid_Vec (
+	std::string_view		in_string,
+	std::size_t &			io_index,
+	std::size_t				in_end,
+	CHAR_T * &				io_out,
+	const CHAR_T *			in_out_end) noexcept
+{
+	auto data = in_string.data();
+
+	while (((io_index + 16) <= in_end) and ((in_out_end - io_out) >= 16))
+	{
+		auto next_is_start = ((io_index + 16) == in_end) or
+			!UTF8_Is_Trail_Byte (static_cast <uint8_t> (data [io_index + 16]));
+		auto consumed = UTF8_Widen_Block (data + io_index, next_is_start, io_out);
+
+		if (0 == consumed) break;
+
+		io_index += consumed;
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	UTF-8 Narrowing Tables
+
+	The narrowing kernels encode 4 code points at a time in 32-bit lanes,
+	lead byte first, and then squeeze out the unused bytes with a single
+	shuffle. From UTF-32, each lane holds 1-4 bytes, giving 4^4 = 256 possible
+	patterns. From UTF-16, each lane holds 1-3 bytes, since each half of a
+	surrogate pair is responsible for 2 of the 4 bytes of its sequence, giving
+	3^4 = 81 patterns. As with the widening tables, patterns are indexed by
+	treating the lane lengths (less one) as digits. The spread tables map a
+	4-bit lane mask to those digits, so an index is a sum of lookups.
+*/
+
+struct UTF8NarrowTables
+{
+	uint8_t					shuffle_3 [81][16];
+	uint8_t					shuffle_4 [256][16];
+	uint8_t					length_3 [81];
+	uint8_t					length_4 [256];
+	uint8_t					spread_3 [16];
+	uint8_t					spread_4 [16];
+};
+
+
+//	Fill in the packing pattern for the lane lengths encoded in in_code, and
+//	return the total length.
+constexpr std::size_t
+Make_UTF8_Pack (
+	uint8_t *				out_shuffle,
+	std::size_t				in_code,
+	std::size_t				in_base)
+{
+	std::size_t length = 0;
+
+	for (std::size_t i = 0; i < 16; ++i)
+	{
+		out_shuffle [i] = k_shuffle_zero;
+	}
+
+	for (std::size_t lane = 0; lane < 4; ++lane, in_code /= in_base)
+	{
+		for (std::size_t b = 0; b <= (in_code % in_base); ++b)
+		{
+			out_shuffle [length++] = static_cast <uint8_t> ((lane * 4) + b);
+		}
+	}
+
+	return length;
+}
+
+
+constexpr UTF8NarrowTables
+Make_UTF8_Narrow_Tables()
+{
+	UTF8NarrowTables nrv {};
+
+	for (std::size_t i = 0; i < 81; ++i)
+	{
+		nrv.length_3 [i] = static_cast <uint8_t> (
+			Make_UTF8_Pack (nrv.shuffle_3 [i], i, 3));
+	}
+
+	for (std::size_t i = 0; i < 256; ++i)
+	{
+		nrv.length_4 [i] = static_cast <uint8_t> (
+			Make_UTF8_Pack (nrv.shuffle_4 [i], i, 4));
+	}
+
+	for (std::size_t mask = 0; mask < 16; ++mask)
+	{
+		for (std::size_t lane = 0, p3 = 1, p4 = 1; lane < 4; ++lane, p3 *= 3, p4 *= 4)
+		{
+			if (mask & (std::size_t {1} << lane))
+			{
+				nrv.spread_3 [mask] = static_cast <uint8_t> (nrv.spread_3 [mask] + p3);
+				nrv.spread_4 [mask] = static_cast <uint8_t> (nrv.spread_4 [mask] + p4);
+			}
+		}
+	}
+
+	return nrv;
+}
+
+alignas (16) constexpr UTF8NarrowTables k_utf8_narrow_tables {Make_UTF8_Narrow_Tables()};
+
+
+/*------------------------------------------------------------------------------
+	Lane helpers for the narrowing kernels. The Less functions perform
+	unsigned comparisons, returning all ones in each lane where a < in_bound.
+	The Mask functions gather the top bit of each lane into an integer.
+*/
+
+inline __m128i
+U16_Less (
+	__m128i					a,
+	uint16_t				in_bound) noexcept
+{
+	return _mm_cmpeq_epi16 (_mm_min_epu16 (a,
+		_mm_set1_epi16 (static_cast <short> (in_bound - 1))), a);
+}
+
+inline __m128i
+U32_Less (
+	__m128i					a,
+	uint32_t				in_bound) noexcept
+{
+	return _mm_cmpeq_epi32 (_mm_min_epu32 (a,
+		_mm_set1_epi32 (static_cast <int> (in_bound - 1))), a);
+}
+
+inline unsigned
+U16_Mask (
+	__m128i					a) noexcept
+{
+	return static_cast <unsigned> (_mm_movemask_epi8 (
+		_mm_packs_epi16 (a, _mm_setzero_si128())));
+}
+
+inline unsigned
+U32_Mask (
+	__m128i					a) noexcept
+{
+	return static_cast <unsigned> (_mm_movemask_ps (_mm_castsi128_ps (a)));
+}
+
+
+/*------------------------------------------------------------------------------
+	Encode the 4 code points in in_code as UTF-8 within their lanes, lead
+	byte first. The masks indicate which lanes are below U+0080, U+0800, and
+	U+10000, respectively.
+*/
+
+inline __m128i
+UTF8_Encode_Lanes (
+	__m128i					in_code,
+	__m128i					in_lt_80,
+	__m128i					in_lt_800,
+	__m128i					in_lt_10000) noexcept
+{
+	auto low_bits = _mm_set1_epi32 (0x3F);
+	auto trail = _mm_set1_epi32 (0x80);
+
+	auto trail_0 = _mm_or_si128 (_mm_and_si128 (in_code, low_bits), trail);
+	auto trail_1 = _mm_or_si128 (_mm_and_si128 (
+		_mm_srli_epi32 (in_code, 6), low_bits), trail);
+	auto trail_2 = _mm_or_si128 (_mm_and_si128 (
+		_mm_srli_epi32 (in_code, 12), low_bits), trail);
+
+	auto encoded_2 = _mm_or_si128 (
+		_mm_or_si128 (_mm_srli_epi32 (in_code, 6), _mm_set1_epi32 (0xC0)),
+		_mm_slli_epi32 (trail_0, 8));
+	auto encoded_3 = _mm_or_si128 (
+		_mm_or_si128 (_mm_srli_epi32 (in_code, 12), _mm_set1_epi32 (0xE0)),
+		_mm_or_si128 (_mm_slli_epi32 (trail_1, 8), _mm_slli_epi32 (trail_0, 16)));
+	auto encoded_4 = _mm_or_si128 (
+		_mm_or_si128 (
+			_mm_or_si128 (_mm_srli_epi32 (in_code, 18), _mm_set1_epi32 (0xF0)),
+			_mm_slli_epi32 (trail_2, 8)),
+		_mm_or_si128 (_mm_slli_epi32 (trail_1, 16), _mm_slli_epi32 (trail_0, 24)));
+
+	auto nrv = _mm_blendv_epi8 (encoded_4, encoded_3, in_lt_10000);
+
+	nrv = _mm_blendv_epi8 (nrv, encoded_2, in_lt_800);
+	nrv = _mm_blendv_epi8 (nrv, in_code, in_lt_80);
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Return true if all 4 code points in in_code are valid Unicode characters,
+	as per Is_Char.
+*/
+
+inline bool
+UTF32_Are_Chars (
+	__m128i					in_code) noexcept
+{
+	auto in_range = [in_code] (uint32_t in_first, uint32_t in_last)
+	{
+		return U32_Less (_mm_sub_epi32 (in_code,
+			_mm_set1_epi32 (static_cast <int> (in_first))), in_last - in_first + 1);
+	};
+
+	auto plane_end = _mm_set1_epi32 (0xFFFE);
+	auto bad = _mm_or_si128 (
+		_mm_or_si128 (in_range (0xD800u, 0xDFFFu), in_range (0xFDD0u, 0xFDEFu)),
+		_mm_cmpeq_epi32 (_mm_and_si128 (in_code, plane_end), plane_end));
+
+	bad = _mm_or_si128 (bad, _mm_xor_si128 (U32_Less (in_code, 0x110000u),
+		_mm_set1_epi32 (-1)));
+
+	return _mm_testz_si128 (bad, bad);
+}
+
+
+/*------------------------------------------------------------------------------
+	Narrow 4 valid code points to UTF-8, advancing io_out. Always writes 16
+	bytes.
+*/
+
+inline void
+UTF32_Narrow_Lanes (
+	__m128i					in_code,
+	char * &				io_out) noexcept
+{
+	auto lt_80 = U32_Less (in_code, 0x80u);
+	auto lt_800 = U32_Less (in_code, 0x800u);
+	auto lt_10000 = U32_Less (in_code, 0x10000u);
+	auto index = k_utf8_narrow_tables.spread_4 [~U32_Mask (lt_80) & 0x0Fu] +
+		k_utf8_narrow_tables.spread_4 [~U32_Mask (lt_800) & 0x0Fu] +
+		k_utf8_narrow_tables.spread_4 [~U32_Mask (lt_10000) & 0x0Fu];
+
+	auto encoded = UTF8_Encode_Lanes (in_code, lt_80, lt_800, lt_10000);
+	auto packed = _mm_shuffle_epi8 (encoded, _mm_loadu_si128 (
+		reinterpret_cast <const __m128i *> (k_utf8_narrow_tables.shuffle_4 [index])));
+
+	_mm_storeu_si128 (reinterpret_cast <__m128i *> (io_out), packed);
+	io_out += k_utf8_narrow_tables.length_4 [index];
+}
+
+
+/*------------------------------------------------------------------------------
+	Narrow 4 UTF-16 code units (zero-extended to 32 bits) to UTF-8, advancing
+	io_out by the number of bytes belonging to the first in_count units.
+	in_prev holds the unit preceding each one, which supplies the 2 bits of a
+	trail surrogate’s first byte that come from its lead. Surrogates must be
+	properly paired, except that the final unit may be a lead. Always writes
+	16 bytes.
+*/
+
+inline void
+UTF16_Narrow_Lanes (
+	__m128i					in_unit,
+	__m128i					in_prev,
+	std::size_t				in_count,
+	char * &				io_out) noexcept
+{
+	auto surrogate_bits = _mm_set1_epi32 (0xFC00);
+	auto is_lead = _mm_cmpeq_epi32 (_mm_and_si128 (in_unit, surrogate_bits),
+		_mm_set1_epi32 (0xD800));
+	auto is_trail = _mm_cmpeq_epi32 (_mm_and_si128 (in_unit, surrogate_bits),
+		_mm_set1_epi32 (0xDC00));
+	auto lt_80 = U32_Less (in_unit, 0x80u);
+	auto lt_800 = U32_Less (in_unit, 0x800u);
+	auto index = k_utf8_narrow_tables.spread_3 [~U32_Mask (lt_80) & 0x0Fu] +
+		k_utf8_narrow_tables.spread_3 [~U32_Mask (lt_800) & 0x0Fu] -
+		k_utf8_narrow_tables.spread_3 [U32_Mask (_mm_or_si128 (is_lead, is_trail))];
+
+	//	A lead surrogate contributes the first two bytes of the sequence, the
+	//	trail surrogate the last two. With u = (lead & 0x3FF) + 0x40, the code
+	//	point is (u << 10) | (trail & 0x3FF).
+	auto trail = _mm_set1_epi32 (0x80);
+	auto u = _mm_add_epi32 (_mm_and_si128 (in_unit, _mm_set1_epi32 (0x3FF)),
+		_mm_set1_epi32 (0x40));
+	auto lead_bytes = _mm_or_si128 (
+		_mm_or_si128 (_mm_srli_epi32 (u, 8), _mm_set1_epi32 (0xF0)),
+		_mm_slli_epi32 (_mm_or_si128 (_mm_and_si128 (_mm_srli_epi32 (u, 2),
+			_mm_set1_epi32 (0x3F)), trail), 8));
+	auto trail_bytes = _mm_or_si128 (
+		_mm_or_si128 (trail, _mm_or_si128 (
+			_mm_slli_epi32 (_mm_and_si128 (in_prev, _mm_set1_epi32 (0x03)), 4),
+			_mm_and_si128 (_mm_srli_epi32 (in_unit, 6), _mm_set1_epi32 (0x0F)))),
+		_mm_slli_epi32 (_mm_or_si128 (_mm_and_si128 (in_unit,
+			_mm_set1_epi32 (0x3F)), trail), 8));
+
+	auto encoded = UTF8_Encode_Lanes (in_unit, lt_80, lt_800, _mm_set1_epi32 (-1));
+
+	encoded = _mm_blendv_epi8 (encoded, lead_bytes, is_lead);
+	encoded = _mm_blendv_epi8 (encoded, trail_bytes, is_trail);
+
+	auto packed = _mm_shuffle_epi8 (encoded, _mm_loadu_si128 (
+		reinterpret_cast <const __m128i *> (k_utf8_narrow_tables.shuffle_3 [index])));
+
+	_mm_storeu_si128 (reinterpret_cast <__m128i *> (io_out), packed);
+
+	//	A lead in the last lane always contributes the last 2 bytes.
+	io_out += k_utf8_narrow_tables.length_3 [index] - ((in_count < 4) ? 2 : 0);
+}
+
+
+/*------------------------------------------------------------------------------
+	Classify a block of 8 UTF-16 code units. Return the number of units that
+	can be handled by the vector kernels, which is 8, or 7 if the last unit
+	is a lead surrogate (leaving it to start the next block), or 0 if the
+	block contains anything invalid. Also return 8-bit masks of the units
+	that are at least U+0080, at least U+0800, and surrogates.
+*/
+
+struct UTF16BlockInfo
+{
+	unsigned				ge_80;
+	unsigned				ge_800;
+	unsigned				surrogates;
+};
+
+inline std::size_t
+UTF16_Classify_Block (
+	__m128i					in_unit,
+	UTF16BlockInfo &		out_info) noexcept
+{
+	auto surrogate_bits = _mm_set1_epi16 (static_cast <short> (0xFC00));
+	auto lead = U16_Mask (_mm_cmpeq_epi16 (_mm_and_si128 (in_unit, surrogate_bits),
+		_mm_set1_epi16 (static_cast <short> (0xD800))));
+	auto trail = U16_Mask (_mm_cmpeq_epi16 (_mm_and_si128 (in_unit, surrogate_bits),
+		_mm_set1_epi16 (static_cast <short> (0xDC00))));
+
+	//	Every trail surrogate must be preceded by a lead, and every lead must
+	//	be followed by a trail, except for one in the last unit.
+	if (trail != ((lead << 1) & 0xFFu))
+	{
+		return 0;
+	}
+
+	//	Reject noncharacters: [U+FDD0, U+FDEF] and U+FFFE/U+FFFF in the BMP,
+	//	and surrogate pairs for U+nFFFE/U+nFFFF, whose lead ends in 0x3F and
+	//	whose trail is 0xDFFE or 0xDFFF.
+	auto bad = _mm_or_si128 (
+		U16_Less (_mm_sub_epi16 (in_unit, _mm_set1_epi16 (static_cast <short> (0xFDD0))), 0x20),
+		_mm_cmpeq_epi16 (_mm_or_si128 (in_unit, _mm_set1_epi16 (1)),
+			_mm_set1_epi16 (-1)));
+
+	bad = _mm_or_si128 (bad, _mm_and_si128 (
+		_mm_cmpeq_epi16 (_mm_or_si128 (in_unit, _mm_set1_epi16 (1)),
+			_mm_set1_epi16 (static_cast <short> (0xDFFF))),
+		_mm_cmpeq_epi16 (_mm_and_si128 (_mm_slli_si128 (in_unit, 2),
+			_mm_set1_epi16 (static_cast <short> (0xFC3F))),
+			_mm_set1_epi16 (static_cast <short> (0xD83F)))));
+
+	if (!_mm_testz_si128 (bad, bad))
+	{
+		return 0;
+	}
+
+	out_info.ge_80 = ~U16_Mask (U16_Less (in_unit, 0x80)) & 0xFFu;
+	out_info.ge_800 = ~U16_Mask (U16_Less (in_unit, 0x800)) & 0xFFu;
+	out_info.surrogates = lead | trail;
+
+	return (lead & 0x80u) ? 7 : 8;
+}
+
+
+/*------------------------------------------------------------------------------
+	Narrow one block of 8 UTF-16 or UTF-32 code units (as per CHAR_T) to
+	UTF-8, advancing io_out. Return the number of units consumed, or 0 if the
+	block must be left to the scalar code. Up to 32 bytes may be written.
+*/
+
+template <typename CHAR_T>
+inline std::size_t
+UTF_Narrow_Block (
+	const CHAR_T *			in_data,
+	char * &				io_out) noexcept
+{
+	auto data = reinterpret_cast <const __m128i *> (in_data);
+	auto out = reinterpret_cast <__m128i *> (io_out);
+
+	if constexpr (sizeof (CHAR_T) == sizeof (char16_t))
+	{
+		auto units = _mm_loadu_si128 (data);
+
+		if (0xFFFFu == static_cast <unsigned> (
+			_mm_movemask_epi8 (U16_Less (units, 0x80))))
+		{
+			_mm_storel_epi64 (out, _mm_packus_epi16 (units, units));
+			io_out += 8;
+
+			return 8;
+		}
+
+		UTF16BlockInfo info;
+		auto nrv = UTF16_Classify_Block (units, info);
+
+		if (0 != nrv)
+		{
+			auto prev = _mm_slli_si128 (units, 2);
+
+			UTF16_Narrow_Lanes (_mm_cvtepu16_epi32 (units),
+				_mm_cvtepu16_epi32 (prev), 4, io_out);
+			UTF16_Narrow_Lanes (_mm_cvtepu16_epi32 (_mm_srli_si128 (units, 8)),
+				_mm_cvtepu16_epi32 (_mm_srli_si128 (prev, 8)), nrv - 4, io_out);
+		}
+
+		return nrv;
+	}
+	else
+	{
+		static_assert (sizeof (CHAR_T) == sizeof (char32_t),
+			"CHAR_T must be a 16- or 32-bit type");
+
+		auto low = _mm_loadu_si128 (data);
+		auto high = _mm_loadu_si128 (data + 1);
+
+		if (0x0Fu == U32_Mask (U32_Less (_mm_or_si128 (low, high), 0x80u)))
+		{
+			auto packed = _mm_packus_epi32 (low, high);
+
+			_mm_storel_epi64 (out, _mm_packus_epi16 (packed, packed));
+			io_out += 8;
+
+			return 8;
+		}
+
+		if (!UTF32_Are_Chars (low) or !UTF32_Are_Chars (high))
+		{
+			return 0;
+		}
+
+		UTF32_Narrow_Lanes (low, io_out);
+		UTF32_Narrow_Lanes (high, io_out);
+
+		return 8;
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Counterpart to UTF_Narrow_Block that adds the number of bytes it would
+	have written to io_length instead of writing them.
+*/
+
+template <typename CHAR_T>
+inline std::size_t
+UTF_Narrow_Length_Block (
+	const CHAR_T *			in_data,
+	std::size_t &			io_length) noexcept
+{
+	auto data = reinterpret_cast <const __m128i *> (in_data);
+
+	if constexpr (sizeof (CHAR_T) == sizeof (char16_t))
+	{
+		UTF16BlockInfo info;
+		auto units = _mm_loadu_si128 (data);
+
+		if (0xFFFFu == static_cast <unsigned> (
+			_mm_movemask_epi8 (U16_Less (units, 0x80))))
+		{
+			io_length += 8;
+
+			return 8;
+		}
+
+		auto nrv = UTF16_Classify_Block (units, info);
+
+		if (0 != nrv)
+		{
+			//	Each unit is 1 byte, plus 1 for U+0080 and above, plus 1 for
+			//	U+0800 and above; surrogates are 2 bytes, not 3.
+			auto used = (nrv < 8) ? 0x7Fu : 0xFFu;
+
+			io_length += nrv +
+				static_cast <std::size_t> (_mm_popcnt_u32 (info.ge_80 & used)) +
+				static_cast <std::size_t> (_mm_popcnt_u32 (info.ge_800 & used)) -
+				static_cast <std::size_t> (_mm_popcnt_u32 (info.surrogates & used));
+		}
+
+		return nrv;
+	}
+	else
+	{
+		auto low = _mm_loadu_si128 (data);
+		auto high = _mm_loadu_si128 (data + 1);
+
+		if (!UTF32_Are_Chars (low) or !UTF32_Are_Chars (high))
+		{
+			return 0;
+		}
+
+		auto count_ge = [low, high] (uint32_t in_bound)
+		{
+			return static_cast <std::size_t> (_mm_popcnt_u32 (
+				(U32_Mask (U32_Less (low, in_bound)) |
+					(U32_Mask (U32_Less (high, in_bound)) << 4)) ^ 0xFFu));
+		};
+
+		io_length += 8 + count_ge (0x80u) + count_ge (0x800u) + count_ge (0x10000u);
+
+		return 8;
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Vector counterpart to UTF8_Count_Valid_Scalar. Whatever doesn’t fit in a
+	whole block is left for the scalar code.
+*/
+
+inline void
+UTF8_Count_Valid_Vec (
+	std::string_view		in_string,
+	std::size_t &			io_index,
+	std::size_t				in_end,
+	std::size_t &			io_code_points,
+	std::size_t &			io_supplementary) noexcept
+{
+	auto data = in_string.data();
+
+	for (; (io_index + 16) <= in_end; io_index += 16)
+	{
+		auto bytes = _mm_loadu_si128 (reinterpret_cast <const __m128i *> (
+			data + io_index));
+		auto trail = _mm_cmplt_epi8 (bytes, _mm_set1_epi8 (-64));
+		auto lead_4 = _mm_cmpeq_epi8 (_mm_max_epu8 (bytes,
+			_mm_set1_epi8 (static_cast <char> (0xF0))), bytes);
+
+		io_code_points += 16 - static_cast <std::size_t> (
+			_mm_popcnt_u32 (static_cast <unsigned> (_mm_movemask_epi8 (trail))));
+		io_supplementary += static_cast <std::size_t> (
+			_mm_popcnt_u32 (static_cast <unsigned> (_mm_movemask_epi8 (lead_4))));
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Vector counterpart to UTF16_Count_Pairs_Scalar. Each block of 8 units is
+	compared against the same block shifted by one unit, so we stop a unit
+	short of the end of the string.
+*/
+
+template <typename CHAR_T>
+inline void
+UTF16_Count_Pairs_Vec (
+	std::basic_string_view <CHAR_T>	in_string,
+	std::size_t &			io_index,
+	std::size_t				in_end,
+	std::size_t &			io_pairs,
+	std::size_t &			io_nonchar_pairs) noexcept
+{
+	auto data = in_string.data();
+	auto surrogate_bits = _mm_set1_epi16 (static_cast <short> (0xFC00));
+
+	for (; ((io_index + 8) <= in_end) and ((io_index + 9) <= in_string.size());
+		io_index += 8)
+	{
+		auto units = _mm_loadu_si128 (reinterpret_cast <const __m128i *> (
+			data + io_index));
+		auto next = _mm_loadu_si128 (reinterpret_cast <const __m128i *> (
+			data + io_index + 1));
+		auto pairs = _mm_and_si128 (
+			_mm_cmpeq_epi16 (_mm_and_si128 (units, surrogate_bits),
+				_mm_set1_epi16 (static_cast <short> (0xD800))),
+			_mm_cmpeq_epi16 (_mm_and_si128 (next, surrogate_bits),
+				_mm_set1_epi16 (static_cast <short> (0xDC00))));
+		auto nonchar_pairs = _mm_and_si128 (pairs, _mm_and_si128 (
+			_mm_cmpeq_epi16 (_mm_and_si128 (units,
+				_mm_set1_epi16 (static_cast <short> (0xFC3F))),
+				_mm_set1_epi16 (static_cast <short> (0xD83F))),
+			_mm_cmpeq_epi16 (_mm_or_si128 (next, _mm_set1_epi16 (1)),
+				_mm_set1_epi16 (static_cast <short> (0xDFFF)))));
+
+		io_pairs += static_cast <std::size_t> (_mm_popcnt_u32 (U16_Mask (pairs)));
+		io_nonchar_pairs += static_cast <std::size_t> (
+			_mm_popcnt_u32 (U16_Mask (nonchar_pairs)));
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Vector counterpart to UTF32_Count_Supplementary_Scalar.
+*/
+
+template <typename CHAR_T>
+inline void
+UTF32_Count_Supplementary_Vec (
+	std::basic_string_view <CHAR_T>	in_string,
+	std::size_t &			io_index,
+	std::size_t				in_end,
+	std::size_t &			io_supplementary) noexcept
+{
+	auto data = in_string.data();
+	auto plane_end = _mm_set1_epi32 (0xFFFE);
+
+	for (; (io_index + 4) <= in_end; io_index += 4)
+	{
+		auto code_points = _mm_loadu_si128 (reinterpret_cast <const __m128i *> (
+			data + io_index));
+		auto supplementary = U32_Less (_mm_sub_epi32 (code_points,
+			_mm_set1_epi32 (0x10000)), 0x100000u);
+		auto nonchar = _mm_cmpeq_epi32 (_mm_and_si128 (code_points, plane_end),
+			plane_end);
+
+		io_supplementary += static_cast <std::size_t> (_mm_popcnt_u32 (
+			U32_Mask (_mm_andnot_si128 (nonchar, supplementary))));
+	}
+}
+
+#endif	//	LUL_TEMP_VEC_KERNELS
+
+
+/*------------------------------------------------------------------------------
+	Common implementation for the ASCII_Prefix family; see ASCII_Prefix_Scalar.
+*/
+
+template <typename CHAR_T>
+std::size_t
+ASCII_Prefix_Impl (
+	const CHAR_T *			in_data,
+	std::size_t				in_size) noexcept
+{
+	std::size_t nrv = 0;
+
+	#if LUL_TEMP_VEC_KERNELS
+		nrv = ASCII_Prefix_Vec (in_data, in_size);
+	#endif
+
+	return nrv + ASCII_Prefix_Scalar (in_data + nrv, in_size - nrv);
+}
+
+
+/*------------------------------------------------------------------------------
+	Transcode the run of ASCII code units starting at io_index, if there is
+	one, as far as the output buffer allows, and advance io_index and io_out.
+	The transcoders call this whenever they find themselves at the start of
+	an ASCII run, so that mostly-ASCII text is handled as a handful of bulk
+	copies rather than code point by code point.
+*/
+
+template <typename IN_T, typename OUT_T>
+inline void
+Copy_ASCII_Run (
+	std::basic_string_view <IN_T>	in_string,
+	std::size_t &			io_index,
+	OUT_T * &				io_out,
+	const OUT_T *			in_out_end) noexcept
+{
+	auto data = in_string.data() + io_index;
+	auto size = in_string.size() - io_index;
+
+	if ((0 == size) or (static_cast <std::make_unsigned_t <IN_T>> (*data) >= 0x80u))
+	{
+		return;
+	}
+
+	auto run = std::min (ASCII_Prefix_Impl (data, size),
+		static_cast <std::size_t> (in_out_end - io_out));
+
+	Copy_ASCII (data, run, io_out);
+	io_index += run;
+}
+
+
+/*------------------------------------------------------------------------------
+	Common implementation for the UTF8_Widen family. We alternate between
+	transcoding the longest run known to be valid at full speed, and picking
+	our way through whatever follows with UTF_Decode until we’ve dealt with
+	the offending sequence; this keeps the error handling semantics exactly
+	the same as To_Ustring’s.
+*/
+
+template <typename CHAR_T>
+TranscodeResult
+UTF8_Widen_Impl (
+	std::string_view		in_string,
+	CHAR_T *				out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	auto nrv = TranscodeResult {0, 0, TranscodeResult::npos};
+	auto out = out_buffer;
+	auto out_end = out_buffer + in_buffer_size;
+	auto full = false;
+	std::size_t index = 0;
+
+	while ((index < in_string.size()) and !full)
+	{
+		Copy_ASCII_Run (in_string, index, out, out_end);
+
+		auto valid_end = index + UTF8_Valid_Prefix (in_string.substr (index));
+
+		#if LUL_TEMP_VEC_KERNELS
+			UTF8_Widen_Valid_Vec (in_string, index, valid_end, out, out_end);
+		#endif
+
+		full = !UTF8_Widen_Valid_Scalar (in_string, index, valid_end, out, out_end);
+
+		while ((index < in_string.size()) and !full)
+		{
+			bool valid;
+
+			full = !Transcode_One (in_string, index, out, out_end,
+				nrv.error_index, valid);
+
+			if (!valid) break;
+		}
+	}
+
+	nrv.consumed = index;
+	nrv.produced = static_cast <std::size_t> (out - out_buffer);
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Common implementation for the UTF_Narrow family. Blocks that the vector
+	kernel can’t vouch for are handed to the scalar code, which deals with
+	them one sequence at a time before we try the vector kernel again. The
+	vector kernel is only used while there’s room for it to overwrite the
+	output; an exactly-sized buffer is finished off by the scalar code.
+*/
+
+template <typename CHAR_T>
+TranscodeResult
+UTF_Narrow_Impl (
+	std::basic_string_view <CHAR_T>	in_string,
+	char *					out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	auto nrv = TranscodeResult {0, 0, TranscodeResult::npos};
+	auto out = out_buffer;
+	auto out_end = out_buffer + in_buffer_size;
+	auto size = in_string.size();
+	std::size_t index = 0;
+
+	while (index < size)
+	{
+		Copy_ASCII_Run (in_string, index, out, out_end);
+
+		#if LUL_TEMP_VEC_KERNELS
+			while (((index + 8) <= size) and ((out_end - out) >= 32))
+			{
+				auto consumed = UTF_Narrow_Block (in_string.data() + index, out);
+
+				if (0 == consumed) break;
+
+				index += consumed;
+			}
+		#endif
+
+		if (!UTF_Narrow_Scalar (in_string, index, std::min (index + 8, size),
+			out, out_end, nrv.error_index))
+		{
+			break;
+		}
+	}
+
+	nrv.consumed = index;
+	nrv.produced = static_cast <std::size_t> (out - out_buffer);
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Common implementation for the UTF_Convert family, which only has scalar
+	kernels since it deals with conversions that mostly map one-to-one.
+*/
+
+template <typename IN_T, typename OUT_T>
+TranscodeResult
+UTF_Convert_Impl (
+	std::basic_string_view <IN_T>	in_string,
+	OUT_T *					out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	auto nrv = TranscodeResult {0, 0, TranscodeResult::npos};
+	auto out = out_buffer;
+	auto out_end = out_buffer + in_buffer_size;
+	std::size_t index = 0;
+
+	while (index < in_string.size())
+	{
+		bool valid;
+
+		Copy_ASCII_Run (in_string, index, out, out_end);
+
+		if (index == in_string.size()) break;
+
+		if (!Transcode_One (in_string, index, out, out_end, nrv.error_index, valid))
+		{
+			break;
+		}
+	}
+
+	nrv.consumed = index;
+	nrv.produced = static_cast <std::size_t> (out - out_buffer);
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Common implementation for the UTF_Narrow_Length family; this mirrors
+	UTF_Narrow_Impl.
+*/
+
+template <typename CHAR_T>
+std::size_t
+UTF_Narrow_Length_Impl (
+	std::basic_string_view <CHAR_T>	in_string) noexcept
+{
+	auto size = in_string.size();
+	std::size_t nrv = 0;
+	std::size_t index = 0;
+
+	while (index < size)
+	{
+		#if LUL_TEMP_VEC_KERNELS
+			while ((index + 8) <= size)
+			{
+				auto consumed = UTF_Narrow_Length_Block (in_string.data() + index, nrv);
+
+				if (0 == consumed) break;
+
+				index += consumed;
+			}
+		#endif
+
+		UTF_Narrow_Length_Scalar (in_string, index, std::min (index + 8, size), nrv);
+	}
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Return the number of code points UTF_Decode would produce for a UTF-8
+	string, and how many of those lie outside the BMP. Valid runs are counted
+	by looking at lead bytes alone; whatever follows each run is picked
+	through with UTF_Decode, which produces one code point per call, valid or
+	not.
+*/
+
+void
+UTF8_Count (
+	std::string_view		in_string,
+	std::size_t &			out_code_points,
+	std::size_t &			out_supplementary) noexcept
+{
+	std::size_t index = 0;
+
+	out_code_points = 0;
+	out_supplementary = 0;
+
+	while (index < in_string.size())
+	{
+		auto valid_end = index + UTF8_Valid_Prefix (in_string.substr (index));
+
+		#if LUL_TEMP_VEC_KERNELS
+			UTF8_Count_Valid_Vec (in_string, index, valid_end, out_code_points,
+				out_supplementary);
+		#endif
+
+		UTF8_Count_Valid_Scalar (in_string, index, valid_end, out_code_points,
+			out_supplementary);
+
+		while (index < in_string.size())
+		{
+			char32_t code_point;
+
+			++out_code_points;
+
+			if (!UTF_Decode (in_string, index, code_point)) break;
+
+			out_supplementary += !Is_In_BMP (code_point);
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Count the surrogate pairs in a UTF-16 string, as per
+	UTF16_Count_Pairs_Scalar.
+*/
+
+template <typename CHAR_T>
+void
+UTF16_Count_Pairs (
+	std::basic_string_view <CHAR_T>	in_string,
+	std::size_t &			out_pairs,
+	std::size_t &			out_nonchar_pairs) noexcept
+{
+	std::size_t index = 0;
+
+	out_pairs = 0;
+	out_nonchar_pairs = 0;
+
+	#if LUL_TEMP_VEC_KERNELS
+		UTF16_Count_Pairs_Vec (in_string, index, in_string.size(), out_pairs,
+			out_nonchar_pairs);
+	#endif
+
+	UTF16_Count_Pairs_Scalar (in_string, index, in_string.size(), out_pairs,
+		out_nonchar_pairs);
+}
+
+
+/*------------------------------------------------------------------------------
+	Count the valid characters outside the BMP in a UTF-32 string.
+*/
+
+template <typename CHAR_T>
+std::size_t
+UTF32_Count_Supplementary (
+	std::basic_string_view <CHAR_T>	in_string) noexcept
+{
+	std::size_t index = 0;
+	std::size_t nrv = 0;
+
+	#if LUL_TEMP_VEC_KERNELS
+		UTF32_Count_Supplementary_Vec (in_string, index, in_string.size(), nrv);
+	#endif
+
+	UTF32_Count_Supplementary_Scalar (in_string, index, in_string.size(), nrv);
+
+	return nrv;
+}
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+ASCII_Prefix (
+	std::string_view		in_string) noexcept
+{
+	return ASCII_Prefix_Impl (in_string.data(), in_string.size());
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+ASCII_Prefix (
+	std::u16string_view		in_string) noexcept
+{
+	return ASCII_Prefix_Impl (in_string.data(), in_string.size());
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+ASCII_Prefix (
+	std::u32string_view		in_string) noexcept
+{
+	return ASCII_Prefix_Impl (in_string.data(), in_string.size());
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+ASCII_Prefix (
+	std::wstring_view		in_string) noexcept
+{
+	return ASCII_Prefix_Impl (in_string.data(), in_string.size());
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+ASCII_Fold (
+	std::string_view		in_string,
+	char *					out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	auto size = std::min (in_string.size(), in_buffer_size);
+	std::size_t nrv = 0;
+
+	#if LUL_TEMP_VEC_KERNELS
+		nrv = ASCII_Fold_Vec (in_string.data(), size, out_buffer);
+	#endif
+
+	return ASCII_Fold_Scalar (in_string.data(), size, nrv, out_buffer);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+ASCII_Fold_Mismatch (
+	std::string_view		in_lhs,
+	std::string_view		in_rhs) noexcept
+{
+	auto size = std::min (in_lhs.size(), in_rhs.size());
+	std::size_t nrv = 0;
+
+	#if LUL_TEMP_VEC_KERNELS
+		nrv = ASCII_Fold_Mismatch_Vec (in_lhs.data(), in_rhs.data(), size);
+	#endif
+
+	return ASCII_Fold_Mismatch_Scalar (in_lhs.data(), in_rhs.data(), size, nrv);
+}
+
+
+/*------------------------------------------------------------------------------
+	Leading ASCII is skipped in bulk before the validator proper gets going;
+	this is by far the most common case, and the validator has to do a fair
+	bit of bookkeeping even for blocks that turn out to be all ASCII.
+*/
+
+std::size_t
+UTF8_Valid_Prefix (
+	std::string_view		in_string) noexcept
+{
+	auto nrv = ASCII_Prefix_Impl (in_string.data(), in_string.size());
+
+	if (nrv == in_string.size()) return nrv;
+
+	#if LUL_TEMP_VEC_KERNELS
+		return nrv + UTF8_Valid_Prefix_Vec (in_string.substr (nrv));
+	#else
+		return UTF8_Valid_Prefix_Scalar (in_string, nrv);
+	#endif
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF8_Widen (
+	std::string_view		in_string,
+	char16_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	return UTF8_Widen_Impl (in_string, out_buffer, in_buffer_size);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF8_Widen (
+	std::string_view		in_string,
+	char32_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	return UTF8_Widen_Impl (in_string, out_buffer, in_buffer_size);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF8_Widen (
+	std::string_view		in_string,
+	wchar_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	return UTF8_Widen_Impl (in_string, out_buffer, in_buffer_size);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF_Length_As_UTF8 (
+	std::u16string_view		in_string) noexcept
+{
+	return UTF_Narrow_Length_Impl (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF_Length_As_UTF8 (
+	std::u32string_view		in_string) noexcept
+{
+	return UTF_Narrow_Length_Impl (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF_Length_As_UTF8 (
+	std::wstring_view		in_string) noexcept
+{
+	return UTF_Narrow_Length_Impl (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF_Narrow (
+	std::u16string_view		in_string,
+	char *					out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	return UTF_Narrow_Impl (in_string, out_buffer, in_buffer_size);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF_Narrow (
+	std::u32string_view		in_string,
+	char *					out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	return UTF_Narrow_Impl (in_string, out_buffer, in_buffer_size);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF_Narrow (
+	std::wstring_view		in_string,
+	char *					out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	return UTF_Narrow_Impl (in_string, out_buffer, in_buffer_size);
+}
+
+
+/*------------------------------------------------------------------------------
+	Each valid sequence outside the BMP becomes a surrogate pair; everything
+	else, including replacement characters, is a single unit.
+*/
+
+std::size_t
+UTF_Length_As_UTF16 (
+	std::string_view		in_string) noexcept
+{
+	std::size_t code_points;
+	std::size_t supplementary;
+
+	UTF8_Count (in_string, code_points, supplementary);
+
+	return code_points + supplementary;
+}
+
+
+/*------------------------------------------------------------------------------
+	Surrogate pairs come through unchanged, with the exception of pairs that
+	encode noncharacters, which collapse into a single replacement character.
+*/
+
+std::size_t
+UTF_Length_As_UTF16 (
+	std::u16string_view		in_string) noexcept
+{
+	std::size_t pairs;
+	std::size_t nonchar_pairs;
+
+	UTF16_Count_Pairs (in_string, pairs, nonchar_pairs);
+
+	return in_string.size() - nonchar_pairs;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF_Length_As_UTF16 (
+	std::u32string_view		in_string) noexcept
+{
+	return in_string.size() + UTF32_Count_Supplementary (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF_Length_As_UTF16 (
+	std::wstring_view		in_string) noexcept
+{
+	#if LUL_TYPE_WCHAR_T_IS_16_BITS
+		return UTF_Length_As_UTF16 (std::u16string_view {
+			reinterpret_cast <const char16_t *> (in_string.data()),
+				in_string.size()});
+	#else
+		return UTF_Length_As_UTF16 (std::u32string_view {
+			reinterpret_cast <const char32_t *> (in_string.data()),
+				in_string.size()});
+	#endif
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF_Length_As_UTF32 (
+	std::string_view		in_string) noexcept
+{
+	std::size_t code_points;
+	std::size_t supplementary;
+
+	UTF8_Count (in_string, code_points, supplementary);
+
+	return code_points;
+}
+
+
+/*------------------------------------------------------------------------------
+	Each surrogate pair, valid or not, is consumed as a single sequence.
+*/
+
+std::size_t
+UTF_Length_As_UTF32 (
+	std::u16string_view		in_string) noexcept
+{
+	std::size_t pairs;
+	std::size_t nonchar_pairs;
+
+	UTF16_Count_Pairs (in_string, pairs, nonchar_pairs);
+
+	return in_string.size() - pairs;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF_Length_As_UTF32 (
+	std::u32string_view		in_string) noexcept
+{
+	return in_string.size();
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF_Length_As_UTF32 (
+	std::wstring_view		in_string) noexcept
+{
+	#if LUL_TYPE_WCHAR_T_IS_16_BITS
+		return UTF_Length_As_UTF32 (std::u16string_view {
+			reinterpret_cast <const char16_t *> (in_string.data()),
+				in_string.size()});
+	#else
+		return in_string.size();
+	#endif
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF_Convert (
+	std::u16string_view		in_string,
+	char32_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	return UTF_Convert_Impl (in_string, out_buffer, in_buffer_size);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF_Convert (
+	std::u16string_view		in_string,
+	wchar_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	return UTF_Convert_Impl (in_string, out_buffer, in_buffer_size);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF_Convert (
+	std::u32string_view		in_string,
+	char16_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	return UTF_Convert_Impl (in_string, out_buffer, in_buffer_size);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF_Convert (
+	std::u32string_view		in_string,
+	wchar_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	return UTF_Convert_Impl (in_string, out_buffer, in_buffer_size);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF_Convert (
+	std::wstring_view		in_string,
+	char16_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	return UTF_Convert_Impl (in_string, out_buffer, in_buffer_size);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF_Convert (
+	std::wstring_view		in_string,
+	char32_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept
+{
+	return UTF_Convert_Impl (in_string, out_buffer, in_buffer_size);
+}
+
+
+/*----------------------------------------------------------------------------*/
+
+}	//	namespace uc
+
+LUL_end_v_namespace
+
+#undef LUL_TEMP_VEC_KERNELS
@@ -0,0 +1,364 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“UnicodeKernels_priv.hpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+	These are the bulk-processing engines behind the public string utilities.
+	Each kernel has a vectorized implementation selected at compile-time by
+	the LUL_TARGET_VEC_xxx conditionals, and a scalar fallback that is built
+	on the per-code-point routines in lulUnicodeUtilities_priv.hpp. Whichever
+	implementation is selected, the results are required to be identical to
+	those of the scalar routines; the vector code is purely an optimization.
+
+------------------------------------------------------------------------------*/
+
+
+#pragma once
+
+
+//	std
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulUtilities.hpp>
+
+#include "lulConfig_priv.hpp"
+
+
+LUL_begin_v_namespace
+
+namespace uc {
+
+
+/*------------------------------------------------------------------------------
+	ASCII Runs
+
+	Return the length of the run of ASCII code units (i.e., those below 0x80)
+	at the start of in_string. This is the primitive the other kernels use to
+	skip over ASCII in bulk, since that’s what most text consists of; it
+	returns in_string.size() if and only if the whole string is ASCII.
+*/
+
+std::size_t ASCII_Prefix (
+	std::string_view		in_string) noexcept;
+
+std::size_t ASCII_Prefix (
+	std::u16string_view		in_string) noexcept;
+
+std::size_t ASCII_Prefix (
+	std::u32string_view		in_string) noexcept;
+
+std::size_t ASCII_Prefix (
+	std::wstring_view		in_string) noexcept;
+
+
+/*------------------------------------------------------------------------------
+	ASCII Case Folding
+
+	ASCII_Fold writes the case folding of the run of ASCII code units at the
+	start of in_string to out_buffer, stopping at the first non-ASCII code
+	unit or once in_buffer_size code units have been written, and returns
+	the number written. ASCII_Fold_Mismatch returns the length of the
+	longest common prefix of in_lhs and in_rhs that is ASCII in both and
+	identical once folded; the caller picks up from there one code point at
+	a time. In ASCII, folding simply maps A-Z to a-z.
+*/
+
+std::size_t ASCII_Fold (
+	std::string_view		in_string,
+	char *					out_buffer,
+	std::size_t				in_buffer_size) noexcept;
+
+std::size_t ASCII_Fold_Mismatch (
+	std::string_view		in_lhs,
+	std::string_view		in_rhs) noexcept;
+
+
+/*------------------------------------------------------------------------------
+	Validation
+
+	Return the length of a prefix of in_string that is known to consist solely
+	of complete, valid UTF-8 sequences, as per UTF_Decode. The result always
+	falls on a code point boundary, and is equal to in_string.size() if and
+	only if the entire string is valid. Note that when the string is invalid,
+	the returned prefix is not necessarily the longest valid prefix; callers
+	that need the exact location of a bad sequence should resume decoding with
+	UTF_Decode from the returned index.
+*/
+
+std::size_t UTF8_Valid_Prefix (
+	std::string_view		in_string) noexcept;
+
+
+/*------------------------------------------------------------------------------
+	Transcoded Lengths
+
+	Return the exact length, in code units of the destination encoding, of
+	the string that To_Ustring would produce from in_string. Each invalid
+	sequence is counted as the U+FFFD that replaces it. These allow results to
+	be allocated exactly once, at exactly the right size.
+
+	UTF_Length_As selects the right function based on the destination
+	CHAR_T, which must be one of char, char16_t, char32_t, or wchar_t.
+*/
+
+std::size_t UTF_Length_As_UTF8 (
+	std::u16string_view		in_string) noexcept;
+
+std::size_t UTF_Length_As_UTF8 (
+	std::u32string_view		in_string) noexcept;
+
+std::size_t UTF_Length_As_UTF8 (
+	std::wstring_view		in_string) noexcept;
+
+std::size_t UTF_Length_As_UTF16 (
+	std::string_view		in_string) noexcept;
+
+std::size_t UTF_Length_As_UTF16 (
+	std::u16string_view		in_string) noexcept;
+
+std::size_t UTF_Length_As_UTF16 (
+	std::u32string_view		in_string) noexcept;
+
+std::size_t UTF_Length_As_UTF16 (
+	std::wstring_view		in_string) noexcept;
+
+std::size_t UTF_Length_As_UTF32 (
+	std::string_view		in_string) noexcept;
+
+std::size_t UTF_Length_As_UTF32 (
+	std::u16string_view		in_string) noexcept;
+
+std::size_t UTF_Length_As_UTF32 (
+	std::u32string_view		in_string) noexcept;
+
+std::size_t UTF_Length_As_UTF32 (
+	std::wstring_view		in_string) noexcept;
+
+
+template <typename CHAR_T, typename T>
+std::size_t
+UTF_Length_As (
+	const T &				in_string) noexcept
+{
+	if constexpr (sizeof (CHAR_T) == sizeof (char))
+	{
+		return UTF_Length_As_UTF8 (in_string);
+	}
+	else if constexpr (sizeof (CHAR_T) == sizeof (char16_t))
+	{
+		return UTF_Length_As_UTF16 (in_string);
+	}
+	else
+	{
+		static_assert (sizeof (CHAR_T) == sizeof (char32_t),
+			"CHAR_T must be an 8-, 16-, or 32-bit type");
+
+		return UTF_Length_As_UTF32 (in_string);
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Widening Transcoders
+
+	Convert a UTF-8 string to UTF-16, UTF-32, or wide characters, writing the
+	result to out_buffer. The results are identical to those of To_Ustring:
+	each invalid sequence is replaced by a single U+FFFD. If out_buffer fills
+	up, conversion stops at the last code point that fits; the result
+	reports how far we got, as per TranscodeResult.
+
+	The vector kernels may scribble over code units past the current output
+	position, but never past in_buffer_size, so an exactly-sized buffer (as
+	per UTF_Length_As <CHAR_T>) is fine.
+*/
+
+TranscodeResult UTF8_Widen (
+	std::string_view		in_string,
+	char16_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept;
+
+TranscodeResult UTF8_Widen (
+	std::string_view		in_string,
+	char32_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept;
+
+TranscodeResult UTF8_Widen (
+	std::string_view		in_string,
+	wchar_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept;
+
+
+/*------------------------------------------------------------------------------
+	Parallel Drivers
+
+	Parallel_Thread_Count returns the number of threads that should be used
+	to process in_size bytes of UTF-8, as per the public parallel processing
+	settings; 1 means the input should be processed on the calling thread.
+
+	The drivers split in_string into in_threads pieces, backing each split
+	point up over trail bytes so that it lands on the start of a sequence.
+	Since a sequence can never swallow the byte that starts the next one, each
+	piece decodes exactly as it would as part of the whole string, so the
+	pieces can be processed independently and the results simply stitched
+	back together. UTF8_Verify_Parallel returns true if in_string is valid;
+	UTF8_Widen_Parallel replaces the contents of out_string with the result of
+	UTF8_Widen_To_Ustring, and returns true if the conversion was clean.
+*/
+
+std::size_t Parallel_Thread_Count (
+	std::size_t				in_size) noexcept;
+
+bool UTF8_Verify_Parallel (
+	std::string_view		in_string,
+	std::size_t				in_threads);
+
+bool UTF8_Widen_Parallel (
+	std::string_view		in_string,
+	std::size_t				in_threads,
+	std::u16string &		out_string);
+
+bool UTF8_Widen_Parallel (
+	std::string_view		in_string,
+	std::size_t				in_threads,
+	std::u32string &		out_string);
+
+bool UTF8_Widen_Parallel (
+	std::string_view		in_string,
+	std::size_t				in_threads,
+	std::wstring &			out_string);
+
+
+/*------------------------------------------------------------------------------
+	Convenience wrapper for UTF8_Widen that allocates exactly the space needed
+	for its result. R must be one of std::u16string, std::u32string, or
+	std::wstring. Very large inputs are handed off to UTF8_Widen_Parallel.
+*/
+
+template <typename R>
+R
+UTF8_Widen_To_Ustring (
+	std::string_view		in_string,
+	bool *					out_clean)
+{
+	if (auto threads = Parallel_Thread_Count (in_string.size()); threads > 1)
+	{
+		auto nrv = R{};
+		auto clean = UTF8_Widen_Parallel (in_string, threads, nrv);
+
+		if (out_clean) *out_clean = clean;
+
+		return nrv;
+	}
+
+	auto nrv = R (UTF_Length_As <typename R::value_type> (in_string),
+		typename R::value_type{});
+	auto result = UTF8_Widen (in_string, nrv.data(), nrv.size());
+
+	nrv.resize (result.produced);
+
+	if (out_clean) *out_clean = (TranscodeResult::npos == result.error_index);
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Narrowing Transcoders
+
+	Convert a UTF-16, UTF-32, or wide string to UTF-8, writing the result to
+	out_buffer. These behave just like UTF8_Widen in all other respects.
+*/
+
+TranscodeResult UTF_Narrow (
+	std::u16string_view		in_string,
+	char *					out_buffer,
+	std::size_t				in_buffer_size) noexcept;
+
+TranscodeResult UTF_Narrow (
+	std::u32string_view		in_string,
+	char *					out_buffer,
+	std::size_t				in_buffer_size) noexcept;
+
+TranscodeResult UTF_Narrow (
+	std::wstring_view		in_string,
+	char *					out_buffer,
+	std::size_t				in_buffer_size) noexcept;
+
+
+/*------------------------------------------------------------------------------
+	Convenience wrapper for UTF_Narrow that allocates exactly the space needed
+	for its result. T must be one of std::u16string_view, std::u32string_view,
+	or std::wstring_view.
+*/
+
+template <typename T>
+std::string
+UTF_Narrow_To_Ustring (
+	T						in_string,
+	bool *					out_clean)
+{
+	auto nrv = std::string (UTF_Length_As_UTF8 (in_string), '\0');
+	auto result = UTF_Narrow (in_string, nrv.data(), nrv.size());
+
+	nrv.resize (result.produced);
+
+	if (out_clean) *out_clean = (TranscodeResult::npos == result.error_index);
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Bounded Converters
+
+	Convert between UTF-16, UTF-32, and wide strings, writing the result to
+	out_buffer. These are scalar-only counterparts to To_Ustring, and
+	otherwise behave just like UTF8_Widen.
+*/
+
+TranscodeResult UTF_Convert (
+	std::u16string_view		in_string,
+	char32_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept;
+
+TranscodeResult UTF_Convert (
+	std::u16string_view		in_string,
+	wchar_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept;
+
+TranscodeResult UTF_Convert (
+	std::u32string_view		in_string,
+	char16_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept;
+
+TranscodeResult UTF_Convert (
+	std::u32string_view		in_string,
+	wchar_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept;
+
+TranscodeResult UTF_Convert (
+	std::wstring_view		in_string,
+	char16_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept;
+
+TranscodeResult UTF_Convert (
+	std::wstring_view		in_string,
+	char32_t *				out_buffer,
+	std::size_t				in_buffer_size) noexcept;
+
+
+/*----------------------------------------------------------------------------*/
+
+}	//	namespace uc
+
+LUL_end_v_namespace
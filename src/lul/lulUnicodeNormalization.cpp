@@ -0,0 +1,481 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“UnicodeNormalization.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+	This implements the normalization algorithm from UAX #15. Strings are
+	first run through the quick check, which usually settles the matter
+	without our ever having to decode a code point twice. Otherwise, the
+	string is normalized from the last point at which the quick check was
+	sure of itself; everything before that is copied over as-is.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulUtilities.hpp>
+
+#include "lulConfig_priv.hpp"
+#include "lulUnicodeKernels_priv.hpp"
+#include "lulUnicodeUtilities_priv.hpp"
+
+
+LUL_begin_v_namespace
+
+
+namespace {
+
+
+/*------------------------------------------------------------------------------
+	Types
+*/
+
+enum class QuickCheck
+{
+	Yes,
+	Maybe,
+	No
+};
+
+
+//	The quick check flags and the steps of the algorithm that apply to each
+//	normalization form.
+struct FormTraits
+{
+	uint8_t					no;
+	uint8_t					maybe;
+	bool					compatible;
+	bool					compose;
+};
+
+
+/*------------------------------------------------------------------------------
+*/
+
+FormTraits
+Get_Form_Traits (
+	NormalizationForm		in_form) noexcept
+{
+	switch (in_form)
+	{
+		case NormalizationForm::NFC:
+			return {uc::NORM_QC_nfc_no, uc::NORM_QC_nfc_maybe, false, true};
+
+		case NormalizationForm::NFKC:
+			return {uc::NORM_QC_nfkc_no, uc::NORM_QC_nfkc_maybe, true, true};
+
+		case NormalizationForm::NFKD:
+			return {uc::NORM_QC_nfkd_no, 0, true, false};
+
+		case NormalizationForm::NFD:
+		default:
+			return {uc::NORM_QC_nfd_no, 0, false, false};
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+uint8_t
+Combining_Class (
+	char32_t				in_code) noexcept
+{
+	uint8_t ccc;
+	uint8_t qc;
+
+	uc::Normalization_Properties (in_code, ccc, qc);
+
+	return ccc;
+}
+
+
+/*------------------------------------------------------------------------------
+	Run the quick check from UAX #15 over in_string. out_safe is set to the
+	start of the last starter that was Yes before the first code point that
+	wasn’t; since nothing after it can affect anything before it, only the
+	rest of the string ever needs normalizing. An invalid sequence is always
+	No, since normalizing replaces it. ASCII is Yes in every form, and is
+	always a starter.
+*/
+
+template <typename CHAR_T>
+QuickCheck
+Quick_Check (
+	std::basic_string_view <CHAR_T>	in_string,
+	const FormTraits &		in_traits,
+	std::size_t &			out_safe) noexcept
+{
+	auto nrv = QuickCheck::Yes;
+	auto size = in_string.size();
+	std::size_t index = 0;
+	uint8_t last_ccc = 0;
+
+	out_safe = 0;
+
+	while (index < size)
+	{
+		if (auto run = uc::ASCII_Prefix (in_string.substr (index)); run)
+		{
+			index += run;
+			last_ccc = 0;
+
+			if (QuickCheck::Yes == nrv) out_safe = index - 1;
+
+			continue;
+		}
+
+		auto start = index;
+		char32_t code_point;
+		uint8_t ccc;
+		uint8_t qc;
+
+		if (!uc::UTF_Decode (in_string, index, code_point)) return QuickCheck::No;
+
+		uc::Normalization_Properties (code_point, ccc, qc);
+
+		if ((0 != ccc) and (last_ccc > ccc)) return QuickCheck::No;
+		if (qc & in_traits.no) return QuickCheck::No;
+
+		if (qc & in_traits.maybe)
+		{
+			nrv = QuickCheck::Maybe;
+		}
+		else if ((0 == ccc) and (QuickCheck::Yes == nrv))
+		{
+			out_safe = start;
+		}
+
+		last_ccc = ccc;
+	}
+
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Decode in_string, replacing invalid sequences as usual, and append the
+	full decomposition of each code point to io_code_points.
+*/
+
+template <typename CHAR_T>
+void
+Decompose (
+	std::basic_string_view <CHAR_T>	in_string,
+	bool					in_compatible,
+	std::u32string &		io_code_points)
+{
+	auto size = in_string.size();
+	std::size_t index = 0;
+
+	io_code_points.reserve (io_code_points.size() + size);
+
+	while (index < size)
+	{
+		char32_t code_point;
+
+		if (!uc::UTF_Decode (in_string, index, code_point))
+		{
+			io_code_points += uc::CODE_POINT_replacement;
+			continue;
+		}
+
+		if ((code_point - uc::HANGUL_s_base) < uc::HANGUL_s_count)
+		{
+			auto s = code_point - uc::HANGUL_s_base;
+			auto t = s % uc::HANGUL_t_count;
+
+			io_code_points += uc::HANGUL_l_base + s / (uc::HANGUL_v_count * uc::HANGUL_t_count);
+			io_code_points += uc::HANGUL_v_base +
+				(s % (uc::HANGUL_v_count * uc::HANGUL_t_count)) / uc::HANGUL_t_count;
+
+			if (t) io_code_points += uc::HANGUL_t_base + t;
+
+			continue;
+		}
+
+		auto decomposition = uc::Decomposition (code_point, in_compatible);
+
+		if (decomposition.empty())
+		{
+			io_code_points += code_point;
+		}
+		else
+		{
+			io_code_points.append (decomposition);
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Put each run of non-starters into canonical order. The runs are almost
+	always just one or two code points long, so an insertion sort (which is
+	stable, as it must be) is the way to go.
+*/
+
+void
+Reorder (
+	std::u32string &		io_code_points) noexcept
+{
+	for (std::size_t i = 1; i < io_code_points.size(); ++i)
+	{
+		auto code_point = io_code_points [i];
+		auto ccc = Combining_Class (code_point);
+
+		if (0 == ccc) continue;
+
+		auto j = i;
+
+		while ((j > 0) and (Combining_Class (io_code_points [j - 1]) > ccc))
+		{
+			io_code_points [j] = io_code_points [j - 1];
+			--j;
+		}
+
+		io_code_points [j] = code_point;
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Apply the canonical composition algorithm in place. A code point can
+	combine with the last starter so long as it isn’t blocked from it, i.e.,
+	so long as nothing between them is a starter or has the same or higher
+	combining class.
+*/
+
+void
+Compose (
+	std::u32string &		io_code_points) noexcept
+{
+	auto size = io_code_points.size();
+
+	if (0 == size) return;
+
+	std::size_t starter = 0;
+	std::size_t out = 1;
+	auto have_starter = (0 == Combining_Class (io_code_points [0]));
+	unsigned last_ccc = 0;
+
+	for (std::size_t i = 1; i < size; ++i)
+	{
+		auto code_point = io_code_points [i];
+		auto ccc = Combining_Class (code_point);
+
+		if (have_starter and ((last_ccc < ccc) or (0 == last_ccc)))
+		{
+			if (auto composite = uc::Composition (io_code_points [starter], code_point); composite)
+			{
+				io_code_points [starter] = composite;
+				continue;
+			}
+		}
+
+		if (0 == ccc)
+		{
+			starter = out;
+			have_starter = true;
+		}
+
+		last_ccc = ccc;
+		io_code_points [out++] = code_point;
+	}
+
+	io_code_points.resize (out);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+Encode (
+	std::u32string_view		in_code_points,
+	std::string &			io_string)
+{
+	for (auto code_point : in_code_points) (void) uc::UTF_Encode (code_point, io_string);
+}
+
+
+void
+Encode (
+	std::u32string_view		in_code_points,
+	std::u16string &		io_string)
+{
+	for (auto code_point : in_code_points) (void) uc::UTF_Encode (code_point, io_string);
+}
+
+
+void
+Encode (
+	std::u32string_view		in_code_points,
+	std::u32string &		io_string)
+{
+	io_string.append (in_code_points);
+}
+
+
+/*------------------------------------------------------------------------------
+	Common implementation for the Normalize family. If the quick check can’t
+	rule it out, we have to normalize the string to know for sure whether it
+	was already normalized; in that case, we still hand back in_string if
+	normalizing didn’t change anything.
+*/
+
+template <typename CHAR_T>
+std::basic_string_view <CHAR_T>
+Normalize_Impl (
+	std::basic_string_view <CHAR_T>	in_string,
+	NormalizationForm		in_form,
+	std::basic_string <CHAR_T> &	out_buffer)
+{
+	auto traits = Get_Form_Traits (in_form);
+	std::size_t safe;
+	auto check = Quick_Check (in_string, traits, safe);
+
+	if (QuickCheck::Yes == check) return in_string;
+
+	auto code_points = std::u32string{};
+
+	Decompose (in_string.substr (safe), traits.compatible, code_points);
+	Reorder (code_points);
+
+	if (traits.compose) Compose (code_points);
+
+	out_buffer.assign (in_string.data(), safe);
+	Encode (code_points, out_buffer);
+
+	auto nrv = std::basic_string_view <CHAR_T> {out_buffer};
+
+	if ((QuickCheck::Maybe == check) and (nrv == in_string)) return in_string;
+
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+template <typename CHAR_T>
+bool
+Is_Normalized_Impl (
+	std::basic_string_view <CHAR_T>	in_string,
+	NormalizationForm		in_form)
+{
+	std::size_t safe;
+
+	switch (Quick_Check (in_string, Get_Form_Traits (in_form), safe))
+	{
+		case QuickCheck::Yes:
+			return true;
+
+		case QuickCheck::No:
+			return false;
+
+		case QuickCheck::Maybe:
+		default:
+			break;
+	}
+
+	auto buffer = std::basic_string <CHAR_T>{};
+
+	return Normalize_Impl (in_string, in_form, buffer).data() == in_string.data();
+}
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+Is_Normalized (
+	std::string_view		in_string,
+	NormalizationForm		in_form)
+{
+	return Is_Normalized_Impl (in_string, in_form);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+Is_Normalized (
+	std::u16string_view		in_string,
+	NormalizationForm		in_form)
+{
+	return Is_Normalized_Impl (in_string, in_form);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+Is_Normalized (
+	std::u32string_view		in_string,
+	NormalizationForm		in_form)
+{
+	return Is_Normalized_Impl (in_string, in_form);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::string_view
+Normalize (
+	std::string_view		in_string,
+	NormalizationForm		in_form,
+	std::string &			out_buffer)
+{
+	return Normalize_Impl (in_string, in_form, out_buffer);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::u16string_view
+Normalize (
+	std::u16string_view		in_string,
+	NormalizationForm		in_form,
+	std::u16string &		out_buffer)
+{
+	return Normalize_Impl (in_string, in_form, out_buffer);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::u32string_view
+Normalize (
+	std::u32string_view		in_string,
+	NormalizationForm		in_form,
+	std::u32string &		out_buffer)
+{
+	return Normalize_Impl (in_string, in_form, out_buffer);
+}
+
+
+/*----------------------------------------------------------------------------*/
+
+LUL_end_v_namespace
@@ -0,0 +1,284 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“UnicodeParallel_priv.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+	These drivers farm very large UTF-8 inputs out to the kernels in
+	lulUnicodeKernels_priv.cpp on several threads at once. Threads are simply
+	spawned for each call and joined before returning; the inputs involved are
+	large enough that the cost of doing so is lost in the noise, and it keeps
+	us from having to manage a pool whose lifetime would need to be tied to
+	Initialize and Finalize.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <numeric>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulUtilities.hpp>
+
+#include "lulConfig_priv.hpp"
+#include "lulUnicodeKernels_priv.hpp"
+#include "lulUnicodeUtilities_priv.hpp"
+
+
+LUL_begin_v_namespace
+
+namespace uc {
+
+namespace {
+
+
+/*------------------------------------------------------------------------------
+	Constants
+*/
+
+//	The smallest piece we’re willing to hand off to a thread; anything smaller
+//	isn’t worth the cost of spinning the thread up.
+constexpr std::size_t	k_min_piece_size					{1024 * 1024};
+
+
+/*------------------------------------------------------------------------------
+	Return the boundaries of up to in_pieces pieces of in_string, including
+	the end of the string, such that each piece starts at a byte that isn’t a
+	trail byte. A split point that can’t be backed up that far without running
+	into the previous one (which only happens with pathological input) is
+	dropped, so there may be fewer pieces than requested.
+*/
+
+std::vector <std::size_t>
+UTF8_Split (
+	std::string_view		in_string,
+	std::size_t				in_pieces)
+{
+	auto size = in_string.size();
+	auto nrv = std::vector <std::size_t> {0};
+
+	nrv.reserve (in_pieces + 1);
+
+	for (std::size_t i = 1; i < in_pieces; ++i)
+	{
+		auto split = (size / in_pieces) * i;
+
+		while ((split > nrv.back()) and
+			UTF8_Is_Trail_Byte (static_cast <uint8_t> (in_string [split])))
+		{
+			--split;
+		}
+
+		if (split > nrv.back()) nrv.push_back (split);
+	}
+
+	nrv.push_back (size);
+
+	return nrv;
+}
+
+
+/*------------------------------------------------------------------------------
+	Call in_task (i) for each i in [0, in_count), each on its own thread,
+	except for the first task, which is run on the calling thread. If we can’t
+	get as many threads as we’d like, the remaining tasks are run on the
+	calling thread, as well.
+*/
+
+template <typename TASK>
+void
+Run_Parallel (
+	std::size_t				in_count,
+	TASK &					in_task)
+{
+	auto workers = std::vector <std::thread>{};
+	std::size_t i = 1;
+
+	workers.reserve (in_count);
+
+	try
+	{
+		for (; i < in_count; ++i)
+		{
+			workers.emplace_back ([&in_task, i] { in_task (i); });
+		}
+	}
+
+	catch (...)
+	{
+		//	fall through
+	}
+
+	for (; i < in_count; ++i)
+	{
+		in_task (i);
+	}
+
+	in_task (0);
+
+	for (auto & worker : workers)
+	{
+		worker.join();
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Common implementation for the UTF8_Widen_Parallel family. The pieces are
+	measured in parallel, which tells us where each piece’s output starts,
+	and then transcoded in parallel directly into their final positions.
+	Since each piece is given exactly as much room as it needs, the vector
+	kernels can’t scribble over the output of the neighboring piece.
+*/
+
+template <typename R>
+bool
+UTF8_Widen_Parallel_Impl (
+	std::string_view		in_string,
+	std::size_t				in_threads,
+	R &						out_string)
+{
+	using char_type = typename R::value_type;
+
+	auto splits = UTF8_Split (in_string, in_threads);
+	auto pieces = splits.size() - 1;
+	auto offsets = std::vector <std::size_t> (pieces + 1, 0);
+	auto clean = std::vector <uint8_t> (pieces, 0);
+
+	auto piece = [&in_string, &splits] (std::size_t in_piece)
+	{
+		return in_string.substr (splits [in_piece],
+			splits [in_piece + 1] - splits [in_piece]);
+	};
+
+	auto measure = [&offsets, &piece] (std::size_t in_piece)
+	{
+		offsets [in_piece + 1] = UTF_Length_As <char_type> (piece (in_piece));
+	};
+
+	Run_Parallel (pieces, measure);
+
+	std::partial_sum (offsets.begin(), offsets.end(), offsets.begin());
+
+	out_string.assign (offsets.back(), char_type{});
+
+	auto widen = [&out_string, &offsets, &clean, &piece] (std::size_t in_piece)
+	{
+		auto result = UTF8_Widen (piece (in_piece),
+			out_string.data() + offsets [in_piece],
+			offsets [in_piece + 1] - offsets [in_piece]);
+
+		clean [in_piece] = (TranscodeResult::npos == result.error_index);
+	};
+
+	Run_Parallel (pieces, widen);
+
+	return std::all_of (clean.begin(), clean.end(), [] (uint8_t c) { return c; });
+}
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+Parallel_Thread_Count (
+	std::size_t				in_size) noexcept
+{
+	if (in_size < Get_Parallel_Threshold()) return 1;
+
+	auto limit = Get_Parallel_Thread_Limit();
+
+	if (0 == limit)
+	{
+		limit = std::max (std::thread::hardware_concurrency(), 1u);
+	}
+
+	return std::max (std::min (limit, in_size / k_min_piece_size), std::size_t {1});
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+UTF8_Verify_Parallel (
+	std::string_view		in_string,
+	std::size_t				in_threads)
+{
+	auto splits = UTF8_Split (in_string, in_threads);
+	auto pieces = splits.size() - 1;
+	auto valid = std::vector <uint8_t> (pieces, 0);
+
+	auto verify = [&in_string, &splits, &valid] (std::size_t in_piece)
+	{
+		auto piece = in_string.substr (splits [in_piece],
+			splits [in_piece + 1] - splits [in_piece]);
+
+		valid [in_piece] = (UTF8_Valid_Prefix (piece) == piece.size());
+	};
+
+	Run_Parallel (pieces, verify);
+
+	return std::all_of (valid.begin(), valid.end(), [] (uint8_t v) { return v; });
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+UTF8_Widen_Parallel (
+	std::string_view		in_string,
+	std::size_t				in_threads,
+	std::u16string &		out_string)
+{
+	return UTF8_Widen_Parallel_Impl (in_string, in_threads, out_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+UTF8_Widen_Parallel (
+	std::string_view		in_string,
+	std::size_t				in_threads,
+	std::u32string &		out_string)
+{
+	return UTF8_Widen_Parallel_Impl (in_string, in_threads, out_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+UTF8_Widen_Parallel (
+	std::string_view		in_string,
+	std::size_t				in_threads,
+	std::wstring &			out_string)
+{
+	return UTF8_Widen_Parallel_Impl (in_string, in_threads, out_string);
+}
+
+
+/*----------------------------------------------------------------------------*/
+
+}	//	namespace uc
+
+LUL_end_v_namespace
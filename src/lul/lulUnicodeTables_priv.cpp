@@ -0,0 +1,11357 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“UnicodeTables_priv.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+	DO NOT EDIT. This file was generated by tools/lulGenerateUnicodeTables.py
+	from version 14.0.0 of the Unicode Character Database.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <cstddef>
+#include <cstdint>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+
+#include "lulConfig_priv.hpp"
+#include "lulUnicodeUtilities_priv.hpp"
+
+
+LUL_begin_v_namespace
+
+namespace uc {
+
+
+/*------------------------------------------------------------------------------
+	Display width, as a two-stage lookup; see Code_Point_Width. The first
+	stage maps each block of 256 code points to a block in the second stage,
+	and identical blocks are shared. Each second stage block packs 4 widths
+	into a byte, 2 bits apiece, with 3 meaning that the code point is not
+	printable.
+*/
+
+static_assert (WIDTH_block_bits == 8, "regenerate the width tables");
+
+const uint8_t
+WIDTH_stage1 [4352] =
+{
+	0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+	0x0F, 0x10, 0x11, 0x12, 0x01, 0x01, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x01, 0x1B,
+	0x1C, 0x1D, 0x01, 0x1E, 0x1F, 0x20, 0x21, 0x22, 0x01, 0x01, 0x01, 0x23, 0x24, 0x25, 0x26, 0x27,
+	0x28, 0x27, 0x29, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x2A, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x2B, 0x01, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x27, 0x27, 0x34, 0x01, 0x35, 0x36, 0x37,
+	0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x01, 0x3E, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46,
+	0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C, 0x4D, 0x4E, 0x4F, 0x50, 0x51, 0x27, 0x52, 0x53, 0x54, 0x55,
+	0x01, 0x01, 0x01, 0x56, 0x57, 0x58, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x59,
+	0x01, 0x01, 0x01, 0x01, 0x5A, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x01, 0x01, 0x5B, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x01, 0x01, 0x5C, 0x5D, 0x27, 0x27, 0x5E, 0x5F,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x60, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x61,
+	0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x69, 0x01, 0x01, 0x6A, 0x27, 0x27, 0x27, 0x27, 0x6B,
+	0x6C, 0x6D, 0x6E, 0x27, 0x27, 0x27, 0x27, 0x6F, 0x70, 0x71, 0x27, 0x27, 0x72, 0x73, 0x74, 0x27,
+	0x75, 0x76, 0x27, 0x77, 0x78, 0x79, 0x7A, 0x7B, 0x7C, 0x7D, 0x7E, 0x7F, 0x27, 0x27, 0x27, 0x80,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x80,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x80,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x80,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x80,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x80,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x80,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x80,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x80,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x80,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x80,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x80,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x80,
+	0x81, 0x82, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27,
+	0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x27, 0x80,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x83,
+};
+
+
+const uint8_t
+WIDTH_stage2 [132][64] =
+{
+	{
+		0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xD5,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x5A, 0x55,
+		0xAA, 0x55, 0x95, 0x59, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x15, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x95, 0x56, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10,
+		0x41, 0x10, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x6A, 0x55, 0xA9, 0xAA, 0xAA,
+	},
+	{
+		0x00, 0x50, 0x55, 0x55, 0x00, 0x00, 0x40, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x54, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x10, 0x00, 0x14, 0x04, 0x50, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x25, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x80, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x00, 0xA4, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x95, 0x52,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x10, 0x00, 0x00, 0x01, 0x01, 0xA0, 0x55, 0x55, 0x55, 0x95,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x9A, 0x55, 0x55, 0x95, 0xAA, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x95, 0xA0, 0xAA, 0x00, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x54,
+		0x01, 0x00, 0x54, 0x51, 0x01, 0x00, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x51, 0x56, 0x55, 0x69, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x99, 0x5A, 0xA5, 0x54,
+		0x01, 0x68, 0x69, 0x91, 0xAA, 0x6A, 0xAA, 0x65, 0x05, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x85,
+	},
+	{
+		0x42, 0x56, 0x95, 0x6A, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x59, 0x96, 0xA5, 0x58,
+		0x81, 0x2A, 0x28, 0xA0, 0xA2, 0xAA, 0x56, 0x99, 0xAA, 0x5A, 0x55, 0x55, 0x50, 0x91, 0xAA, 0xAA,
+		0x42, 0x56, 0x55, 0x65, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x59, 0x56, 0xA5, 0x54,
+		0x01, 0x20, 0x64, 0xA1, 0xA9, 0xAA, 0xAA, 0xAA, 0x05, 0x5A, 0x55, 0x55, 0xA5, 0xAA, 0x06, 0x00,
+	},
+	{
+		0x52, 0x56, 0x55, 0x69, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x59, 0x56, 0xA5, 0x14,
+		0x01, 0x68, 0x69, 0xA1, 0xAA, 0x42, 0xAA, 0x65, 0x05, 0x5A, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA,
+		0x4A, 0x56, 0x95, 0x5A, 0x59, 0xA5, 0x96, 0x59, 0x6A, 0xA9, 0x95, 0x5A, 0x55, 0x55, 0xA5, 0x5A,
+		0x94, 0x5A, 0x59, 0xA1, 0xA9, 0x6A, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA,
+	},
+	{
+		0x54, 0x54, 0x55, 0x59, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x55, 0x55, 0xA5, 0x04,
+		0x54, 0x09, 0x08, 0xA0, 0xAA, 0x82, 0x95, 0xA6, 0x05, 0x5A, 0x55, 0x55, 0xAA, 0x6A, 0x55, 0x55,
+		0x51, 0x55, 0x55, 0x59, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x55, 0x56, 0xA5, 0x14,
+		0x55, 0x49, 0x59, 0xA0, 0xAA, 0x96, 0xAA, 0x96, 0x05, 0x5A, 0x55, 0x55, 0x96, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x50, 0x55, 0x55, 0x59, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54,
+		0x01, 0x58, 0x59, 0x51, 0xAA, 0x55, 0x55, 0x55, 0x05, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x52, 0x56, 0x55, 0x55, 0x55, 0x95, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0xA6,
+		0x55, 0x95, 0x8A, 0x6A, 0x05, 0x88, 0x55, 0x55, 0xAA, 0x5A, 0x55, 0x55, 0x5A, 0xA9, 0xAA, 0xAA,
+	},
+	{
+		0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x00, 0x80, 0x6A,
+		0x55, 0x15, 0x00, 0x40, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x96, 0x59, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x66, 0x55, 0x55, 0x51, 0x00, 0x00, 0xA4,
+		0x55, 0x99, 0x00, 0xA0, 0x55, 0x55, 0xA5, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x11, 0x51, 0x55,
+		0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x02, 0x00, 0x00, 0x40,
+		0x00, 0x04, 0x55, 0x01, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x58,
+		0x55, 0x45, 0x55, 0x59, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x04, 0x00, 0x41, 0x41,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x05, 0x54, 0x55, 0x55, 0x55, 0x01, 0x54, 0x55, 0x55,
+		0x45, 0x41, 0x55, 0x51, 0x55, 0x55, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x65, 0xAA, 0xA6, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x59, 0xA5, 0x55, 0x95, 0x59, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x59, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0xA5, 0x55, 0x95,
+		0x59, 0xA5, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x59, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x02, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0xA5,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x05, 0xA4, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x05, 0x95, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x05, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x59, 0x09, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x10, 0x00, 0x50,
+		0x55, 0x45, 0x01, 0x00, 0x00, 0x55, 0x55, 0xA1, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0xA5, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA,
+		0x55, 0x41, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x91, 0xAA, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x40, 0x15, 0x54, 0xAA, 0x45, 0x55, 0x01, 0xAA,
+		0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0xA9, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x95, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x14, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x00, 0x80, 0x44, 0x01, 0x00, 0x54, 0x15, 0x00, 0x00, 0x28,
+		0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0xA5, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x80, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x40, 0x54,
+		0x45, 0x55, 0x55, 0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x55, 0x55, 0x95,
+		0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x10, 0x50, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x45, 0x50, 0x11, 0x50, 0xAA, 0xAA, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00, 0x05, 0x6A, 0x55,
+		0x55, 0x55, 0xA5, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xA9, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56,
+		0x55, 0x55, 0xAA, 0xAA, 0x40, 0x00, 0x00, 0x00, 0x04, 0x00, 0x54, 0x51, 0x55, 0x54, 0x90, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xA5, 0x55, 0xA5, 0x55, 0x55, 0x66, 0x66, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x55,
+		0x55, 0x59, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x59, 0x55, 0x95,
+	},
+	{
+		0x55, 0x55, 0x15, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x40, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x08, 0x00, 0x00, 0xA5, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0xA9, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA8, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x56, 0x96, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x69,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+		0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x59, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x69,
+		0x55, 0x5A, 0x55, 0x65, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0xA5, 0x59, 0x65, 0x59,
+	},
+	{
+		0x55, 0x59, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x66, 0x95, 0x9A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x95,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x56, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0xAA, 0x56, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0xAA, 0xA6, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x6A, 0xA9, 0xAA, 0xAA, 0x2A,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95,
+		0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x55, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x0A, 0xA0, 0xAA, 0xAA, 0xAA, 0x6A,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x82, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x00, 0x00, 0x50,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x95, 0xAA, 0x65, 0x56, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x55,
+	},
+	{
+		0x45, 0x45, 0x15, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x41, 0x55, 0xA8, 0x55, 0x55, 0xA5, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xA0, 0xAA, 0x5A, 0x55, 0x55, 0xA5, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x50, 0x55, 0x55, 0x15,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x50, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x15, 0x00, 0x00, 0x50, 0xAA, 0xAA, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x05, 0x50, 0x50,
+		0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0xA5, 0x5A, 0x55, 0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x40, 0x41, 0x81, 0xAA, 0xAA,
+		0x15, 0x55, 0x55, 0xA4, 0x55, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x54,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x14, 0x54, 0x05,
+		0x91, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x50, 0x55, 0x85, 0xAA, 0xAA,
+	},
+	{
+		0x56, 0x95, 0x56, 0x95, 0x56, 0x95, 0xAA, 0xAA, 0x55, 0x95, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x51, 0x54, 0xA1, 0x55, 0x55, 0xA5, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+		0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+	},
+	{
+		0x55, 0x95, 0xAA, 0xAA, 0x6A, 0x55, 0xAA, 0x46, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x99,
+		0x65, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x95, 0xAA, 0xAA, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xAA, 0x6A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x59, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x29,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+		0x5A, 0x55, 0x5A, 0x55, 0x5A, 0x55, 0x5A, 0xA9, 0xAA, 0xAA, 0x55, 0x95, 0xAA, 0xAA, 0x02, 0xF5,
+	},
+	{
+		0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x95, 0x65,
+		0x55, 0x55, 0x55, 0xA5, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA,
+	},
+	{
+		0x95, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6A, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0xA9, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA1,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x95, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x80, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xAA, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0x6A, 0x55, 0x55, 0x95, 0x55,
+		0x55, 0x55, 0x95, 0x55, 0x95, 0x65, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x65, 0x55, 0x65, 0xA9,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x95, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0xA5, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0xA9, 0x69,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0x6A, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x95, 0xA5, 0x6A, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x6A,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x01, 0x82, 0xAA, 0x00, 0x55, 0x56, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x80, 0x2A,
+		0x55, 0x55, 0xA9, 0xAA, 0x55, 0x55, 0xA9, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x81, 0x6A, 0x55, 0x55, 0x95, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x56, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0x56, 0xA9, 0xAA, 0xAA, 0x56, 0x55, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0x5A, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x25, 0xA4, 0xA5, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x05, 0x00, 0x00, 0x54, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55,
+		0x05, 0x50, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA,
+	},
+	{
+		0x51, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+		0x00, 0x40, 0x55, 0xA5, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x14, 0xA4, 0xAA, 0x2A,
+		0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x40, 0x41, 0x51,
+		0x85, 0xAA, 0xAA, 0xA2, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0x55, 0x55, 0xA5, 0xAA,
+	},
+	{
+		0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x01, 0x00, 0x58, 0x55, 0x55,
+		0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x95, 0xAA, 0xAA,
+		0x50, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x00, 0x40,
+		0x55, 0x55, 0x01, 0x14, 0x55, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x04, 0x55, 0x85,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x55, 0x95, 0x59, 0x65, 0x55, 0x55, 0x55, 0x65, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x15, 0x00, 0x80, 0xAA, 0x55, 0x55, 0xA5, 0xAA,
+	},
+	{
+		0x50, 0x56, 0x55, 0x69, 0x69, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x59, 0x56, 0x25, 0x54,
+		0x54, 0x69, 0x69, 0xA5, 0xA9, 0x6A, 0xAA, 0x56, 0x55, 0x0A, 0x00, 0xA8, 0x00, 0xA8, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x00,
+		0x05, 0x44, 0x55, 0x55, 0x55, 0x55, 0x55, 0x46, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x44, 0x15,
+		0x04, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0xA0, 0x55, 0x10,
+		0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA0, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x40, 0x11,
+		0x54, 0xA9, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x51, 0x00, 0x10, 0xA5, 0xAA,
+		0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x02, 0x05, 0x10, 0x00, 0xAA, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x00, 0x41, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0x6A,
+	},
+	{
+		0x55, 0x95, 0xA6, 0x55, 0x55, 0x96, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x29, 0x44,
+		0x15, 0x95, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x0A, 0x55, 0x54, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x01, 0x00, 0x40, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x00, 0x14, 0x40,
+		0x55, 0x15, 0xAA, 0xAA, 0x01, 0x40, 0x01, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x05, 0x00, 0x00, 0x40, 0x50, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x80, 0x00, 0x10,
+		0x55, 0xA5, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x04, 0x81, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x95, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x01, 0x80, 0x8A, 0x20,
+		0x00, 0x10, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x65, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x95, 0x60, 0x11, 0xA9, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x15, 0x54, 0xA9, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0x6A,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0xA9, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x00, 0x00, 0xA8, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0xA5, 0x5A, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95,
+		0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x00, 0xA4, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x40, 0x55, 0x55,
+		0x55, 0xA5, 0xAA, 0xAA, 0x55, 0x55, 0x65, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x56,
+		0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x95, 0x2A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xAA, 0x2A, 0x40, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0x55, 0x55, 0x55, 0xA9,
+		0x55, 0x55, 0xA9, 0xAA, 0x55, 0x55, 0xA5, 0x41, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x80, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x15, 0x50, 0x55, 0x15, 0x00, 0x00, 0x00,
+		0x40, 0x01, 0x00, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x05, 0x50, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x05, 0xA4, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x59, 0x9A, 0x96, 0x56, 0x59, 0x55, 0x55, 0x65, 0x56,
+		0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x65, 0x95, 0x56, 0x55, 0x59, 0x55, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0x95,
+		0x55, 0x99, 0x5A, 0x55, 0x59, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x15, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x54, 0x55, 0x51, 0x55, 0x55,
+		0x55, 0x54, 0x55, 0xAA, 0xAA, 0xAA, 0x2A, 0x00, 0x02, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x28, 0x00, 0x20, 0x08, 0x80, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0x00, 0x40, 0x55, 0xA5,
+		0x55, 0x55, 0xA5, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x85, 0xAA, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x00, 0x55, 0x55, 0xA5, 0x6A,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x95, 0x55, 0x96, 0x55, 0x55, 0x55, 0x95,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x69, 0x55, 0x55, 0x00, 0x80, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x00, 0x40, 0xAA, 0x55, 0x55, 0xA5, 0x5A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x96, 0x69, 0x56, 0x55, 0x95, 0x55, 0x66, 0xAA,
+		0x9A, 0x6A, 0x66, 0x56, 0x96, 0x69, 0x66, 0x66, 0x96, 0x69, 0x95, 0x55, 0x95, 0x55, 0x56, 0x99,
+		0x55, 0x55, 0x65, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x56, 0x56, 0x65, 0x55, 0x55, 0x55, 0x55, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA5, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55,
+		0x56, 0x55, 0x55, 0x95, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x65, 0xA9, 0xAA, 0x6A, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x55, 0x55, 0xA9, 0xAA, 0x9A, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA6,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0x6A, 0x95, 0xAA, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0x56, 0x56, 0xAA, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A,
+		0xA6, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x96,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x5A,
+		0x55, 0x55, 0x95, 0x6A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x65, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x95, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0x5A, 0x55, 0x56, 0x6A, 0xA9, 0xAA, 0xAA, 0x55, 0x55, 0x95, 0xAA, 0x55, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xA5, 0xA5, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x6A, 0xAA,
+		0xAA, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0x55, 0xA5, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x95, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x95, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x55, 0x55, 0xA5, 0xAA,
+	},
+	{
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xFA,
+	},
+	{
+		0xA2, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA,
+	},
+	{
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55,
+		0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0xF5,
+	},
+};
+
+
+/*------------------------------------------------------------------------------
+	Grapheme_Cluster_Break, as a two-stage lookup; see Grapheme_Break_Property.
+	This is laid out just like the width tables, except that each second
+	stage block packs 2 values into a byte, 4 bits apiece, low nybble first.
+*/
+
+static_assert (GRAPHEME_block_bits == 8, "regenerate the grapheme tables");
+
+const uint8_t
+GRAPHEME_stage1 [4352] =
+{
+	0x00, 0x01, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+	0x0F, 0x10, 0x01, 0x11, 0x01, 0x01, 0x01, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x01, 0x01,
+	0x19, 0x1A, 0x01, 0x1B, 0x1C, 0x1D, 0x1E, 0x1F, 0x01, 0x20, 0x01, 0x21, 0x22, 0x23, 0x01, 0x01,
+	0x24, 0x01, 0x25, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x26, 0x01, 0x27, 0x28, 0x29, 0x2A, 0x2B, 0x2B, 0x2B, 0x2B,
+	0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+	0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B,
+	0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2B, 0x2C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x2D, 0x01, 0x01, 0x2E, 0x2F,
+	0x01, 0x30, 0x31, 0x32, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x33, 0x01, 0x01, 0x34, 0x35, 0x36,
+	0x37, 0x38, 0x39, 0x3A, 0x3B, 0x3C, 0x3D, 0x3E, 0x3F, 0x40, 0x41, 0x01, 0x42, 0x43, 0x44, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x45, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x46, 0x47, 0x01, 0x01, 0x01, 0x48,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x49, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4A,
+	0x01, 0x4B, 0x4C, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x4D, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x4E, 0x47, 0x4F, 0x01, 0x01, 0x01, 0x01, 0x01, 0x50, 0x51, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x52, 0x53, 0x54, 0x55, 0x52, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x52, 0x01, 0x52, 0x52, 0x52, 0x5B,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x5C, 0x5D, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E, 0x5E,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+};
+
+
+const uint8_t
+GRAPHEME_stage2 [95][128] =
+{
+	{
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x32, 0x13, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+		0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x30, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x40, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40,
+		0x40, 0x04, 0x44, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x77, 0x77, 0x77, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x03, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x74, 0x40,
+		0x44, 0x44, 0x04, 0x40, 0x04, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x40, 0x44, 0x44,
+		0x44, 0x44, 0x40, 0x44, 0x40, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x77, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x47, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+	},
+	{
+		0x44, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x04, 0x88,
+		0x48, 0x44, 0x44, 0x44, 0x84, 0x88, 0x48, 0x88, 0x40, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x40, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x84,
+		0x48, 0x44, 0x04, 0x80, 0x08, 0x80, 0x48, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+	},
+	{
+		0x40, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88,
+		0x48, 0x04, 0x00, 0x40, 0x04, 0x40, 0x44, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x40, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x88,
+		0x48, 0x44, 0x44, 0x40, 0x84, 0x80, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44,
+	},
+	{
+		0x40, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44,
+		0x48, 0x44, 0x04, 0x80, 0x08, 0x80, 0x48, 0x00, 0x00, 0x00, 0x40, 0x44, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84,
+		0x84, 0x08, 0x00, 0x88, 0x08, 0x88, 0x48, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x84, 0x88, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44,
+		0x84, 0x88, 0x08, 0x44, 0x04, 0x44, 0x44, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x40, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x48,
+		0x88, 0x84, 0x08, 0x84, 0x08, 0x88, 0x44, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x44, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x84,
+		0x48, 0x44, 0x04, 0x88, 0x08, 0x88, 0x48, 0x07, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x40, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x40, 0x88, 0x44, 0x04, 0x04, 0x88, 0x88, 0x88, 0x48,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x40, 0x40, 0x00, 0x00, 0x88,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x84,
+		0x44, 0x44, 0x04, 0x44, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x40, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x84, 0x44, 0x44, 0x44, 0x40, 0x84, 0x48, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x44, 0x00, 0x00, 0x44,
+		0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x04, 0x48, 0x04, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+		0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+		0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0xAA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+		0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+		0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x48, 0x44, 0x44, 0x44, 0x88,
+		0x88, 0x88, 0x88, 0x84, 0x48, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x44, 0x84, 0x88, 0x48, 0x84, 0x88, 0x00, 0x00, 0x88, 0x84, 0x88, 0x88, 0x48, 0x44, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x84, 0x48, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x84, 0x44, 0x44, 0x44, 0x04,
+		0x04, 0x04, 0x40, 0x44, 0x44, 0x44, 0x84, 0x88, 0x88, 0x48, 0x44, 0x44, 0x44, 0x44, 0x04, 0x40,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x44, 0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x84, 0x84, 0x88,
+		0x88, 0x84, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x80, 0x44, 0x44, 0x88, 0x44, 0x48, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x84, 0x44, 0x88, 0x48, 0x48, 0x44, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x44, 0x44, 0x44, 0x44, 0x88, 0x44, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x84, 0x44, 0x44, 0x44, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x04, 0x80, 0x44, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x54, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0xEE, 0x0E, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00,
+		0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0x0E,
+	},
+	{
+		0xEE, 0xEE, 0xEE, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x0E, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+	},
+	{
+		0xEE, 0xEE, 0xEE, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x0E, 0x0E, 0x0E, 0x00, 0x00, 0xE0, 0x00,
+		0xE0, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x0E, 0xE0, 0x00, 0x00, 0x0E, 0x0E, 0x00, 0xE0, 0xEE, 0xE0, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0xE0, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0x00, 0x00, 0x00, 0x00,
+		0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0xE0, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x0E, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xE0, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x04, 0x00, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x80, 0x48, 0x84, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+		0x88, 0x88, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x09, 0x00,
+		0x44, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x88, 0x44, 0x44, 0x88, 0x44, 0x88,
+		0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x84, 0x48, 0x84, 0x48, 0x04, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x84, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x44, 0x04, 0x40, 0x04, 0x00, 0x00, 0x44,
+		0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x44, 0x88, 0x00, 0x00, 0x80, 0x04, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x80, 0x48, 0x88, 0x84, 0x08, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+		0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+		0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+		0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+		0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+		0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+		0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+		0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+	},
+	{
+		0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+		0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+		0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+		0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+		0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD,
+		0xDD, 0xDD, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA,
+		0xAA, 0xAA, 0xAA, 0x0A, 0x00, 0xB0, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB,
+		0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x04, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x40, 0x44, 0x40, 0x04, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x04, 0x00, 0x40,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x48, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40,
+		0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x48, 0x44, 0x84, 0x48, 0x04, 0x70, 0x00,
+		0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x48, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x80, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x44, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x88, 0x44, 0x44, 0x44, 0x44, 0x84,
+		0x08, 0x77, 0x00, 0x00, 0x40, 0x44, 0x04, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x48, 0x44, 0x88, 0x84, 0x44, 0x00, 0x00, 0x00, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+		0x88, 0x48, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x44, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04, 0x84,
+		0x84, 0x88, 0x08, 0x80, 0x08, 0x80, 0x88, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x88, 0x00, 0x44, 0x44, 0x44, 0x04, 0x00, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x88, 0x44, 0x44, 0x44, 0x44,
+		0x88, 0x44, 0x84, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x48, 0x44, 0x44, 0x84, 0x84, 0x48, 0x48,
+		0x84, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x88, 0x44, 0x44, 0x00, 0x88, 0x88, 0x44, 0x48,
+		0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x48, 0x44, 0x44, 0x44, 0x84, 0x48, 0x48,
+		0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x48, 0x88, 0x44, 0x44, 0x44, 0x48, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44,
+		0x00, 0x44, 0x44, 0x48, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x48, 0x44, 0x44, 0x44, 0x44, 0x48, 0x04, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x84, 0x88, 0x88, 0x80, 0x08, 0x40, 0x84, 0x74,
+		0x78, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x88, 0x44, 0x44, 0x00, 0x44, 0x88, 0x88,
+		0x04, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x40, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x84, 0x47, 0x44, 0x04,
+		0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x84, 0x48, 0x44, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x77, 0x77, 0x77, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x84, 0x44, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x44, 0x44, 0x44, 0x04, 0x44, 0x44, 0x44, 0x48,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x80, 0x44, 0x44, 0x44, 0x84, 0x44, 0x48, 0x04, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44, 0x04, 0x00, 0x04, 0x44, 0x40,
+		0x44, 0x44, 0x44, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x88, 0x08, 0x44, 0x80, 0x48, 0x48, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x84, 0x08, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x03, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x80, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+		0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88,
+		0x88, 0x88, 0x88, 0x88, 0x00, 0x00, 0x00, 0x40, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x88, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x04,
+		0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x40, 0x48, 0x44, 0x00, 0x80, 0x44, 0x44, 0x34, 0x33, 0x33, 0x33, 0x43, 0x44, 0x44,
+		0x44, 0x04, 0x40, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x40, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x44, 0x44,
+		0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x44, 0x44, 0x44, 0x04, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x40, 0x44, 0x44,
+		0x44, 0x40, 0x04, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x44, 0x44, 0x44, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0x0E, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66,
+	},
+	{
+		0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0x0E, 0xEE, 0xEE,
+		0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+	},
+	{
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x4E, 0x44, 0x44,
+	},
+	{
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00,
+		0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+	},
+	{
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x0E, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xE0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+	},
+	{
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE,
+		0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x00,
+	},
+	{
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+	},
+	{
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+		0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+	},
+	{
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+		0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+	},
+};
+
+
+/*------------------------------------------------------------------------------
+	Normalization properties, decompositions, and compositions; see
+	Normalization_Properties, Decomposition, and Composition. Each property
+	class is a pair of {Canonical_Combining_Class, NORM_QC_* flags}.
+*/
+
+static_assert (NORM_class_block_bits == 7, "regenerate the normalization tables");
+static_assert (NORM_decomposition_block_bits == 7, "regenerate the normalization tables");
+
+const uint8_t
+NORM_classes [69][2] =
+{
+	{	  0, 0x00	},
+	{	  0, 0x12	},
+	{	  0, 0x03	},
+	{	230, 0x28	},
+	{	230, 0x00	},
+	{	232, 0x00	},
+	{	220, 0x00	},
+	{	216, 0x28	},
+	{	202, 0x00	},
+	{	220, 0x28	},
+	{	202, 0x28	},
+	{	  1, 0x00	},
+	{	  1, 0x28	},
+	{	230, 0x17	},
+	{	240, 0x28	},
+	{	233, 0x00	},
+	{	234, 0x00	},
+	{	  0, 0x17	},
+	{	  0, 0x13	},
+	{	222, 0x00	},
+	{	228, 0x00	},
+	{	 10, 0x00	},
+	{	 11, 0x00	},
+	{	 12, 0x00	},
+	{	 13, 0x00	},
+	{	 14, 0x00	},
+	{	 15, 0x00	},
+	{	 16, 0x00	},
+	{	 17, 0x00	},
+	{	 18, 0x00	},
+	{	 19, 0x00	},
+	{	 20, 0x00	},
+	{	 21, 0x00	},
+	{	 22, 0x00	},
+	{	 23, 0x00	},
+	{	 24, 0x00	},
+	{	 25, 0x00	},
+	{	 30, 0x00	},
+	{	 31, 0x00	},
+	{	 32, 0x00	},
+	{	 27, 0x00	},
+	{	 28, 0x00	},
+	{	 29, 0x00	},
+	{	 33, 0x00	},
+	{	 34, 0x00	},
+	{	 35, 0x00	},
+	{	 36, 0x00	},
+	{	  7, 0x28	},
+	{	  9, 0x00	},
+	{	  7, 0x00	},
+	{	  0, 0x28	},
+	{	 84, 0x00	},
+	{	 91, 0x28	},
+	{	  9, 0x28	},
+	{	103, 0x00	},
+	{	107, 0x00	},
+	{	118, 0x00	},
+	{	122, 0x00	},
+	{	216, 0x00	},
+	{	129, 0x00	},
+	{	130, 0x00	},
+	{	132, 0x00	},
+	{	214, 0x00	},
+	{	218, 0x00	},
+	{	224, 0x00	},
+	{	  8, 0x28	},
+	{	 26, 0x00	},
+	{	  6, 0x00	},
+	{	226, 0x00	},
+};
+
+
+const uint8_t
+NORM_class_stage1 [8704] =
+{
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x0A, 0x0B, 0x0C, 0x0D, 0x0E,
+	0x0F, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E,
+	0x1F, 0x20, 0x21, 0x22, 0x00, 0x00, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x25,
+	0x00, 0x26, 0x27, 0x00, 0x28, 0x29, 0x2A, 0x2B, 0x2C, 0x2D, 0x2E, 0x2F, 0x30, 0x31, 0x32, 0x33,
+	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x00, 0x3B, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x3D, 0x3E, 0x00, 0x00, 0x3F, 0x40, 0x41, 0x42, 0x00, 0x43, 0x44, 0x45,
+	0x46, 0x47, 0x48, 0x49, 0x4A, 0x44, 0x44, 0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4B, 0x4C, 0x4D, 0x4E,
+	0x4F, 0x50, 0x51, 0x52, 0x00, 0x53, 0x54, 0x55, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30,
+	0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x30, 0x56,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x57, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x44, 0x44, 0x5C, 0x5D, 0x5E, 0x5F, 0x60, 0x61,
+	0x00, 0x00, 0x00, 0x62, 0x00, 0x63, 0x64, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x65,
+	0x00, 0x00, 0x00, 0x00, 0x66, 0x67, 0x00, 0x00, 0x00, 0x00, 0x68, 0x00, 0x00, 0x69, 0x6A, 0x6B,
+	0x6C, 0x6D, 0x6E, 0x6F, 0x70, 0x71, 0x72, 0x00, 0x73, 0x74, 0x00, 0x75, 0x76, 0x77, 0x78, 0x00,
+	0x79, 0x00, 0x7A, 0x7B, 0x7C, 0x7D, 0x00, 0x00, 0x76, 0x00, 0x7E, 0x7F, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0x81, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x82,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x84, 0x85, 0x86, 0x00, 0x00, 0x00, 0x87, 0x88, 0x89, 0x44, 0x44, 0x8A, 0x44, 0x8B,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x8C, 0x00, 0x81, 0x00, 0x00, 0x8D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x8E, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0x91, 0x00, 0x00,
+	0x00, 0x00, 0x92, 0x93, 0x94, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x95, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x57, 0x57, 0x57, 0x57, 0x96, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+
+const uint8_t
+NORM_class_stage2 [151][128] =
+{
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01,
+		0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x00, 0x01, 0x01, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
+		0x01, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x01, 0x01, 0x01, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x03, 0x04, 0x04, 0x03,
+		0x04, 0x03, 0x04, 0x03, 0x03, 0x05, 0x06, 0x06, 0x06, 0x06, 0x05, 0x07, 0x06, 0x06, 0x06, 0x06,
+		0x06, 0x08, 0x08, 0x09, 0x09, 0x09, 0x09, 0x0A, 0x0A, 0x06, 0x06, 0x06, 0x06, 0x09, 0x09, 0x06,
+		0x09, 0x09, 0x06, 0x06, 0x0B, 0x0B, 0x0B, 0x0B, 0x0C, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x04,
+		0x0D, 0x0D, 0x03, 0x0D, 0x0D, 0x0E, 0x04, 0x06, 0x06, 0x06, 0x04, 0x04, 0x04, 0x06, 0x06, 0x00,
+		0x04, 0x04, 0x04, 0x06, 0x06, 0x06, 0x06, 0x04, 0x05, 0x06, 0x06, 0x04, 0x0F, 0x10, 0x10, 0x0F,
+		0x10, 0x10, 0x0F, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x01, 0x12, 0x02, 0x11, 0x02, 0x02, 0x02, 0x00, 0x02, 0x00, 0x02, 0x02,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00,
+		0x01, 0x01, 0x01, 0x12, 0x12, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x02, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x02, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x06, 0x04, 0x04, 0x04, 0x04, 0x06, 0x04, 0x04, 0x04, 0x13, 0x06, 0x04, 0x04, 0x04, 0x04,
+		0x04, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x06, 0x04, 0x04, 0x13, 0x14, 0x04,
+		0x15, 0x16, 0x17, 0x18, 0x19, 0x1A, 0x1B, 0x1C, 0x1D, 0x1E, 0x1E, 0x1F, 0x20, 0x21, 0x00, 0x22,
+		0x00, 0x23, 0x24, 0x00, 0x04, 0x06, 0x00, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x25, 0x26, 0x27, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x28, 0x29, 0x2A, 0x25, 0x26,
+		0x27, 0x2B, 0x2C, 0x03, 0x03, 0x09, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x04, 0x04, 0x06,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x2D, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04,
+		0x04, 0x04, 0x04, 0x06, 0x04, 0x00, 0x00, 0x04, 0x04, 0x00, 0x06, 0x04, 0x04, 0x06, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x06, 0x04, 0x04, 0x06, 0x04, 0x04, 0x06, 0x06, 0x06, 0x04, 0x06, 0x06, 0x04, 0x06, 0x04,
+		0x04, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x06, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04,
+		0x04, 0x04, 0x06, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04,
+		0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06,
+		0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+		0x04, 0x04, 0x00, 0x06, 0x04, 0x04, 0x06, 0x04, 0x04, 0x06, 0x04, 0x04, 0x04, 0x06, 0x06, 0x06,
+		0x28, 0x29, 0x2A, 0x04, 0x04, 0x04, 0x06, 0x04, 0x04, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2F, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+		0x00, 0x04, 0x06, 0x04, 0x04, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x32, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x30, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x11,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x00, 0x00, 0x11, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x32, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x02, 0x30, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x30, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x33, 0x34, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00,
+		0x02, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x30, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x32, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x30, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x35, 0x00, 0x00, 0x00, 0x00, 0x32,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x02, 0x02, 0x32,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x36, 0x36, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x37, 0x37, 0x37, 0x37, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x38, 0x38, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x39, 0x39, 0x39, 0x39, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x06, 0x00, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+		0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x3B, 0x3C, 0x11, 0x3D, 0x11, 0x11, 0x01, 0x11, 0x01, 0x3C, 0x3C, 0x3C, 0x3C, 0x00, 0x00,
+	},
+	{
+		0x3C, 0x11, 0x04, 0x04, 0x30, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00,
+		0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32, 0x32,
+		0x32, 0x32, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x06,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x06, 0x00, 0x06,
+		0x06, 0x04, 0x04, 0x06, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+		0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x31, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00,
+		0x02, 0x02, 0x00, 0x02, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x04, 0x04, 0x04,
+		0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x04, 0x04, 0x00, 0x0B, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04, 0x06, 0x06, 0x06, 0x06,
+		0x04, 0x00, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x04, 0x04, 0x06, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x04, 0x04, 0x10, 0x3E, 0x06,
+		0x08, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x05, 0x14, 0x14, 0x06, 0x3F, 0x04, 0x0F, 0x06, 0x04, 0x06,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x01, 0x12, 0x00, 0x00, 0x00, 0x00,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x11, 0x02, 0x11, 0x02, 0x11, 0x02, 0x11, 0x02, 0x11, 0x02, 0x11, 0x02, 0x11, 0x00, 0x00,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x11, 0x02, 0x01, 0x11, 0x01,
+		0x01, 0x12, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x11, 0x02, 0x11, 0x02, 0x12, 0x12, 0x12,
+		0x02, 0x02, 0x02, 0x11, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x02, 0x11, 0x00, 0x12, 0x12, 0x12,
+		0x02, 0x02, 0x02, 0x11, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x11, 0x02, 0x12, 0x11, 0x11,
+		0x00, 0x00, 0x02, 0x02, 0x02, 0x00, 0x02, 0x02, 0x02, 0x11, 0x02, 0x11, 0x02, 0x11, 0x01, 0x00,
+	},
+	{
+		0x11, 0x11, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x04, 0x0B, 0x0B, 0x04, 0x04, 0x04, 0x04, 0x0B, 0x0B, 0x0B, 0x04, 0x04, 0x00, 0x00, 0x00,
+		0x00, 0x04, 0x00, 0x00, 0x00, 0x0B, 0x0B, 0x04, 0x06, 0x04, 0x0B, 0x0B, 0x06, 0x06, 0x06, 0x06,
+		0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x11, 0x00, 0x01, 0x00, 0x11, 0x11, 0x01, 0x01, 0x00, 0x01,
+		0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x01,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+		0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x14, 0x05, 0x13, 0x40, 0x40,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00,
+		0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+		0x02, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x41, 0x41, 0x01, 0x01, 0x00, 0x02, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00,
+		0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00,
+		0x02, 0x00, 0x02, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x02, 0x02, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x02, 0x01,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+		0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x04, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+		0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x00, 0x04, 0x04, 0x06, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04,
+		0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02, 0x02,
+		0x02, 0x02, 0x02, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	},
+	{
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+		0x11, 0x00, 0x11, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00,
+		0x11, 0x00, 0x11, 0x00, 0x00, 0x11, 0x11, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+	},
+	{
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x42, 0x11,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x11, 0x00,
+		0x11, 0x11, 0x00, 0x11, 0x11, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x04, 0x04,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+		0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x0B, 0x06, 0x00, 0x00, 0x00, 0x00, 0x30,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x04, 0x04, 0x04, 0x06, 0x04, 0x06, 0x06, 0x06,
+		0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x04, 0x06, 0x04, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x02, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02,
+		0x00, 0x00, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x31, 0x00, 0x32, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x30, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x02, 0x02, 0x32, 0x02, 0x00,
+		0x00, 0x00, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x00, 0x30,
+		0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x32, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x30, 0x30, 0x00,
+		0x00, 0x00, 0x00, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x31, 0x00, 0x30, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x0B, 0x0B, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x43, 0x43, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0B, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x3A, 0x3A, 0x0B, 0x0B, 0x0B, 0x00, 0x00, 0x00, 0x44, 0x3A, 0x3A,
+		0x3A, 0x3A, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x06, 0x06, 0x06, 0x06,
+	},
+	{
+		0x06, 0x06, 0x06, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+		0x00, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+	},
+	{
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04,
+		0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04,
+		0x04, 0x04, 0x00, 0x04, 0x04, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x31, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x01, 0x01,
+		0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01, 0x00, 0x01,
+		0x00, 0x01, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x00,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+	{
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11,
+		0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+		0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	},
+};
+
+
+const uint8_t
+NORM_decomposition_stage1 [8704] =
+{
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x0A, 0x0B, 0x0C, 0x00, 0x00,
+	0x00, 0x00, 0x0D, 0x0E, 0x0F, 0x00, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19,
+	0x1A, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x1D, 0x1E, 0x1F, 0x20, 0x21, 0x22,
+	0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x00, 0x2A, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x2C, 0x2D, 0x00, 0x00, 0x2E, 0x00, 0x2F, 0x00, 0x00, 0x30, 0x31, 0x32,
+	0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3B, 0x3C, 0x3D,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x3F, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4A, 0x4B, 0x4C,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4D,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x4E, 0x4F, 0x00, 0x00, 0x00, 0x50, 0x00, 0x00, 0x51, 0x00, 0x52, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x53, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x54, 0x55, 0x00, 0x00, 0x00, 0x00, 0x56, 0x57, 0x58, 0x59, 0x5A, 0x5B, 0x5C, 0x5D,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x5E, 0x5F, 0x00, 0x00,
+	0x00, 0x00, 0x60, 0x61, 0x62, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x64, 0x65, 0x66, 0x67, 0x68, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+};
+
+
+const uint16_t
+NORM_decomposition_stage2 [105][128] =
+{
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0001, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0003, 0x0000, 0x0006, 0x0000, 0x0000, 0x0000, 0x0000, 0x0008,
+		0x0000, 0x0000, 0x000B, 0x000D, 0x000F, 0x0012, 0x0000, 0x0000,
+		0x0014, 0x0017, 0x0019, 0x0000, 0x001B, 0x001F, 0x0023, 0x0000,
+		0x0027, 0x002A, 0x002D, 0x0030, 0x0033, 0x0036, 0x0000, 0x0039,
+		0x003C, 0x003F, 0x0042, 0x0045, 0x0048, 0x004B, 0x004E, 0x0051,
+		0x0000, 0x0054, 0x0057, 0x005A, 0x005D, 0x0060, 0x0063, 0x0000,
+		0x0000, 0x0066, 0x0069, 0x006C, 0x006F, 0x0072, 0x0000, 0x0000,
+		0x0075, 0x0078, 0x007B, 0x007E, 0x0081, 0x0084, 0x0000, 0x0087,
+		0x008A, 0x008D, 0x0090, 0x0093, 0x0096, 0x0099, 0x009C, 0x009F,
+		0x0000, 0x00A2, 0x00A5, 0x00A8, 0x00AB, 0x00AE, 0x00B1, 0x0000,
+		0x0000, 0x00B4, 0x00B7, 0x00BA, 0x00BD, 0x00C0, 0x0000, 0x00C3,
+	},
+	{
+		0x00C6, 0x00C9, 0x00CC, 0x00CF, 0x00D2, 0x00D5, 0x00D8, 0x00DB,
+		0x00DE, 0x00E1, 0x00E4, 0x00E7, 0x00EA, 0x00ED, 0x00F0, 0x00F3,
+		0x0000, 0x0000, 0x00F6, 0x00F9, 0x00FC, 0x00FF, 0x0102, 0x0105,
+		0x0108, 0x010B, 0x010E, 0x0111, 0x0114, 0x0117, 0x011A, 0x011D,
+		0x0120, 0x0123, 0x0126, 0x0129, 0x012C, 0x012F, 0x0000, 0x0000,
+		0x0132, 0x0135, 0x0138, 0x013B, 0x013E, 0x0141, 0x0144, 0x0147,
+		0x014A, 0x0000, 0x014D, 0x0150, 0x0153, 0x0156, 0x0159, 0x015C,
+		0x0000, 0x015F, 0x0162, 0x0165, 0x0168, 0x016B, 0x016E, 0x0171,
+		0x0174, 0x0000, 0x0000, 0x0177, 0x017A, 0x017D, 0x0180, 0x0183,
+		0x0186, 0x0189, 0x0000, 0x0000, 0x018C, 0x018F, 0x0192, 0x0195,
+		0x0198, 0x019B, 0x0000, 0x0000, 0x019E, 0x01A1, 0x01A4, 0x01A7,
+		0x01AA, 0x01AD, 0x01B0, 0x01B3, 0x01B6, 0x01B9, 0x01BC, 0x01BF,
+		0x01C2, 0x01C5, 0x01C8, 0x01CB, 0x01CE, 0x01D1, 0x0000, 0x0000,
+		0x01D4, 0x01D7, 0x01DA, 0x01DD, 0x01E0, 0x01E3, 0x01E6, 0x01E9,
+		0x01EC, 0x01EF, 0x01F2, 0x01F5, 0x01F8, 0x01FB, 0x01FE, 0x0201,
+		0x0204, 0x0207, 0x020A, 0x020D, 0x0210, 0x0213, 0x0216, 0x0219,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x021B, 0x021E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0221,
+		0x0224, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0227, 0x022B, 0x022F, 0x0233,
+		0x0236, 0x0239, 0x023C, 0x023F, 0x0242, 0x0245, 0x0248, 0x024B,
+		0x024E, 0x0251, 0x0254, 0x0257, 0x025A, 0x025D, 0x0261, 0x0265,
+		0x0269, 0x026D, 0x0271, 0x0275, 0x0279, 0x0000, 0x027D, 0x0281,
+		0x0285, 0x0289, 0x028D, 0x0290, 0x0000, 0x0000, 0x0293, 0x0296,
+		0x0299, 0x029C, 0x029F, 0x02A2, 0x02A5, 0x02A9, 0x02AD, 0x02B0,
+		0x02B3, 0x02B6, 0x02B9, 0x02BC, 0x02BF, 0x02C2, 0x0000, 0x0000,
+		0x02C5, 0x02C8, 0x02CB, 0x02CF, 0x02D3, 0x02D6, 0x02D9, 0x02DC,
+	},
+	{
+		0x02DF, 0x02E2, 0x02E5, 0x02E8, 0x02EB, 0x02EE, 0x02F1, 0x02F4,
+		0x02F7, 0x02FA, 0x02FD, 0x0300, 0x0303, 0x0306, 0x0309, 0x030C,
+		0x030F, 0x0312, 0x0315, 0x0318, 0x031B, 0x031E, 0x0321, 0x0324,
+		0x0327, 0x032A, 0x032D, 0x0330, 0x0000, 0x0000, 0x0333, 0x0336,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0339, 0x033C,
+		0x033F, 0x0342, 0x0345, 0x0349, 0x034D, 0x0351, 0x0355, 0x0358,
+		0x035B, 0x035F, 0x0363, 0x0366, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0369, 0x036B, 0x036D, 0x036F, 0x0371, 0x0373, 0x0375, 0x0377,
+		0x0379, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x037B, 0x037E, 0x0381, 0x0384, 0x0387, 0x038A, 0x0000, 0x0000,
+		0x038D, 0x038F, 0x0391, 0x0393, 0x0395, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0397, 0x0399, 0x0000, 0x039B, 0x039D, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x03A0, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x03A2, 0x0000, 0x0000, 0x0000, 0x03A5, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x03A7, 0x03AA, 0x03B0, 0x03B3,
+		0x03B5, 0x03B8, 0x03BB, 0x0000, 0x03BE, 0x0000, 0x03C1, 0x03C4,
+		0x03C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x03CB, 0x03CE, 0x03D1, 0x03D4, 0x03D7, 0x03DA,
+		0x03DD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x03E1, 0x03E4, 0x03E7, 0x03EA, 0x03ED, 0x0000,
+		0x03F0, 0x03F2, 0x03F4, 0x03F6, 0x03FB, 0x0400, 0x0402, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0404, 0x0406, 0x0408, 0x0000, 0x040A, 0x040C, 0x0000, 0x0000,
+		0x0000, 0x040E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0410, 0x0413, 0x0000, 0x0416, 0x0000, 0x0000, 0x0000, 0x0419,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x041C, 0x041F, 0x0422, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0425, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0428, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x042B, 0x042E, 0x0000, 0x0431, 0x0000, 0x0000, 0x0000, 0x0434,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0437, 0x043A, 0x043D, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0440, 0x0443,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0446, 0x0449, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x044C, 0x044F, 0x0452, 0x0455, 0x0000, 0x0000, 0x0458, 0x045B,
+		0x0000, 0x0000, 0x045E, 0x0461, 0x0464, 0x0467, 0x046A, 0x046D,
+		0x0000, 0x0000, 0x0470, 0x0473, 0x0476, 0x0479, 0x047C, 0x047F,
+		0x0000, 0x0000, 0x0482, 0x0485, 0x0488, 0x048B, 0x048E, 0x0491,
+		0x0494, 0x0497, 0x049A, 0x049D, 0x04A0, 0x04A3, 0x0000, 0x0000,
+		0x04A6, 0x04A9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04AC,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x04AF, 0x04B2, 0x04B5, 0x04B8, 0x04BB, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x04BE, 0x04C1, 0x04C4,
+		0x04C7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x04CA, 0x0000, 0x04CD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x04D0, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x04D3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x04D6, 0x0000, 0x0000, 0x04D9, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x04DC, 0x04DF, 0x04E2, 0x04E5, 0x04E8, 0x04EB, 0x04EE, 0x04F1,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x04F4, 0x04F7, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x04FA, 0x04FD, 0x0000, 0x0500,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0503, 0x0000, 0x0000, 0x0506, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0509, 0x050C, 0x050F, 0x0000, 0x0000, 0x0512, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0515, 0x0000, 0x0000, 0x0518, 0x051B, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x051E, 0x0521, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0524, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0527, 0x052A, 0x052D, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0530, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0533, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0536,
+		0x0539, 0x0000, 0x053C, 0x053F, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0543, 0x0546, 0x0549, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x054C, 0x0000, 0x054F, 0x0552, 0x0556, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0559, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x055C, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x055F, 0x0562, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0565, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0567, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x056A, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x056D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0570,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0573, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0576, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0579, 0x0000, 0x057C, 0x057F, 0x0582,
+		0x0586, 0x0589, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x058D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0590, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0593, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0596, 0x0000, 0x0000, 0x0000, 0x0000, 0x0599,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x059C, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x059F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05A2, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x05A5, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x05A7, 0x0000,
+		0x05AA, 0x0000, 0x05AD, 0x0000, 0x05B0, 0x0000, 0x05B3, 0x0000,
+		0x0000, 0x0000, 0x05B6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x05B9, 0x0000, 0x05BC, 0x0000, 0x0000,
+		0x05BF, 0x05C2, 0x0000, 0x05C5, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x05C8, 0x05CA, 0x05CC, 0x0000,
+		0x05CE, 0x05D0, 0x05D2, 0x05D4, 0x05D6, 0x05D8, 0x05DA, 0x05DC,
+		0x05DE, 0x05E0, 0x05E2, 0x0000, 0x05E4, 0x05E6, 0x05E8, 0x05EA,
+		0x05EC, 0x05EE, 0x05F0, 0x05F2, 0x05F4, 0x05F6, 0x05F8, 0x05FA,
+		0x05FC, 0x05FE, 0x0600, 0x0602, 0x0604, 0x0606, 0x0000, 0x0608,
+		0x060A, 0x060C, 0x060E, 0x0610, 0x0612, 0x0614, 0x0616, 0x0618,
+		0x061A, 0x061C, 0x061E, 0x0620, 0x0622, 0x0624, 0x0626, 0x0628,
+		0x062A, 0x062C, 0x062E, 0x0630, 0x0632, 0x0634, 0x0636, 0x0638,
+		0x063A, 0x063C, 0x063E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0640, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0642, 0x0644, 0x0646, 0x0648, 0x064A,
+		0x064C, 0x064E, 0x0650, 0x0652, 0x0654, 0x0656, 0x0658, 0x065A,
+		0x065C, 0x065E, 0x0660, 0x0662, 0x0664, 0x0666, 0x0668, 0x066A,
+		0x066C, 0x066E, 0x0670, 0x0672, 0x0674, 0x0676, 0x0678, 0x067A,
+		0x067C, 0x067E, 0x0680, 0x0682, 0x0684, 0x0686, 0x0688, 0x068A,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x068C, 0x068F, 0x0692, 0x0695, 0x0698, 0x069B, 0x069E, 0x06A1,
+		0x06A4, 0x06A8, 0x06AC, 0x06AF, 0x06B2, 0x06B5, 0x06B8, 0x06BB,
+		0x06BE, 0x06C1, 0x06C4, 0x06C7, 0x06CA, 0x06CE, 0x06D2, 0x06D6,
+		0x06DA, 0x06DD, 0x06E0, 0x06E3, 0x06E6, 0x06EA, 0x06EE, 0x06F1,
+		0x06F4, 0x06F7, 0x06FA, 0x06FD, 0x0700, 0x0703, 0x0706, 0x0709,
+		0x070C, 0x070F, 0x0712, 0x0715, 0x0718, 0x071B, 0x071E, 0x0722,
+		0x0726, 0x0729, 0x072C, 0x072F, 0x0732, 0x0735, 0x0738, 0x073B,
+		0x073E, 0x0742, 0x0746, 0x0749, 0x074C, 0x074F, 0x0752, 0x0755,
+		0x0758, 0x075B, 0x075E, 0x0761, 0x0764, 0x0767, 0x076A, 0x076D,
+		0x0770, 0x0773, 0x0776, 0x0779, 0x077C, 0x0780, 0x0784, 0x0788,
+		0x078C, 0x0790, 0x0794, 0x0798, 0x079C, 0x079F, 0x07A2, 0x07A5,
+		0x07A8, 0x07AB, 0x07AE, 0x07B1, 0x07B4, 0x07B8, 0x07BC, 0x07BF,
+		0x07C2, 0x07C5, 0x07C8, 0x07CB, 0x07CE, 0x07D2, 0x07D6, 0x07DA,
+		0x07DE, 0x07E2, 0x07E6, 0x07E9, 0x07EC, 0x07EF, 0x07F2, 0x07F5,
+		0x07F8, 0x07FB, 0x07FE, 0x0801, 0x0804, 0x0807, 0x080A, 0x080D,
+		0x0810, 0x0814, 0x0818, 0x081C, 0x0820, 0x0823, 0x0826, 0x0829,
+	},
+	{
+		0x082C, 0x082F, 0x0832, 0x0835, 0x0838, 0x083B, 0x083E, 0x0841,
+		0x0844, 0x0847, 0x084A, 0x084D, 0x0850, 0x0853, 0x0856, 0x0859,
+		0x085C, 0x085F, 0x0862, 0x0865, 0x0868, 0x086B, 0x086E, 0x0871,
+		0x0874, 0x0877, 0x087A, 0x087D, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0882, 0x0885, 0x0888, 0x088B, 0x088E, 0x0892, 0x0896, 0x089A,
+		0x089E, 0x08A2, 0x08A6, 0x08AA, 0x08AE, 0x08B2, 0x08B6, 0x08BA,
+		0x08BE, 0x08C2, 0x08C6, 0x08CA, 0x08CE, 0x08D2, 0x08D6, 0x08DA,
+		0x08DE, 0x08E1, 0x08E4, 0x08E7, 0x08EA, 0x08ED, 0x08F0, 0x08F4,
+		0x08F8, 0x08FC, 0x0900, 0x0904, 0x0908, 0x090C, 0x0910, 0x0914,
+		0x0918, 0x091B, 0x091E, 0x0921, 0x0924, 0x0927, 0x092A, 0x092D,
+		0x0930, 0x0934, 0x0938, 0x093C, 0x0940, 0x0944, 0x0948, 0x094C,
+		0x0950, 0x0954, 0x0958, 0x095C, 0x0960, 0x0964, 0x0968, 0x096C,
+		0x0970, 0x0974, 0x0978, 0x097C, 0x0980, 0x0983, 0x0986, 0x0989,
+		0x098C, 0x0990, 0x0994, 0x0998, 0x099C, 0x09A0, 0x09A4, 0x09A8,
+		0x09AC, 0x09B0, 0x09B4, 0x09B7, 0x09BA, 0x09BD, 0x09C0, 0x09C3,
+		0x09C6, 0x09C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x09CC, 0x09CF, 0x09D2, 0x09D6, 0x09DA, 0x09DE, 0x09E2, 0x09E6,
+		0x09EA, 0x09ED, 0x09F0, 0x09F4, 0x09F8, 0x09FC, 0x0A00, 0x0A04,
+		0x0A08, 0x0A0B, 0x0A0E, 0x0A12, 0x0A16, 0x0A1A, 0x0000, 0x0000,
+		0x0A1E, 0x0A21, 0x0A24, 0x0A28, 0x0A2C, 0x0A30, 0x0000, 0x0000,
+		0x0A34, 0x0A37, 0x0A3A, 0x0A3E, 0x0A42, 0x0A46, 0x0A4A, 0x0A4E,
+		0x0A52, 0x0A55, 0x0A58, 0x0A5C, 0x0A60, 0x0A64, 0x0A68, 0x0A6C,
+		0x0A70, 0x0A73, 0x0A76, 0x0A7A, 0x0A7E, 0x0A82, 0x0A86, 0x0A8A,
+		0x0A8E, 0x0A91, 0x0A94, 0x0A98, 0x0A9C, 0x0AA0, 0x0AA4, 0x0AA8,
+		0x0AAC, 0x0AAF, 0x0AB2, 0x0AB6, 0x0ABA, 0x0ABE, 0x0000, 0x0000,
+		0x0AC2, 0x0AC5, 0x0AC8, 0x0ACC, 0x0AD0, 0x0AD4, 0x0000, 0x0000,
+		0x0AD8, 0x0ADB, 0x0ADE, 0x0AE2, 0x0AE6, 0x0AEA, 0x0AEE, 0x0AF2,
+		0x0000, 0x0AF6, 0x0000, 0x0AF9, 0x0000, 0x0AFD, 0x0000, 0x0B01,
+		0x0B05, 0x0B08, 0x0B0B, 0x0B0F, 0x0B13, 0x0B17, 0x0B1B, 0x0B1F,
+		0x0B23, 0x0B26, 0x0B29, 0x0B2D, 0x0B31, 0x0B35, 0x0B39, 0x0B3D,
+		0x0B41, 0x0B44, 0x0B47, 0x0B4A, 0x0B4D, 0x0B50, 0x0B53, 0x0B56,
+		0x0B59, 0x0B5C, 0x0B5F, 0x0B62, 0x0B65, 0x0B68, 0x0000, 0x0000,
+	},
+	{
+		0x0B6B, 0x0B6F, 0x0B73, 0x0B78, 0x0B7D, 0x0B82, 0x0B87, 0x0B8C,
+		0x0B91, 0x0B95, 0x0B99, 0x0B9E, 0x0BA3, 0x0BA8, 0x0BAD, 0x0BB2,
+		0x0BB7, 0x0BBB, 0x0BBF, 0x0BC4, 0x0BC9, 0x0BCE, 0x0BD3, 0x0BD8,
+		0x0BDD, 0x0BE1, 0x0BE5, 0x0BEA, 0x0BEF, 0x0BF4, 0x0BF9, 0x0BFE,
+		0x0C03, 0x0C07, 0x0C0B, 0x0C10, 0x0C15, 0x0C1A, 0x0C1F, 0x0C24,
+		0x0C29, 0x0C2D, 0x0C31, 0x0C36, 0x0C3B, 0x0C40, 0x0C45, 0x0C4A,
+		0x0C4F, 0x0C52, 0x0C55, 0x0C59, 0x0C5C, 0x0000, 0x0C60, 0x0C63,
+		0x0C67, 0x0C6A, 0x0C6D, 0x0C70, 0x0C73, 0x0C76, 0x0C79, 0x0C7B,
+		0x0C7E, 0x0C81, 0x0C87, 0x0C8B, 0x0C8E, 0x0000, 0x0C92, 0x0C95,
+		0x0C99, 0x0C9C, 0x0C9F, 0x0CA2, 0x0CA5, 0x0CA8, 0x0CAE, 0x0CB4,
+		0x0CBA, 0x0CBD, 0x0CC0, 0x0CC4, 0x0000, 0x0000, 0x0CC8, 0x0CCB,
+		0x0CCF, 0x0CD2, 0x0CD5, 0x0CD8, 0x0000, 0x0CDB, 0x0CE1, 0x0CE7,
+		0x0CED, 0x0CF0, 0x0CF3, 0x0CF7, 0x0CFB, 0x0CFE, 0x0D01, 0x0D04,
+		0x0D08, 0x0D0B, 0x0D0E, 0x0D11, 0x0D14, 0x0D17, 0x0D1D, 0x0D23,
+		0x0000, 0x0000, 0x0D25, 0x0D29, 0x0D2C, 0x0000, 0x0D30, 0x0D33,
+		0x0D37, 0x0D3A, 0x0D3D, 0x0D40, 0x0D43, 0x0D46, 0x0D4A, 0x0000,
+	},
+	{
+		0x0D4D, 0x0D50, 0x0D53, 0x0D55, 0x0D57, 0x0D59, 0x0D5B, 0x0D5D,
+		0x0D5F, 0x0D61, 0x0D63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0D65, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D67,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0D6A, 0x0D6C, 0x0D6F, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D73,
+		0x0000, 0x0000, 0x0000, 0x0D75, 0x0D78, 0x0000, 0x0D7C, 0x0D7F,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0D83, 0x0000, 0x0D86, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D89,
+		0x0D8C, 0x0D8F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D92,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0D97,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0D99, 0x0D9B, 0x0000, 0x0000, 0x0D9D, 0x0D9F, 0x0DA1, 0x0DA3,
+		0x0DA5, 0x0DA7, 0x0DA9, 0x0DAB, 0x0DAD, 0x0DAF, 0x0DB1, 0x0DB3,
+	},
+	{
+		0x0DB5, 0x0DB7, 0x0DB9, 0x0DBB, 0x0DBD, 0x0DBF, 0x0DC1, 0x0DC3,
+		0x0DC5, 0x0DC7, 0x0DC9, 0x0DCB, 0x0DCD, 0x0DCF, 0x0DD1, 0x0000,
+		0x0DD3, 0x0DD5, 0x0DD7, 0x0DD9, 0x0DDB, 0x0DDD, 0x0DDF, 0x0DE1,
+		0x0DE3, 0x0DE5, 0x0DE7, 0x0DE9, 0x0DEB, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0DED, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0DF0, 0x0DF4, 0x0DF8, 0x0DFA, 0x0000, 0x0DFD, 0x0E01, 0x0E05,
+		0x0000, 0x0E07, 0x0E0A, 0x0E0C, 0x0E0E, 0x0E10, 0x0E12, 0x0E14,
+		0x0E16, 0x0E18, 0x0E1A, 0x0E1C, 0x0000, 0x0E1E, 0x0E20, 0x0000,
+		0x0000, 0x0E23, 0x0E25, 0x0E27, 0x0E29, 0x0E2B, 0x0000, 0x0000,
+		0x0E2D, 0x0E30, 0x0E34, 0x0000, 0x0E37, 0x0000, 0x0E39, 0x0000,
+		0x0E3B, 0x0000, 0x0E3D, 0x0E3F, 0x0E42, 0x0E44, 0x0000, 0x0E46,
+		0x0E48, 0x0E4A, 0x0000, 0x0E4C, 0x0E4E, 0x0E50, 0x0E52, 0x0E54,
+		0x0E56, 0x0E58, 0x0000, 0x0E5A, 0x0E5E, 0x0E60, 0x0E62, 0x0E64,
+		0x0E66, 0x0000, 0x0000, 0x0000, 0x0000, 0x0E68, 0x0E6A, 0x0E6C,
+		0x0E6E, 0x0E70, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0E72, 0x0E76, 0x0E7A, 0x0E7F, 0x0E83, 0x0E87, 0x0E8B, 0x0E8F,
+		0x0E93, 0x0E97, 0x0E9B, 0x0E9F, 0x0EA3, 0x0EA7, 0x0EAB, 0x0EAF,
+		0x0EB2, 0x0EB4, 0x0EB7, 0x0EBB, 0x0EBE, 0x0EC0, 0x0EC3, 0x0EC7,
+		0x0ECC, 0x0ECF, 0x0ED1, 0x0ED4, 0x0ED8, 0x0EDA, 0x0EDC, 0x0EDE,
+		0x0EE0, 0x0EE2, 0x0EE5, 0x0EE9, 0x0EEC, 0x0EEE, 0x0EF1, 0x0EF5,
+		0x0EFA, 0x0EFD, 0x0EFF, 0x0F02, 0x0F06, 0x0F08, 0x0F0A, 0x0F0C,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0F0E, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0F12, 0x0F15, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F18, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F1B, 0x0F1E, 0x0F21,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0F24, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0F27, 0x0000, 0x0000, 0x0F2A, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0F2D, 0x0000, 0x0F30, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0F33, 0x0F36, 0x0000, 0x0F3A,
+		0x0F3D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0F41, 0x0000, 0x0000, 0x0F44, 0x0000, 0x0000, 0x0F47,
+		0x0000, 0x0F4A, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0F4D, 0x0000, 0x0F50, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0F53, 0x0F56, 0x0F59,
+		0x0F5C, 0x0F5F, 0x0000, 0x0000, 0x0F62, 0x0F65, 0x0000, 0x0000,
+		0x0F68, 0x0F6B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0F6E, 0x0F71, 0x0000, 0x0000, 0x0F74, 0x0F77, 0x0000, 0x0000,
+		0x0F7A, 0x0F7D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0F80, 0x0F83, 0x0F86, 0x0F89,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0F8C, 0x0F8F, 0x0F92, 0x0F95, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0F98, 0x0F9B, 0x0F9E, 0x0FA1, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0FA4, 0x0FA6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0FA8, 0x0FAA, 0x0FAC, 0x0FAE, 0x0FB0, 0x0FB2, 0x0FB4, 0x0FB6,
+		0x0FB8, 0x0FBA, 0x0FBD, 0x0FC0, 0x0FC3, 0x0FC6, 0x0FC9, 0x0FCC,
+		0x0FCF, 0x0FD2, 0x0FD5, 0x0FD8, 0x0FDB, 0x0FDF, 0x0FE3, 0x0FE7,
+		0x0FEB, 0x0FEF, 0x0FF3, 0x0FF7, 0x0FFB, 0x0FFF, 0x1004, 0x1009,
+	},
+	{
+		0x100E, 0x1013, 0x1018, 0x101D, 0x1022, 0x1027, 0x102C, 0x1031,
+		0x1036, 0x1039, 0x103C, 0x103F, 0x1042, 0x1045, 0x1048, 0x104B,
+		0x104E, 0x1051, 0x1055, 0x1059, 0x105D, 0x1061, 0x1065, 0x1069,
+		0x106D, 0x1071, 0x1075, 0x1079, 0x107D, 0x1081, 0x1085, 0x1089,
+		0x108D, 0x1091, 0x1095, 0x1099, 0x109D, 0x10A1, 0x10A5, 0x10A9,
+		0x10AD, 0x10B1, 0x10B5, 0x10B9, 0x10BD, 0x10C1, 0x10C5, 0x10C9,
+		0x10CD, 0x10D1, 0x10D5, 0x10D9, 0x10DD, 0x10E1, 0x10E5, 0x10E7,
+		0x10E9, 0x10EB, 0x10ED, 0x10EF, 0x10F1, 0x10F3, 0x10F5, 0x10F7,
+		0x10F9, 0x10FB, 0x10FD, 0x10FF, 0x1101, 0x1103, 0x1105, 0x1107,
+		0x1109, 0x110B, 0x110D, 0x110F, 0x1111, 0x1113, 0x1115, 0x1117,
+		0x1119, 0x111B, 0x111D, 0x111F, 0x1121, 0x1123, 0x1125, 0x1127,
+		0x1129, 0x112B, 0x112D, 0x112F, 0x1131, 0x1133, 0x1135, 0x1137,
+		0x1139, 0x113B, 0x113D, 0x113F, 0x1141, 0x1143, 0x1145, 0x1147,
+		0x1149, 0x114B, 0x114D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x114F, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x1154, 0x1158, 0x115B, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x115F, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x1162, 0x1164, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1166,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1168,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x116A, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x116C, 0x116E, 0x1170, 0x1172, 0x1174, 0x1176, 0x1178, 0x117A,
+		0x117C, 0x117E, 0x1180, 0x1182, 0x1184, 0x1186, 0x1188, 0x118A,
+		0x118C, 0x118E, 0x1190, 0x1192, 0x1194, 0x1196, 0x1198, 0x119A,
+		0x119C, 0x119E, 0x11A0, 0x11A2, 0x11A4, 0x11A6, 0x11A8, 0x11AA,
+		0x11AC, 0x11AE, 0x11B0, 0x11B2, 0x11B4, 0x11B6, 0x11B8, 0x11BA,
+		0x11BC, 0x11BE, 0x11C0, 0x11C2, 0x11C4, 0x11C6, 0x11C8, 0x11CA,
+		0x11CC, 0x11CE, 0x11D0, 0x11D2, 0x11D4, 0x11D6, 0x11D8, 0x11DA,
+		0x11DC, 0x11DE, 0x11E0, 0x11E2, 0x11E4, 0x11E6, 0x11E8, 0x11EA,
+		0x11EC, 0x11EE, 0x11F0, 0x11F2, 0x11F4, 0x11F6, 0x11F8, 0x11FA,
+		0x11FC, 0x11FE, 0x1200, 0x1202, 0x1204, 0x1206, 0x1208, 0x120A,
+		0x120C, 0x120E, 0x1210, 0x1212, 0x1214, 0x1216, 0x1218, 0x121A,
+		0x121C, 0x121E, 0x1220, 0x1222, 0x1224, 0x1226, 0x1228, 0x122A,
+		0x122C, 0x122E, 0x1230, 0x1232, 0x1234, 0x1236, 0x1238, 0x123A,
+		0x123C, 0x123E, 0x1240, 0x1242, 0x1244, 0x1246, 0x1248, 0x124A,
+		0x124C, 0x124E, 0x1250, 0x1252, 0x1254, 0x1256, 0x1258, 0x125A,
+		0x125C, 0x125E, 0x1260, 0x1262, 0x1264, 0x1266, 0x1268, 0x126A,
+	},
+	{
+		0x126C, 0x126E, 0x1270, 0x1272, 0x1274, 0x1276, 0x1278, 0x127A,
+		0x127C, 0x127E, 0x1280, 0x1282, 0x1284, 0x1286, 0x1288, 0x128A,
+		0x128C, 0x128E, 0x1290, 0x1292, 0x1294, 0x1296, 0x1298, 0x129A,
+		0x129C, 0x129E, 0x12A0, 0x12A2, 0x12A4, 0x12A6, 0x12A8, 0x12AA,
+		0x12AC, 0x12AE, 0x12B0, 0x12B2, 0x12B4, 0x12B6, 0x12B8, 0x12BA,
+		0x12BC, 0x12BE, 0x12C0, 0x12C2, 0x12C4, 0x12C6, 0x12C8, 0x12CA,
+		0x12CC, 0x12CE, 0x12D0, 0x12D2, 0x12D4, 0x12D6, 0x12D8, 0x12DA,
+		0x12DC, 0x12DE, 0x12E0, 0x12E2, 0x12E4, 0x12E6, 0x12E8, 0x12EA,
+		0x12EC, 0x12EE, 0x12F0, 0x12F2, 0x12F4, 0x12F6, 0x12F8, 0x12FA,
+		0x12FC, 0x12FE, 0x1300, 0x1302, 0x1304, 0x1306, 0x1308, 0x130A,
+		0x130C, 0x130E, 0x1310, 0x1312, 0x1314, 0x1316, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x1318, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x131A, 0x0000,
+		0x131C, 0x131E, 0x1320, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x1322, 0x0000, 0x1325, 0x0000,
+		0x1328, 0x0000, 0x132B, 0x0000, 0x132E, 0x0000, 0x1331, 0x0000,
+		0x1334, 0x0000, 0x1337, 0x0000, 0x133A, 0x0000, 0x133D, 0x0000,
+		0x1340, 0x0000, 0x1343, 0x0000, 0x0000, 0x1346, 0x0000, 0x1349,
+		0x0000, 0x134C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x134F, 0x1352, 0x0000, 0x1355, 0x1358, 0x0000, 0x135B, 0x135E,
+		0x0000, 0x1361, 0x1364, 0x0000, 0x1367, 0x136A, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x136D, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x1370, 0x1373, 0x0000, 0x1376, 0x1379,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x137C, 0x0000, 0x137F, 0x0000,
+		0x1382, 0x0000, 0x1385, 0x0000, 0x1388, 0x0000, 0x138B, 0x0000,
+		0x138E, 0x0000, 0x1391, 0x0000, 0x1394, 0x0000, 0x1397, 0x0000,
+		0x139A, 0x0000, 0x139D, 0x0000, 0x0000, 0x13A0, 0x0000, 0x13A3,
+		0x0000, 0x13A6, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x13A9, 0x13AC, 0x0000, 0x13AF, 0x13B2, 0x0000, 0x13B5, 0x13B8,
+		0x0000, 0x13BB, 0x13BE, 0x0000, 0x13C1, 0x13C4, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x13C7, 0x0000, 0x0000, 0x13CA,
+		0x13CD, 0x13D0, 0x13D3, 0x0000, 0x0000, 0x0000, 0x13D6, 0x13D9,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x13DC, 0x13DE, 0x13E0, 0x13E2, 0x13E4, 0x13E6, 0x13E8,
+		0x13EA, 0x13EC, 0x13EE, 0x13F0, 0x13F2, 0x13F4, 0x13F6, 0x13F8,
+		0x13FA, 0x13FC, 0x13FE, 0x1400, 0x1402, 0x1404, 0x1406, 0x1408,
+		0x140A, 0x140C, 0x140E, 0x1410, 0x1412, 0x1414, 0x1416, 0x1418,
+		0x141A, 0x141C, 0x141E, 0x1420, 0x1422, 0x1424, 0x1426, 0x1428,
+		0x142A, 0x142C, 0x142E, 0x1430, 0x1432, 0x1434, 0x1436, 0x1438,
+		0x143A, 0x143C, 0x143E, 0x1440, 0x1442, 0x1444, 0x1446, 0x1448,
+		0x144A, 0x144C, 0x144E, 0x1450, 0x1452, 0x1454, 0x1456, 0x1458,
+		0x145A, 0x145C, 0x145E, 0x1460, 0x1462, 0x1464, 0x1466, 0x1468,
+		0x146A, 0x146C, 0x146E, 0x1470, 0x1472, 0x1474, 0x1476, 0x1478,
+	},
+	{
+		0x147A, 0x147C, 0x147E, 0x1480, 0x1482, 0x1484, 0x1486, 0x1488,
+		0x148A, 0x148C, 0x148E, 0x1490, 0x1492, 0x1494, 0x1496, 0x0000,
+		0x0000, 0x0000, 0x1498, 0x149A, 0x149C, 0x149E, 0x14A0, 0x14A2,
+		0x14A4, 0x14A6, 0x14A8, 0x14AA, 0x14AC, 0x14AE, 0x14B0, 0x14B2,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x14B4, 0x14B8, 0x14BC, 0x14C0, 0x14C4, 0x14C8, 0x14CC, 0x14D0,
+		0x14D4, 0x14D8, 0x14DC, 0x14E0, 0x14E4, 0x14E8, 0x14EC, 0x14F1,
+		0x14F6, 0x14FB, 0x1500, 0x1505, 0x150A, 0x150F, 0x1514, 0x1519,
+		0x151E, 0x1523, 0x1528, 0x152D, 0x1532, 0x1537, 0x153F, 0x0000,
+		0x1546, 0x154A, 0x154E, 0x1552, 0x1556, 0x155A, 0x155E, 0x1562,
+		0x1566, 0x156A, 0x156E, 0x1572, 0x1576, 0x157A, 0x157E, 0x1582,
+		0x1586, 0x158A, 0x158E, 0x1592, 0x1596, 0x159A, 0x159E, 0x15A2,
+		0x15A6, 0x15AA, 0x15AE, 0x15B2, 0x15B6, 0x15BA, 0x15BE, 0x15C2,
+		0x15C6, 0x15CA, 0x15CE, 0x15D2, 0x15D6, 0x15D8, 0x15DA, 0x15DC,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x15DE, 0x15E2, 0x15E5, 0x15E8, 0x15EB, 0x15EE, 0x15F1, 0x15F4,
+		0x15F7, 0x15FA, 0x15FD, 0x1600, 0x1603, 0x1606, 0x1609, 0x160C,
+		0x160F, 0x1611, 0x1613, 0x1615, 0x1617, 0x1619, 0x161B, 0x161D,
+		0x161F, 0x1621, 0x1623, 0x1625, 0x1627, 0x1629, 0x162B, 0x162E,
+		0x1631, 0x1634, 0x1637, 0x163A, 0x163D, 0x1640, 0x1643, 0x1646,
+		0x1649, 0x164C, 0x164F, 0x1652, 0x1655, 0x165B, 0x1660, 0x0000,
+	},
+	{
+		0x1663, 0x1665, 0x1667, 0x1669, 0x166B, 0x166D, 0x166F, 0x1671,
+		0x1673, 0x1675, 0x1677, 0x1679, 0x167B, 0x167D, 0x167F, 0x1681,
+		0x1683, 0x1685, 0x1687, 0x1689, 0x168B, 0x168D, 0x168F, 0x1691,
+		0x1693, 0x1695, 0x1697, 0x1699, 0x169B, 0x169D, 0x169F, 0x16A1,
+		0x16A3, 0x16A5, 0x16A7, 0x16A9, 0x16AB, 0x16AD, 0x16AF, 0x16B1,
+		0x16B3, 0x16B5, 0x16B7, 0x16B9, 0x16BB, 0x16BD, 0x16BF, 0x16C1,
+		0x16C3, 0x16C5, 0x16C8, 0x16CB, 0x16CE, 0x16D1, 0x16D4, 0x16D7,
+		0x16DA, 0x16DD, 0x16E0, 0x16E3, 0x16E6, 0x16E9, 0x16EC, 0x16EF,
+		0x16F2, 0x16F5, 0x16F8, 0x16FB, 0x16FE, 0x1701, 0x1704, 0x1707,
+		0x170A, 0x170D, 0x1711, 0x1715, 0x1719, 0x171C, 0x1720, 0x1723,
+		0x1727, 0x1729, 0x172B, 0x172D, 0x172F, 0x1731, 0x1733, 0x1735,
+		0x1737, 0x1739, 0x173B, 0x173D, 0x173F, 0x1741, 0x1743, 0x1745,
+		0x1747, 0x1749, 0x174B, 0x174D, 0x174F, 0x1751, 0x1753, 0x1755,
+		0x1757, 0x1759, 0x175B, 0x175D, 0x175F, 0x1761, 0x1763, 0x1765,
+		0x1767, 0x1769, 0x176B, 0x176D, 0x176F, 0x1771, 0x1773, 0x1775,
+		0x1777, 0x1779, 0x177B, 0x177D, 0x177F, 0x1781, 0x1783, 0x1785,
+	},
+	{
+		0x1788, 0x178E, 0x1793, 0x1799, 0x179D, 0x17A3, 0x17A7, 0x17AB,
+		0x17B2, 0x17B7, 0x17BB, 0x17BF, 0x17C3, 0x17C8, 0x17CD, 0x17D2,
+		0x17D7, 0x17DC, 0x17E1, 0x17E6, 0x17ED, 0x17F0, 0x17F7, 0x17FE,
+		0x1804, 0x1809, 0x1810, 0x1817, 0x181C, 0x1820, 0x1824, 0x1829,
+		0x182E, 0x1834, 0x183A, 0x183E, 0x1842, 0x1847, 0x184B, 0x184F,
+		0x1852, 0x1855, 0x1859, 0x185D, 0x1864, 0x1869, 0x186F, 0x1876,
+		0x187B, 0x187F, 0x1883, 0x188A, 0x188F, 0x1896, 0x189A, 0x18A0,
+		0x18A4, 0x18A9, 0x18AD, 0x18B2, 0x18B8, 0x18BD, 0x18C3, 0x18C8,
+		0x18CB, 0x18D1, 0x18D5, 0x18D9, 0x18DE, 0x18E2, 0x18E6, 0x18EA,
+		0x18F0, 0x18F5, 0x18F8, 0x18FF, 0x1903, 0x1909, 0x190E, 0x1913,
+		0x1917, 0x191B, 0x1920, 0x1923, 0x1928, 0x192E, 0x1931, 0x1938,
+		0x193C, 0x193F, 0x1942, 0x1945, 0x1948, 0x194B, 0x194E, 0x1951,
+		0x1954, 0x1957, 0x195A, 0x195E, 0x1962, 0x1966, 0x196A, 0x196E,
+		0x1972, 0x1976, 0x197A, 0x197E, 0x1982, 0x1986, 0x198A, 0x198E,
+		0x1992, 0x1996, 0x199A, 0x199D, 0x19A0, 0x19A4, 0x19A7, 0x19AA,
+		0x19AD, 0x19B1, 0x19B5, 0x19B8, 0x19BB, 0x19BE, 0x19C1, 0x19C4,
+	},
+	{
+		0x19C9, 0x19CC, 0x19CF, 0x19D2, 0x19D5, 0x19D8, 0x19DB, 0x19DE,
+		0x19E1, 0x19E5, 0x19EA, 0x19ED, 0x19F0, 0x19F3, 0x19F6, 0x19F9,
+		0x19FC, 0x19FF, 0x1A03, 0x1A07, 0x1A0B, 0x1A0F, 0x1A12, 0x1A15,
+		0x1A18, 0x1A1B, 0x1A1E, 0x1A21, 0x1A24, 0x1A27, 0x1A2A, 0x1A2D,
+		0x1A31, 0x1A35, 0x1A38, 0x1A3C, 0x1A40, 0x1A44, 0x1A47, 0x1A4B,
+		0x1A4F, 0x1A54, 0x1A57, 0x1A5B, 0x1A5F, 0x1A63, 0x1A67, 0x1A6D,
+		0x1A74, 0x1A77, 0x1A7A, 0x1A7D, 0x1A80, 0x1A83, 0x1A86, 0x1A89,
+		0x1A8C, 0x1A8F, 0x1A92, 0x1A95, 0x1A98, 0x1A9B, 0x1A9E, 0x1AA1,
+		0x1AA4, 0x1AA7, 0x1AAA, 0x1AAF, 0x1AB2, 0x1AB5, 0x1AB8, 0x1ABD,
+		0x1AC1, 0x1AC4, 0x1AC7, 0x1ACA, 0x1ACD, 0x1AD0, 0x1AD3, 0x1AD6,
+		0x1AD9, 0x1ADC, 0x1ADF, 0x1AE3, 0x1AE6, 0x1AE9, 0x1AED, 0x1AF1,
+		0x1AF4, 0x1AF9, 0x1AFD, 0x1B00, 0x1B03, 0x1B06, 0x1B09, 0x1B0D,
+		0x1B11, 0x1B14, 0x1B17, 0x1B1A, 0x1B1D, 0x1B20, 0x1B23, 0x1B26,
+		0x1B29, 0x1B2C, 0x1B30, 0x1B34, 0x1B38, 0x1B3C, 0x1B40, 0x1B44,
+		0x1B48, 0x1B4C, 0x1B50, 0x1B54, 0x1B58, 0x1B5C, 0x1B60, 0x1B64,
+		0x1B68, 0x1B6C, 0x1B70, 0x1B74, 0x1B78, 0x1B7C, 0x1B80, 0x1B84,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x1B88, 0x1B8A, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x1B8C, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x1B8E, 0x1B90, 0x1B92, 0x0000, 0x0000, 0x0000,
+		0x1B94, 0x1B96, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x1B98, 0x1B9A, 0x1B9C, 0x1B9E,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x1BA0, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x1BA2, 0x1BA4, 0x1BA6, 0x1BA8, 0x1BAA, 0x1BAC, 0x1BAE, 0x1BB0,
+		0x1BB2, 0x1BB4, 0x1BB6, 0x1BB8, 0x1BBA, 0x1BBC, 0x1BBE, 0x1BC0,
+		0x1BC2, 0x1BC4, 0x1BC6, 0x1BC8, 0x1BCA, 0x1BCC, 0x1BCE, 0x1BD0,
+		0x1BD2, 0x1BD4, 0x1BD6, 0x1BD8, 0x1BDA, 0x1BDC, 0x1BDE, 0x1BE0,
+		0x1BE2, 0x1BE4, 0x1BE6, 0x1BE8, 0x1BEA, 0x1BEC, 0x1BEE, 0x1BF0,
+		0x1BF2, 0x1BF4, 0x1BF6, 0x1BF8, 0x1BFA, 0x1BFC, 0x1BFE, 0x1C00,
+		0x1C02, 0x1C04, 0x1C06, 0x1C08, 0x1C0A, 0x1C0C, 0x1C0E, 0x1C10,
+		0x1C12, 0x1C14, 0x1C16, 0x1C18, 0x1C1A, 0x1C1C, 0x1C1E, 0x1C20,
+		0x1C22, 0x1C24, 0x1C26, 0x1C28, 0x1C2A, 0x1C2C, 0x1C2E, 0x1C30,
+		0x1C32, 0x1C34, 0x1C36, 0x1C38, 0x1C3A, 0x1C3C, 0x1C3E, 0x1C40,
+		0x1C42, 0x1C44, 0x1C46, 0x1C48, 0x1C4A, 0x1C4C, 0x1C4E, 0x1C50,
+		0x1C52, 0x1C54, 0x1C56, 0x1C58, 0x1C5A, 0x1C5C, 0x1C5E, 0x1C60,
+		0x1C62, 0x1C64, 0x1C66, 0x1C68, 0x1C6A, 0x1C6C, 0x1C6E, 0x1C70,
+		0x1C72, 0x1C74, 0x1C76, 0x1C78, 0x1C7A, 0x1C7C, 0x1C7E, 0x1C80,
+		0x1C82, 0x1C84, 0x1C86, 0x1C88, 0x1C8A, 0x1C8C, 0x1C8E, 0x1C90,
+		0x1C92, 0x1C94, 0x1C96, 0x1C98, 0x1C9A, 0x1C9C, 0x1C9E, 0x1CA0,
+	},
+	{
+		0x1CA2, 0x1CA4, 0x1CA6, 0x1CA8, 0x1CAA, 0x1CAC, 0x1CAE, 0x1CB0,
+		0x1CB2, 0x1CB4, 0x1CB6, 0x1CB8, 0x1CBA, 0x1CBC, 0x1CBE, 0x1CC0,
+		0x1CC2, 0x1CC4, 0x1CC6, 0x1CC8, 0x1CCA, 0x1CCC, 0x1CCE, 0x1CD0,
+		0x1CD2, 0x1CD4, 0x1CD6, 0x1CD8, 0x1CDA, 0x1CDC, 0x1CDE, 0x1CE0,
+		0x1CE2, 0x1CE4, 0x1CE6, 0x1CE8, 0x1CEA, 0x1CEC, 0x1CEE, 0x1CF0,
+		0x1CF2, 0x1CF4, 0x1CF6, 0x1CF8, 0x1CFA, 0x1CFC, 0x1CFE, 0x1D00,
+		0x1D02, 0x1D04, 0x1D06, 0x1D08, 0x1D0A, 0x1D0C, 0x1D0E, 0x1D10,
+		0x1D12, 0x1D14, 0x1D16, 0x1D18, 0x1D1A, 0x1D1C, 0x1D1E, 0x1D20,
+		0x1D22, 0x1D24, 0x1D26, 0x1D28, 0x1D2A, 0x1D2C, 0x1D2E, 0x1D30,
+		0x1D32, 0x1D34, 0x1D36, 0x1D38, 0x1D3A, 0x1D3C, 0x1D3E, 0x1D40,
+		0x1D42, 0x1D44, 0x1D46, 0x1D48, 0x1D4A, 0x1D4C, 0x1D4E, 0x1D50,
+		0x1D52, 0x1D54, 0x1D56, 0x1D58, 0x1D5A, 0x1D5C, 0x1D5E, 0x1D60,
+		0x1D62, 0x1D64, 0x1D66, 0x1D68, 0x1D6A, 0x1D6C, 0x1D6E, 0x1D70,
+		0x1D72, 0x1D74, 0x1D76, 0x1D78, 0x1D7A, 0x1D7C, 0x1D7E, 0x1D80,
+		0x1D82, 0x1D84, 0x1D86, 0x1D88, 0x1D8A, 0x1D8C, 0x1D8E, 0x1D90,
+		0x1D92, 0x1D94, 0x1D96, 0x1D98, 0x1D9A, 0x1D9C, 0x1D9E, 0x1DA0,
+	},
+	{
+		0x1DA2, 0x1DA4, 0x1DA6, 0x1DA8, 0x1DAA, 0x1DAC, 0x1DAE, 0x1DB0,
+		0x1DB2, 0x1DB4, 0x1DB6, 0x1DB8, 0x1DBA, 0x1DBC, 0x0000, 0x0000,
+		0x1DBE, 0x0000, 0x1DC0, 0x0000, 0x0000, 0x1DC2, 0x1DC4, 0x1DC6,
+		0x1DC8, 0x1DCA, 0x1DCC, 0x1DCE, 0x1DD0, 0x1DD2, 0x1DD4, 0x0000,
+		0x1DD6, 0x0000, 0x1DD8, 0x0000, 0x0000, 0x1DDA, 0x1DDC, 0x0000,
+		0x0000, 0x0000, 0x1DDE, 0x1DE0, 0x1DE2, 0x1DE4, 0x1DE6, 0x1DE8,
+		0x1DEA, 0x1DEC, 0x1DEE, 0x1DF0, 0x1DF2, 0x1DF4, 0x1DF6, 0x1DF8,
+		0x1DFA, 0x1DFC, 0x1DFE, 0x1E00, 0x1E02, 0x1E04, 0x1E06, 0x1E08,
+		0x1E0A, 0x1E0C, 0x1E0E, 0x1E10, 0x1E12, 0x1E14, 0x1E16, 0x1E18,
+		0x1E1A, 0x1E1C, 0x1E1E, 0x1E20, 0x1E22, 0x1E24, 0x1E26, 0x1E28,
+		0x1E2A, 0x1E2C, 0x1E2E, 0x1E30, 0x1E32, 0x1E34, 0x1E36, 0x1E38,
+		0x1E3A, 0x1E3C, 0x1E3E, 0x1E40, 0x1E42, 0x1E44, 0x1E46, 0x1E48,
+		0x1E4A, 0x1E4C, 0x1E4E, 0x1E50, 0x1E52, 0x1E54, 0x1E56, 0x1E58,
+		0x1E5A, 0x1E5C, 0x1E5E, 0x1E60, 0x1E62, 0x1E64, 0x0000, 0x0000,
+		0x1E66, 0x1E68, 0x1E6A, 0x1E6C, 0x1E6E, 0x1E70, 0x1E72, 0x1E74,
+		0x1E76, 0x1E78, 0x1E7A, 0x1E7C, 0x1E7E, 0x1E80, 0x1E82, 0x1E84,
+	},
+	{
+		0x1E86, 0x1E88, 0x1E8A, 0x1E8C, 0x1E8E, 0x1E90, 0x1E92, 0x1E94,
+		0x1E96, 0x1E98, 0x1E9A, 0x1E9C, 0x1E9E, 0x1EA0, 0x1EA2, 0x1EA4,
+		0x1EA6, 0x1EA8, 0x1EAA, 0x1EAC, 0x1EAE, 0x1EB0, 0x1EB2, 0x1EB4,
+		0x1EB6, 0x1EB8, 0x1EBA, 0x1EBC, 0x1EBE, 0x1EC0, 0x1EC2, 0x1EC4,
+		0x1EC6, 0x1EC8, 0x1ECA, 0x1ECC, 0x1ECE, 0x1ED0, 0x1ED2, 0x1ED4,
+		0x1ED6, 0x1ED8, 0x1EDA, 0x1EDC, 0x1EDE, 0x1EE0, 0x1EE2, 0x1EE4,
+		0x1EE6, 0x1EE8, 0x1EEA, 0x1EEC, 0x1EEE, 0x1EF0, 0x1EF2, 0x1EF4,
+		0x1EF6, 0x1EF8, 0x1EFA, 0x1EFC, 0x1EFE, 0x1F00, 0x1F02, 0x1F04,
+		0x1F06, 0x1F08, 0x1F0A, 0x1F0C, 0x1F0E, 0x1F10, 0x1F12, 0x1F14,
+		0x1F16, 0x1F18, 0x1F1A, 0x1F1C, 0x1F1E, 0x1F20, 0x1F22, 0x1F24,
+		0x1F26, 0x1F28, 0x1F2A, 0x1F2C, 0x1F2E, 0x1F30, 0x1F32, 0x1F34,
+		0x1F36, 0x1F38, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x1F3A, 0x1F3D, 0x1F40, 0x1F43, 0x1F47, 0x1F4B, 0x1F4E, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x1F51, 0x1F54, 0x1F57, 0x1F5A, 0x1F5D,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1F60, 0x0000, 0x1F63,
+		0x1F66, 0x1F68, 0x1F6A, 0x1F6C, 0x1F6E, 0x1F70, 0x1F72, 0x1F74,
+		0x1F76, 0x1F78, 0x1F7A, 0x1F7D, 0x1F80, 0x1F84, 0x1F88, 0x1F8B,
+		0x1F8E, 0x1F91, 0x1F94, 0x1F97, 0x1F9A, 0x1F9D, 0x1FA0, 0x0000,
+		0x1FA3, 0x1FA6, 0x1FA9, 0x1FAC, 0x1FAF, 0x0000, 0x1FB2, 0x0000,
+		0x1FB5, 0x1FB8, 0x0000, 0x1FBB, 0x1FBE, 0x0000, 0x1FC1, 0x1FC4,
+		0x1FC7, 0x1FCA, 0x1FCD, 0x1FD0, 0x1FD3, 0x1FD6, 0x1FD9, 0x1FDC,
+		0x1FDF, 0x1FE1, 0x1FE3, 0x1FE5, 0x1FE7, 0x1FE9, 0x1FEB, 0x1FED,
+		0x1FEF, 0x1FF1, 0x1FF3, 0x1FF5, 0x1FF7, 0x1FF9, 0x1FFB, 0x1FFD,
+		0x1FFF, 0x2001, 0x2003, 0x2005, 0x2007, 0x2009, 0x200B, 0x200D,
+		0x200F, 0x2011, 0x2013, 0x2015, 0x2017, 0x2019, 0x201B, 0x201D,
+		0x201F, 0x2021, 0x2023, 0x2025, 0x2027, 0x2029, 0x202B, 0x202D,
+		0x202F, 0x2031, 0x2033, 0x2035, 0x2037, 0x2039, 0x203B, 0x203D,
+	},
+	{
+		0x203F, 0x2041, 0x2043, 0x2045, 0x2047, 0x2049, 0x204B, 0x204D,
+		0x204F, 0x2051, 0x2053, 0x2055, 0x2057, 0x2059, 0x205B, 0x205D,
+		0x205F, 0x2061, 0x2063, 0x2065, 0x2067, 0x2069, 0x206B, 0x206D,
+		0x206F, 0x2071, 0x2073, 0x2075, 0x2077, 0x2079, 0x207B, 0x207D,
+		0x207F, 0x2081, 0x2083, 0x2085, 0x2087, 0x208A, 0x208D, 0x208F,
+		0x2091, 0x2093, 0x2095, 0x2097, 0x2099, 0x209B, 0x209D, 0x209F,
+		0x20A1, 0x20A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x20A7, 0x20A9, 0x20AB, 0x20AD, 0x20AF,
+		0x20B1, 0x20B3, 0x20B5, 0x20B7, 0x20B9, 0x20BB, 0x20BE, 0x20C0,
+		0x20C2, 0x20C4, 0x20C6, 0x20C8, 0x20CA, 0x20CC, 0x20CE, 0x20D0,
+		0x20D2, 0x20D4, 0x20D6, 0x20DA, 0x20DE, 0x20E2, 0x20E6, 0x20EA,
+		0x20EE, 0x20F2, 0x20F6, 0x20FA, 0x20FE, 0x2102, 0x2106, 0x210A,
+		0x210E, 0x2112, 0x2116, 0x211A, 0x211E, 0x2120, 0x2122, 0x2124,
+	},
+	{
+		0x2126, 0x212A, 0x212E, 0x2132, 0x2136, 0x213A, 0x213D, 0x2140,
+		0x2143, 0x2146, 0x2149, 0x214C, 0x214F, 0x2152, 0x2155, 0x2158,
+		0x215B, 0x215E, 0x2161, 0x2164, 0x2167, 0x216A, 0x216D, 0x2170,
+		0x2173, 0x2176, 0x2179, 0x217C, 0x217F, 0x2182, 0x2185, 0x2188,
+		0x218B, 0x218E, 0x2191, 0x2194, 0x2197, 0x219A, 0x219D, 0x21A0,
+		0x21A3, 0x21A6, 0x21A9, 0x21AC, 0x21AF, 0x21B2, 0x21B5, 0x21B8,
+		0x21BB, 0x21BE, 0x21C1, 0x21C4, 0x21C7, 0x21CA, 0x21CD, 0x21D0,
+		0x21D3, 0x21D6, 0x21D9, 0x21DC, 0x21DF, 0x21E2, 0x21E5, 0x21E8,
+		0x21EB, 0x21EE, 0x21F1, 0x21F4, 0x21F7, 0x21FA, 0x21FD, 0x2200,
+		0x2203, 0x2206, 0x2209, 0x220C, 0x220F, 0x2212, 0x2215, 0x2218,
+		0x221B, 0x221E, 0x2221, 0x2224, 0x2227, 0x222A, 0x222D, 0x2230,
+		0x2233, 0x2236, 0x2239, 0x223C, 0x223F, 0x2242, 0x2245, 0x2249,
+		0x224D, 0x2251, 0x2255, 0x2259, 0x225D, 0x2261, 0x2265, 0x2269,
+		0x226D, 0x2271, 0x2275, 0x2278, 0x227B, 0x227E, 0x2281, 0x2284,
+		0x2287, 0x228A, 0x228D, 0x2290, 0x2293, 0x2296, 0x2299, 0x229C,
+		0x229F, 0x22A2, 0x22A5, 0x22A8, 0x22AB, 0x22AE, 0x22B1, 0x22B4,
+	},
+	{
+		0x22B7, 0x22BA, 0x22BD, 0x22C0, 0x22C3, 0x22C6, 0x22C9, 0x22CC,
+		0x22CF, 0x22D2, 0x22D5, 0x22D8, 0x22DB, 0x22DE, 0x22E1, 0x22E4,
+		0x22E7, 0x22EA, 0x22ED, 0x22F0, 0x22F3, 0x22F6, 0x22F9, 0x22FC,
+		0x2300, 0x2304, 0x2308, 0x230C, 0x2310, 0x2313, 0x2316, 0x2319,
+		0x231C, 0x231F, 0x2322, 0x2325, 0x2328, 0x232B, 0x232E, 0x2331,
+		0x2334, 0x2337, 0x233A, 0x233D, 0x2340, 0x2343, 0x2346, 0x2349,
+		0x234C, 0x234F, 0x2352, 0x2355, 0x2358, 0x235B, 0x235E, 0x2361,
+		0x2364, 0x2367, 0x236A, 0x236D, 0x2370, 0x2373, 0x2376, 0x2379,
+		0x237C, 0x237F, 0x2382, 0x2385, 0x2388, 0x238B, 0x238E, 0x2391,
+		0x2394, 0x2397, 0x239A, 0x239D, 0x23A0, 0x23A3, 0x23A6, 0x23A9,
+		0x23AC, 0x23AF, 0x23B2, 0x23B5, 0x23B8, 0x23BB, 0x23BE, 0x23C1,
+		0x23C4, 0x23C7, 0x23CA, 0x23CD, 0x23D0, 0x23D3, 0x23D6, 0x23D9,
+		0x23DD, 0x23E1, 0x23E4, 0x23E7, 0x23EA, 0x23ED, 0x23F0, 0x23F3,
+		0x23F6, 0x23F9, 0x23FC, 0x23FF, 0x2402, 0x2405, 0x2408, 0x240B,
+		0x240E, 0x2411, 0x2414, 0x2418, 0x241C, 0x2420, 0x2423, 0x2426,
+		0x2429, 0x242C, 0x242F, 0x2432, 0x2435, 0x2438, 0x243B, 0x243E,
+	},
+	{
+		0x2441, 0x2444, 0x2447, 0x244A, 0x244D, 0x2450, 0x2453, 0x2456,
+		0x2459, 0x245C, 0x245F, 0x2462, 0x2465, 0x2468, 0x246B, 0x246E,
+		0x2471, 0x2474, 0x2477, 0x247A, 0x247D, 0x2480, 0x2483, 0x2486,
+		0x2489, 0x248C, 0x248F, 0x2492, 0x2495, 0x2498, 0x249B, 0x249E,
+		0x24A1, 0x24A4, 0x24A7, 0x24AA, 0x24AD, 0x24B0, 0x24B3, 0x24B6,
+		0x24B9, 0x24BC, 0x24BF, 0x24C2, 0x24C5, 0x24C8, 0x24CB, 0x24CE,
+		0x24D1, 0x24D4, 0x24D7, 0x24DA, 0x24DD, 0x24E0, 0x24E3, 0x24E6,
+		0x24E9, 0x24EC, 0x24EF, 0x24F2, 0x24F5, 0x24F8, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x24FB, 0x24FF, 0x2503, 0x2507, 0x250B, 0x250F, 0x2513, 0x2517,
+		0x251B, 0x251F, 0x2523, 0x2527, 0x252B, 0x252F, 0x2533, 0x2537,
+		0x253B, 0x253F, 0x2543, 0x2547, 0x254B, 0x254F, 0x2553, 0x2557,
+		0x255B, 0x255F, 0x2563, 0x2567, 0x256B, 0x256F, 0x2573, 0x2577,
+		0x257B, 0x257F, 0x2583, 0x2587, 0x258B, 0x258F, 0x2593, 0x2597,
+		0x259B, 0x259F, 0x25A3, 0x25A7, 0x25AB, 0x25AF, 0x25B3, 0x25B7,
+	},
+	{
+		0x25BB, 0x25BF, 0x25C3, 0x25C7, 0x25CB, 0x25CF, 0x25D3, 0x25D7,
+		0x25DB, 0x25DF, 0x25E3, 0x25E7, 0x25EB, 0x25EF, 0x25F3, 0x25F7,
+		0x0000, 0x0000, 0x25FB, 0x25FF, 0x2603, 0x2607, 0x260B, 0x260F,
+		0x2613, 0x2617, 0x261B, 0x261F, 0x2623, 0x2627, 0x262B, 0x262F,
+		0x2633, 0x2637, 0x263B, 0x263F, 0x2643, 0x2647, 0x264B, 0x264F,
+		0x2653, 0x2657, 0x265B, 0x265F, 0x2663, 0x2667, 0x266B, 0x266F,
+		0x2673, 0x2677, 0x267B, 0x267F, 0x2683, 0x2687, 0x268B, 0x268F,
+		0x2693, 0x2697, 0x269B, 0x269F, 0x26A3, 0x26A7, 0x26AB, 0x26AF,
+		0x26B3, 0x26B7, 0x26BB, 0x26BF, 0x26C3, 0x26C7, 0x26CB, 0x26CF,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x26D3, 0x26D7, 0x26DB, 0x26E0, 0x26E5, 0x26EA, 0x26EF, 0x26F4,
+		0x26F9, 0x26FE, 0x2702, 0x2715, 0x271E, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x2723, 0x2725, 0x2727, 0x2729, 0x272B, 0x272D, 0x272F, 0x2731,
+		0x2733, 0x2735, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x2739, 0x273C, 0x273E, 0x2740, 0x2742, 0x2744, 0x2746, 0x2748,
+		0x274A, 0x274C, 0x274E, 0x2750, 0x2752, 0x2754, 0x2756, 0x2758,
+		0x275A, 0x275C, 0x275E, 0x2760, 0x2762, 0x0000, 0x0000, 0x2764,
+		0x2766, 0x2768, 0x276B, 0x276E, 0x2771, 0x2774, 0x2776, 0x2778,
+		0x277A, 0x277C, 0x277E, 0x0000, 0x2780, 0x2782, 0x2784, 0x2786,
+		0x2788, 0x278A, 0x278C, 0x278E, 0x2790, 0x2792, 0x2794, 0x2796,
+		0x2798, 0x279A, 0x279C, 0x279E, 0x27A0, 0x27A2, 0x27A4, 0x0000,
+		0x27A6, 0x27A8, 0x27AA, 0x27AC, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x27AE, 0x27B1, 0x27B4, 0x0000, 0x27B7, 0x0000, 0x27BA, 0x27BD,
+		0x27C0, 0x27C3, 0x27C6, 0x27C9, 0x27CC, 0x27CF, 0x27D2, 0x27D5,
+	},
+	{
+		0x27D8, 0x27DA, 0x27DD, 0x27E0, 0x27E3, 0x27E6, 0x27E9, 0x27EC,
+		0x27EF, 0x27F2, 0x27F5, 0x27F8, 0x27FB, 0x27FE, 0x2800, 0x2802,
+		0x2804, 0x2806, 0x2808, 0x280A, 0x280C, 0x280E, 0x2810, 0x2812,
+		0x2814, 0x2816, 0x2818, 0x281A, 0x281C, 0x281E, 0x2820, 0x2822,
+		0x2824, 0x2826, 0x2828, 0x282A, 0x282C, 0x282E, 0x2830, 0x2832,
+		0x2834, 0x2836, 0x2838, 0x283A, 0x283C, 0x283E, 0x2840, 0x2842,
+		0x2844, 0x2846, 0x2848, 0x284A, 0x284C, 0x284E, 0x2850, 0x2852,
+		0x2854, 0x2856, 0x2858, 0x285A, 0x285C, 0x285E, 0x2860, 0x2862,
+		0x2864, 0x2866, 0x2868, 0x286A, 0x286C, 0x286E, 0x2870, 0x2872,
+		0x2874, 0x2876, 0x2878, 0x287A, 0x287C, 0x287E, 0x2880, 0x2882,
+		0x2884, 0x2886, 0x2888, 0x288A, 0x288C, 0x288E, 0x2890, 0x2892,
+		0x2894, 0x2896, 0x2898, 0x289A, 0x289C, 0x289E, 0x28A0, 0x28A2,
+		0x28A4, 0x28A6, 0x28A8, 0x28AA, 0x28AC, 0x28AE, 0x28B0, 0x28B2,
+		0x28B4, 0x28B6, 0x28B8, 0x28BA, 0x28BC, 0x28BE, 0x28C0, 0x28C2,
+		0x28C4, 0x28C6, 0x28C8, 0x28CA, 0x28CC, 0x28CE, 0x28D2, 0x28D6,
+		0x28DA, 0x28DE, 0x28E2, 0x28E6, 0x28E9, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x28EC, 0x28EE, 0x28F0, 0x28F2, 0x28F4, 0x28F6, 0x28F8,
+		0x28FA, 0x28FC, 0x28FE, 0x2900, 0x2902, 0x2904, 0x2906, 0x2908,
+		0x290A, 0x290C, 0x290E, 0x2910, 0x2912, 0x2914, 0x2916, 0x2918,
+		0x291A, 0x291C, 0x291E, 0x2920, 0x2922, 0x2924, 0x2926, 0x2928,
+		0x292A, 0x292C, 0x292E, 0x2930, 0x2932, 0x2934, 0x2936, 0x2938,
+		0x293A, 0x293C, 0x293E, 0x2940, 0x2942, 0x2944, 0x2946, 0x2948,
+		0x294A, 0x294C, 0x294E, 0x2950, 0x2952, 0x2954, 0x2956, 0x2958,
+		0x295A, 0x295C, 0x295E, 0x2960, 0x2962, 0x2964, 0x2966, 0x2968,
+		0x296A, 0x296C, 0x296E, 0x2970, 0x2972, 0x2974, 0x2976, 0x2978,
+		0x297A, 0x297C, 0x297E, 0x2980, 0x2982, 0x2984, 0x2986, 0x2988,
+		0x298A, 0x298C, 0x298E, 0x2990, 0x2992, 0x2994, 0x2996, 0x2998,
+		0x299A, 0x299C, 0x299E, 0x29A0, 0x29A2, 0x29A4, 0x29A6, 0x29A8,
+		0x29AA, 0x29AC, 0x29AE, 0x29B0, 0x29B2, 0x29B4, 0x29B6, 0x29B8,
+		0x29BA, 0x29BC, 0x29BE, 0x29C0, 0x29C2, 0x29C4, 0x29C6, 0x29C8,
+		0x29CA, 0x29CC, 0x29CE, 0x29D0, 0x29D2, 0x29D4, 0x29D6, 0x29D8,
+		0x29DA, 0x29DC, 0x29DE, 0x29E0, 0x29E2, 0x29E4, 0x29E6, 0x29E8,
+	},
+	{
+		0x29EA, 0x29EC, 0x29EE, 0x29F0, 0x29F2, 0x29F4, 0x29F6, 0x29F8,
+		0x29FA, 0x29FC, 0x29FE, 0x2A00, 0x2A02, 0x2A04, 0x2A06, 0x2A08,
+		0x2A0A, 0x2A0C, 0x2A0E, 0x2A10, 0x2A12, 0x2A14, 0x2A16, 0x2A18,
+		0x2A1A, 0x2A1C, 0x2A1E, 0x2A20, 0x2A22, 0x2A24, 0x2A26, 0x2A28,
+		0x2A2A, 0x2A2C, 0x2A2E, 0x2A30, 0x2A32, 0x2A34, 0x2A36, 0x2A38,
+		0x2A3A, 0x2A3C, 0x2A3E, 0x2A40, 0x2A42, 0x2A44, 0x2A46, 0x2A48,
+		0x2A4A, 0x2A4C, 0x2A4E, 0x2A50, 0x2A52, 0x2A54, 0x2A56, 0x2A58,
+		0x2A5A, 0x2A5C, 0x2A5E, 0x2A60, 0x2A62, 0x2A64, 0x2A66, 0x0000,
+		0x0000, 0x0000, 0x2A68, 0x2A6A, 0x2A6C, 0x2A6E, 0x2A70, 0x2A72,
+		0x0000, 0x0000, 0x2A74, 0x2A76, 0x2A78, 0x2A7A, 0x2A7C, 0x2A7E,
+		0x0000, 0x0000, 0x2A80, 0x2A82, 0x2A84, 0x2A86, 0x2A88, 0x2A8A,
+		0x0000, 0x0000, 0x2A8C, 0x2A8E, 0x2A90, 0x0000, 0x0000, 0x0000,
+		0x2A92, 0x2A94, 0x2A96, 0x2A98, 0x2A9B, 0x2A9D, 0x2A9F, 0x0000,
+		0x2AA1, 0x2AA3, 0x2AA5, 0x2AA7, 0x2AA9, 0x2AAB, 0x2AAD, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x2AAF, 0x2AB1, 0x2AB3, 0x2AB5, 0x2AB7, 0x0000, 0x2AB9,
+		0x2ABB, 0x2ABD, 0x2ABF, 0x2AC1, 0x2AC3, 0x2AC5, 0x2AC7, 0x2AC9,
+		0x2ACB, 0x2ACD, 0x2ACF, 0x2AD1, 0x2AD3, 0x2AD5, 0x2AD7, 0x2AD9,
+		0x2ADB, 0x2ADD, 0x2ADF, 0x2AE1, 0x2AE3, 0x2AE5, 0x2AE7, 0x2AE9,
+		0x2AEB, 0x2AED, 0x2AEF, 0x2AF1, 0x2AF3, 0x2AF5, 0x2AF7, 0x2AF9,
+		0x2AFB, 0x2AFD, 0x2AFF, 0x2B01, 0x2B03, 0x2B05, 0x2B07, 0x2B09,
+		0x2B0B, 0x0000, 0x2B0D, 0x2B0F, 0x2B11, 0x2B13, 0x2B15, 0x2B17,
+		0x2B19, 0x2B1B, 0x2B1D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x2B1F, 0x0000, 0x2B22, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x2B25, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2B28, 0x2B2B,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x2B2E, 0x2B31, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x2B34, 0x2B37, 0x0000, 0x2B3A, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x2B3D, 0x2B40, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x2B43, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x2B46, 0x2B49,
+		0x2B4C, 0x2B50, 0x2B54, 0x2B58, 0x2B5C, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x2B60, 0x2B63, 0x2B66, 0x2B6A, 0x2B6E,
+		0x2B72, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x2B76, 0x2B78, 0x2B7A, 0x2B7C, 0x2B7E, 0x2B80, 0x2B82, 0x2B84,
+		0x2B86, 0x2B88, 0x2B8A, 0x2B8C, 0x2B8E, 0x2B90, 0x2B92, 0x2B94,
+		0x2B96, 0x2B98, 0x2B9A, 0x2B9C, 0x2B9E, 0x2BA0, 0x2BA2, 0x2BA4,
+		0x2BA6, 0x2BA8, 0x2BAA, 0x2BAC, 0x2BAE, 0x2BB0, 0x2BB2, 0x2BB4,
+		0x2BB6, 0x2BB8, 0x2BBA, 0x2BBC, 0x2BBE, 0x2BC0, 0x2BC2, 0x2BC4,
+		0x2BC6, 0x2BC8, 0x2BCA, 0x2BCC, 0x2BCE, 0x2BD0, 0x2BD2, 0x2BD4,
+		0x2BD6, 0x2BD8, 0x2BDA, 0x2BDC, 0x2BDE, 0x2BE0, 0x2BE2, 0x2BE4,
+		0x2BE6, 0x2BE8, 0x2BEA, 0x2BEC, 0x2BEE, 0x2BF0, 0x2BF2, 0x2BF4,
+		0x2BF6, 0x2BF8, 0x2BFA, 0x2BFC, 0x2BFE, 0x2C00, 0x2C02, 0x2C04,
+		0x2C06, 0x2C08, 0x2C0A, 0x2C0C, 0x2C0E, 0x2C10, 0x2C12, 0x2C14,
+		0x2C16, 0x2C18, 0x2C1A, 0x2C1C, 0x2C1E, 0x0000, 0x2C20, 0x2C22,
+		0x2C24, 0x2C26, 0x2C28, 0x2C2A, 0x2C2C, 0x2C2E, 0x2C30, 0x2C32,
+		0x2C34, 0x2C36, 0x2C38, 0x2C3A, 0x2C3C, 0x2C3E, 0x2C40, 0x2C42,
+		0x2C44, 0x2C46, 0x2C48, 0x2C4A, 0x2C4C, 0x2C4E, 0x2C50, 0x2C52,
+		0x2C54, 0x2C56, 0x2C58, 0x2C5A, 0x2C5C, 0x2C5E, 0x2C60, 0x2C62,
+		0x2C64, 0x2C66, 0x2C68, 0x2C6A, 0x2C6C, 0x2C6E, 0x2C70, 0x2C72,
+	},
+	{
+		0x2C74, 0x2C76, 0x2C78, 0x2C7A, 0x2C7C, 0x2C7E, 0x2C80, 0x2C82,
+		0x2C84, 0x2C86, 0x2C88, 0x2C8A, 0x2C8C, 0x2C8E, 0x2C90, 0x2C92,
+		0x2C94, 0x2C96, 0x2C98, 0x2C9A, 0x2C9C, 0x2C9E, 0x2CA0, 0x2CA2,
+		0x2CA4, 0x2CA6, 0x2CA8, 0x2CAA, 0x2CAC, 0x0000, 0x2CAE, 0x2CB0,
+		0x0000, 0x0000, 0x2CB2, 0x0000, 0x0000, 0x2CB4, 0x2CB6, 0x0000,
+		0x0000, 0x2CB8, 0x2CBA, 0x2CBC, 0x2CBE, 0x0000, 0x2CC0, 0x2CC2,
+		0x2CC4, 0x2CC6, 0x2CC8, 0x2CCA, 0x2CCC, 0x2CCE, 0x2CD0, 0x2CD2,
+		0x2CD4, 0x2CD6, 0x0000, 0x2CD8, 0x0000, 0x2CDA, 0x2CDC, 0x2CDE,
+		0x2CE0, 0x2CE2, 0x2CE4, 0x2CE6, 0x0000, 0x2CE8, 0x2CEA, 0x2CEC,
+		0x2CEE, 0x2CF0, 0x2CF2, 0x2CF4, 0x2CF6, 0x2CF8, 0x2CFA, 0x2CFC,
+		0x2CFE, 0x2D00, 0x2D02, 0x2D04, 0x2D06, 0x2D08, 0x2D0A, 0x2D0C,
+		0x2D0E, 0x2D10, 0x2D12, 0x2D14, 0x2D16, 0x2D18, 0x2D1A, 0x2D1C,
+		0x2D1E, 0x2D20, 0x2D22, 0x2D24, 0x2D26, 0x2D28, 0x2D2A, 0x2D2C,
+		0x2D2E, 0x2D30, 0x2D32, 0x2D34, 0x2D36, 0x2D38, 0x2D3A, 0x2D3C,
+		0x2D3E, 0x2D40, 0x2D42, 0x2D44, 0x2D46, 0x2D48, 0x2D4A, 0x2D4C,
+		0x2D4E, 0x2D50, 0x2D52, 0x2D54, 0x2D56, 0x2D58, 0x2D5A, 0x2D5C,
+	},
+	{
+		0x2D5E, 0x2D60, 0x2D62, 0x2D64, 0x2D66, 0x2D68, 0x0000, 0x2D6A,
+		0x2D6C, 0x2D6E, 0x2D70, 0x0000, 0x0000, 0x2D72, 0x2D74, 0x2D76,
+		0x2D78, 0x2D7A, 0x2D7C, 0x2D7E, 0x2D80, 0x0000, 0x2D82, 0x2D84,
+		0x2D86, 0x2D88, 0x2D8A, 0x2D8C, 0x2D8E, 0x0000, 0x2D90, 0x2D92,
+		0x2D94, 0x2D96, 0x2D98, 0x2D9A, 0x2D9C, 0x2D9E, 0x2DA0, 0x2DA2,
+		0x2DA4, 0x2DA6, 0x2DA8, 0x2DAA, 0x2DAC, 0x2DAE, 0x2DB0, 0x2DB2,
+		0x2DB4, 0x2DB6, 0x2DB8, 0x2DBA, 0x2DBC, 0x2DBE, 0x2DC0, 0x2DC2,
+		0x2DC4, 0x2DC6, 0x0000, 0x2DC8, 0x2DCA, 0x2DCC, 0x2DCE, 0x0000,
+		0x2DD0, 0x2DD2, 0x2DD4, 0x2DD6, 0x2DD8, 0x0000, 0x2DDA, 0x0000,
+		0x0000, 0x0000, 0x2DDC, 0x2DDE, 0x2DE0, 0x2DE2, 0x2DE4, 0x2DE6,
+		0x2DE8, 0x0000, 0x2DEA, 0x2DEC, 0x2DEE, 0x2DF0, 0x2DF2, 0x2DF4,
+		0x2DF6, 0x2DF8, 0x2DFA, 0x2DFC, 0x2DFE, 0x2E00, 0x2E02, 0x2E04,
+		0x2E06, 0x2E08, 0x2E0A, 0x2E0C, 0x2E0E, 0x2E10, 0x2E12, 0x2E14,
+		0x2E16, 0x2E18, 0x2E1A, 0x2E1C, 0x2E1E, 0x2E20, 0x2E22, 0x2E24,
+		0x2E26, 0x2E28, 0x2E2A, 0x2E2C, 0x2E2E, 0x2E30, 0x2E32, 0x2E34,
+		0x2E36, 0x2E38, 0x2E3A, 0x2E3C, 0x2E3E, 0x2E40, 0x2E42, 0x2E44,
+	},
+	{
+		0x2E46, 0x2E48, 0x2E4A, 0x2E4C, 0x2E4E, 0x2E50, 0x2E52, 0x2E54,
+		0x2E56, 0x2E58, 0x2E5A, 0x2E5C, 0x2E5E, 0x2E60, 0x2E62, 0x2E64,
+		0x2E66, 0x2E68, 0x2E6A, 0x2E6C, 0x2E6E, 0x2E70, 0x2E72, 0x2E74,
+		0x2E76, 0x2E78, 0x2E7A, 0x2E7C, 0x2E7E, 0x2E80, 0x2E82, 0x2E84,
+		0x2E86, 0x2E88, 0x2E8A, 0x2E8C, 0x2E8E, 0x2E90, 0x2E92, 0x2E94,
+		0x2E96, 0x2E98, 0x2E9A, 0x2E9C, 0x2E9E, 0x2EA0, 0x2EA2, 0x2EA4,
+		0x2EA6, 0x2EA8, 0x2EAA, 0x2EAC, 0x2EAE, 0x2EB0, 0x2EB2, 0x2EB4,
+		0x2EB6, 0x2EB8, 0x2EBA, 0x2EBC, 0x2EBE, 0x2EC0, 0x2EC2, 0x2EC4,
+		0x2EC6, 0x2EC8, 0x2ECA, 0x2ECC, 0x2ECE, 0x2ED0, 0x2ED2, 0x2ED4,
+		0x2ED6, 0x2ED8, 0x2EDA, 0x2EDC, 0x2EDE, 0x2EE0, 0x2EE2, 0x2EE4,
+		0x2EE6, 0x2EE8, 0x2EEA, 0x2EEC, 0x2EEE, 0x2EF0, 0x2EF2, 0x2EF4,
+		0x2EF6, 0x2EF8, 0x2EFA, 0x2EFC, 0x2EFE, 0x2F00, 0x2F02, 0x2F04,
+		0x2F06, 0x2F08, 0x2F0A, 0x2F0C, 0x2F0E, 0x2F10, 0x2F12, 0x2F14,
+		0x2F16, 0x2F18, 0x2F1A, 0x2F1C, 0x2F1E, 0x2F20, 0x2F22, 0x2F24,
+		0x2F26, 0x2F28, 0x2F2A, 0x2F2C, 0x2F2E, 0x2F30, 0x2F32, 0x2F34,
+		0x2F36, 0x2F38, 0x2F3A, 0x2F3C, 0x2F3E, 0x2F40, 0x2F42, 0x2F44,
+	},
+	{
+		0x2F46, 0x2F48, 0x2F4A, 0x2F4C, 0x2F4E, 0x2F50, 0x2F52, 0x2F54,
+		0x2F56, 0x2F58, 0x2F5A, 0x2F5C, 0x2F5E, 0x2F60, 0x2F62, 0x2F64,
+		0x2F66, 0x2F68, 0x2F6A, 0x2F6C, 0x2F6E, 0x2F70, 0x2F72, 0x2F74,
+		0x2F76, 0x2F78, 0x2F7A, 0x2F7C, 0x2F7E, 0x2F80, 0x2F82, 0x2F84,
+		0x2F86, 0x2F88, 0x2F8A, 0x2F8C, 0x2F8E, 0x2F90, 0x2F92, 0x2F94,
+		0x2F96, 0x2F98, 0x2F9A, 0x2F9C, 0x2F9E, 0x2FA0, 0x2FA2, 0x2FA4,
+		0x2FA6, 0x2FA8, 0x2FAA, 0x2FAC, 0x2FAE, 0x2FB0, 0x2FB2, 0x2FB4,
+		0x2FB6, 0x2FB8, 0x2FBA, 0x2FBC, 0x2FBE, 0x2FC0, 0x2FC2, 0x2FC4,
+		0x2FC6, 0x2FC8, 0x2FCA, 0x2FCC, 0x2FCE, 0x2FD0, 0x2FD2, 0x2FD4,
+		0x2FD6, 0x2FD8, 0x2FDA, 0x2FDC, 0x2FDE, 0x2FE0, 0x2FE2, 0x2FE4,
+		0x2FE6, 0x2FE8, 0x2FEA, 0x2FEC, 0x2FEE, 0x2FF0, 0x2FF2, 0x2FF4,
+		0x2FF6, 0x2FF8, 0x2FFA, 0x2FFC, 0x2FFE, 0x3000, 0x3002, 0x3004,
+		0x3006, 0x3008, 0x300A, 0x300C, 0x300E, 0x3010, 0x3012, 0x3014,
+		0x3016, 0x3018, 0x301A, 0x301C, 0x301E, 0x3020, 0x3022, 0x3024,
+		0x3026, 0x3028, 0x302A, 0x302C, 0x302E, 0x3030, 0x3032, 0x3034,
+		0x3036, 0x3038, 0x303A, 0x303C, 0x303E, 0x3040, 0x3042, 0x3044,
+	},
+	{
+		0x3046, 0x3048, 0x304A, 0x304C, 0x304E, 0x3050, 0x3052, 0x3054,
+		0x3056, 0x3058, 0x305A, 0x305C, 0x305E, 0x3060, 0x3062, 0x3064,
+		0x3066, 0x3068, 0x306A, 0x306C, 0x306E, 0x3070, 0x3072, 0x3074,
+		0x3076, 0x3078, 0x307A, 0x307C, 0x307E, 0x3080, 0x3082, 0x3084,
+		0x3086, 0x3088, 0x308A, 0x308C, 0x308E, 0x3090, 0x0000, 0x0000,
+		0x3092, 0x3094, 0x3096, 0x3098, 0x309A, 0x309C, 0x309E, 0x30A0,
+		0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AC, 0x30AE, 0x30B0,
+		0x30B2, 0x30B4, 0x30B6, 0x30B8, 0x30BA, 0x30BC, 0x30BE, 0x30C0,
+		0x30C2, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CC, 0x30CE, 0x30D0,
+		0x30D2, 0x30D4, 0x30D6, 0x30D8, 0x30DA, 0x30DC, 0x30DE, 0x30E0,
+		0x30E2, 0x30E4, 0x30E6, 0x30E8, 0x30EA, 0x30EC, 0x30EE, 0x30F0,
+		0x30F2, 0x30F4, 0x30F6, 0x30F8, 0x30FA, 0x30FC, 0x30FE, 0x3100,
+		0x3102, 0x3104, 0x3106, 0x3108, 0x310A, 0x310C, 0x310E, 0x3110,
+		0x3112, 0x3114, 0x3116, 0x3118, 0x311A, 0x311C, 0x311E, 0x3120,
+		0x3122, 0x3124, 0x3126, 0x3128, 0x312A, 0x312C, 0x312E, 0x3130,
+		0x3132, 0x3134, 0x3136, 0x3138, 0x313A, 0x313C, 0x313E, 0x3140,
+	},
+	{
+		0x3142, 0x3144, 0x3146, 0x3148, 0x314A, 0x314C, 0x314E, 0x3150,
+		0x3152, 0x3154, 0x3156, 0x3158, 0x315A, 0x315C, 0x315E, 0x3160,
+		0x3162, 0x3164, 0x3166, 0x3168, 0x316A, 0x316C, 0x316E, 0x3170,
+		0x3172, 0x3174, 0x3176, 0x3178, 0x317A, 0x317C, 0x317E, 0x3180,
+		0x3182, 0x3184, 0x3186, 0x3188, 0x318A, 0x318C, 0x318E, 0x3190,
+		0x3192, 0x3194, 0x3196, 0x3198, 0x319A, 0x319C, 0x319E, 0x31A0,
+		0x31A2, 0x31A4, 0x31A6, 0x31A8, 0x31AA, 0x31AC, 0x31AE, 0x31B0,
+		0x31B2, 0x31B4, 0x31B6, 0x31B8, 0x31BA, 0x31BC, 0x31BE, 0x31C0,
+		0x31C2, 0x31C4, 0x31C6, 0x31C8, 0x31CA, 0x31CC, 0x31CE, 0x31D0,
+		0x31D2, 0x31D4, 0x31D6, 0x31D8, 0x31DA, 0x31DC, 0x31DE, 0x31E0,
+		0x31E2, 0x31E4, 0x31E6, 0x31E8, 0x31EA, 0x31EC, 0x31EE, 0x31F0,
+		0x31F2, 0x31F4, 0x31F6, 0x31F8, 0x31FA, 0x31FC, 0x31FE, 0x3200,
+		0x3202, 0x3204, 0x3206, 0x3208, 0x320A, 0x320C, 0x320E, 0x3210,
+		0x3212, 0x3214, 0x3216, 0x3218, 0x321A, 0x321C, 0x321E, 0x3220,
+		0x3222, 0x3224, 0x3226, 0x3228, 0x322A, 0x322C, 0x322E, 0x3230,
+		0x3232, 0x3234, 0x3236, 0x3238, 0x323A, 0x323C, 0x323E, 0x3240,
+	},
+	{
+		0x3242, 0x3244, 0x3246, 0x3248, 0x324A, 0x324C, 0x324E, 0x3250,
+		0x3252, 0x3254, 0x3256, 0x3258, 0x325A, 0x325C, 0x325E, 0x3260,
+		0x3262, 0x3264, 0x3266, 0x3268, 0x326A, 0x326C, 0x326E, 0x3270,
+		0x3272, 0x3274, 0x3276, 0x3278, 0x327A, 0x327C, 0x327E, 0x3280,
+		0x3282, 0x3284, 0x3286, 0x3288, 0x328A, 0x328C, 0x328E, 0x3290,
+		0x3292, 0x3294, 0x3296, 0x3298, 0x329A, 0x329C, 0x329E, 0x32A0,
+		0x32A2, 0x32A4, 0x32A6, 0x32A8, 0x32AA, 0x32AC, 0x32AE, 0x32B0,
+		0x32B2, 0x32B4, 0x32B6, 0x32B8, 0x32BA, 0x32BC, 0x32BE, 0x32C0,
+		0x32C2, 0x32C4, 0x32C6, 0x32C8, 0x32CA, 0x32CC, 0x32CE, 0x32D0,
+		0x32D2, 0x32D4, 0x32D6, 0x32D8, 0x0000, 0x0000, 0x32DA, 0x32DC,
+		0x32DE, 0x32E0, 0x32E2, 0x32E4, 0x32E6, 0x32E8, 0x32EA, 0x32EC,
+		0x32EE, 0x32F0, 0x32F2, 0x32F4, 0x32F6, 0x32F8, 0x32FA, 0x32FC,
+		0x32FE, 0x3300, 0x3302, 0x3304, 0x3306, 0x3308, 0x330A, 0x330C,
+		0x330E, 0x3310, 0x3312, 0x3314, 0x3316, 0x3318, 0x331A, 0x331C,
+		0x331E, 0x3320, 0x3322, 0x3324, 0x3326, 0x3328, 0x332A, 0x332C,
+		0x332E, 0x3330, 0x3332, 0x3334, 0x3336, 0x3338, 0x333A, 0x333C,
+	},
+	{
+		0x333E, 0x3340, 0x3342, 0x3344, 0x0000, 0x3346, 0x3348, 0x334A,
+		0x334C, 0x334E, 0x3350, 0x3352, 0x3354, 0x3356, 0x3358, 0x335A,
+		0x335C, 0x335E, 0x3360, 0x3362, 0x3364, 0x3366, 0x3368, 0x336A,
+		0x336C, 0x336E, 0x3370, 0x3372, 0x3374, 0x3376, 0x3378, 0x337A,
+		0x0000, 0x337C, 0x337E, 0x0000, 0x3380, 0x0000, 0x0000, 0x3382,
+		0x0000, 0x3384, 0x3386, 0x3388, 0x338A, 0x338C, 0x338E, 0x3390,
+		0x3392, 0x3394, 0x3396, 0x0000, 0x3398, 0x339A, 0x339C, 0x339E,
+		0x0000, 0x33A0, 0x0000, 0x33A2, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x33A4, 0x0000, 0x0000, 0x0000, 0x0000, 0x33A6,
+		0x0000, 0x33A8, 0x0000, 0x33AA, 0x0000, 0x33AC, 0x33AE, 0x33B0,
+		0x0000, 0x33B2, 0x33B4, 0x0000, 0x33B6, 0x0000, 0x0000, 0x33B8,
+		0x0000, 0x33BA, 0x0000, 0x33BC, 0x0000, 0x33BE, 0x0000, 0x33C0,
+		0x0000, 0x33C2, 0x33C4, 0x0000, 0x33C6, 0x0000, 0x0000, 0x33C8,
+		0x33CA, 0x33CC, 0x33CE, 0x0000, 0x33D0, 0x33D2, 0x33D4, 0x33D6,
+		0x33D8, 0x33DA, 0x33DC, 0x0000, 0x33DE, 0x33E0, 0x33E2, 0x33E4,
+		0x0000, 0x33E6, 0x33E8, 0x33EA, 0x33EC, 0x0000, 0x33EE, 0x0000,
+	},
+	{
+		0x33F0, 0x33F2, 0x33F4, 0x33F6, 0x33F8, 0x33FA, 0x33FC, 0x33FE,
+		0x3400, 0x3402, 0x0000, 0x3404, 0x3406, 0x3408, 0x340A, 0x340C,
+		0x340E, 0x3410, 0x3412, 0x3414, 0x3416, 0x3418, 0x341A, 0x341C,
+		0x341E, 0x3420, 0x3422, 0x3424, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x3426, 0x3428, 0x342A, 0x0000, 0x342C, 0x342E, 0x3430,
+		0x3432, 0x3434, 0x0000, 0x3436, 0x3438, 0x343A, 0x343C, 0x343E,
+		0x3440, 0x3442, 0x3444, 0x3446, 0x3448, 0x344A, 0x344C, 0x344E,
+		0x3450, 0x3452, 0x3454, 0x3456, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x3458, 0x345B, 0x345E, 0x3461, 0x3464, 0x3467, 0x346A, 0x346D,
+		0x3470, 0x3473, 0x3476, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x3479, 0x347D, 0x3481, 0x3485, 0x3489, 0x348D, 0x3491, 0x3495,
+		0x3499, 0x349D, 0x34A1, 0x34A5, 0x34A9, 0x34AD, 0x34B1, 0x34B5,
+		0x34B9, 0x34BD, 0x34C1, 0x34C5, 0x34C9, 0x34CD, 0x34D1, 0x34D5,
+		0x34D9, 0x34DD, 0x34E1, 0x34E5, 0x34E7, 0x34E9, 0x34EC, 0x0000,
+		0x34EF, 0x34F1, 0x34F3, 0x34F5, 0x34F7, 0x34F9, 0x34FB, 0x34FD,
+		0x34FF, 0x3501, 0x3503, 0x3505, 0x3507, 0x3509, 0x350B, 0x350D,
+		0x350F, 0x3511, 0x3513, 0x3515, 0x3517, 0x3519, 0x351B, 0x351D,
+		0x351F, 0x3521, 0x3523, 0x3526, 0x3529, 0x352C, 0x352F, 0x3533,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x3536, 0x3539, 0x353C, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x353F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x3542, 0x3545, 0x3548, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x354A, 0x354C, 0x354E, 0x3550, 0x3553, 0x3555, 0x3557, 0x3559,
+		0x355B, 0x355D, 0x355F, 0x3561, 0x3563, 0x3565, 0x3567, 0x3569,
+		0x356B, 0x356D, 0x356F, 0x3571, 0x3573, 0x3575, 0x3577, 0x3579,
+		0x357B, 0x357D, 0x357F, 0x3581, 0x3583, 0x3585, 0x3587, 0x3589,
+		0x358B, 0x358D, 0x358F, 0x3591, 0x3593, 0x3595, 0x3597, 0x3599,
+		0x359B, 0x359D, 0x359F, 0x35A1, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x35A3, 0x35A7, 0x35AB, 0x35AF, 0x35B3, 0x35B7, 0x35BB, 0x35BF,
+		0x35C3, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x35C7, 0x35C9, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x35CB, 0x35CD, 0x35CF, 0x35D1, 0x35D3, 0x35D5, 0x35D7, 0x35D9,
+		0x35DB, 0x35DD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x35DF, 0x35E1, 0x35E3, 0x35E5, 0x35E7, 0x35E9, 0x35EB, 0x35ED,
+		0x35EF, 0x35F1, 0x35F3, 0x35F5, 0x35F7, 0x35F9, 0x35FB, 0x35FD,
+		0x35FF, 0x3601, 0x3603, 0x3605, 0x3607, 0x3609, 0x360B, 0x360D,
+		0x360F, 0x3611, 0x3613, 0x3615, 0x3617, 0x3619, 0x361B, 0x361D,
+		0x361F, 0x3621, 0x3623, 0x3625, 0x3627, 0x3629, 0x362B, 0x362D,
+		0x362F, 0x3631, 0x3633, 0x3635, 0x3637, 0x3639, 0x363B, 0x363D,
+		0x363F, 0x3641, 0x3643, 0x3645, 0x3647, 0x3649, 0x364B, 0x364D,
+		0x364F, 0x3651, 0x3653, 0x3655, 0x3657, 0x3659, 0x365B, 0x365D,
+		0x365F, 0x3661, 0x3663, 0x3665, 0x3667, 0x3669, 0x366B, 0x366D,
+		0x366F, 0x3671, 0x3673, 0x3675, 0x3677, 0x3679, 0x367B, 0x367D,
+		0x367F, 0x3681, 0x3683, 0x3685, 0x3687, 0x3689, 0x368B, 0x368D,
+		0x368F, 0x3691, 0x3693, 0x3695, 0x3697, 0x3699, 0x369B, 0x369D,
+		0x369F, 0x36A1, 0x36A3, 0x36A5, 0x36A7, 0x36A9, 0x36AB, 0x36AD,
+		0x36AF, 0x36B1, 0x36B3, 0x36B5, 0x36B7, 0x36B9, 0x36BB, 0x36BD,
+		0x36BF, 0x36C1, 0x36C3, 0x36C5, 0x36C7, 0x36C9, 0x36CB, 0x36CD,
+		0x36CF, 0x36D1, 0x36D3, 0x36D5, 0x36D7, 0x36D9, 0x36DB, 0x36DD,
+	},
+	{
+		0x36DF, 0x36E1, 0x36E3, 0x36E5, 0x36E7, 0x36E9, 0x36EB, 0x36ED,
+		0x36EF, 0x36F1, 0x36F3, 0x36F5, 0x36F7, 0x36F9, 0x36FB, 0x36FD,
+		0x36FF, 0x3701, 0x3703, 0x3705, 0x3707, 0x3709, 0x370B, 0x370D,
+		0x370F, 0x3711, 0x3713, 0x3715, 0x3717, 0x3719, 0x371B, 0x371D,
+		0x371F, 0x3721, 0x3723, 0x3725, 0x3727, 0x3729, 0x372B, 0x372D,
+		0x372F, 0x3731, 0x3733, 0x3735, 0x3737, 0x3739, 0x373B, 0x373D,
+		0x373F, 0x3741, 0x3743, 0x3745, 0x3747, 0x3749, 0x374B, 0x374D,
+		0x374F, 0x3751, 0x3753, 0x3755, 0x3757, 0x3759, 0x375B, 0x375D,
+		0x375F, 0x3761, 0x3763, 0x3765, 0x3767, 0x3769, 0x376B, 0x376D,
+		0x376F, 0x3771, 0x3773, 0x3775, 0x3777, 0x3779, 0x377B, 0x377D,
+		0x377F, 0x3781, 0x3783, 0x3785, 0x3787, 0x3789, 0x378B, 0x378D,
+		0x378F, 0x3791, 0x3793, 0x3795, 0x3797, 0x3799, 0x379B, 0x379D,
+		0x379F, 0x37A1, 0x37A3, 0x37A5, 0x37A7, 0x37A9, 0x37AB, 0x37AD,
+		0x37AF, 0x37B1, 0x37B3, 0x37B5, 0x37B7, 0x37B9, 0x37BB, 0x37BD,
+		0x37BF, 0x37C1, 0x37C3, 0x37C5, 0x37C7, 0x37C9, 0x37CB, 0x37CD,
+		0x37CF, 0x37D1, 0x37D3, 0x37D5, 0x37D7, 0x37D9, 0x37DB, 0x37DD,
+	},
+	{
+		0x37DF, 0x37E1, 0x37E3, 0x37E5, 0x37E7, 0x37E9, 0x37EB, 0x37ED,
+		0x37EF, 0x37F1, 0x37F3, 0x37F5, 0x37F7, 0x37F9, 0x37FB, 0x37FD,
+		0x37FF, 0x3801, 0x3803, 0x3805, 0x3807, 0x3809, 0x380B, 0x380D,
+		0x380F, 0x3811, 0x3813, 0x3815, 0x3817, 0x3819, 0x381B, 0x381D,
+		0x381F, 0x3821, 0x3823, 0x3825, 0x3827, 0x3829, 0x382B, 0x382D,
+		0x382F, 0x3831, 0x3833, 0x3835, 0x3837, 0x3839, 0x383B, 0x383D,
+		0x383F, 0x3841, 0x3843, 0x3845, 0x3847, 0x3849, 0x384B, 0x384D,
+		0x384F, 0x3851, 0x3853, 0x3855, 0x3857, 0x3859, 0x385B, 0x385D,
+		0x385F, 0x3861, 0x3863, 0x3865, 0x3867, 0x3869, 0x386B, 0x386D,
+		0x386F, 0x3871, 0x3873, 0x3875, 0x3877, 0x3879, 0x387B, 0x387D,
+		0x387F, 0x3881, 0x3883, 0x3885, 0x3887, 0x3889, 0x388B, 0x388D,
+		0x388F, 0x3891, 0x3893, 0x3895, 0x3897, 0x3899, 0x389B, 0x389D,
+		0x389F, 0x38A1, 0x38A3, 0x38A5, 0x38A7, 0x38A9, 0x38AB, 0x38AD,
+		0x38AF, 0x38B1, 0x38B3, 0x38B5, 0x38B7, 0x38B9, 0x38BB, 0x38BD,
+		0x38BF, 0x38C1, 0x38C3, 0x38C5, 0x38C7, 0x38C9, 0x38CB, 0x38CD,
+		0x38CF, 0x38D1, 0x38D3, 0x38D5, 0x38D7, 0x38D9, 0x38DB, 0x38DD,
+	},
+	{
+		0x38DF, 0x38E1, 0x38E3, 0x38E5, 0x38E7, 0x38E9, 0x38EB, 0x38ED,
+		0x38EF, 0x38F1, 0x38F3, 0x38F5, 0x38F7, 0x38F9, 0x38FB, 0x38FD,
+		0x38FF, 0x3901, 0x3903, 0x3905, 0x3907, 0x3909, 0x390B, 0x390D,
+		0x390F, 0x3911, 0x3913, 0x3915, 0x3917, 0x3919, 0x391B, 0x391D,
+		0x391F, 0x3921, 0x3923, 0x3925, 0x3927, 0x3929, 0x392B, 0x392D,
+		0x392F, 0x3931, 0x3933, 0x3935, 0x3937, 0x3939, 0x393B, 0x393D,
+		0x393F, 0x3941, 0x3943, 0x3945, 0x3947, 0x3949, 0x394B, 0x394D,
+		0x394F, 0x3951, 0x3953, 0x3955, 0x3957, 0x3959, 0x395B, 0x395D,
+		0x395F, 0x3961, 0x3963, 0x3965, 0x3967, 0x3969, 0x396B, 0x396D,
+		0x396F, 0x3971, 0x3973, 0x3975, 0x3977, 0x3979, 0x397B, 0x397D,
+		0x397F, 0x3981, 0x3983, 0x3985, 0x3987, 0x3989, 0x398B, 0x398D,
+		0x398F, 0x3991, 0x3993, 0x3995, 0x3997, 0x3999, 0x399B, 0x399D,
+		0x399F, 0x39A1, 0x39A3, 0x39A5, 0x39A7, 0x39A9, 0x39AB, 0x39AD,
+		0x39AF, 0x39B1, 0x39B3, 0x39B5, 0x39B7, 0x39B9, 0x39BB, 0x39BD,
+		0x39BF, 0x39C1, 0x39C3, 0x39C5, 0x39C7, 0x39C9, 0x39CB, 0x39CD,
+		0x39CF, 0x39D1, 0x39D3, 0x39D5, 0x39D7, 0x39D9, 0x39DB, 0x39DD,
+	},
+	{
+		0x39DF, 0x39E1, 0x39E3, 0x39E5, 0x39E7, 0x39E9, 0x39EB, 0x39ED,
+		0x39EF, 0x39F1, 0x39F3, 0x39F5, 0x39F7, 0x39F9, 0x39FB, 0x39FD,
+		0x39FF, 0x3A01, 0x3A03, 0x3A05, 0x3A07, 0x3A09, 0x3A0B, 0x3A0D,
+		0x3A0F, 0x3A11, 0x3A13, 0x3A15, 0x3A17, 0x3A19, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+};
+
+
+const char32_t
+NORM_decompositions [14875] =
+{
+	0x00000, 0x00100, 0x00020, 0x00200, 0x00020, 0x00308, 0x00100, 0x00061,
+	0x00200, 0x00020, 0x00304, 0x00100, 0x00032, 0x00100, 0x00033, 0x00200,
+	0x00020, 0x00301, 0x00100, 0x003BC, 0x00200, 0x00020, 0x00327, 0x00100,
+	0x00031, 0x00100, 0x0006F, 0x00300, 0x00031, 0x02044, 0x00034, 0x00300,
+	0x00031, 0x02044, 0x00032, 0x00300, 0x00033, 0x02044, 0x00034, 0x00002,
+	0x00041, 0x00300, 0x00002, 0x00041, 0x00301, 0x00002, 0x00041, 0x00302,
+	0x00002, 0x00041, 0x00303, 0x00002, 0x00041, 0x00308, 0x00002, 0x00041,
+	0x0030A, 0x00002, 0x00043, 0x00327, 0x00002, 0x00045, 0x00300, 0x00002,
+	0x00045, 0x00301, 0x00002, 0x00045, 0x00302, 0x00002, 0x00045, 0x00308,
+	0x00002, 0x00049, 0x00300, 0x00002, 0x00049, 0x00301, 0x00002, 0x00049,
+	0x00302, 0x00002, 0x00049, 0x00308, 0x00002, 0x0004E, 0x00303, 0x00002,
+	0x0004F, 0x00300, 0x00002, 0x0004F, 0x00301, 0x00002, 0x0004F, 0x00302,
+	0x00002, 0x0004F, 0x00303, 0x00002, 0x0004F, 0x00308, 0x00002, 0x00055,
+	0x00300, 0x00002, 0x00055, 0x00301, 0x00002, 0x00055, 0x00302, 0x00002,
+	0x00055, 0x00308, 0x00002, 0x00059, 0x00301, 0x00002, 0x00061, 0x00300,
+	0x00002, 0x00061, 0x00301, 0x00002, 0x00061, 0x00302, 0x00002, 0x00061,
+	0x00303, 0x00002, 0x00061, 0x00308, 0x00002, 0x00061, 0x0030A, 0x00002,
+	0x00063, 0x00327, 0x00002, 0x00065, 0x00300, 0x00002, 0x00065, 0x00301,
+	0x00002, 0x00065, 0x00302, 0x00002, 0x00065, 0x00308, 0x00002, 0x00069,
+	0x00300, 0x00002, 0x00069, 0x00301, 0x00002, 0x00069, 0x00302, 0x00002,
+	0x00069, 0x00308, 0x00002, 0x0006E, 0x00303, 0x00002, 0x0006F, 0x00300,
+	0x00002, 0x0006F, 0x00301, 0x00002, 0x0006F, 0x00302, 0x00002, 0x0006F,
+	0x00303, 0x00002, 0x0006F, 0x00308, 0x00002, 0x00075, 0x00300, 0x00002,
+	0x00075, 0x00301, 0x00002, 0x00075, 0x00302, 0x00002, 0x00075, 0x00308,
+	0x00002, 0x00079, 0x00301, 0x00002, 0x00079, 0x00308, 0x00002, 0x00041,
+	0x00304, 0x00002, 0x00061, 0x00304, 0x00002, 0x00041, 0x00306, 0x00002,
+	0x00061, 0x00306, 0x00002, 0x00041, 0x00328, 0x00002, 0x00061, 0x00328,
+	0x00002, 0x00043, 0x00301, 0x00002, 0x00063, 0x00301, 0x00002, 0x00043,
+	0x00302, 0x00002, 0x00063, 0x00302, 0x00002, 0x00043, 0x00307, 0x00002,
+	0x00063, 0x00307, 0x00002, 0x00043, 0x0030C, 0x00002, 0x00063, 0x0030C,
+	0x00002, 0x00044, 0x0030C, 0x00002, 0x00064, 0x0030C, 0x00002, 0x00045,
+	0x00304, 0x00002, 0x00065, 0x00304, 0x00002, 0x00045, 0x00306, 0x00002,
+	0x00065, 0x00306, 0x00002, 0x00045, 0x00307, 0x00002, 0x00065, 0x00307,
+	0x00002, 0x00045, 0x00328, 0x00002, 0x00065, 0x00328, 0x00002, 0x00045,
+	0x0030C, 0x00002, 0x00065, 0x0030C, 0x00002, 0x00047, 0x00302, 0x00002,
+	0x00067, 0x00302, 0x00002, 0x00047, 0x00306, 0x00002, 0x00067, 0x00306,
+	0x00002, 0x00047, 0x00307, 0x00002, 0x00067, 0x00307, 0x00002, 0x00047,
+	0x00327, 0x00002, 0x00067, 0x00327, 0x00002, 0x00048, 0x00302, 0x00002,
+	0x00068, 0x00302, 0x00002, 0x00049, 0x00303, 0x00002, 0x00069, 0x00303,
+	0x00002, 0x00049, 0x00304, 0x00002, 0x00069, 0x00304, 0x00002, 0x00049,
+	0x00306, 0x00002, 0x00069, 0x00306, 0x00002, 0x00049, 0x00328, 0x00002,
+	0x00069, 0x00328, 0x00002, 0x00049, 0x00307, 0x00200, 0x00049, 0x0004A,
+	0x00200, 0x00069, 0x0006A, 0x00002, 0x0004A, 0x00302, 0x00002, 0x0006A,
+	0x00302, 0x00002, 0x0004B, 0x00327, 0x00002, 0x0006B, 0x00327, 0x00002,
+	0x0004C, 0x00301, 0x00002, 0x0006C, 0x00301, 0x00002, 0x0004C, 0x00327,
+	0x00002, 0x0006C, 0x00327, 0x00002, 0x0004C, 0x0030C, 0x00002, 0x0006C,
+	0x0030C, 0x00200, 0x0004C, 0x000B7, 0x00200, 0x0006C, 0x000B7, 0x00002,
+	0x0004E, 0x00301, 0x00002, 0x0006E, 0x00301, 0x00002, 0x0004E, 0x00327,
+	0x00002, 0x0006E, 0x00327, 0x00002, 0x0004E, 0x0030C, 0x00002, 0x0006E,
+	0x0030C, 0x00200, 0x002BC, 0x0006E, 0x00002, 0x0004F, 0x00304, 0x00002,
+	0x0006F, 0x00304, 0x00002, 0x0004F, 0x00306, 0x00002, 0x0006F, 0x00306,
+	0x00002, 0x0004F, 0x0030B, 0x00002, 0x0006F, 0x0030B, 0x00002, 0x00052,
+	0x00301, 0x00002, 0x00072, 0x00301, 0x00002, 0x00052, 0x00327, 0x00002,
+	0x00072, 0x00327, 0x00002, 0x00052, 0x0030C, 0x00002, 0x00072, 0x0030C,
+	0x00002, 0x00053, 0x00301, 0x00002, 0x00073, 0x00301, 0x00002, 0x00053,
+	0x00302, 0x00002, 0x00073, 0x00302, 0x00002, 0x00053, 0x00327, 0x00002,
+	0x00073, 0x00327, 0x00002, 0x00053, 0x0030C, 0x00002, 0x00073, 0x0030C,
+	0x00002, 0x00054, 0x00327, 0x00002, 0x00074, 0x00327, 0x00002, 0x00054,
+	0x0030C, 0x00002, 0x00074, 0x0030C, 0x00002, 0x00055, 0x00303, 0x00002,
+	0x00075, 0x00303, 0x00002, 0x00055, 0x00304, 0x00002, 0x00075, 0x00304,
+	0x00002, 0x00055, 0x00306, 0x00002, 0x00075, 0x00306, 0x00002, 0x00055,
+	0x0030A, 0x00002, 0x00075, 0x0030A, 0x00002, 0x00055, 0x0030B, 0x00002,
+	0x00075, 0x0030B, 0x00002, 0x00055, 0x00328, 0x00002, 0x00075, 0x00328,
+	0x00002, 0x00057, 0x00302, 0x00002, 0x00077, 0x00302, 0x00002, 0x00059,
+	0x00302, 0x00002, 0x00079, 0x00302, 0x00002, 0x00059, 0x00308, 0x00002,
+	0x0005A, 0x00301, 0x00002, 0x0007A, 0x00301, 0x00002, 0x0005A, 0x00307,
+	0x00002, 0x0007A, 0x00307, 0x00002, 0x0005A, 0x0030C, 0x00002, 0x0007A,
+	0x0030C, 0x00100, 0x00073, 0x00002, 0x0004F, 0x0031B, 0x00002, 0x0006F,
+	0x0031B, 0x00002, 0x00055, 0x0031B, 0x00002, 0x00075, 0x0031B, 0x00300,
+	0x00044, 0x0005A, 0x0030C, 0x00300, 0x00044, 0x0007A, 0x0030C, 0x00300,
+	0x00064, 0x0007A, 0x0030C, 0x00200, 0x0004C, 0x0004A, 0x00200, 0x0004C,
+	0x0006A, 0x00200, 0x0006C, 0x0006A, 0x00200, 0x0004E, 0x0004A, 0x00200,
+	0x0004E, 0x0006A, 0x00200, 0x0006E, 0x0006A, 0x00002, 0x00041, 0x0030C,
+	0x00002, 0x00061, 0x0030C, 0x00002, 0x00049, 0x0030C, 0x00002, 0x00069,
+	0x0030C, 0x00002, 0x0004F, 0x0030C, 0x00002, 0x0006F, 0x0030C, 0x00002,
+	0x00055, 0x0030C, 0x00002, 0x00075, 0x0030C, 0x00003, 0x00055, 0x00308,
+	0x00304, 0x00003, 0x00075, 0x00308, 0x00304, 0x00003, 0x00055, 0x00308,
+	0x00301, 0x00003, 0x00075, 0x00308, 0x00301, 0x00003, 0x00055, 0x00308,
+	0x0030C, 0x00003, 0x00075, 0x00308, 0x0030C, 0x00003, 0x00055, 0x00308,
+	0x00300, 0x00003, 0x00075, 0x00308, 0x00300, 0x00003, 0x00041, 0x00308,
+	0x00304, 0x00003, 0x00061, 0x00308, 0x00304, 0x00003, 0x00041, 0x00307,
+	0x00304, 0x00003, 0x00061, 0x00307, 0x00304, 0x00002, 0x000C6, 0x00304,
+	0x00002, 0x000E6, 0x00304, 0x00002, 0x00047, 0x0030C, 0x00002, 0x00067,
+	0x0030C, 0x00002, 0x0004B, 0x0030C, 0x00002, 0x0006B, 0x0030C, 0x00002,
+	0x0004F, 0x00328, 0x00002, 0x0006F, 0x00328, 0x00003, 0x0004F, 0x00328,
+	0x00304, 0x00003, 0x0006F, 0x00328, 0x00304, 0x00002, 0x001B7, 0x0030C,
+	0x00002, 0x00292, 0x0030C, 0x00002, 0x0006A, 0x0030C, 0x00200, 0x00044,
+	0x0005A, 0x00200, 0x00044, 0x0007A, 0x00200, 0x00064, 0x0007A, 0x00002,
+	0x00047, 0x00301, 0x00002, 0x00067, 0x00301, 0x00002, 0x0004E, 0x00300,
+	0x00002, 0x0006E, 0x00300, 0x00003, 0x00041, 0x0030A, 0x00301, 0x00003,
+	0x00061, 0x0030A, 0x00301, 0x00002, 0x000C6, 0x00301, 0x00002, 0x000E6,
+	0x00301, 0x00002, 0x000D8, 0x00301, 0x00002, 0x000F8, 0x00301, 0x00002,
+	0x00041, 0x0030F, 0x00002, 0x00061, 0x0030F, 0x00002, 0x00041, 0x00311,
+	0x00002, 0x00061, 0x00311, 0x00002, 0x00045, 0x0030F, 0x00002, 0x00065,
+	0x0030F, 0x00002, 0x00045, 0x00311, 0x00002, 0x00065, 0x00311, 0x00002,
+	0x00049, 0x0030F, 0x00002, 0x00069, 0x0030F, 0x00002, 0x00049, 0x00311,
+	0x00002, 0x00069, 0x00311, 0x00002, 0x0004F, 0x0030F, 0x00002, 0x0006F,
+	0x0030F, 0x00002, 0x0004F, 0x00311, 0x00002, 0x0006F, 0x00311, 0x00002,
+	0x00052, 0x0030F, 0x00002, 0x00072, 0x0030F, 0x00002, 0x00052, 0x00311,
+	0x00002, 0x00072, 0x00311, 0x00002, 0x00055, 0x0030F, 0x00002, 0x00075,
+	0x0030F, 0x00002, 0x00055, 0x00311, 0x00002, 0x00075, 0x00311, 0x00002,
+	0x00053, 0x00326, 0x00002, 0x00073, 0x00326, 0x00002, 0x00054, 0x00326,
+	0x00002, 0x00074, 0x00326, 0x00002, 0x00048, 0x0030C, 0x00002, 0x00068,
+	0x0030C, 0x00002, 0x00041, 0x00307, 0x00002, 0x00061, 0x00307, 0x00002,
+	0x00045, 0x00327, 0x00002, 0x00065, 0x00327, 0x00003, 0x0004F, 0x00308,
+	0x00304, 0x00003, 0x0006F, 0x00308, 0x00304, 0x00003, 0x0004F, 0x00303,
+	0x00304, 0x00003, 0x0006F, 0x00303, 0x00304, 0x00002, 0x0004F, 0x00307,
+	0x00002, 0x0006F, 0x00307, 0x00003, 0x0004F, 0x00307, 0x00304, 0x00003,
+	0x0006F, 0x00307, 0x00304, 0x00002, 0x00059, 0x00304, 0x00002, 0x00079,
+	0x00304, 0x00100, 0x00068, 0x00100, 0x00266, 0x00100, 0x0006A, 0x00100,
+	0x00072, 0x00100, 0x00279, 0x00100, 0x0027B, 0x00100, 0x00281, 0x00100,
+	0x00077, 0x00100, 0x00079, 0x00200, 0x00020, 0x00306, 0x00200, 0x00020,
+	0x00307, 0x00200, 0x00020, 0x0030A, 0x00200, 0x00020, 0x00328, 0x00200,
+	0x00020, 0x00303, 0x00200, 0x00020, 0x0030B, 0x00100, 0x00263, 0x00100,
+	0x0006C, 0x00100, 0x00073, 0x00100, 0x00078, 0x00100, 0x00295, 0x00001,
+	0x00300, 0x00001, 0x00301, 0x00001, 0x00313, 0x00002, 0x00308, 0x00301,
+	0x00001, 0x002B9, 0x00200, 0x00020, 0x00345, 0x00001, 0x0003B, 0x00200,
+	0x00020, 0x00301, 0x00302, 0x000A8, 0x00301, 0x00020, 0x00308, 0x00301,
+	0x00002, 0x00391, 0x00301, 0x00001, 0x000B7, 0x00002, 0x00395, 0x00301,
+	0x00002, 0x00397, 0x00301, 0x00002, 0x00399, 0x00301, 0x00002, 0x0039F,
+	0x00301, 0x00002, 0x003A5, 0x00301, 0x00002, 0x003A9, 0x00301, 0x00003,
+	0x003B9, 0x00308, 0x00301, 0x00002, 0x00399, 0x00308, 0x00002, 0x003A5,
+	0x00308, 0x00002, 0x003B1, 0x00301, 0x00002, 0x003B5, 0x00301, 0x00002,
+	0x003B7, 0x00301, 0x00002, 0x003B9, 0x00301, 0x00003, 0x003C5, 0x00308,
+	0x00301, 0x00002, 0x003B9, 0x00308, 0x00002, 0x003C5, 0x00308, 0x00002,
+	0x003BF, 0x00301, 0x00002, 0x003C5, 0x00301, 0x00002, 0x003C9, 0x00301,
+	0x00100, 0x003B2, 0x00100, 0x003B8, 0x00100, 0x003A5, 0x00202, 0x003D2,
+	0x00301, 0x003A5, 0x00301, 0x00202, 0x003D2, 0x00308, 0x003A5, 0x00308,
+	0x00100, 0x003C6, 0x00100, 0x003C0, 0x00100, 0x003BA, 0x00100, 0x003C1,
+	0x00100, 0x003C2, 0x00100, 0x00398, 0x00100, 0x003B5, 0x00100, 0x003A3,
+	0x00002, 0x00415, 0x00300, 0x00002, 0x00415, 0x00308, 0x00002, 0x00413,
+	0x00301, 0x00002, 0x00406, 0x00308, 0x00002, 0x0041A, 0x00301, 0x00002,
+	0x00418, 0x00300, 0x00002, 0x00423, 0x00306, 0x00002, 0x00418, 0x00306,
+	0x00002, 0x00438, 0x00306, 0x00002, 0x00435, 0x00300, 0x00002, 0x00435,
+	0x00308, 0x00002, 0x00433, 0x00301, 0x00002, 0x00456, 0x00308, 0x00002,
+	0x0043A, 0x00301, 0x00002, 0x00438, 0x00300, 0x00002, 0x00443, 0x00306,
+	0x00002, 0x00474, 0x0030F, 0x00002, 0x00475, 0x0030F, 0x00002, 0x00416,
+	0x00306, 0x00002, 0x00436, 0x00306, 0x00002, 0x00410, 0x00306, 0x00002,
+	0x00430, 0x00306, 0x00002, 0x00410, 0x00308, 0x00002, 0x00430, 0x00308,
+	0x00002, 0x00415, 0x00306, 0x00002, 0x00435, 0x00306, 0x00002, 0x004D8,
+	0x00308, 0x00002, 0x004D9, 0x00308, 0x00002, 0x00416, 0x00308, 0x00002,
+	0x00436, 0x00308, 0x00002, 0x00417, 0x00308, 0x00002, 0x00437, 0x00308,
+	0x00002, 0x00418, 0x00304, 0x00002, 0x00438, 0x00304, 0x00002, 0x00418,
+	0x00308, 0x00002, 0x00438, 0x00308, 0x00002, 0x0041E, 0x00308, 0x00002,
+	0x0043E, 0x00308, 0x00002, 0x004E8, 0x00308, 0x00002, 0x004E9, 0x00308,
+	0x00002, 0x0042D, 0x00308, 0x00002, 0x0044D, 0x00308, 0x00002, 0x00423,
+	0x00304, 0x00002, 0x00443, 0x00304, 0x00002, 0x00423, 0x00308, 0x00002,
+	0x00443, 0x00308, 0x00002, 0x00423, 0x0030B, 0x00002, 0x00443, 0x0030B,
+	0x00002, 0x00427, 0x00308, 0x00002, 0x00447, 0x00308, 0x00002, 0x0042B,
+	0x00308, 0x00002, 0x0044B, 0x00308, 0x00200, 0x00565, 0x00582, 0x00002,
+	0x00627, 0x00653, 0x00002, 0x00627, 0x00654, 0x00002, 0x00648, 0x00654,
+	0x00002, 0x00627, 0x00655, 0x00002, 0x0064A, 0x00654, 0x00200, 0x00627,
+	0x00674, 0x00200, 0x00648, 0x00674, 0x00200, 0x006C7, 0x00674, 0x00200,
+	0x0064A, 0x00674, 0x00002, 0x006D5, 0x00654, 0x00002, 0x006C1, 0x00654,
+	0x00002, 0x006D2, 0x00654, 0x00002, 0x00928, 0x0093C, 0x00002, 0x00930,
+	0x0093C, 0x00002, 0x00933, 0x0093C, 0x00002, 0x00915, 0x0093C, 0x00002,
+	0x00916, 0x0093C, 0x00002, 0x00917, 0x0093C, 0x00002, 0x0091C, 0x0093C,
+	0x00002, 0x00921, 0x0093C, 0x00002, 0x00922, 0x0093C, 0x00002, 0x0092B,
+	0x0093C, 0x00002, 0x0092F, 0x0093C, 0x00002, 0x009C7, 0x009BE, 0x00002,
+	0x009C7, 0x009D7, 0x00002, 0x009A1, 0x009BC, 0x00002, 0x009A2, 0x009BC,
+	0x00002, 0x009AF, 0x009BC, 0x00002, 0x00A32, 0x00A3C, 0x00002, 0x00A38,
+	0x00A3C, 0x00002, 0x00A16, 0x00A3C, 0x00002, 0x00A17, 0x00A3C, 0x00002,
+	0x00A1C, 0x00A3C, 0x00002, 0x00A2B, 0x00A3C, 0x00002, 0x00B47, 0x00B56,
+	0x00002, 0x00B47, 0x00B3E, 0x00002, 0x00B47, 0x00B57, 0x00002, 0x00B21,
+	0x00B3C, 0x00002, 0x00B22, 0x00B3C, 0x00002, 0x00B92, 0x00BD7, 0x00002,
+	0x00BC6, 0x00BBE, 0x00002, 0x00BC7, 0x00BBE, 0x00002, 0x00BC6, 0x00BD7,
+	0x00002, 0x00C46, 0x00C56, 0x00002, 0x00CBF, 0x00CD5, 0x00002, 0x00CC6,
+	0x00CD5, 0x00002, 0x00CC6, 0x00CD6, 0x00002, 0x00CC6, 0x00CC2, 0x00003,
+	0x00CC6, 0x00CC2, 0x00CD5, 0x00002, 0x00D46, 0x00D3E, 0x00002, 0x00D47,
+	0x00D3E, 0x00002, 0x00D46, 0x00D57, 0x00002, 0x00DD9, 0x00DCA, 0x00002,
+	0x00DD9, 0x00DCF, 0x00003, 0x00DD9, 0x00DCF, 0x00DCA, 0x00002, 0x00DD9,
+	0x00DDF, 0x00200, 0x00E4D, 0x00E32, 0x00200, 0x00ECD, 0x00EB2, 0x00200,
+	0x00EAB, 0x00E99, 0x00200, 0x00EAB, 0x00EA1, 0x00100, 0x00F0B, 0x00002,
+	0x00F42, 0x00FB7, 0x00002, 0x00F4C, 0x00FB7, 0x00002, 0x00F51, 0x00FB7,
+	0x00002, 0x00F56, 0x00FB7, 0x00002, 0x00F5B, 0x00FB7, 0x00002, 0x00F40,
+	0x00FB5, 0x00002, 0x00F71, 0x00F72, 0x00002, 0x00F71, 0x00F74, 0x00002,
+	0x00FB2, 0x00F80, 0x00300, 0x00FB2, 0x00F71, 0x00F80, 0x00002, 0x00FB3,
+	0x00F80, 0x00300, 0x00FB3, 0x00F71, 0x00F80, 0x00002, 0x00F71, 0x00F80,
+	0x00002, 0x00F92, 0x00FB7, 0x00002, 0x00F9C, 0x00FB7, 0x00002, 0x00FA1,
+	0x00FB7, 0x00002, 0x00FA6, 0x00FB7, 0x00002, 0x00FAB, 0x00FB7, 0x00002,
+	0x00F90, 0x00FB5, 0x00002, 0x01025, 0x0102E, 0x00100, 0x010DC, 0x00002,
+	0x01B05, 0x01B35, 0x00002, 0x01B07, 0x01B35, 0x00002, 0x01B09, 0x01B35,
+	0x00002, 0x01B0B, 0x01B35, 0x00002, 0x01B0D, 0x01B35, 0x00002, 0x01B11,
+	0x01B35, 0x00002, 0x01B3A, 0x01B35, 0x00002, 0x01B3C, 0x01B35, 0x00002,
+	0x01B3E, 0x01B35, 0x00002, 0x01B3F, 0x01B35, 0x00002, 0x01B42, 0x01B35,
+	0x00100, 0x00041, 0x00100, 0x000C6, 0x00100, 0x00042, 0x00100, 0x00044,
+	0x00100, 0x00045, 0x00100, 0x0018E, 0x00100, 0x00047, 0x00100, 0x00048,
+	0x00100, 0x00049, 0x00100, 0x0004A, 0x00100, 0x0004B, 0x00100, 0x0004C,
+	0x00100, 0x0004D, 0x00100, 0x0004E, 0x00100, 0x0004F, 0x00100, 0x00222,
+	0x00100, 0x00050, 0x00100, 0x00052, 0x00100, 0x00054, 0x00100, 0x00055,
+	0x00100, 0x00057, 0x00100, 0x00061, 0x00100, 0x00250, 0x00100, 0x00251,
+	0x00100, 0x01D02, 0x00100, 0x00062, 0x00100, 0x00064, 0x00100, 0x00065,
+	0x00100, 0x00259, 0x00100, 0x0025B, 0x00100, 0x0025C, 0x00100, 0x00067,
+	0x00100, 0x0006B, 0x00100, 0x0006D, 0x00100, 0x0014B, 0x00100, 0x0006F,
+	0x00100, 0x00254, 0x00100, 0x01D16, 0x00100, 0x01D17, 0x00100, 0x00070,
+	0x00100, 0x00074, 0x00100, 0x00075, 0x00100, 0x01D1D, 0x00100, 0x0026F,
+	0x00100, 0x00076, 0x00100, 0x01D25, 0x00100, 0x003B2, 0x00100, 0x003B3,
+	0x00100, 0x003B4, 0x00100, 0x003C6, 0x00100, 0x003C7, 0x00100, 0x00069,
+	0x00100, 0x00072, 0x00100, 0x00075, 0x00100, 0x00076, 0x00100, 0x003B2,
+	0x00100, 0x003B3, 0x00100, 0x003C1, 0x00100, 0x003C6, 0x00100, 0x003C7,
+	0x00100, 0x0043D, 0x00100, 0x00252, 0x00100, 0x00063, 0x00100, 0x00255,
+	0x00100, 0x000F0, 0x00100, 0x0025C, 0x00100, 0x00066, 0x00100, 0x0025F,
+	0x00100, 0x00261, 0x00100, 0x00265, 0x00100, 0x00268, 0x00100, 0x00269,
+	0x00100, 0x0026A, 0x00100, 0x01D7B, 0x00100, 0x0029D, 0x00100, 0x0026D,
+	0x00100, 0x01D85, 0x00100, 0x0029F, 0x00100, 0x00271, 0x00100, 0x00270,
+	0x00100, 0x00272, 0x00100, 0x00273, 0x00100, 0x00274, 0x00100, 0x00275,
+	0x00100, 0x00278, 0x00100, 0x00282, 0x00100, 0x00283, 0x00100, 0x001AB,
+	0x00100, 0x00289, 0x00100, 0x0028A, 0x00100, 0x01D1C, 0x00100, 0x0028B,
+	0x00100, 0x0028C, 0x00100, 0x0007A, 0x00100, 0x00290, 0x00100, 0x00291,
+	0x00100, 0x00292, 0x00100, 0x003B8, 0x00002, 0x00041, 0x00325, 0x00002,
+	0x00061, 0x00325, 0x00002, 0x00042, 0x00307, 0x00002, 0x00062, 0x00307,
+	0x00002, 0x00042, 0x00323, 0x00002, 0x00062, 0x00323, 0x00002, 0x00042,
+	0x00331, 0x00002, 0x00062, 0x00331, 0x00003, 0x00043, 0x00327, 0x00301,
+	0x00003, 0x00063, 0x00327, 0x00301, 0x00002, 0x00044, 0x00307, 0x00002,
+	0x00064, 0x00307, 0x00002, 0x00044, 0x00323, 0x00002, 0x00064, 0x00323,
+	0x00002, 0x00044, 0x00331, 0x00002, 0x00064, 0x00331, 0x00002, 0x00044,
+	0x00327, 0x00002, 0x00064, 0x00327, 0x00002, 0x00044, 0x0032D, 0x00002,
+	0x00064, 0x0032D, 0x00003, 0x00045, 0x00304, 0x00300, 0x00003, 0x00065,
+	0x00304, 0x00300, 0x00003, 0x00045, 0x00304, 0x00301, 0x00003, 0x00065,
+	0x00304, 0x00301, 0x00002, 0x00045, 0x0032D, 0x00002, 0x00065, 0x0032D,
+	0x00002, 0x00045, 0x00330, 0x00002, 0x00065, 0x00330, 0x00003, 0x00045,
+	0x00327, 0x00306, 0x00003, 0x00065, 0x00327, 0x00306, 0x00002, 0x00046,
+	0x00307, 0x00002, 0x00066, 0x00307, 0x00002, 0x00047, 0x00304, 0x00002,
+	0x00067, 0x00304, 0x00002, 0x00048, 0x00307, 0x00002, 0x00068, 0x00307,
+	0x00002, 0x00048, 0x00323, 0x00002, 0x00068, 0x00323, 0x00002, 0x00048,
+	0x00308, 0x00002, 0x00068, 0x00308, 0x00002, 0x00048, 0x00327, 0x00002,
+	0x00068, 0x00327, 0x00002, 0x00048, 0x0032E, 0x00002, 0x00068, 0x0032E,
+	0x00002, 0x00049, 0x00330, 0x00002, 0x00069, 0x00330, 0x00003, 0x00049,
+	0x00308, 0x00301, 0x00003, 0x00069, 0x00308, 0x00301, 0x00002, 0x0004B,
+	0x00301, 0x00002, 0x0006B, 0x00301, 0x00002, 0x0004B, 0x00323, 0x00002,
+	0x0006B, 0x00323, 0x00002, 0x0004B, 0x00331, 0x00002, 0x0006B, 0x00331,
+	0x00002, 0x0004C, 0x00323, 0x00002, 0x0006C, 0x00323, 0x00003, 0x0004C,
+	0x00323, 0x00304, 0x00003, 0x0006C, 0x00323, 0x00304, 0x00002, 0x0004C,
+	0x00331, 0x00002, 0x0006C, 0x00331, 0x00002, 0x0004C, 0x0032D, 0x00002,
+	0x0006C, 0x0032D, 0x00002, 0x0004D, 0x00301, 0x00002, 0x0006D, 0x00301,
+	0x00002, 0x0004D, 0x00307, 0x00002, 0x0006D, 0x00307, 0x00002, 0x0004D,
+	0x00323, 0x00002, 0x0006D, 0x00323, 0x00002, 0x0004E, 0x00307, 0x00002,
+	0x0006E, 0x00307, 0x00002, 0x0004E, 0x00323, 0x00002, 0x0006E, 0x00323,
+	0x00002, 0x0004E, 0x00331, 0x00002, 0x0006E, 0x00331, 0x00002, 0x0004E,
+	0x0032D, 0x00002, 0x0006E, 0x0032D, 0x00003, 0x0004F, 0x00303, 0x00301,
+	0x00003, 0x0006F, 0x00303, 0x00301, 0x00003, 0x0004F, 0x00303, 0x00308,
+	0x00003, 0x0006F, 0x00303, 0x00308, 0x00003, 0x0004F, 0x00304, 0x00300,
+	0x00003, 0x0006F, 0x00304, 0x00300, 0x00003, 0x0004F, 0x00304, 0x00301,
+	0x00003, 0x0006F, 0x00304, 0x00301, 0x00002, 0x00050, 0x00301, 0x00002,
+	0x00070, 0x00301, 0x00002, 0x00050, 0x00307, 0x00002, 0x00070, 0x00307,
+	0x00002, 0x00052, 0x00307, 0x00002, 0x00072, 0x00307, 0x00002, 0x00052,
+	0x00323, 0x00002, 0x00072, 0x00323, 0x00003, 0x00052, 0x00323, 0x00304,
+	0x00003, 0x00072, 0x00323, 0x00304, 0x00002, 0x00052, 0x00331, 0x00002,
+	0x00072, 0x00331, 0x00002, 0x00053, 0x00307, 0x00002, 0x00073, 0x00307,
+	0x00002, 0x00053, 0x00323, 0x00002, 0x00073, 0x00323, 0x00003, 0x00053,
+	0x00301, 0x00307, 0x00003, 0x00073, 0x00301, 0x00307, 0x00003, 0x00053,
+	0x0030C, 0x00307, 0x00003, 0x00073, 0x0030C, 0x00307, 0x00003, 0x00053,
+	0x00323, 0x00307, 0x00003, 0x00073, 0x00323, 0x00307, 0x00002, 0x00054,
+	0x00307, 0x00002, 0x00074, 0x00307, 0x00002, 0x00054, 0x00323, 0x00002,
+	0x00074, 0x00323, 0x00002, 0x00054, 0x00331, 0x00002, 0x00074, 0x00331,
+	0x00002, 0x00054, 0x0032D, 0x00002, 0x00074, 0x0032D, 0x00002, 0x00055,
+	0x00324, 0x00002, 0x00075, 0x00324, 0x00002, 0x00055, 0x00330, 0x00002,
+	0x00075, 0x00330, 0x00002, 0x00055, 0x0032D, 0x00002, 0x00075, 0x0032D,
+	0x00003, 0x00055, 0x00303, 0x00301, 0x00003, 0x00075, 0x00303, 0x00301,
+	0x00003, 0x00055, 0x00304, 0x00308, 0x00003, 0x00075, 0x00304, 0x00308,
+	0x00002, 0x00056, 0x00303, 0x00002, 0x00076, 0x00303, 0x00002, 0x00056,
+	0x00323, 0x00002, 0x00076, 0x00323, 0x00002, 0x00057, 0x00300, 0x00002,
+	0x00077, 0x00300, 0x00002, 0x00057, 0x00301, 0x00002, 0x00077, 0x00301,
+	0x00002, 0x00057, 0x00308, 0x00002, 0x00077, 0x00308, 0x00002, 0x00057,
+	0x00307, 0x00002, 0x00077, 0x00307, 0x00002, 0x00057, 0x00323, 0x00002,
+	0x00077, 0x00323, 0x00002, 0x00058, 0x00307, 0x00002, 0x00078, 0x00307,
+	0x00002, 0x00058, 0x00308, 0x00002, 0x00078, 0x00308, 0x00002, 0x00059,
+	0x00307, 0x00002, 0x00079, 0x00307, 0x00002, 0x0005A, 0x00302, 0x00002,
+	0x0007A, 0x00302, 0x00002, 0x0005A, 0x00323, 0x00002, 0x0007A, 0x00323,
+	0x00002, 0x0005A, 0x00331, 0x00002, 0x0007A, 0x00331, 0x00002, 0x00068,
+	0x00331, 0x00002, 0x00074, 0x00308, 0x00002, 0x00077, 0x0030A, 0x00002,
+	0x00079, 0x0030A, 0x00200, 0x00061, 0x002BE, 0x00202, 0x0017F, 0x00307,
+	0x00073, 0x00307, 0x00002, 0x00041, 0x00323, 0x00002, 0x00061, 0x00323,
+	0x00002, 0x00041, 0x00309, 0x00002, 0x00061, 0x00309, 0x00003, 0x00041,
+	0x00302, 0x00301, 0x00003, 0x00061, 0x00302, 0x00301, 0x00003, 0x00041,
+	0x00302, 0x00300, 0x00003, 0x00061, 0x00302, 0x00300, 0x00003, 0x00041,
+	0x00302, 0x00309, 0x00003, 0x00061, 0x00302, 0x00309, 0x00003, 0x00041,
+	0x00302, 0x00303, 0x00003, 0x00061, 0x00302, 0x00303, 0x00003, 0x00041,
+	0x00323, 0x00302, 0x00003, 0x00061, 0x00323, 0x00302, 0x00003, 0x00041,
+	0x00306, 0x00301, 0x00003, 0x00061, 0x00306, 0x00301, 0x00003, 0x00041,
+	0x00306, 0x00300, 0x00003, 0x00061, 0x00306, 0x00300, 0x00003, 0x00041,
+	0x00306, 0x00309, 0x00003, 0x00061, 0x00306, 0x00309, 0x00003, 0x00041,
+	0x00306, 0x00303, 0x00003, 0x00061, 0x00306, 0x00303, 0x00003, 0x00041,
+	0x00323, 0x00306, 0x00003, 0x00061, 0x00323, 0x00306, 0x00002, 0x00045,
+	0x00323, 0x00002, 0x00065, 0x00323, 0x00002, 0x00045, 0x00309, 0x00002,
+	0x00065, 0x00309, 0x00002, 0x00045, 0x00303, 0x00002, 0x00065, 0x00303,
+	0x00003, 0x00045, 0x00302, 0x00301, 0x00003, 0x00065, 0x00302, 0x00301,
+	0x00003, 0x00045, 0x00302, 0x00300, 0x00003, 0x00065, 0x00302, 0x00300,
+	0x00003, 0x00045, 0x00302, 0x00309, 0x00003, 0x00065, 0x00302, 0x00309,
+	0x00003, 0x00045, 0x00302, 0x00303, 0x00003, 0x00065, 0x00302, 0x00303,
+	0x00003, 0x00045, 0x00323, 0x00302, 0x00003, 0x00065, 0x00323, 0x00302,
+	0x00002, 0x00049, 0x00309, 0x00002, 0x00069, 0x00309, 0x00002, 0x00049,
+	0x00323, 0x00002, 0x00069, 0x00323, 0x00002, 0x0004F, 0x00323, 0x00002,
+	0x0006F, 0x00323, 0x00002, 0x0004F, 0x00309, 0x00002, 0x0006F, 0x00309,
+	0x00003, 0x0004F, 0x00302, 0x00301, 0x00003, 0x0006F, 0x00302, 0x00301,
+	0x00003, 0x0004F, 0x00302, 0x00300, 0x00003, 0x0006F, 0x00302, 0x00300,
+	0x00003, 0x0004F, 0x00302, 0x00309, 0x00003, 0x0006F, 0x00302, 0x00309,
+	0x00003, 0x0004F, 0x00302, 0x00303, 0x00003, 0x0006F, 0x00302, 0x00303,
+	0x00003, 0x0004F, 0x00323, 0x00302, 0x00003, 0x0006F, 0x00323, 0x00302,
+	0x00003, 0x0004F, 0x0031B, 0x00301, 0x00003, 0x0006F, 0x0031B, 0x00301,
+	0x00003, 0x0004F, 0x0031B, 0x00300, 0x00003, 0x0006F, 0x0031B, 0x00300,
+	0x00003, 0x0004F, 0x0031B, 0x00309, 0x00003, 0x0006F, 0x0031B, 0x00309,
+	0x00003, 0x0004F, 0x0031B, 0x00303, 0x00003, 0x0006F, 0x0031B, 0x00303,
+	0x00003, 0x0004F, 0x0031B, 0x00323, 0x00003, 0x0006F, 0x0031B, 0x00323,
+	0x00002, 0x00055, 0x00323, 0x00002, 0x00075, 0x00323, 0x00002, 0x00055,
+	0x00309, 0x00002, 0x00075, 0x00309, 0x00003, 0x00055, 0x0031B, 0x00301,
+	0x00003, 0x00075, 0x0031B, 0x00301, 0x00003, 0x00055, 0x0031B, 0x00300,
+	0x00003, 0x00075, 0x0031B, 0x00300, 0x00003, 0x00055, 0x0031B, 0x00309,
+	0x00003, 0x00075, 0x0031B, 0x00309, 0x00003, 0x00055, 0x0031B, 0x00303,
+	0x00003, 0x00075, 0x0031B, 0x00303, 0x00003, 0x00055, 0x0031B, 0x00323,
+	0x00003, 0x00075, 0x0031B, 0x00323, 0x00002, 0x00059, 0x00300, 0x00002,
+	0x00079, 0x00300, 0x00002, 0x00059, 0x00323, 0x00002, 0x00079, 0x00323,
+	0x00002, 0x00059, 0x00309, 0x00002, 0x00079, 0x00309, 0x00002, 0x00059,
+	0x00303, 0x00002, 0x00079, 0x00303, 0x00002, 0x003B1, 0x00313, 0x00002,
+	0x003B1, 0x00314, 0x00003, 0x003B1, 0x00313, 0x00300, 0x00003, 0x003B1,
+	0x00314, 0x00300, 0x00003, 0x003B1, 0x00313, 0x00301, 0x00003, 0x003B1,
+	0x00314, 0x00301, 0x00003, 0x003B1, 0x00313, 0x00342, 0x00003, 0x003B1,
+	0x00314, 0x00342, 0x00002, 0x00391, 0x00313, 0x00002, 0x00391, 0x00314,
+	0x00003, 0x00391, 0x00313, 0x00300, 0x00003, 0x00391, 0x00314, 0x00300,
+	0x00003, 0x00391, 0x00313, 0x00301, 0x00003, 0x00391, 0x00314, 0x00301,
+	0x00003, 0x00391, 0x00313, 0x00342, 0x00003, 0x00391, 0x00314, 0x00342,
+	0x00002, 0x003B5, 0x00313, 0x00002, 0x003B5, 0x00314, 0x00003, 0x003B5,
+	0x00313, 0x00300, 0x00003, 0x003B5, 0x00314, 0x00300, 0x00003, 0x003B5,
+	0x00313, 0x00301, 0x00003, 0x003B5, 0x00314, 0x00301, 0x00002, 0x00395,
+	0x00313, 0x00002, 0x00395, 0x00314, 0x00003, 0x00395, 0x00313, 0x00300,
+	0x00003, 0x00395, 0x00314, 0x00300, 0x00003, 0x00395, 0x00313, 0x00301,
+	0x00003, 0x00395, 0x00314, 0x00301, 0x00002, 0x003B7, 0x00313, 0x00002,
+	0x003B7, 0x00314, 0x00003, 0x003B7, 0x00313, 0x00300, 0x00003, 0x003B7,
+	0x00314, 0x00300, 0x00003, 0x003B7, 0x00313, 0x00301, 0x00003, 0x003B7,
+	0x00314, 0x00301, 0x00003, 0x003B7, 0x00313, 0x00342, 0x00003, 0x003B7,
+	0x00314, 0x00342, 0x00002, 0x00397, 0x00313, 0x00002, 0x00397, 0x00314,
+	0x00003, 0x00397, 0x00313, 0x00300, 0x00003, 0x00397, 0x00314, 0x00300,
+	0x00003, 0x00397, 0x00313, 0x00301, 0x00003, 0x00397, 0x00314, 0x00301,
+	0x00003, 0x00397, 0x00313, 0x00342, 0x00003, 0x00397, 0x00314, 0x00342,
+	0x00002, 0x003B9, 0x00313, 0x00002, 0x003B9, 0x00314, 0x00003, 0x003B9,
+	0x00313, 0x00300, 0x00003, 0x003B9, 0x00314, 0x00300, 0x00003, 0x003B9,
+	0x00313, 0x00301, 0x00003, 0x003B9, 0x00314, 0x00301, 0x00003, 0x003B9,
+	0x00313, 0x00342, 0x00003, 0x003B9, 0x00314, 0x00342, 0x00002, 0x00399,
+	0x00313, 0x00002, 0x00399, 0x00314, 0x00003, 0x00399, 0x00313, 0x00300,
+	0x00003, 0x00399, 0x00314, 0x00300, 0x00003, 0x00399, 0x00313, 0x00301,
+	0x00003, 0x00399, 0x00314, 0x00301, 0x00003, 0x00399, 0x00313, 0x00342,
+	0x00003, 0x00399, 0x00314, 0x00342, 0x00002, 0x003BF, 0x00313, 0x00002,
+	0x003BF, 0x00314, 0x00003, 0x003BF, 0x00313, 0x00300, 0x00003, 0x003BF,
+	0x00314, 0x00300, 0x00003, 0x003BF, 0x00313, 0x00301, 0x00003, 0x003BF,
+	0x00314, 0x00301, 0x00002, 0x0039F, 0x00313, 0x00002, 0x0039F, 0x00314,
+	0x00003, 0x0039F, 0x00313, 0x00300, 0x00003, 0x0039F, 0x00314, 0x00300,
+	0x00003, 0x0039F, 0x00313, 0x00301, 0x00003, 0x0039F, 0x00314, 0x00301,
+	0x00002, 0x003C5, 0x00313, 0x00002, 0x003C5, 0x00314, 0x00003, 0x003C5,
+	0x00313, 0x00300, 0x00003, 0x003C5, 0x00314, 0x00300, 0x00003, 0x003C5,
+	0x00313, 0x00301, 0x00003, 0x003C5, 0x00314, 0x00301, 0x00003, 0x003C5,
+	0x00313, 0x00342, 0x00003, 0x003C5, 0x00314, 0x00342, 0x00002, 0x003A5,
+	0x00314, 0x00003, 0x003A5, 0x00314, 0x00300, 0x00003, 0x003A5, 0x00314,
+	0x00301, 0x00003, 0x003A5, 0x00314, 0x00342, 0x00002, 0x003C9, 0x00313,
+	0x00002, 0x003C9, 0x00314, 0x00003, 0x003C9, 0x00313, 0x00300, 0x00003,
+	0x003C9, 0x00314, 0x00300, 0x00003, 0x003C9, 0x00313, 0x00301, 0x00003,
+	0x003C9, 0x00314, 0x00301, 0x00003, 0x003C9, 0x00313, 0x00342, 0x00003,
+	0x003C9, 0x00314, 0x00342, 0x00002, 0x003A9, 0x00313, 0x00002, 0x003A9,
+	0x00314, 0x00003, 0x003A9, 0x00313, 0x00300, 0x00003, 0x003A9, 0x00314,
+	0x00300, 0x00003, 0x003A9, 0x00313, 0x00301, 0x00003, 0x003A9, 0x00314,
+	0x00301, 0x00003, 0x003A9, 0x00313, 0x00342, 0x00003, 0x003A9, 0x00314,
+	0x00342, 0x00002, 0x003B1, 0x00300, 0x00002, 0x003B1, 0x00301, 0x00002,
+	0x003B5, 0x00300, 0x00002, 0x003B5, 0x00301, 0x00002, 0x003B7, 0x00300,
+	0x00002, 0x003B7, 0x00301, 0x00002, 0x003B9, 0x00300, 0x00002, 0x003B9,
+	0x00301, 0x00002, 0x003BF, 0x00300, 0x00002, 0x003BF, 0x00301, 0x00002,
+	0x003C5, 0x00300, 0x00002, 0x003C5, 0x00301, 0x00002, 0x003C9, 0x00300,
+	0x00002, 0x003C9, 0x00301, 0x00003, 0x003B1, 0x00313, 0x00345, 0x00003,
+	0x003B1, 0x00314, 0x00345, 0x00004, 0x003B1, 0x00313, 0x00300, 0x00345,
+	0x00004, 0x003B1, 0x00314, 0x00300, 0x00345, 0x00004, 0x003B1, 0x00313,
+	0x00301, 0x00345, 0x00004, 0x003B1, 0x00314, 0x00301, 0x00345, 0x00004,
+	0x003B1, 0x00313, 0x00342, 0x00345, 0x00004, 0x003B1, 0x00314, 0x00342,
+	0x00345, 0x00003, 0x00391, 0x00313, 0x00345, 0x00003, 0x00391, 0x00314,
+	0x00345, 0x00004, 0x00391, 0x00313, 0x00300, 0x00345, 0x00004, 0x00391,
+	0x00314, 0x00300, 0x00345, 0x00004, 0x00391, 0x00313, 0x00301, 0x00345,
+	0x00004, 0x00391, 0x00314, 0x00301, 0x00345, 0x00004, 0x00391, 0x00313,
+	0x00342, 0x00345, 0x00004, 0x00391, 0x00314, 0x00342, 0x00345, 0x00003,
+	0x003B7, 0x00313, 0x00345, 0x00003, 0x003B7, 0x00314, 0x00345, 0x00004,
+	0x003B7, 0x00313, 0x00300, 0x00345, 0x00004, 0x003B7, 0x00314, 0x00300,
+	0x00345, 0x00004, 0x003B7, 0x00313, 0x00301, 0x00345, 0x00004, 0x003B7,
+	0x00314, 0x00301, 0x00345, 0x00004, 0x003B7, 0x00313, 0x00342, 0x00345,
+	0x00004, 0x003B7, 0x00314, 0x00342, 0x00345, 0x00003, 0x00397, 0x00313,
+	0x00345, 0x00003, 0x00397, 0x00314, 0x00345, 0x00004, 0x00397, 0x00313,
+	0x00300, 0x00345, 0x00004, 0x00397, 0x00314, 0x00300, 0x00345, 0x00004,
+	0x00397, 0x00313, 0x00301, 0x00345, 0x00004, 0x00397, 0x00314, 0x00301,
+	0x00345, 0x00004, 0x00397, 0x00313, 0x00342, 0x00345, 0x00004, 0x00397,
+	0x00314, 0x00342, 0x00345, 0x00003, 0x003C9, 0x00313, 0x00345, 0x00003,
+	0x003C9, 0x00314, 0x00345, 0x00004, 0x003C9, 0x00313, 0x00300, 0x00345,
+	0x00004, 0x003C9, 0x00314, 0x00300, 0x00345, 0x00004, 0x003C9, 0x00313,
+	0x00301, 0x00345, 0x00004, 0x003C9, 0x00314, 0x00301, 0x00345, 0x00004,
+	0x003C9, 0x00313, 0x00342, 0x00345, 0x00004, 0x003C9, 0x00314, 0x00342,
+	0x00345, 0x00003, 0x003A9, 0x00313, 0x00345, 0x00003, 0x003A9, 0x00314,
+	0x00345, 0x00004, 0x003A9, 0x00313, 0x00300, 0x00345, 0x00004, 0x003A9,
+	0x00314, 0x00300, 0x00345, 0x00004, 0x003A9, 0x00313, 0x00301, 0x00345,
+	0x00004, 0x003A9, 0x00314, 0x00301, 0x00345, 0x00004, 0x003A9, 0x00313,
+	0x00342, 0x00345, 0x00004, 0x003A9, 0x00314, 0x00342, 0x00345, 0x00002,
+	0x003B1, 0x00306, 0x00002, 0x003B1, 0x00304, 0x00003, 0x003B1, 0x00300,
+	0x00345, 0x00002, 0x003B1, 0x00345, 0x00003, 0x003B1, 0x00301, 0x00345,
+	0x00002, 0x003B1, 0x00342, 0x00003, 0x003B1, 0x00342, 0x00345, 0x00002,
+	0x00391, 0x00306, 0x00002, 0x00391, 0x00304, 0x00002, 0x00391, 0x00300,
+	0x00002, 0x00391, 0x00301, 0x00002, 0x00391, 0x00345, 0x00200, 0x00020,
+	0x00313, 0x00001, 0x003B9, 0x00200, 0x00020, 0x00313, 0x00200, 0x00020,
+	0x00342, 0x00302, 0x000A8, 0x00342, 0x00020, 0x00308, 0x00342, 0x00003,
+	0x003B7, 0x00300, 0x00345, 0x00002, 0x003B7, 0x00345, 0x00003, 0x003B7,
+	0x00301, 0x00345, 0x00002, 0x003B7, 0x00342, 0x00003, 0x003B7, 0x00342,
+	0x00345, 0x00002, 0x00395, 0x00300, 0x00002, 0x00395, 0x00301, 0x00002,
+	0x00397, 0x00300, 0x00002, 0x00397, 0x00301, 0x00002, 0x00397, 0x00345,
+	0x00302, 0x01FBF, 0x00300, 0x00020, 0x00313, 0x00300, 0x00302, 0x01FBF,
+	0x00301, 0x00020, 0x00313, 0x00301, 0x00302, 0x01FBF, 0x00342, 0x00020,
+	0x00313, 0x00342, 0x00002, 0x003B9, 0x00306, 0x00002, 0x003B9, 0x00304,
+	0x00003, 0x003B9, 0x00308, 0x00300, 0x00003, 0x003B9, 0x00308, 0x00301,
+	0x00002, 0x003B9, 0x00342, 0x00003, 0x003B9, 0x00308, 0x00342, 0x00002,
+	0x00399, 0x00306, 0x00002, 0x00399, 0x00304, 0x00002, 0x00399, 0x00300,
+	0x00002, 0x00399, 0x00301, 0x00302, 0x01FFE, 0x00300, 0x00020, 0x00314,
+	0x00300, 0x00302, 0x01FFE, 0x00301, 0x00020, 0x00314, 0x00301, 0x00302,
+	0x01FFE, 0x00342, 0x00020, 0x00314, 0x00342, 0x00002, 0x003C5, 0x00306,
+	0x00002, 0x003C5, 0x00304, 0x00003, 0x003C5, 0x00308, 0x00300, 0x00003,
+	0x003C5, 0x00308, 0x00301, 0x00002, 0x003C1, 0x00313, 0x00002, 0x003C1,
+	0x00314, 0x00002, 0x003C5, 0x00342, 0x00003, 0x003C5, 0x00308, 0x00342,
+	0x00002, 0x003A5, 0x00306, 0x00002, 0x003A5, 0x00304, 0x00002, 0x003A5,
+	0x00300, 0x00002, 0x003A5, 0x00301, 0x00002, 0x003A1, 0x00314, 0x00302,
+	0x000A8, 0x00300, 0x00020, 0x00308, 0x00300, 0x00302, 0x000A8, 0x00301,
+	0x00020, 0x00308, 0x00301, 0x00001, 0x00060, 0x00003, 0x003C9, 0x00300,
+	0x00345, 0x00002, 0x003C9, 0x00345, 0x00003, 0x003C9, 0x00301, 0x00345,
+	0x00002, 0x003C9, 0x00342, 0x00003, 0x003C9, 0x00342, 0x00345, 0x00002,
+	0x0039F, 0x00300, 0x00002, 0x0039F, 0x00301, 0x00002, 0x003A9, 0x00300,
+	0x00002, 0x003A9, 0x00301, 0x00002, 0x003A9, 0x00345, 0x00201, 0x000B4,
+	0x00020, 0x00301, 0x00200, 0x00020, 0x00314, 0x00101, 0x02002, 0x00020,
+	0x00101, 0x02003, 0x00020, 0x00100, 0x00020, 0x00100, 0x00020, 0x00100,
+	0x00020, 0x00100, 0x00020, 0x00100, 0x00020, 0x00100, 0x00020, 0x00100,
+	0x00020, 0x00100, 0x00020, 0x00100, 0x00020, 0x00100, 0x02010, 0x00200,
+	0x00020, 0x00333, 0x00100, 0x0002E, 0x00200, 0x0002E, 0x0002E, 0x00300,
+	0x0002E, 0x0002E, 0x0002E, 0x00100, 0x00020, 0x00200, 0x02032, 0x02032,
+	0x00300, 0x02032, 0x02032, 0x02032, 0x00200, 0x02035, 0x02035, 0x00300,
+	0x02035, 0x02035, 0x02035, 0x00200, 0x00021, 0x00021, 0x00200, 0x00020,
+	0x00305, 0x00200, 0x0003F, 0x0003F, 0x00200, 0x0003F, 0x00021, 0x00200,
+	0x00021, 0x0003F, 0x00400, 0x02032, 0x02032, 0x02032, 0x02032, 0x00100,
+	0x00020, 0x00100, 0x00030, 0x00100, 0x00069, 0x00100, 0x00034, 0x00100,
+	0x00035, 0x00100, 0x00036, 0x00100, 0x00037, 0x00100, 0x00038, 0x00100,
+	0x00039, 0x00100, 0x0002B, 0x00100, 0x02212, 0x00100, 0x0003D, 0x00100,
+	0x00028, 0x00100, 0x00029, 0x00100, 0x0006E, 0x00100, 0x00030, 0x00100,
+	0x00031, 0x00100, 0x00032, 0x00100, 0x00033, 0x00100, 0x00034, 0x00100,
+	0x00035, 0x00100, 0x00036, 0x00100, 0x00037, 0x00100, 0x00038, 0x00100,
+	0x00039, 0x00100, 0x0002B, 0x00100, 0x02212, 0x00100, 0x0003D, 0x00100,
+	0x00028, 0x00100, 0x00029, 0x00100, 0x00061, 0x00100, 0x00065, 0x00100,
+	0x0006F, 0x00100, 0x00078, 0x00100, 0x00259, 0x00100, 0x00068, 0x00100,
+	0x0006B, 0x00100, 0x0006C, 0x00100, 0x0006D, 0x00100, 0x0006E, 0x00100,
+	0x00070, 0x00100, 0x00073, 0x00100, 0x00074, 0x00200, 0x00052, 0x00073,
+	0x00300, 0x00061, 0x0002F, 0x00063, 0x00300, 0x00061, 0x0002F, 0x00073,
+	0x00100, 0x00043, 0x00200, 0x000B0, 0x00043, 0x00300, 0x00063, 0x0002F,
+	0x0006F, 0x00300, 0x00063, 0x0002F, 0x00075, 0x00100, 0x00190, 0x00200,
+	0x000B0, 0x00046, 0x00100, 0x00067, 0x00100, 0x00048, 0x00100, 0x00048,
+	0x00100, 0x00048, 0x00100, 0x00068, 0x00100, 0x00127, 0x00100, 0x00049,
+	0x00100, 0x00049, 0x00100, 0x0004C, 0x00100, 0x0006C, 0x00100, 0x0004E,
+	0x00200, 0x0004E, 0x0006F, 0x00100, 0x00050, 0x00100, 0x00051, 0x00100,
+	0x00052, 0x00100, 0x00052, 0x00100, 0x00052, 0x00200, 0x00053, 0x0004D,
+	0x00300, 0x00054, 0x00045, 0x0004C, 0x00200, 0x00054, 0x0004D, 0x00100,
+	0x0005A, 0x00001, 0x003A9, 0x00100, 0x0005A, 0x00001, 0x0004B, 0x00002,
+	0x00041, 0x0030A, 0x00100, 0x00042, 0x00100, 0x00043, 0x00100, 0x00065,
+	0x00100, 0x00045, 0x00100, 0x00046, 0x00100, 0x0004D, 0x00100, 0x0006F,
+	0x00100, 0x005D0, 0x00100, 0x005D1, 0x00100, 0x005D2, 0x00100, 0x005D3,
+	0x00100, 0x00069, 0x00300, 0x00046, 0x00041, 0x00058, 0x00100, 0x003C0,
+	0x00100, 0x003B3, 0x00100, 0x00393, 0x00100, 0x003A0, 0x00100, 0x02211,
+	0x00100, 0x00044, 0x00100, 0x00064, 0x00100, 0x00065, 0x00100, 0x00069,
+	0x00100, 0x0006A, 0x00300, 0x00031, 0x02044, 0x00037, 0x00300, 0x00031,
+	0x02044, 0x00039, 0x00400, 0x00031, 0x02044, 0x00031, 0x00030, 0x00300,
+	0x00031, 0x02044, 0x00033, 0x00300, 0x00032, 0x02044, 0x00033, 0x00300,
+	0x00031, 0x02044, 0x00035, 0x00300, 0x00032, 0x02044, 0x00035, 0x00300,
+	0x00033, 0x02044, 0x00035, 0x00300, 0x00034, 0x02044, 0x00035, 0x00300,
+	0x00031, 0x02044, 0x00036, 0x00300, 0x00035, 0x02044, 0x00036, 0x00300,
+	0x00031, 0x02044, 0x00038, 0x00300, 0x00033, 0x02044, 0x00038, 0x00300,
+	0x00035, 0x02044, 0x00038, 0x00300, 0x00037, 0x02044, 0x00038, 0x00200,
+	0x00031, 0x02044, 0x00100, 0x00049, 0x00200, 0x00049, 0x00049, 0x00300,
+	0x00049, 0x00049, 0x00049, 0x00200, 0x00049, 0x00056, 0x00100, 0x00056,
+	0x00200, 0x00056, 0x00049, 0x00300, 0x00056, 0x00049, 0x00049, 0x00400,
+	0x00056, 0x00049, 0x00049, 0x00049, 0x00200, 0x00049, 0x00058, 0x00100,
+	0x00058, 0x00200, 0x00058, 0x00049, 0x00300, 0x00058, 0x00049, 0x00049,
+	0x00100, 0x0004C, 0x00100, 0x00043, 0x00100, 0x00044, 0x00100, 0x0004D,
+	0x00100, 0x00069, 0x00200, 0x00069, 0x00069, 0x00300, 0x00069, 0x00069,
+	0x00069, 0x00200, 0x00069, 0x00076, 0x00100, 0x00076, 0x00200, 0x00076,
+	0x00069, 0x00300, 0x00076, 0x00069, 0x00069, 0x00400, 0x00076, 0x00069,
+	0x00069, 0x00069, 0x00200, 0x00069, 0x00078, 0x00100, 0x00078, 0x00200,
+	0x00078, 0x00069, 0x00300, 0x00078, 0x00069, 0x00069, 0x00100, 0x0006C,
+	0x00100, 0x00063, 0x00100, 0x00064, 0x00100, 0x0006D, 0x00300, 0x00030,
+	0x02044, 0x00033, 0x00002, 0x02190, 0x00338, 0x00002, 0x02192, 0x00338,
+	0x00002, 0x02194, 0x00338, 0x00002, 0x021D0, 0x00338, 0x00002, 0x021D4,
+	0x00338, 0x00002, 0x021D2, 0x00338, 0x00002, 0x02203, 0x00338, 0x00002,
+	0x02208, 0x00338, 0x00002, 0x0220B, 0x00338, 0x00002, 0x02223, 0x00338,
+	0x00002, 0x02225, 0x00338, 0x00200, 0x0222B, 0x0222B, 0x00300, 0x0222B,
+	0x0222B, 0x0222B, 0x00200, 0x0222E, 0x0222E, 0x00300, 0x0222E, 0x0222E,
+	0x0222E, 0x00002, 0x0223C, 0x00338, 0x00002, 0x02243, 0x00338, 0x00002,
+	0x02245, 0x00338, 0x00002, 0x02248, 0x00338, 0x00002, 0x0003D, 0x00338,
+	0x00002, 0x02261, 0x00338, 0x00002, 0x0224D, 0x00338, 0x00002, 0x0003C,
+	0x00338, 0x00002, 0x0003E, 0x00338, 0x00002, 0x02264, 0x00338, 0x00002,
+	0x02265, 0x00338, 0x00002, 0x02272, 0x00338, 0x00002, 0x02273, 0x00338,
+	0x00002, 0x02276, 0x00338, 0x00002, 0x02277, 0x00338, 0x00002, 0x0227A,
+	0x00338, 0x00002, 0x0227B, 0x00338, 0x00002, 0x02282, 0x00338, 0x00002,
+	0x02283, 0x00338, 0x00002, 0x02286, 0x00338, 0x00002, 0x02287, 0x00338,
+	0x00002, 0x022A2, 0x00338, 0x00002, 0x022A8, 0x00338, 0x00002, 0x022A9,
+	0x00338, 0x00002, 0x022AB, 0x00338, 0x00002, 0x0227C, 0x00338, 0x00002,
+	0x0227D, 0x00338, 0x00002, 0x02291, 0x00338, 0x00002, 0x02292, 0x00338,
+	0x00002, 0x022B2, 0x00338, 0x00002, 0x022B3, 0x00338, 0x00002, 0x022B4,
+	0x00338, 0x00002, 0x022B5, 0x00338, 0x00001, 0x03008, 0x00001, 0x03009,
+	0x00100, 0x00031, 0x00100, 0x00032, 0x00100, 0x00033, 0x00100, 0x00034,
+	0x00100, 0x00035, 0x00100, 0x00036, 0x00100, 0x00037, 0x00100, 0x00038,
+	0x00100, 0x00039, 0x00200, 0x00031, 0x00030, 0x00200, 0x00031, 0x00031,
+	0x00200, 0x00031, 0x00032, 0x00200, 0x00031, 0x00033, 0x00200, 0x00031,
+	0x00034, 0x00200, 0x00031, 0x00035, 0x00200, 0x00031, 0x00036, 0x00200,
+	0x00031, 0x00037, 0x00200, 0x00031, 0x00038, 0x00200, 0x00031, 0x00039,
+	0x00200, 0x00032, 0x00030, 0x00300, 0x00028, 0x00031, 0x00029, 0x00300,
+	0x00028, 0x00032, 0x00029, 0x00300, 0x00028, 0x00033, 0x00029, 0x00300,
+	0x00028, 0x00034, 0x00029, 0x00300, 0x00028, 0x00035, 0x00029, 0x00300,
+	0x00028, 0x00036, 0x00029, 0x00300, 0x00028, 0x00037, 0x00029, 0x00300,
+	0x00028, 0x00038, 0x00029, 0x00300, 0x00028, 0x00039, 0x00029, 0x00400,
+	0x00028, 0x00031, 0x00030, 0x00029, 0x00400, 0x00028, 0x00031, 0x00031,
+	0x00029, 0x00400, 0x00028, 0x00031, 0x00032, 0x00029, 0x00400, 0x00028,
+	0x00031, 0x00033, 0x00029, 0x00400, 0x00028, 0x00031, 0x00034, 0x00029,
+	0x00400, 0x00028, 0x00031, 0x00035, 0x00029, 0x00400, 0x00028, 0x00031,
+	0x00036, 0x00029, 0x00400, 0x00028, 0x00031, 0x00037, 0x00029, 0x00400,
+	0x00028, 0x00031, 0x00038, 0x00029, 0x00400, 0x00028, 0x00031, 0x00039,
+	0x00029, 0x00400, 0x00028, 0x00032, 0x00030, 0x00029, 0x00200, 0x00031,
+	0x0002E, 0x00200, 0x00032, 0x0002E, 0x00200, 0x00033, 0x0002E, 0x00200,
+	0x00034, 0x0002E, 0x00200, 0x00035, 0x0002E, 0x00200, 0x00036, 0x0002E,
+	0x00200, 0x00037, 0x0002E, 0x00200, 0x00038, 0x0002E, 0x00200, 0x00039,
+	0x0002E, 0x00300, 0x00031, 0x00030, 0x0002E, 0x00300, 0x00031, 0x00031,
+	0x0002E, 0x00300, 0x00031, 0x00032, 0x0002E, 0x00300, 0x00031, 0x00033,
+	0x0002E, 0x00300, 0x00031, 0x00034, 0x0002E, 0x00300, 0x00031, 0x00035,
+	0x0002E, 0x00300, 0x00031, 0x00036, 0x0002E, 0x00300, 0x00031, 0x00037,
+	0x0002E, 0x00300, 0x00031, 0x00038, 0x0002E, 0x00300, 0x00031, 0x00039,
+	0x0002E, 0x00300, 0x00032, 0x00030, 0x0002E, 0x00300, 0x00028, 0x00061,
+	0x00029, 0x00300, 0x00028, 0x00062, 0x00029, 0x00300, 0x00028, 0x00063,
+	0x00029, 0x00300, 0x00028, 0x00064, 0x00029, 0x00300, 0x00028, 0x00065,
+	0x00029, 0x00300, 0x00028, 0x00066, 0x00029, 0x00300, 0x00028, 0x00067,
+	0x00029, 0x00300, 0x00028, 0x00068, 0x00029, 0x00300, 0x00028, 0x00069,
+	0x00029, 0x00300, 0x00028, 0x0006A, 0x00029, 0x00300, 0x00028, 0x0006B,
+	0x00029, 0x00300, 0x00028, 0x0006C, 0x00029, 0x00300, 0x00028, 0x0006D,
+	0x00029, 0x00300, 0x00028, 0x0006E, 0x00029, 0x00300, 0x00028, 0x0006F,
+	0x00029, 0x00300, 0x00028, 0x00070, 0x00029, 0x00300, 0x00028, 0x00071,
+	0x00029, 0x00300, 0x00028, 0x00072, 0x00029, 0x00300, 0x00028, 0x00073,
+	0x00029, 0x00300, 0x00028, 0x00074, 0x00029, 0x00300, 0x00028, 0x00075,
+	0x00029, 0x00300, 0x00028, 0x00076, 0x00029, 0x00300, 0x00028, 0x00077,
+	0x00029, 0x00300, 0x00028, 0x00078, 0x00029, 0x00300, 0x00028, 0x00079,
+	0x00029, 0x00300, 0x00028, 0x0007A, 0x00029, 0x00100, 0x00041, 0x00100,
+	0x00042, 0x00100, 0x00043, 0x00100, 0x00044, 0x00100, 0x00045, 0x00100,
+	0x00046, 0x00100, 0x00047, 0x00100, 0x00048, 0x00100, 0x00049, 0x00100,
+	0x0004A, 0x00100, 0x0004B, 0x00100, 0x0004C, 0x00100, 0x0004D, 0x00100,
+	0x0004E, 0x00100, 0x0004F, 0x00100, 0x00050, 0x00100, 0x00051, 0x00100,
+	0x00052, 0x00100, 0x00053, 0x00100, 0x00054, 0x00100, 0x00055, 0x00100,
+	0x00056, 0x00100, 0x00057, 0x00100, 0x00058, 0x00100, 0x00059, 0x00100,
+	0x0005A, 0x00100, 0x00061, 0x00100, 0x00062, 0x00100, 0x00063, 0x00100,
+	0x00064, 0x00100, 0x00065, 0x00100, 0x00066, 0x00100, 0x00067, 0x00100,
+	0x00068, 0x00100, 0x00069, 0x00100, 0x0006A, 0x00100, 0x0006B, 0x00100,
+	0x0006C, 0x00100, 0x0006D, 0x00100, 0x0006E, 0x00100, 0x0006F, 0x00100,
+	0x00070, 0x00100, 0x00071, 0x00100, 0x00072, 0x00100, 0x00073, 0x00100,
+	0x00074, 0x00100, 0x00075, 0x00100, 0x00076, 0x00100, 0x00077, 0x00100,
+	0x00078, 0x00100, 0x00079, 0x00100, 0x0007A, 0x00100, 0x00030, 0x00400,
+	0x0222B, 0x0222B, 0x0222B, 0x0222B, 0x00300, 0x0003A, 0x0003A, 0x0003D,
+	0x00200, 0x0003D, 0x0003D, 0x00300, 0x0003D, 0x0003D, 0x0003D, 0x00002,
+	0x02ADD, 0x00338, 0x00100, 0x0006A, 0x00100, 0x00056, 0x00100, 0x02D61,
+	0x00100, 0x06BCD, 0x00100, 0x09F9F, 0x00100, 0x04E00, 0x00100, 0x04E28,
+	0x00100, 0x04E36, 0x00100, 0x04E3F, 0x00100, 0x04E59, 0x00100, 0x04E85,
+	0x00100, 0x04E8C, 0x00100, 0x04EA0, 0x00100, 0x04EBA, 0x00100, 0x0513F,
+	0x00100, 0x05165, 0x00100, 0x0516B, 0x00100, 0x05182, 0x00100, 0x05196,
+	0x00100, 0x051AB, 0x00100, 0x051E0, 0x00100, 0x051F5, 0x00100, 0x05200,
+	0x00100, 0x0529B, 0x00100, 0x052F9, 0x00100, 0x05315, 0x00100, 0x0531A,
+	0x00100, 0x05338, 0x00100, 0x05341, 0x00100, 0x0535C, 0x00100, 0x05369,
+	0x00100, 0x05382, 0x00100, 0x053B6, 0x00100, 0x053C8, 0x00100, 0x053E3,
+	0x00100, 0x056D7, 0x00100, 0x0571F, 0x00100, 0x058EB, 0x00100, 0x05902,
+	0x00100, 0x0590A, 0x00100, 0x05915, 0x00100, 0x05927, 0x00100, 0x05973,
+	0x00100, 0x05B50, 0x00100, 0x05B80, 0x00100, 0x05BF8, 0x00100, 0x05C0F,
+	0x00100, 0x05C22, 0x00100, 0x05C38, 0x00100, 0x05C6E, 0x00100, 0x05C71,
+	0x00100, 0x05DDB, 0x00100, 0x05DE5, 0x00100, 0x05DF1, 0x00100, 0x05DFE,
+	0x00100, 0x05E72, 0x00100, 0x05E7A, 0x00100, 0x05E7F, 0x00100, 0x05EF4,
+	0x00100, 0x05EFE, 0x00100, 0x05F0B, 0x00100, 0x05F13, 0x00100, 0x05F50,
+	0x00100, 0x05F61, 0x00100, 0x05F73, 0x00100, 0x05FC3, 0x00100, 0x06208,
+	0x00100, 0x06236, 0x00100, 0x0624B, 0x00100, 0x0652F, 0x00100, 0x06534,
+	0x00100, 0x06587, 0x00100, 0x06597, 0x00100, 0x065A4, 0x00100, 0x065B9,
+	0x00100, 0x065E0, 0x00100, 0x065E5, 0x00100, 0x066F0, 0x00100, 0x06708,
+	0x00100, 0x06728, 0x00100, 0x06B20, 0x00100, 0x06B62, 0x00100, 0x06B79,
+	0x00100, 0x06BB3, 0x00100, 0x06BCB, 0x00100, 0x06BD4, 0x00100, 0x06BDB,
+	0x00100, 0x06C0F, 0x00100, 0x06C14, 0x00100, 0x06C34, 0x00100, 0x0706B,
+	0x00100, 0x0722A, 0x00100, 0x07236, 0x00100, 0x0723B, 0x00100, 0x0723F,
+	0x00100, 0x07247, 0x00100, 0x07259, 0x00100, 0x0725B, 0x00100, 0x072AC,
+	0x00100, 0x07384, 0x00100, 0x07389, 0x00100, 0x074DC, 0x00100, 0x074E6,
+	0x00100, 0x07518, 0x00100, 0x0751F, 0x00100, 0x07528, 0x00100, 0x07530,
+	0x00100, 0x0758B, 0x00100, 0x07592, 0x00100, 0x07676, 0x00100, 0x0767D,
+	0x00100, 0x076AE, 0x00100, 0x076BF, 0x00100, 0x076EE, 0x00100, 0x077DB,
+	0x00100, 0x077E2, 0x00100, 0x077F3, 0x00100, 0x0793A, 0x00100, 0x079B8,
+	0x00100, 0x079BE, 0x00100, 0x07A74, 0x00100, 0x07ACB, 0x00100, 0x07AF9,
+	0x00100, 0x07C73, 0x00100, 0x07CF8, 0x00100, 0x07F36, 0x00100, 0x07F51,
+	0x00100, 0x07F8A, 0x00100, 0x07FBD, 0x00100, 0x08001, 0x00100, 0x0800C,
+	0x00100, 0x08012, 0x00100, 0x08033, 0x00100, 0x0807F, 0x00100, 0x08089,
+	0x00100, 0x081E3, 0x00100, 0x081EA, 0x00100, 0x081F3, 0x00100, 0x081FC,
+	0x00100, 0x0820C, 0x00100, 0x0821B, 0x00100, 0x0821F, 0x00100, 0x0826E,
+	0x00100, 0x08272, 0x00100, 0x08278, 0x00100, 0x0864D, 0x00100, 0x0866B,
+	0x00100, 0x08840, 0x00100, 0x0884C, 0x00100, 0x08863, 0x00100, 0x0897E,
+	0x00100, 0x0898B, 0x00100, 0x089D2, 0x00100, 0x08A00, 0x00100, 0x08C37,
+	0x00100, 0x08C46, 0x00100, 0x08C55, 0x00100, 0x08C78, 0x00100, 0x08C9D,
+	0x00100, 0x08D64, 0x00100, 0x08D70, 0x00100, 0x08DB3, 0x00100, 0x08EAB,
+	0x00100, 0x08ECA, 0x00100, 0x08F9B, 0x00100, 0x08FB0, 0x00100, 0x08FB5,
+	0x00100, 0x09091, 0x00100, 0x09149, 0x00100, 0x091C6, 0x00100, 0x091CC,
+	0x00100, 0x091D1, 0x00100, 0x09577, 0x00100, 0x09580, 0x00100, 0x0961C,
+	0x00100, 0x096B6, 0x00100, 0x096B9, 0x00100, 0x096E8, 0x00100, 0x09751,
+	0x00100, 0x0975E, 0x00100, 0x09762, 0x00100, 0x09769, 0x00100, 0x097CB,
+	0x00100, 0x097ED, 0x00100, 0x097F3, 0x00100, 0x09801, 0x00100, 0x098A8,
+	0x00100, 0x098DB, 0x00100, 0x098DF, 0x00100, 0x09996, 0x00100, 0x09999,
+	0x00100, 0x099AC, 0x00100, 0x09AA8, 0x00100, 0x09AD8, 0x00100, 0x09ADF,
+	0x00100, 0x09B25, 0x00100, 0x09B2F, 0x00100, 0x09B32, 0x00100, 0x09B3C,
+	0x00100, 0x09B5A, 0x00100, 0x09CE5, 0x00100, 0x09E75, 0x00100, 0x09E7F,
+	0x00100, 0x09EA5, 0x00100, 0x09EBB, 0x00100, 0x09EC3, 0x00100, 0x09ECD,
+	0x00100, 0x09ED1, 0x00100, 0x09EF9, 0x00100, 0x09EFD, 0x00100, 0x09F0E,
+	0x00100, 0x09F13, 0x00100, 0x09F20, 0x00100, 0x09F3B, 0x00100, 0x09F4A,
+	0x00100, 0x09F52, 0x00100, 0x09F8D, 0x00100, 0x09F9C, 0x00100, 0x09FA0,
+	0x00100, 0x00020, 0x00100, 0x03012, 0x00100, 0x05341, 0x00100, 0x05344,
+	0x00100, 0x05345, 0x00002, 0x0304B, 0x03099, 0x00002, 0x0304D, 0x03099,
+	0x00002, 0x0304F, 0x03099, 0x00002, 0x03051, 0x03099, 0x00002, 0x03053,
+	0x03099, 0x00002, 0x03055, 0x03099, 0x00002, 0x03057, 0x03099, 0x00002,
+	0x03059, 0x03099, 0x00002, 0x0305B, 0x03099, 0x00002, 0x0305D, 0x03099,
+	0x00002, 0x0305F, 0x03099, 0x00002, 0x03061, 0x03099, 0x00002, 0x03064,
+	0x03099, 0x00002, 0x03066, 0x03099, 0x00002, 0x03068, 0x03099, 0x00002,
+	0x0306F, 0x03099, 0x00002, 0x0306F, 0x0309A, 0x00002, 0x03072, 0x03099,
+	0x00002, 0x03072, 0x0309A, 0x00002, 0x03075, 0x03099, 0x00002, 0x03075,
+	0x0309A, 0x00002, 0x03078, 0x03099, 0x00002, 0x03078, 0x0309A, 0x00002,
+	0x0307B, 0x03099, 0x00002, 0x0307B, 0x0309A, 0x00002, 0x03046, 0x03099,
+	0x00200, 0x00020, 0x03099, 0x00200, 0x00020, 0x0309A, 0x00002, 0x0309D,
+	0x03099, 0x00200, 0x03088, 0x0308A, 0x00002, 0x030AB, 0x03099, 0x00002,
+	0x030AD, 0x03099, 0x00002, 0x030AF, 0x03099, 0x00002, 0x030B1, 0x03099,
+	0x00002, 0x030B3, 0x03099, 0x00002, 0x030B5, 0x03099, 0x00002, 0x030B7,
+	0x03099, 0x00002, 0x030B9, 0x03099, 0x00002, 0x030BB, 0x03099, 0x00002,
+	0x030BD, 0x03099, 0x00002, 0x030BF, 0x03099, 0x00002, 0x030C1, 0x03099,
+	0x00002, 0x030C4, 0x03099, 0x00002, 0x030C6, 0x03099, 0x00002, 0x030C8,
+	0x03099, 0x00002, 0x030CF, 0x03099, 0x00002, 0x030CF, 0x0309A, 0x00002,
+	0x030D2, 0x03099, 0x00002, 0x030D2, 0x0309A, 0x00002, 0x030D5, 0x03099,
+	0x00002, 0x030D5, 0x0309A, 0x00002, 0x030D8, 0x03099, 0x00002, 0x030D8,
+	0x0309A, 0x00002, 0x030DB, 0x03099, 0x00002, 0x030DB, 0x0309A, 0x00002,
+	0x030A6, 0x03099, 0x00002, 0x030EF, 0x03099, 0x00002, 0x030F0, 0x03099,
+	0x00002, 0x030F1, 0x03099, 0x00002, 0x030F2, 0x03099, 0x00002, 0x030FD,
+	0x03099, 0x00200, 0x030B3, 0x030C8, 0x00100, 0x01100, 0x00100, 0x01101,
+	0x00100, 0x011AA, 0x00100, 0x01102, 0x00100, 0x011AC, 0x00100, 0x011AD,
+	0x00100, 0x01103, 0x00100, 0x01104, 0x00100, 0x01105, 0x00100, 0x011B0,
+	0x00100, 0x011B1, 0x00100, 0x011B2, 0x00100, 0x011B3, 0x00100, 0x011B4,
+	0x00100, 0x011B5, 0x00100, 0x0111A, 0x00100, 0x01106, 0x00100, 0x01107,
+	0x00100, 0x01108, 0x00100, 0x01121, 0x00100, 0x01109, 0x00100, 0x0110A,
+	0x00100, 0x0110B, 0x00100, 0x0110C, 0x00100, 0x0110D, 0x00100, 0x0110E,
+	0x00100, 0x0110F, 0x00100, 0x01110, 0x00100, 0x01111, 0x00100, 0x01112,
+	0x00100, 0x01161, 0x00100, 0x01162, 0x00100, 0x01163, 0x00100, 0x01164,
+	0x00100, 0x01165, 0x00100, 0x01166, 0x00100, 0x01167, 0x00100, 0x01168,
+	0x00100, 0x01169, 0x00100, 0x0116A, 0x00100, 0x0116B, 0x00100, 0x0116C,
+	0x00100, 0x0116D, 0x00100, 0x0116E, 0x00100, 0x0116F, 0x00100, 0x01170,
+	0x00100, 0x01171, 0x00100, 0x01172, 0x00100, 0x01173, 0x00100, 0x01174,
+	0x00100, 0x01175, 0x00100, 0x01160, 0x00100, 0x01114, 0x00100, 0x01115,
+	0x00100, 0x011C7, 0x00100, 0x011C8, 0x00100, 0x011CC, 0x00100, 0x011CE,
+	0x00100, 0x011D3, 0x00100, 0x011D7, 0x00100, 0x011D9, 0x00100, 0x0111C,
+	0x00100, 0x011DD, 0x00100, 0x011DF, 0x00100, 0x0111D, 0x00100, 0x0111E,
+	0x00100, 0x01120, 0x00100, 0x01122, 0x00100, 0x01123, 0x00100, 0x01127,
+	0x00100, 0x01129, 0x00100, 0x0112B, 0x00100, 0x0112C, 0x00100, 0x0112D,
+	0x00100, 0x0112E, 0x00100, 0x0112F, 0x00100, 0x01132, 0x00100, 0x01136,
+	0x00100, 0x01140, 0x00100, 0x01147, 0x00100, 0x0114C, 0x00100, 0x011F1,
+	0x00100, 0x011F2, 0x00100, 0x01157, 0x00100, 0x01158, 0x00100, 0x01159,
+	0x00100, 0x01184, 0x00100, 0x01185, 0x00100, 0x01188, 0x00100, 0x01191,
+	0x00100, 0x01192, 0x00100, 0x01194, 0x00100, 0x0119E, 0x00100, 0x011A1,
+	0x00100, 0x04E00, 0x00100, 0x04E8C, 0x00100, 0x04E09, 0x00100, 0x056DB,
+	0x00100, 0x04E0A, 0x00100, 0x04E2D, 0x00100, 0x04E0B, 0x00100, 0x07532,
+	0x00100, 0x04E59, 0x00100, 0x04E19, 0x00100, 0x04E01, 0x00100, 0x05929,
+	0x00100, 0x05730, 0x00100, 0x04EBA, 0x00300, 0x00028, 0x01100, 0x00029,
+	0x00300, 0x00028, 0x01102, 0x00029, 0x00300, 0x00028, 0x01103, 0x00029,
+	0x00300, 0x00028, 0x01105, 0x00029, 0x00300, 0x00028, 0x01106, 0x00029,
+	0x00300, 0x00028, 0x01107, 0x00029, 0x00300, 0x00028, 0x01109, 0x00029,
+	0x00300, 0x00028, 0x0110B, 0x00029, 0x00300, 0x00028, 0x0110C, 0x00029,
+	0x00300, 0x00028, 0x0110E, 0x00029, 0x00300, 0x00028, 0x0110F, 0x00029,
+	0x00300, 0x00028, 0x01110, 0x00029, 0x00300, 0x00028, 0x01111, 0x00029,
+	0x00300, 0x00028, 0x01112, 0x00029, 0x00400, 0x00028, 0x01100, 0x01161,
+	0x00029, 0x00400, 0x00028, 0x01102, 0x01161, 0x00029, 0x00400, 0x00028,
+	0x01103, 0x01161, 0x00029, 0x00400, 0x00028, 0x01105, 0x01161, 0x00029,
+	0x00400, 0x00028, 0x01106, 0x01161, 0x00029, 0x00400, 0x00028, 0x01107,
+	0x01161, 0x00029, 0x00400, 0x00028, 0x01109, 0x01161, 0x00029, 0x00400,
+	0x00028, 0x0110B, 0x01161, 0x00029, 0x00400, 0x00028, 0x0110C, 0x01161,
+	0x00029, 0x00400, 0x00028, 0x0110E, 0x01161, 0x00029, 0x00400, 0x00028,
+	0x0110F, 0x01161, 0x00029, 0x00400, 0x00028, 0x01110, 0x01161, 0x00029,
+	0x00400, 0x00028, 0x01111, 0x01161, 0x00029, 0x00400, 0x00028, 0x01112,
+	0x01161, 0x00029, 0x00400, 0x00028, 0x0110C, 0x0116E, 0x00029, 0x00700,
+	0x00028, 0x0110B, 0x01169, 0x0110C, 0x01165, 0x011AB, 0x00029, 0x00600,
+	0x00028, 0x0110B, 0x01169, 0x01112, 0x0116E, 0x00029, 0x00300, 0x00028,
+	0x04E00, 0x00029, 0x00300, 0x00028, 0x04E8C, 0x00029, 0x00300, 0x00028,
+	0x04E09, 0x00029, 0x00300, 0x00028, 0x056DB, 0x00029, 0x00300, 0x00028,
+	0x04E94, 0x00029, 0x00300, 0x00028, 0x0516D, 0x00029, 0x00300, 0x00028,
+	0x04E03, 0x00029, 0x00300, 0x00028, 0x0516B, 0x00029, 0x00300, 0x00028,
+	0x04E5D, 0x00029, 0x00300, 0x00028, 0x05341, 0x00029, 0x00300, 0x00028,
+	0x06708, 0x00029, 0x00300, 0x00028, 0x0706B, 0x00029, 0x00300, 0x00028,
+	0x06C34, 0x00029, 0x00300, 0x00028, 0x06728, 0x00029, 0x00300, 0x00028,
+	0x091D1, 0x00029, 0x00300, 0x00028, 0x0571F, 0x00029, 0x00300, 0x00028,
+	0x065E5, 0x00029, 0x00300, 0x00028, 0x0682A, 0x00029, 0x00300, 0x00028,
+	0x06709, 0x00029, 0x00300, 0x00028, 0x0793E, 0x00029, 0x00300, 0x00028,
+	0x0540D, 0x00029, 0x00300, 0x00028, 0x07279, 0x00029, 0x00300, 0x00028,
+	0x08CA1, 0x00029, 0x00300, 0x00028, 0x0795D, 0x00029, 0x00300, 0x00028,
+	0x052B4, 0x00029, 0x00300, 0x00028, 0x04EE3, 0x00029, 0x00300, 0x00028,
+	0x0547C, 0x00029, 0x00300, 0x00028, 0x05B66, 0x00029, 0x00300, 0x00028,
+	0x076E3, 0x00029, 0x00300, 0x00028, 0x04F01, 0x00029, 0x00300, 0x00028,
+	0x08CC7, 0x00029, 0x00300, 0x00028, 0x05354, 0x00029, 0x00300, 0x00028,
+	0x0796D, 0x00029, 0x00300, 0x00028, 0x04F11, 0x00029, 0x00300, 0x00028,
+	0x081EA, 0x00029, 0x00300, 0x00028, 0x081F3, 0x00029, 0x00100, 0x0554F,
+	0x00100, 0x05E7C, 0x00100, 0x06587, 0x00100, 0x07B8F, 0x00300, 0x00050,
+	0x00054, 0x00045, 0x00200, 0x00032, 0x00031, 0x00200, 0x00032, 0x00032,
+	0x00200, 0x00032, 0x00033, 0x00200, 0x00032, 0x00034, 0x00200, 0x00032,
+	0x00035, 0x00200, 0x00032, 0x00036, 0x00200, 0x00032, 0x00037, 0x00200,
+	0x00032, 0x00038, 0x00200, 0x00032, 0x00039, 0x00200, 0x00033, 0x00030,
+	0x00200, 0x00033, 0x00031, 0x00200, 0x00033, 0x00032, 0x00200, 0x00033,
+	0x00033, 0x00200, 0x00033, 0x00034, 0x00200, 0x00033, 0x00035, 0x00100,
+	0x01100, 0x00100, 0x01102, 0x00100, 0x01103, 0x00100, 0x01105, 0x00100,
+	0x01106, 0x00100, 0x01107, 0x00100, 0x01109, 0x00100, 0x0110B, 0x00100,
+	0x0110C, 0x00100, 0x0110E, 0x00100, 0x0110F, 0x00100, 0x01110, 0x00100,
+	0x01111, 0x00100, 0x01112, 0x00200, 0x01100, 0x01161, 0x00200, 0x01102,
+	0x01161, 0x00200, 0x01103, 0x01161, 0x00200, 0x01105, 0x01161, 0x00200,
+	0x01106, 0x01161, 0x00200, 0x01107, 0x01161, 0x00200, 0x01109, 0x01161,
+	0x00200, 0x0110B, 0x01161, 0x00200, 0x0110C, 0x01161, 0x00200, 0x0110E,
+	0x01161, 0x00200, 0x0110F, 0x01161, 0x00200, 0x01110, 0x01161, 0x00200,
+	0x01111, 0x01161, 0x00200, 0x01112, 0x01161, 0x00500, 0x0110E, 0x01161,
+	0x011B7, 0x01100, 0x01169, 0x00400, 0x0110C, 0x0116E, 0x0110B, 0x01174,
+	0x00200, 0x0110B, 0x0116E, 0x00100, 0x04E00, 0x00100, 0x04E8C, 0x00100,
+	0x04E09, 0x00100, 0x056DB, 0x00100, 0x04E94, 0x00100, 0x0516D, 0x00100,
+	0x04E03, 0x00100, 0x0516B, 0x00100, 0x04E5D, 0x00100, 0x05341, 0x00100,
+	0x06708, 0x00100, 0x0706B, 0x00100, 0x06C34, 0x00100, 0x06728, 0x00100,
+	0x091D1, 0x00100, 0x0571F, 0x00100, 0x065E5, 0x00100, 0x0682A, 0x00100,
+	0x06709, 0x00100, 0x0793E, 0x00100, 0x0540D, 0x00100, 0x07279, 0x00100,
+	0x08CA1, 0x00100, 0x0795D, 0x00100, 0x052B4, 0x00100, 0x079D8, 0x00100,
+	0x07537, 0x00100, 0x05973, 0x00100, 0x09069, 0x00100, 0x0512A, 0x00100,
+	0x05370, 0x00100, 0x06CE8, 0x00100, 0x09805, 0x00100, 0x04F11, 0x00100,
+	0x05199, 0x00100, 0x06B63, 0x00100, 0x04E0A, 0x00100, 0x04E2D, 0x00100,
+	0x04E0B, 0x00100, 0x05DE6, 0x00100, 0x053F3, 0x00100, 0x0533B, 0x00100,
+	0x05B97, 0x00100, 0x05B66, 0x00100, 0x076E3, 0x00100, 0x04F01, 0x00100,
+	0x08CC7, 0x00100, 0x05354, 0x00100, 0x0591C, 0x00200, 0x00033, 0x00036,
+	0x00200, 0x00033, 0x00037, 0x00200, 0x00033, 0x00038, 0x00200, 0x00033,
+	0x00039, 0x00200, 0x00034, 0x00030, 0x00200, 0x00034, 0x00031, 0x00200,
+	0x00034, 0x00032, 0x00200, 0x00034, 0x00033, 0x00200, 0x00034, 0x00034,
+	0x00200, 0x00034, 0x00035, 0x00200, 0x00034, 0x00036, 0x00200, 0x00034,
+	0x00037, 0x00200, 0x00034, 0x00038, 0x00200, 0x00034, 0x00039, 0x00200,
+	0x00035, 0x00030, 0x00200, 0x00031, 0x06708, 0x00200, 0x00032, 0x06708,
+	0x00200, 0x00033, 0x06708, 0x00200, 0x00034, 0x06708, 0x00200, 0x00035,
+	0x06708, 0x00200, 0x00036, 0x06708, 0x00200, 0x00037, 0x06708, 0x00200,
+	0x00038, 0x06708, 0x00200, 0x00039, 0x06708, 0x00300, 0x00031, 0x00030,
+	0x06708, 0x00300, 0x00031, 0x00031, 0x06708, 0x00300, 0x00031, 0x00032,
+	0x06708, 0x00200, 0x00048, 0x00067, 0x00300, 0x00065, 0x00072, 0x00067,
+	0x00200, 0x00065, 0x00056, 0x00300, 0x0004C, 0x00054, 0x00044, 0x00100,
+	0x030A2, 0x00100, 0x030A4, 0x00100, 0x030A6, 0x00100, 0x030A8, 0x00100,
+	0x030AA, 0x00100, 0x030AB, 0x00100, 0x030AD, 0x00100, 0x030AF, 0x00100,
+	0x030B1, 0x00100, 0x030B3, 0x00100, 0x030B5, 0x00100, 0x030B7, 0x00100,
+	0x030B9, 0x00100, 0x030BB, 0x00100, 0x030BD, 0x00100, 0x030BF, 0x00100,
+	0x030C1, 0x00100, 0x030C4, 0x00100, 0x030C6, 0x00100, 0x030C8, 0x00100,
+	0x030CA, 0x00100, 0x030CB, 0x00100, 0x030CC, 0x00100, 0x030CD, 0x00100,
+	0x030CE, 0x00100, 0x030CF, 0x00100, 0x030D2, 0x00100, 0x030D5, 0x00100,
+	0x030D8, 0x00100, 0x030DB, 0x00100, 0x030DE, 0x00100, 0x030DF, 0x00100,
+	0x030E0, 0x00100, 0x030E1, 0x00100, 0x030E2, 0x00100, 0x030E4, 0x00100,
+	0x030E6, 0x00100, 0x030E8, 0x00100, 0x030E9, 0x00100, 0x030EA, 0x00100,
+	0x030EB, 0x00100, 0x030EC, 0x00100, 0x030ED, 0x00100, 0x030EF, 0x00100,
+	0x030F0, 0x00100, 0x030F1, 0x00100, 0x030F2, 0x00200, 0x04EE4, 0x0548C,
+	0x00500, 0x030A2, 0x030CF, 0x0309A, 0x030FC, 0x030C8, 0x00400, 0x030A2,
+	0x030EB, 0x030D5, 0x030A1, 0x00500, 0x030A2, 0x030F3, 0x030D8, 0x0309A,
+	0x030A2, 0x00300, 0x030A2, 0x030FC, 0x030EB, 0x00500, 0x030A4, 0x030CB,
+	0x030F3, 0x030AF, 0x03099, 0x00300, 0x030A4, 0x030F3, 0x030C1, 0x00300,
+	0x030A6, 0x030A9, 0x030F3, 0x00600, 0x030A8, 0x030B9, 0x030AF, 0x030FC,
+	0x030C8, 0x03099, 0x00400, 0x030A8, 0x030FC, 0x030AB, 0x030FC, 0x00300,
+	0x030AA, 0x030F3, 0x030B9, 0x00300, 0x030AA, 0x030FC, 0x030E0, 0x00300,
+	0x030AB, 0x030A4, 0x030EA, 0x00400, 0x030AB, 0x030E9, 0x030C3, 0x030C8,
+	0x00400, 0x030AB, 0x030ED, 0x030EA, 0x030FC, 0x00400, 0x030AB, 0x03099,
+	0x030ED, 0x030F3, 0x00400, 0x030AB, 0x03099, 0x030F3, 0x030DE, 0x00400,
+	0x030AD, 0x03099, 0x030AB, 0x03099, 0x00400, 0x030AD, 0x03099, 0x030CB,
+	0x030FC, 0x00400, 0x030AD, 0x030E5, 0x030EA, 0x030FC, 0x00600, 0x030AD,
+	0x03099, 0x030EB, 0x030BF, 0x03099, 0x030FC, 0x00200, 0x030AD, 0x030ED,
+	0x00600, 0x030AD, 0x030ED, 0x030AF, 0x03099, 0x030E9, 0x030E0, 0x00600,
+	0x030AD, 0x030ED, 0x030E1, 0x030FC, 0x030C8, 0x030EB, 0x00500, 0x030AD,
+	0x030ED, 0x030EF, 0x030C3, 0x030C8, 0x00400, 0x030AF, 0x03099, 0x030E9,
+	0x030E0, 0x00600, 0x030AF, 0x03099, 0x030E9, 0x030E0, 0x030C8, 0x030F3,
+	0x00600, 0x030AF, 0x030EB, 0x030BB, 0x03099, 0x030A4, 0x030ED, 0x00400,
+	0x030AF, 0x030ED, 0x030FC, 0x030CD, 0x00300, 0x030B1, 0x030FC, 0x030B9,
+	0x00300, 0x030B3, 0x030EB, 0x030CA, 0x00400, 0x030B3, 0x030FC, 0x030DB,
+	0x0309A, 0x00400, 0x030B5, 0x030A4, 0x030AF, 0x030EB, 0x00500, 0x030B5,
+	0x030F3, 0x030C1, 0x030FC, 0x030E0, 0x00500, 0x030B7, 0x030EA, 0x030F3,
+	0x030AF, 0x03099, 0x00300, 0x030BB, 0x030F3, 0x030C1, 0x00300, 0x030BB,
+	0x030F3, 0x030C8, 0x00400, 0x030BF, 0x03099, 0x030FC, 0x030B9, 0x00300,
+	0x030C6, 0x03099, 0x030B7, 0x00300, 0x030C8, 0x03099, 0x030EB, 0x00200,
+	0x030C8, 0x030F3, 0x00200, 0x030CA, 0x030CE, 0x00300, 0x030CE, 0x030C3,
+	0x030C8, 0x00300, 0x030CF, 0x030A4, 0x030C4, 0x00600, 0x030CF, 0x0309A,
+	0x030FC, 0x030BB, 0x030F3, 0x030C8, 0x00400, 0x030CF, 0x0309A, 0x030FC,
+	0x030C4, 0x00500, 0x030CF, 0x03099, 0x030FC, 0x030EC, 0x030EB, 0x00600,
+	0x030D2, 0x0309A, 0x030A2, 0x030B9, 0x030C8, 0x030EB, 0x00400, 0x030D2,
+	0x0309A, 0x030AF, 0x030EB, 0x00300, 0x030D2, 0x0309A, 0x030B3, 0x00300,
+	0x030D2, 0x03099, 0x030EB, 0x00600, 0x030D5, 0x030A1, 0x030E9, 0x030C3,
+	0x030C8, 0x03099, 0x00400, 0x030D5, 0x030A3, 0x030FC, 0x030C8, 0x00600,
+	0x030D5, 0x03099, 0x030C3, 0x030B7, 0x030A7, 0x030EB, 0x00300, 0x030D5,
+	0x030E9, 0x030F3, 0x00500, 0x030D8, 0x030AF, 0x030BF, 0x030FC, 0x030EB,
+	0x00300, 0x030D8, 0x0309A, 0x030BD, 0x00400, 0x030D8, 0x0309A, 0x030CB,
+	0x030D2, 0x00300, 0x030D8, 0x030EB, 0x030C4, 0x00400, 0x030D8, 0x0309A,
+	0x030F3, 0x030B9, 0x00500, 0x030D8, 0x0309A, 0x030FC, 0x030B7, 0x03099,
+	0x00400, 0x030D8, 0x03099, 0x030FC, 0x030BF, 0x00500, 0x030DB, 0x0309A,
+	0x030A4, 0x030F3, 0x030C8, 0x00400, 0x030DB, 0x03099, 0x030EB, 0x030C8,
+	0x00200, 0x030DB, 0x030F3, 0x00500, 0x030DB, 0x0309A, 0x030F3, 0x030C8,
+	0x03099, 0x00300, 0x030DB, 0x030FC, 0x030EB, 0x00300, 0x030DB, 0x030FC,
+	0x030F3, 0x00400, 0x030DE, 0x030A4, 0x030AF, 0x030ED, 0x00300, 0x030DE,
+	0x030A4, 0x030EB, 0x00300, 0x030DE, 0x030C3, 0x030CF, 0x00300, 0x030DE,
+	0x030EB, 0x030AF, 0x00500, 0x030DE, 0x030F3, 0x030B7, 0x030E7, 0x030F3,
+	0x00400, 0x030DF, 0x030AF, 0x030ED, 0x030F3, 0x00200, 0x030DF, 0x030EA,
+	0x00600, 0x030DF, 0x030EA, 0x030CF, 0x03099, 0x030FC, 0x030EB, 0x00300,
+	0x030E1, 0x030AB, 0x03099, 0x00500, 0x030E1, 0x030AB, 0x03099, 0x030C8,
+	0x030F3, 0x00400, 0x030E1, 0x030FC, 0x030C8, 0x030EB, 0x00400, 0x030E4,
+	0x030FC, 0x030C8, 0x03099, 0x00300, 0x030E4, 0x030FC, 0x030EB, 0x00300,
+	0x030E6, 0x030A2, 0x030F3, 0x00400, 0x030EA, 0x030C3, 0x030C8, 0x030EB,
+	0x00200, 0x030EA, 0x030E9, 0x00400, 0x030EB, 0x030D2, 0x0309A, 0x030FC,
+	0x00500, 0x030EB, 0x030FC, 0x030D5, 0x03099, 0x030EB, 0x00200, 0x030EC,
+	0x030E0, 0x00600, 0x030EC, 0x030F3, 0x030C8, 0x030B1, 0x03099, 0x030F3,
+	0x00300, 0x030EF, 0x030C3, 0x030C8, 0x00200, 0x00030, 0x070B9, 0x00200,
+	0x00031, 0x070B9, 0x00200, 0x00032, 0x070B9, 0x00200, 0x00033, 0x070B9,
+	0x00200, 0x00034, 0x070B9, 0x00200, 0x00035, 0x070B9, 0x00200, 0x00036,
+	0x070B9, 0x00200, 0x00037, 0x070B9, 0x00200, 0x00038, 0x070B9, 0x00200,
+	0x00039, 0x070B9, 0x00300, 0x00031, 0x00030, 0x070B9, 0x00300, 0x00031,
+	0x00031, 0x070B9, 0x00300, 0x00031, 0x00032, 0x070B9, 0x00300, 0x00031,
+	0x00033, 0x070B9, 0x00300, 0x00031, 0x00034, 0x070B9, 0x00300, 0x00031,
+	0x00035, 0x070B9, 0x00300, 0x00031, 0x00036, 0x070B9, 0x00300, 0x00031,
+	0x00037, 0x070B9, 0x00300, 0x00031, 0x00038, 0x070B9, 0x00300, 0x00031,
+	0x00039, 0x070B9, 0x00300, 0x00032, 0x00030, 0x070B9, 0x00300, 0x00032,
+	0x00031, 0x070B9, 0x00300, 0x00032, 0x00032, 0x070B9, 0x00300, 0x00032,
+	0x00033, 0x070B9, 0x00300, 0x00032, 0x00034, 0x070B9, 0x00300, 0x00068,
+	0x00050, 0x00061, 0x00200, 0x00064, 0x00061, 0x00200, 0x00041, 0x00055,
+	0x00300, 0x00062, 0x00061, 0x00072, 0x00200, 0x0006F, 0x00056, 0x00200,
+	0x00070, 0x00063, 0x00200, 0x00064, 0x0006D, 0x00300, 0x00064, 0x0006D,
+	0x00032, 0x00300, 0x00064, 0x0006D, 0x00033, 0x00200, 0x00049, 0x00055,
+	0x00200, 0x05E73, 0x06210, 0x00200, 0x0662D, 0x0548C, 0x00200, 0x05927,
+	0x06B63, 0x00200, 0x0660E, 0x06CBB, 0x00400, 0x0682A, 0x05F0F, 0x04F1A,
+	0x0793E, 0x00200, 0x00070, 0x00041, 0x00200, 0x0006E, 0x00041, 0x00200,
+	0x003BC, 0x00041, 0x00200, 0x0006D, 0x00041, 0x00200, 0x0006B, 0x00041,
+	0x00200, 0x0004B, 0x00042, 0x00200, 0x0004D, 0x00042, 0x00200, 0x00047,
+	0x00042, 0x00300, 0x00063, 0x00061, 0x0006C, 0x00400, 0x0006B, 0x00063,
+	0x00061, 0x0006C, 0x00200, 0x00070, 0x00046, 0x00200, 0x0006E, 0x00046,
+	0x00200, 0x003BC, 0x00046, 0x00200, 0x003BC, 0x00067, 0x00200, 0x0006D,
+	0x00067, 0x00200, 0x0006B, 0x00067, 0x00200, 0x00048, 0x0007A, 0x00300,
+	0x0006B, 0x00048, 0x0007A, 0x00300, 0x0004D, 0x00048, 0x0007A, 0x00300,
+	0x00047, 0x00048, 0x0007A, 0x00300, 0x00054, 0x00048, 0x0007A, 0x00200,
+	0x003BC, 0x0006C, 0x00200, 0x0006D, 0x0006C, 0x00200, 0x00064, 0x0006C,
+	0x00200, 0x0006B, 0x0006C, 0x00200, 0x00066, 0x0006D, 0x00200, 0x0006E,
+	0x0006D, 0x00200, 0x003BC, 0x0006D, 0x00200, 0x0006D, 0x0006D, 0x00200,
+	0x00063, 0x0006D, 0x00200, 0x0006B, 0x0006D, 0x00300, 0x0006D, 0x0006D,
+	0x00032, 0x00300, 0x00063, 0x0006D, 0x00032, 0x00200, 0x0006D, 0x00032,
+	0x00300, 0x0006B, 0x0006D, 0x00032, 0x00300, 0x0006D, 0x0006D, 0x00033,
+	0x00300, 0x00063, 0x0006D, 0x00033, 0x00200, 0x0006D, 0x00033, 0x00300,
+	0x0006B, 0x0006D, 0x00033, 0x00300, 0x0006D, 0x02215, 0x00073, 0x00400,
+	0x0006D, 0x02215, 0x00073, 0x00032, 0x00200, 0x00050, 0x00061, 0x00300,
+	0x0006B, 0x00050, 0x00061, 0x00300, 0x0004D, 0x00050, 0x00061, 0x00300,
+	0x00047, 0x00050, 0x00061, 0x00300, 0x00072, 0x00061, 0x00064, 0x00500,
+	0x00072, 0x00061, 0x00064, 0x02215, 0x00073, 0x00600, 0x00072, 0x00061,
+	0x00064, 0x02215, 0x00073, 0x00032, 0x00200, 0x00070, 0x00073, 0x00200,
+	0x0006E, 0x00073, 0x00200, 0x003BC, 0x00073, 0x00200, 0x0006D, 0x00073,
+	0x00200, 0x00070, 0x00056, 0x00200, 0x0006E, 0x00056, 0x00200, 0x003BC,
+	0x00056, 0x00200, 0x0006D, 0x00056, 0x00200, 0x0006B, 0x00056, 0x00200,
+	0x0004D, 0x00056, 0x00200, 0x00070, 0x00057, 0x00200, 0x0006E, 0x00057,
+	0x00200, 0x003BC, 0x00057, 0x00200, 0x0006D, 0x00057, 0x00200, 0x0006B,
+	0x00057, 0x00200, 0x0004D, 0x00057, 0x00200, 0x0006B, 0x003A9, 0x00200,
+	0x0004D, 0x003A9, 0x00400, 0x00061, 0x0002E, 0x0006D, 0x0002E, 0x00200,
+	0x00042, 0x00071, 0x00200, 0x00063, 0x00063, 0x00200, 0x00063, 0x00064,
+	0x00400, 0x00043, 0x02215, 0x0006B, 0x00067, 0x00300, 0x00043, 0x0006F,
+	0x0002E, 0x00200, 0x00064, 0x00042, 0x00200, 0x00047, 0x00079, 0x00200,
+	0x00068, 0x00061, 0x00200, 0x00048, 0x00050, 0x00200, 0x00069, 0x0006E,
+	0x00200, 0x0004B, 0x0004B, 0x00200, 0x0004B, 0x0004D, 0x00200, 0x0006B,
+	0x00074, 0x00200, 0x0006C, 0x0006D, 0x00200, 0x0006C, 0x0006E, 0x00300,
+	0x0006C, 0x0006F, 0x00067, 0x00200, 0x0006C, 0x00078, 0x00200, 0x0006D,
+	0x00062, 0x00300, 0x0006D, 0x00069, 0x0006C, 0x00300, 0x0006D, 0x0006F,
+	0x0006C, 0x00200, 0x00050, 0x00048, 0x00400, 0x00070, 0x0002E, 0x0006D,
+	0x0002E, 0x00300, 0x00050, 0x00050, 0x0004D, 0x00200, 0x00050, 0x00052,
+	0x00200, 0x00073, 0x00072, 0x00200, 0x00053, 0x00076, 0x00200, 0x00057,
+	0x00062, 0x00300, 0x00056, 0x02215, 0x0006D, 0x00300, 0x00041, 0x02215,
+	0x0006D, 0x00200, 0x00031, 0x065E5, 0x00200, 0x00032, 0x065E5, 0x00200,
+	0x00033, 0x065E5, 0x00200, 0x00034, 0x065E5, 0x00200, 0x00035, 0x065E5,
+	0x00200, 0x00036, 0x065E5, 0x00200, 0x00037, 0x065E5, 0x00200, 0x00038,
+	0x065E5, 0x00200, 0x00039, 0x065E5, 0x00300, 0x00031, 0x00030, 0x065E5,
+	0x00300, 0x00031, 0x00031, 0x065E5, 0x00300, 0x00031, 0x00032, 0x065E5,
+	0x00300, 0x00031, 0x00033, 0x065E5, 0x00300, 0x00031, 0x00034, 0x065E5,
+	0x00300, 0x00031, 0x00035, 0x065E5, 0x00300, 0x00031, 0x00036, 0x065E5,
+	0x00300, 0x00031, 0x00037, 0x065E5, 0x00300, 0x00031, 0x00038, 0x065E5,
+	0x00300, 0x00031, 0x00039, 0x065E5, 0x00300, 0x00032, 0x00030, 0x065E5,
+	0x00300, 0x00032, 0x00031, 0x065E5, 0x00300, 0x00032, 0x00032, 0x065E5,
+	0x00300, 0x00032, 0x00033, 0x065E5, 0x00300, 0x00032, 0x00034, 0x065E5,
+	0x00300, 0x00032, 0x00035, 0x065E5, 0x00300, 0x00032, 0x00036, 0x065E5,
+	0x00300, 0x00032, 0x00037, 0x065E5, 0x00300, 0x00032, 0x00038, 0x065E5,
+	0x00300, 0x00032, 0x00039, 0x065E5, 0x00300, 0x00033, 0x00030, 0x065E5,
+	0x00300, 0x00033, 0x00031, 0x065E5, 0x00300, 0x00067, 0x00061, 0x0006C,
+	0x00100, 0x0044A, 0x00100, 0x0044C, 0x00100, 0x0A76F, 0x00100, 0x00043,
+	0x00100, 0x00046, 0x00100, 0x00051, 0x00100, 0x00126, 0x00100, 0x00153,
+	0x00100, 0x0A727, 0x00100, 0x0AB37, 0x00100, 0x0026B, 0x00100, 0x0AB52,
+	0x00100, 0x0028D, 0x00001, 0x08C48, 0x00001, 0x066F4, 0x00001, 0x08ECA,
+	0x00001, 0x08CC8, 0x00001, 0x06ED1, 0x00001, 0x04E32, 0x00001, 0x053E5,
+	0x00001, 0x09F9C, 0x00001, 0x09F9C, 0x00001, 0x05951, 0x00001, 0x091D1,
+	0x00001, 0x05587, 0x00001, 0x05948, 0x00001, 0x061F6, 0x00001, 0x07669,
+	0x00001, 0x07F85, 0x00001, 0x0863F, 0x00001, 0x087BA, 0x00001, 0x088F8,
+	0x00001, 0x0908F, 0x00001, 0x06A02, 0x00001, 0x06D1B, 0x00001, 0x070D9,
+	0x00001, 0x073DE, 0x00001, 0x0843D, 0x00001, 0x0916A, 0x00001, 0x099F1,
+	0x00001, 0x04E82, 0x00001, 0x05375, 0x00001, 0x06B04, 0x00001, 0x0721B,
+	0x00001, 0x0862D, 0x00001, 0x09E1E, 0x00001, 0x05D50, 0x00001, 0x06FEB,
+	0x00001, 0x085CD, 0x00001, 0x08964, 0x00001, 0x062C9, 0x00001, 0x081D8,
+	0x00001, 0x0881F, 0x00001, 0x05ECA, 0x00001, 0x06717, 0x00001, 0x06D6A,
+	0x00001, 0x072FC, 0x00001, 0x090CE, 0x00001, 0x04F86, 0x00001, 0x051B7,
+	0x00001, 0x052DE, 0x00001, 0x064C4, 0x00001, 0x06AD3, 0x00001, 0x07210,
+	0x00001, 0x076E7, 0x00001, 0x08001, 0x00001, 0x08606, 0x00001, 0x0865C,
+	0x00001, 0x08DEF, 0x00001, 0x09732, 0x00001, 0x09B6F, 0x00001, 0x09DFA,
+	0x00001, 0x0788C, 0x00001, 0x0797F, 0x00001, 0x07DA0, 0x00001, 0x083C9,
+	0x00001, 0x09304, 0x00001, 0x09E7F, 0x00001, 0x08AD6, 0x00001, 0x058DF,
+	0x00001, 0x05F04, 0x00001, 0x07C60, 0x00001, 0x0807E, 0x00001, 0x07262,
+	0x00001, 0x078CA, 0x00001, 0x08CC2, 0x00001, 0x096F7, 0x00001, 0x058D8,
+	0x00001, 0x05C62, 0x00001, 0x06A13, 0x00001, 0x06DDA, 0x00001, 0x06F0F,
+	0x00001, 0x07D2F, 0x00001, 0x07E37, 0x00001, 0x0964B, 0x00001, 0x052D2,
+	0x00001, 0x0808B, 0x00001, 0x051DC, 0x00001, 0x051CC, 0x00001, 0x07A1C,
+	0x00001, 0x07DBE, 0x00001, 0x083F1, 0x00001, 0x09675, 0x00001, 0x08B80,
+	0x00001, 0x062CF, 0x00001, 0x06A02, 0x00001, 0x08AFE, 0x00001, 0x04E39,
+	0x00001, 0x05BE7, 0x00001, 0x06012, 0x00001, 0x07387, 0x00001, 0x07570,
+	0x00001, 0x05317, 0x00001, 0x078FB, 0x00001, 0x04FBF, 0x00001, 0x05FA9,
+	0x00001, 0x04E0D, 0x00001, 0x06CCC, 0x00001, 0x06578, 0x00001, 0x07D22,
+	0x00001, 0x053C3, 0x00001, 0x0585E, 0x00001, 0x07701, 0x00001, 0x08449,
+	0x00001, 0x08AAA, 0x00001, 0x06BBA, 0x00001, 0x08FB0, 0x00001, 0x06C88,
+	0x00001, 0x062FE, 0x00001, 0x082E5, 0x00001, 0x063A0, 0x00001, 0x07565,
+	0x00001, 0x04EAE, 0x00001, 0x05169, 0x00001, 0x051C9, 0x00001, 0x06881,
+	0x00001, 0x07CE7, 0x00001, 0x0826F, 0x00001, 0x08AD2, 0x00001, 0x091CF,
+	0x00001, 0x052F5, 0x00001, 0x05442, 0x00001, 0x05973, 0x00001, 0x05EEC,
+	0x00001, 0x065C5, 0x00001, 0x06FFE, 0x00001, 0x0792A, 0x00001, 0x095AD,
+	0x00001, 0x09A6A, 0x00001, 0x09E97, 0x00001, 0x09ECE, 0x00001, 0x0529B,
+	0x00001, 0x066C6, 0x00001, 0x06B77, 0x00001, 0x08F62, 0x00001, 0x05E74,
+	0x00001, 0x06190, 0x00001, 0x06200, 0x00001, 0x0649A, 0x00001, 0x06F23,
+	0x00001, 0x07149, 0x00001, 0x07489, 0x00001, 0x079CA, 0x00001, 0x07DF4,
+	0x00001, 0x0806F, 0x00001, 0x08F26, 0x00001, 0x084EE, 0x00001, 0x09023,
+	0x00001, 0x0934A, 0x00001, 0x05217, 0x00001, 0x052A3, 0x00001, 0x054BD,
+	0x00001, 0x070C8, 0x00001, 0x088C2, 0x00001, 0x08AAA, 0x00001, 0x05EC9,
+	0x00001, 0x05FF5, 0x00001, 0x0637B, 0x00001, 0x06BAE, 0x00001, 0x07C3E,
+	0x00001, 0x07375, 0x00001, 0x04EE4, 0x00001, 0x056F9, 0x00001, 0x05BE7,
+	0x00001, 0x05DBA, 0x00001, 0x0601C, 0x00001, 0x073B2, 0x00001, 0x07469,
+	0x00001, 0x07F9A, 0x00001, 0x08046, 0x00001, 0x09234, 0x00001, 0x096F6,
+	0x00001, 0x09748, 0x00001, 0x09818, 0x00001, 0x04F8B, 0x00001, 0x079AE,
+	0x00001, 0x091B4, 0x00001, 0x096B8, 0x00001, 0x060E1, 0x00001, 0x04E86,
+	0x00001, 0x050DA, 0x00001, 0x05BEE, 0x00001, 0x05C3F, 0x00001, 0x06599,
+	0x00001, 0x06A02, 0x00001, 0x071CE, 0x00001, 0x07642, 0x00001, 0x084FC,
+	0x00001, 0x0907C, 0x00001, 0x09F8D, 0x00001, 0x06688, 0x00001, 0x0962E,
+	0x00001, 0x05289, 0x00001, 0x0677B, 0x00001, 0x067F3, 0x00001, 0x06D41,
+	0x00001, 0x06E9C, 0x00001, 0x07409, 0x00001, 0x07559, 0x00001, 0x0786B,
+	0x00001, 0x07D10, 0x00001, 0x0985E, 0x00001, 0x0516D, 0x00001, 0x0622E,
+	0x00001, 0x09678, 0x00001, 0x0502B, 0x00001, 0x05D19, 0x00001, 0x06DEA,
+	0x00001, 0x08F2A, 0x00001, 0x05F8B, 0x00001, 0x06144, 0x00001, 0x06817,
+	0x00001, 0x07387, 0x00001, 0x09686, 0x00001, 0x05229, 0x00001, 0x0540F,
+	0x00001, 0x05C65, 0x00001, 0x06613, 0x00001, 0x0674E, 0x00001, 0x068A8,
+	0x00001, 0x06CE5, 0x00001, 0x07406, 0x00001, 0x075E2, 0x00001, 0x07F79,
+	0x00001, 0x088CF, 0x00001, 0x088E1, 0x00001, 0x091CC, 0x00001, 0x096E2,
+	0x00001, 0x0533F, 0x00001, 0x06EBA, 0x00001, 0x0541D, 0x00001, 0x071D0,
+	0x00001, 0x07498, 0x00001, 0x085FA, 0x00001, 0x096A3, 0x00001, 0x09C57,
+	0x00001, 0x09E9F, 0x00001, 0x06797, 0x00001, 0x06DCB, 0x00001, 0x081E8,
+	0x00001, 0x07ACB, 0x00001, 0x07B20, 0x00001, 0x07C92, 0x00001, 0x072C0,
+	0x00001, 0x07099, 0x00001, 0x08B58, 0x00001, 0x04EC0, 0x00001, 0x08336,
+	0x00001, 0x0523A, 0x00001, 0x05207, 0x00001, 0x05EA6, 0x00001, 0x062D3,
+	0x00001, 0x07CD6, 0x00001, 0x05B85, 0x00001, 0x06D1E, 0x00001, 0x066B4,
+	0x00001, 0x08F3B, 0x00001, 0x0884C, 0x00001, 0x0964D, 0x00001, 0x0898B,
+	0x00001, 0x05ED3, 0x00001, 0x05140, 0x00001, 0x055C0, 0x00001, 0x0585A,
+	0x00001, 0x06674, 0x00001, 0x051DE, 0x00001, 0x0732A, 0x00001, 0x076CA,
+	0x00001, 0x0793C, 0x00001, 0x0795E, 0x00001, 0x07965, 0x00001, 0x0798F,
+	0x00001, 0x09756, 0x00001, 0x07CBE, 0x00001, 0x07FBD, 0x00001, 0x08612,
+	0x00001, 0x08AF8, 0x00001, 0x09038, 0x00001, 0x090FD, 0x00001, 0x098EF,
+	0x00001, 0x098FC, 0x00001, 0x09928, 0x00001, 0x09DB4, 0x00001, 0x090DE,
+	0x00001, 0x096B7, 0x00001, 0x04FAE, 0x00001, 0x050E7, 0x00001, 0x0514D,
+	0x00001, 0x052C9, 0x00001, 0x052E4, 0x00001, 0x05351, 0x00001, 0x0559D,
+	0x00001, 0x05606, 0x00001, 0x05668, 0x00001, 0x05840, 0x00001, 0x058A8,
+	0x00001, 0x05C64, 0x00001, 0x05C6E, 0x00001, 0x06094, 0x00001, 0x06168,
+	0x00001, 0x0618E, 0x00001, 0x061F2, 0x00001, 0x0654F, 0x00001, 0x065E2,
+	0x00001, 0x06691, 0x00001, 0x06885, 0x00001, 0x06D77, 0x00001, 0x06E1A,
+	0x00001, 0x06F22, 0x00001, 0x0716E, 0x00001, 0x0722B, 0x00001, 0x07422,
+	0x00001, 0x07891, 0x00001, 0x0793E, 0x00001, 0x07949, 0x00001, 0x07948,
+	0x00001, 0x07950, 0x00001, 0x07956, 0x00001, 0x0795D, 0x00001, 0x0798D,
+	0x00001, 0x0798E, 0x00001, 0x07A40, 0x00001, 0x07A81, 0x00001, 0x07BC0,
+	0x00001, 0x07DF4, 0x00001, 0x07E09, 0x00001, 0x07E41, 0x00001, 0x07F72,
+	0x00001, 0x08005, 0x00001, 0x081ED, 0x00001, 0x08279, 0x00001, 0x08279,
+	0x00001, 0x08457, 0x00001, 0x08910, 0x00001, 0x08996, 0x00001, 0x08B01,
+	0x00001, 0x08B39, 0x00001, 0x08CD3, 0x00001, 0x08D08, 0x00001, 0x08FB6,
+	0x00001, 0x09038, 0x00001, 0x096E3, 0x00001, 0x097FF, 0x00001, 0x0983B,
+	0x00001, 0x06075, 0x00001, 0x242EE, 0x00001, 0x08218, 0x00001, 0x04E26,
+	0x00001, 0x051B5, 0x00001, 0x05168, 0x00001, 0x04F80, 0x00001, 0x05145,
+	0x00001, 0x05180, 0x00001, 0x052C7, 0x00001, 0x052FA, 0x00001, 0x0559D,
+	0x00001, 0x05555, 0x00001, 0x05599, 0x00001, 0x055E2, 0x00001, 0x0585A,
+	0x00001, 0x058B3, 0x00001, 0x05944, 0x00001, 0x05954, 0x00001, 0x05A62,
+	0x00001, 0x05B28, 0x00001, 0x05ED2, 0x00001, 0x05ED9, 0x00001, 0x05F69,
+	0x00001, 0x05FAD, 0x00001, 0x060D8, 0x00001, 0x0614E, 0x00001, 0x06108,
+	0x00001, 0x0618E, 0x00001, 0x06160, 0x00001, 0x061F2, 0x00001, 0x06234,
+	0x00001, 0x063C4, 0x00001, 0x0641C, 0x00001, 0x06452, 0x00001, 0x06556,
+	0x00001, 0x06674, 0x00001, 0x06717, 0x00001, 0x0671B, 0x00001, 0x06756,
+	0x00001, 0x06B79, 0x00001, 0x06BBA, 0x00001, 0x06D41, 0x00001, 0x06EDB,
+	0x00001, 0x06ECB, 0x00001, 0x06F22, 0x00001, 0x0701E, 0x00001, 0x0716E,
+	0x00001, 0x077A7, 0x00001, 0x07235, 0x00001, 0x072AF, 0x00001, 0x0732A,
+	0x00001, 0x07471, 0x00001, 0x07506, 0x00001, 0x0753B, 0x00001, 0x0761D,
+	0x00001, 0x0761F, 0x00001, 0x076CA, 0x00001, 0x076DB, 0x00001, 0x076F4,
+	0x00001, 0x0774A, 0x00001, 0x07740, 0x00001, 0x078CC, 0x00001, 0x07AB1,
+	0x00001, 0x07BC0, 0x00001, 0x07C7B, 0x00001, 0x07D5B, 0x00001, 0x07DF4,
+	0x00001, 0x07F3E, 0x00001, 0x08005, 0x00001, 0x08352, 0x00001, 0x083EF,
+	0x00001, 0x08779, 0x00001, 0x08941, 0x00001, 0x08986, 0x00001, 0x08996,
+	0x00001, 0x08ABF, 0x00001, 0x08AF8, 0x00001, 0x08ACB, 0x00001, 0x08B01,
+	0x00001, 0x08AFE, 0x00001, 0x08AED, 0x00001, 0x08B39, 0x00001, 0x08B8A,
+	0x00001, 0x08D08, 0x00001, 0x08F38, 0x00001, 0x09072, 0x00001, 0x09199,
+	0x00001, 0x09276, 0x00001, 0x0967C, 0x00001, 0x096E3, 0x00001, 0x09756,
+	0x00001, 0x097DB, 0x00001, 0x097FF, 0x00001, 0x0980B, 0x00001, 0x0983B,
+	0x00001, 0x09B12, 0x00001, 0x09F9C, 0x00001, 0x2284A, 0x00001, 0x22844,
+	0x00001, 0x233D5, 0x00001, 0x03B9D, 0x00001, 0x04018, 0x00001, 0x04039,
+	0x00001, 0x25249, 0x00001, 0x25CD0, 0x00001, 0x27ED3, 0x00001, 0x09F43,
+	0x00001, 0x09F8E, 0x00200, 0x00066, 0x00066, 0x00200, 0x00066, 0x00069,
+	0x00200, 0x00066, 0x0006C, 0x00300, 0x00066, 0x00066, 0x00069, 0x00300,
+	0x00066, 0x00066, 0x0006C, 0x00200, 0x00073, 0x00074, 0x00200, 0x00073,
+	0x00074, 0x00200, 0x00574, 0x00576, 0x00200, 0x00574, 0x00565, 0x00200,
+	0x00574, 0x0056B, 0x00200, 0x0057E, 0x00576, 0x00200, 0x00574, 0x0056D,
+	0x00002, 0x005D9, 0x005B4, 0x00002, 0x005F2, 0x005B7, 0x00100, 0x005E2,
+	0x00100, 0x005D0, 0x00100, 0x005D3, 0x00100, 0x005D4, 0x00100, 0x005DB,
+	0x00100, 0x005DC, 0x00100, 0x005DD, 0x00100, 0x005E8, 0x00100, 0x005EA,
+	0x00100, 0x0002B, 0x00002, 0x005E9, 0x005C1, 0x00002, 0x005E9, 0x005C2,
+	0x00003, 0x005E9, 0x005BC, 0x005C1, 0x00003, 0x005E9, 0x005BC, 0x005C2,
+	0x00002, 0x005D0, 0x005B7, 0x00002, 0x005D0, 0x005B8, 0x00002, 0x005D0,
+	0x005BC, 0x00002, 0x005D1, 0x005BC, 0x00002, 0x005D2, 0x005BC, 0x00002,
+	0x005D3, 0x005BC, 0x00002, 0x005D4, 0x005BC, 0x00002, 0x005D5, 0x005BC,
+	0x00002, 0x005D6, 0x005BC, 0x00002, 0x005D8, 0x005BC, 0x00002, 0x005D9,
+	0x005BC, 0x00002, 0x005DA, 0x005BC, 0x00002, 0x005DB, 0x005BC, 0x00002,
+	0x005DC, 0x005BC, 0x00002, 0x005DE, 0x005BC, 0x00002, 0x005E0, 0x005BC,
+	0x00002, 0x005E1, 0x005BC, 0x00002, 0x005E3, 0x005BC, 0x00002, 0x005E4,
+	0x005BC, 0x00002, 0x005E6, 0x005BC, 0x00002, 0x005E7, 0x005BC, 0x00002,
+	0x005E8, 0x005BC, 0x00002, 0x005E9, 0x005BC, 0x00002, 0x005EA, 0x005BC,
+	0x00002, 0x005D5, 0x005B9, 0x00002, 0x005D1, 0x005BF, 0x00002, 0x005DB,
+	0x005BF, 0x00002, 0x005E4, 0x005BF, 0x00200, 0x005D0, 0x005DC, 0x00100,
+	0x00671, 0x00100, 0x00671, 0x00100, 0x0067B, 0x00100, 0x0067B, 0x00100,
+	0x0067B, 0x00100, 0x0067B, 0x00100, 0x0067E, 0x00100, 0x0067E, 0x00100,
+	0x0067E, 0x00100, 0x0067E, 0x00100, 0x00680, 0x00100, 0x00680, 0x00100,
+	0x00680, 0x00100, 0x00680, 0x00100, 0x0067A, 0x00100, 0x0067A, 0x00100,
+	0x0067A, 0x00100, 0x0067A, 0x00100, 0x0067F, 0x00100, 0x0067F, 0x00100,
+	0x0067F, 0x00100, 0x0067F, 0x00100, 0x00679, 0x00100, 0x00679, 0x00100,
+	0x00679, 0x00100, 0x00679, 0x00100, 0x006A4, 0x00100, 0x006A4, 0x00100,
+	0x006A4, 0x00100, 0x006A4, 0x00100, 0x006A6, 0x00100, 0x006A6, 0x00100,
+	0x006A6, 0x00100, 0x006A6, 0x00100, 0x00684, 0x00100, 0x00684, 0x00100,
+	0x00684, 0x00100, 0x00684, 0x00100, 0x00683, 0x00100, 0x00683, 0x00100,
+	0x00683, 0x00100, 0x00683, 0x00100, 0x00686, 0x00100, 0x00686, 0x00100,
+	0x00686, 0x00100, 0x00686, 0x00100, 0x00687, 0x00100, 0x00687, 0x00100,
+	0x00687, 0x00100, 0x00687, 0x00100, 0x0068D, 0x00100, 0x0068D, 0x00100,
+	0x0068C, 0x00100, 0x0068C, 0x00100, 0x0068E, 0x00100, 0x0068E, 0x00100,
+	0x00688, 0x00100, 0x00688, 0x00100, 0x00698, 0x00100, 0x00698, 0x00100,
+	0x00691, 0x00100, 0x00691, 0x00100, 0x006A9, 0x00100, 0x006A9, 0x00100,
+	0x006A9, 0x00100, 0x006A9, 0x00100, 0x006AF, 0x00100, 0x006AF, 0x00100,
+	0x006AF, 0x00100, 0x006AF, 0x00100, 0x006B3, 0x00100, 0x006B3, 0x00100,
+	0x006B3, 0x00100, 0x006B3, 0x00100, 0x006B1, 0x00100, 0x006B1, 0x00100,
+	0x006B1, 0x00100, 0x006B1, 0x00100, 0x006BA, 0x00100, 0x006BA, 0x00100,
+	0x006BB, 0x00100, 0x006BB, 0x00100, 0x006BB, 0x00100, 0x006BB, 0x00200,
+	0x006D5, 0x00654, 0x00200, 0x006D5, 0x00654, 0x00100, 0x006C1, 0x00100,
+	0x006C1, 0x00100, 0x006C1, 0x00100, 0x006C1, 0x00100, 0x006BE, 0x00100,
+	0x006BE, 0x00100, 0x006BE, 0x00100, 0x006BE, 0x00100, 0x006D2, 0x00100,
+	0x006D2, 0x00200, 0x006D2, 0x00654, 0x00200, 0x006D2, 0x00654, 0x00100,
+	0x006AD, 0x00100, 0x006AD, 0x00100, 0x006AD, 0x00100, 0x006AD, 0x00100,
+	0x006C7, 0x00100, 0x006C7, 0x00100, 0x006C6, 0x00100, 0x006C6, 0x00100,
+	0x006C8, 0x00100, 0x006C8, 0x00200, 0x006C7, 0x00674, 0x00100, 0x006CB,
+	0x00100, 0x006CB, 0x00100, 0x006C5, 0x00100, 0x006C5, 0x00100, 0x006C9,
+	0x00100, 0x006C9, 0x00100, 0x006D0, 0x00100, 0x006D0, 0x00100, 0x006D0,
+	0x00100, 0x006D0, 0x00100, 0x00649, 0x00100, 0x00649, 0x00300, 0x0064A,
+	0x00654, 0x00627, 0x00300, 0x0064A, 0x00654, 0x00627, 0x00300, 0x0064A,
+	0x00654, 0x006D5, 0x00300, 0x0064A, 0x00654, 0x006D5, 0x00300, 0x0064A,
+	0x00654, 0x00648, 0x00300, 0x0064A, 0x00654, 0x00648, 0x00300, 0x0064A,
+	0x00654, 0x006C7, 0x00300, 0x0064A, 0x00654, 0x006C7, 0x00300, 0x0064A,
+	0x00654, 0x006C6, 0x00300, 0x0064A, 0x00654, 0x006C6, 0x00300, 0x0064A,
+	0x00654, 0x006C8, 0x00300, 0x0064A, 0x00654, 0x006C8, 0x00300, 0x0064A,
+	0x00654, 0x006D0, 0x00300, 0x0064A, 0x00654, 0x006D0, 0x00300, 0x0064A,
+	0x00654, 0x006D0, 0x00300, 0x0064A, 0x00654, 0x00649, 0x00300, 0x0064A,
+	0x00654, 0x00649, 0x00300, 0x0064A, 0x00654, 0x00649, 0x00100, 0x006CC,
+	0x00100, 0x006CC, 0x00100, 0x006CC, 0x00100, 0x006CC, 0x00300, 0x0064A,
+	0x00654, 0x0062C, 0x00300, 0x0064A, 0x00654, 0x0062D, 0x00300, 0x0064A,
+	0x00654, 0x00645, 0x00300, 0x0064A, 0x00654, 0x00649, 0x00300, 0x0064A,
+	0x00654, 0x0064A, 0x00200, 0x00628, 0x0062C, 0x00200, 0x00628, 0x0062D,
+	0x00200, 0x00628, 0x0062E, 0x00200, 0x00628, 0x00645, 0x00200, 0x00628,
+	0x00649, 0x00200, 0x00628, 0x0064A, 0x00200, 0x0062A, 0x0062C, 0x00200,
+	0x0062A, 0x0062D, 0x00200, 0x0062A, 0x0062E, 0x00200, 0x0062A, 0x00645,
+	0x00200, 0x0062A, 0x00649, 0x00200, 0x0062A, 0x0064A, 0x00200, 0x0062B,
+	0x0062C, 0x00200, 0x0062B, 0x00645, 0x00200, 0x0062B, 0x00649, 0x00200,
+	0x0062B, 0x0064A, 0x00200, 0x0062C, 0x0062D, 0x00200, 0x0062C, 0x00645,
+	0x00200, 0x0062D, 0x0062C, 0x00200, 0x0062D, 0x00645, 0x00200, 0x0062E,
+	0x0062C, 0x00200, 0x0062E, 0x0062D, 0x00200, 0x0062E, 0x00645, 0x00200,
+	0x00633, 0x0062C, 0x00200, 0x00633, 0x0062D, 0x00200, 0x00633, 0x0062E,
+	0x00200, 0x00633, 0x00645, 0x00200, 0x00635, 0x0062D, 0x00200, 0x00635,
+	0x00645, 0x00200, 0x00636, 0x0062C, 0x00200, 0x00636, 0x0062D, 0x00200,
+	0x00636, 0x0062E, 0x00200, 0x00636, 0x00645, 0x00200, 0x00637, 0x0062D,
+	0x00200, 0x00637, 0x00645, 0x00200, 0x00638, 0x00645, 0x00200, 0x00639,
+	0x0062C, 0x00200, 0x00639, 0x00645, 0x00200, 0x0063A, 0x0062C, 0x00200,
+	0x0063A, 0x00645, 0x00200, 0x00641, 0x0062C, 0x00200, 0x00641, 0x0062D,
+	0x00200, 0x00641, 0x0062E, 0x00200, 0x00641, 0x00645, 0x00200, 0x00641,
+	0x00649, 0x00200, 0x00641, 0x0064A, 0x00200, 0x00642, 0x0062D, 0x00200,
+	0x00642, 0x00645, 0x00200, 0x00642, 0x00649, 0x00200, 0x00642, 0x0064A,
+	0x00200, 0x00643, 0x00627, 0x00200, 0x00643, 0x0062C, 0x00200, 0x00643,
+	0x0062D, 0x00200, 0x00643, 0x0062E, 0x00200, 0x00643, 0x00644, 0x00200,
+	0x00643, 0x00645, 0x00200, 0x00643, 0x00649, 0x00200, 0x00643, 0x0064A,
+	0x00200, 0x00644, 0x0062C, 0x00200, 0x00644, 0x0062D, 0x00200, 0x00644,
+	0x0062E, 0x00200, 0x00644, 0x00645, 0x00200, 0x00644, 0x00649, 0x00200,
+	0x00644, 0x0064A, 0x00200, 0x00645, 0x0062C, 0x00200, 0x00645, 0x0062D,
+	0x00200, 0x00645, 0x0062E, 0x00200, 0x00645, 0x00645, 0x00200, 0x00645,
+	0x00649, 0x00200, 0x00645, 0x0064A, 0x00200, 0x00646, 0x0062C, 0x00200,
+	0x00646, 0x0062D, 0x00200, 0x00646, 0x0062E, 0x00200, 0x00646, 0x00645,
+	0x00200, 0x00646, 0x00649, 0x00200, 0x00646, 0x0064A, 0x00200, 0x00647,
+	0x0062C, 0x00200, 0x00647, 0x00645, 0x00200, 0x00647, 0x00649, 0x00200,
+	0x00647, 0x0064A, 0x00200, 0x0064A, 0x0062C, 0x00200, 0x0064A, 0x0062D,
+	0x00200, 0x0064A, 0x0062E, 0x00200, 0x0064A, 0x00645, 0x00200, 0x0064A,
+	0x00649, 0x00200, 0x0064A, 0x0064A, 0x00200, 0x00630, 0x00670, 0x00200,
+	0x00631, 0x00670, 0x00200, 0x00649, 0x00670, 0x00300, 0x00020, 0x0064C,
+	0x00651, 0x00300, 0x00020, 0x0064D, 0x00651, 0x00300, 0x00020, 0x0064E,
+	0x00651, 0x00300, 0x00020, 0x0064F, 0x00651, 0x00300, 0x00020, 0x00650,
+	0x00651, 0x00300, 0x00020, 0x00651, 0x00670, 0x00300, 0x0064A, 0x00654,
+	0x00631, 0x00300, 0x0064A, 0x00654, 0x00632, 0x00300, 0x0064A, 0x00654,
+	0x00645, 0x00300, 0x0064A, 0x00654, 0x00646, 0x00300, 0x0064A, 0x00654,
+	0x00649, 0x00300, 0x0064A, 0x00654, 0x0064A, 0x00200, 0x00628, 0x00631,
+	0x00200, 0x00628, 0x00632, 0x00200, 0x00628, 0x00645, 0x00200, 0x00628,
+	0x00646, 0x00200, 0x00628, 0x00649, 0x00200, 0x00628, 0x0064A, 0x00200,
+	0x0062A, 0x00631, 0x00200, 0x0062A, 0x00632, 0x00200, 0x0062A, 0x00645,
+	0x00200, 0x0062A, 0x00646, 0x00200, 0x0062A, 0x00649, 0x00200, 0x0062A,
+	0x0064A, 0x00200, 0x0062B, 0x00631, 0x00200, 0x0062B, 0x00632, 0x00200,
+	0x0062B, 0x00645, 0x00200, 0x0062B, 0x00646, 0x00200, 0x0062B, 0x00649,
+	0x00200, 0x0062B, 0x0064A, 0x00200, 0x00641, 0x00649, 0x00200, 0x00641,
+	0x0064A, 0x00200, 0x00642, 0x00649, 0x00200, 0x00642, 0x0064A, 0x00200,
+	0x00643, 0x00627, 0x00200, 0x00643, 0x00644, 0x00200, 0x00643, 0x00645,
+	0x00200, 0x00643, 0x00649, 0x00200, 0x00643, 0x0064A, 0x00200, 0x00644,
+	0x00645, 0x00200, 0x00644, 0x00649, 0x00200, 0x00644, 0x0064A, 0x00200,
+	0x00645, 0x00627, 0x00200, 0x00645, 0x00645, 0x00200, 0x00646, 0x00631,
+	0x00200, 0x00646, 0x00632, 0x00200, 0x00646, 0x00645, 0x00200, 0x00646,
+	0x00646, 0x00200, 0x00646, 0x00649, 0x00200, 0x00646, 0x0064A, 0x00200,
+	0x00649, 0x00670, 0x00200, 0x0064A, 0x00631, 0x00200, 0x0064A, 0x00632,
+	0x00200, 0x0064A, 0x00645, 0x00200, 0x0064A, 0x00646, 0x00200, 0x0064A,
+	0x00649, 0x00200, 0x0064A, 0x0064A, 0x00300, 0x0064A, 0x00654, 0x0062C,
+	0x00300, 0x0064A, 0x00654, 0x0062D, 0x00300, 0x0064A, 0x00654, 0x0062E,
+	0x00300, 0x0064A, 0x00654, 0x00645, 0x00300, 0x0064A, 0x00654, 0x00647,
+	0x00200, 0x00628, 0x0062C, 0x00200, 0x00628, 0x0062D, 0x00200, 0x00628,
+	0x0062E, 0x00200, 0x00628, 0x00645, 0x00200, 0x00628, 0x00647, 0x00200,
+	0x0062A, 0x0062C, 0x00200, 0x0062A, 0x0062D, 0x00200, 0x0062A, 0x0062E,
+	0x00200, 0x0062A, 0x00645, 0x00200, 0x0062A, 0x00647, 0x00200, 0x0062B,
+	0x00645, 0x00200, 0x0062C, 0x0062D, 0x00200, 0x0062C, 0x00645, 0x00200,
+	0x0062D, 0x0062C, 0x00200, 0x0062D, 0x00645, 0x00200, 0x0062E, 0x0062C,
+	0x00200, 0x0062E, 0x00645, 0x00200, 0x00633, 0x0062C, 0x00200, 0x00633,
+	0x0062D, 0x00200, 0x00633, 0x0062E, 0x00200, 0x00633, 0x00645, 0x00200,
+	0x00635, 0x0062D, 0x00200, 0x00635, 0x0062E, 0x00200, 0x00635, 0x00645,
+	0x00200, 0x00636, 0x0062C, 0x00200, 0x00636, 0x0062D, 0x00200, 0x00636,
+	0x0062E, 0x00200, 0x00636, 0x00645, 0x00200, 0x00637, 0x0062D, 0x00200,
+	0x00638, 0x00645, 0x00200, 0x00639, 0x0062C, 0x00200, 0x00639, 0x00645,
+	0x00200, 0x0063A, 0x0062C, 0x00200, 0x0063A, 0x00645, 0x00200, 0x00641,
+	0x0062C, 0x00200, 0x00641, 0x0062D, 0x00200, 0x00641, 0x0062E, 0x00200,
+	0x00641, 0x00645, 0x00200, 0x00642, 0x0062D, 0x00200, 0x00642, 0x00645,
+	0x00200, 0x00643, 0x0062C, 0x00200, 0x00643, 0x0062D, 0x00200, 0x00643,
+	0x0062E, 0x00200, 0x00643, 0x00644, 0x00200, 0x00643, 0x00645, 0x00200,
+	0x00644, 0x0062C, 0x00200, 0x00644, 0x0062D, 0x00200, 0x00644, 0x0062E,
+	0x00200, 0x00644, 0x00645, 0x00200, 0x00644, 0x00647, 0x00200, 0x00645,
+	0x0062C, 0x00200, 0x00645, 0x0062D, 0x00200, 0x00645, 0x0062E, 0x00200,
+	0x00645, 0x00645, 0x00200, 0x00646, 0x0062C, 0x00200, 0x00646, 0x0062D,
+	0x00200, 0x00646, 0x0062E, 0x00200, 0x00646, 0x00645, 0x00200, 0x00646,
+	0x00647, 0x00200, 0x00647, 0x0062C, 0x00200, 0x00647, 0x00645, 0x00200,
+	0x00647, 0x00670, 0x00200, 0x0064A, 0x0062C, 0x00200, 0x0064A, 0x0062D,
+	0x00200, 0x0064A, 0x0062E, 0x00200, 0x0064A, 0x00645, 0x00200, 0x0064A,
+	0x00647, 0x00300, 0x0064A, 0x00654, 0x00645, 0x00300, 0x0064A, 0x00654,
+	0x00647, 0x00200, 0x00628, 0x00645, 0x00200, 0x00628, 0x00647, 0x00200,
+	0x0062A, 0x00645, 0x00200, 0x0062A, 0x00647, 0x00200, 0x0062B, 0x00645,
+	0x00200, 0x0062B, 0x00647, 0x00200, 0x00633, 0x00645, 0x00200, 0x00633,
+	0x00647, 0x00200, 0x00634, 0x00645, 0x00200, 0x00634, 0x00647, 0x00200,
+	0x00643, 0x00644, 0x00200, 0x00643, 0x00645, 0x00200, 0x00644, 0x00645,
+	0x00200, 0x00646, 0x00645, 0x00200, 0x00646, 0x00647, 0x00200, 0x0064A,
+	0x00645, 0x00200, 0x0064A, 0x00647, 0x00300, 0x00640, 0x0064E, 0x00651,
+	0x00300, 0x00640, 0x0064F, 0x00651, 0x00300, 0x00640, 0x00650, 0x00651,
+	0x00200, 0x00637, 0x00649, 0x00200, 0x00637, 0x0064A, 0x00200, 0x00639,
+	0x00649, 0x00200, 0x00639, 0x0064A, 0x00200, 0x0063A, 0x00649, 0x00200,
+	0x0063A, 0x0064A, 0x00200, 0x00633, 0x00649, 0x00200, 0x00633, 0x0064A,
+	0x00200, 0x00634, 0x00649, 0x00200, 0x00634, 0x0064A, 0x00200, 0x0062D,
+	0x00649, 0x00200, 0x0062D, 0x0064A, 0x00200, 0x0062C, 0x00649, 0x00200,
+	0x0062C, 0x0064A, 0x00200, 0x0062E, 0x00649, 0x00200, 0x0062E, 0x0064A,
+	0x00200, 0x00635, 0x00649, 0x00200, 0x00635, 0x0064A, 0x00200, 0x00636,
+	0x00649, 0x00200, 0x00636, 0x0064A, 0x00200, 0x00634, 0x0062C, 0x00200,
+	0x00634, 0x0062D, 0x00200, 0x00634, 0x0062E, 0x00200, 0x00634, 0x00645,
+	0x00200, 0x00634, 0x00631, 0x00200, 0x00633, 0x00631, 0x00200, 0x00635,
+	0x00631, 0x00200, 0x00636, 0x00631, 0x00200, 0x00637, 0x00649, 0x00200,
+	0x00637, 0x0064A, 0x00200, 0x00639, 0x00649, 0x00200, 0x00639, 0x0064A,
+	0x00200, 0x0063A, 0x00649, 0x00200, 0x0063A, 0x0064A, 0x00200, 0x00633,
+	0x00649, 0x00200, 0x00633, 0x0064A, 0x00200, 0x00634, 0x00649, 0x00200,
+	0x00634, 0x0064A, 0x00200, 0x0062D, 0x00649, 0x00200, 0x0062D, 0x0064A,
+	0x00200, 0x0062C, 0x00649, 0x00200, 0x0062C, 0x0064A, 0x00200, 0x0062E,
+	0x00649, 0x00200, 0x0062E, 0x0064A, 0x00200, 0x00635, 0x00649, 0x00200,
+	0x00635, 0x0064A, 0x00200, 0x00636, 0x00649, 0x00200, 0x00636, 0x0064A,
+	0x00200, 0x00634, 0x0062C, 0x00200, 0x00634, 0x0062D, 0x00200, 0x00634,
+	0x0062E, 0x00200, 0x00634, 0x00645, 0x00200, 0x00634, 0x00631, 0x00200,
+	0x00633, 0x00631, 0x00200, 0x00635, 0x00631, 0x00200, 0x00636, 0x00631,
+	0x00200, 0x00634, 0x0062C, 0x00200, 0x00634, 0x0062D, 0x00200, 0x00634,
+	0x0062E, 0x00200, 0x00634, 0x00645, 0x00200, 0x00633, 0x00647, 0x00200,
+	0x00634, 0x00647, 0x00200, 0x00637, 0x00645, 0x00200, 0x00633, 0x0062C,
+	0x00200, 0x00633, 0x0062D, 0x00200, 0x00633, 0x0062E, 0x00200, 0x00634,
+	0x0062C, 0x00200, 0x00634, 0x0062D, 0x00200, 0x00634, 0x0062E, 0x00200,
+	0x00637, 0x00645, 0x00200, 0x00638, 0x00645, 0x00200, 0x00627, 0x0064B,
+	0x00200, 0x00627, 0x0064B, 0x00300, 0x0062A, 0x0062C, 0x00645, 0x00300,
+	0x0062A, 0x0062D, 0x0062C, 0x00300, 0x0062A, 0x0062D, 0x0062C, 0x00300,
+	0x0062A, 0x0062D, 0x00645, 0x00300, 0x0062A, 0x0062E, 0x00645, 0x00300,
+	0x0062A, 0x00645, 0x0062C, 0x00300, 0x0062A, 0x00645, 0x0062D, 0x00300,
+	0x0062A, 0x00645, 0x0062E, 0x00300, 0x0062C, 0x00645, 0x0062D, 0x00300,
+	0x0062C, 0x00645, 0x0062D, 0x00300, 0x0062D, 0x00645, 0x0064A, 0x00300,
+	0x0062D, 0x00645, 0x00649, 0x00300, 0x00633, 0x0062D, 0x0062C, 0x00300,
+	0x00633, 0x0062C, 0x0062D, 0x00300, 0x00633, 0x0062C, 0x00649, 0x00300,
+	0x00633, 0x00645, 0x0062D, 0x00300, 0x00633, 0x00645, 0x0062D, 0x00300,
+	0x00633, 0x00645, 0x0062C, 0x00300, 0x00633, 0x00645, 0x00645, 0x00300,
+	0x00633, 0x00645, 0x00645, 0x00300, 0x00635, 0x0062D, 0x0062D, 0x00300,
+	0x00635, 0x0062D, 0x0062D, 0x00300, 0x00635, 0x00645, 0x00645, 0x00300,
+	0x00634, 0x0062D, 0x00645, 0x00300, 0x00634, 0x0062D, 0x00645, 0x00300,
+	0x00634, 0x0062C, 0x0064A, 0x00300, 0x00634, 0x00645, 0x0062E, 0x00300,
+	0x00634, 0x00645, 0x0062E, 0x00300, 0x00634, 0x00645, 0x00645, 0x00300,
+	0x00634, 0x00645, 0x00645, 0x00300, 0x00636, 0x0062D, 0x00649, 0x00300,
+	0x00636, 0x0062E, 0x00645, 0x00300, 0x00636, 0x0062E, 0x00645, 0x00300,
+	0x00637, 0x00645, 0x0062D, 0x00300, 0x00637, 0x00645, 0x0062D, 0x00300,
+	0x00637, 0x00645, 0x00645, 0x00300, 0x00637, 0x00645, 0x0064A, 0x00300,
+	0x00639, 0x0062C, 0x00645, 0x00300, 0x00639, 0x00645, 0x00645, 0x00300,
+	0x00639, 0x00645, 0x00645, 0x00300, 0x00639, 0x00645, 0x00649, 0x00300,
+	0x0063A, 0x00645, 0x00645, 0x00300, 0x0063A, 0x00645, 0x0064A, 0x00300,
+	0x0063A, 0x00645, 0x00649, 0x00300, 0x00641, 0x0062E, 0x00645, 0x00300,
+	0x00641, 0x0062E, 0x00645, 0x00300, 0x00642, 0x00645, 0x0062D, 0x00300,
+	0x00642, 0x00645, 0x00645, 0x00300, 0x00644, 0x0062D, 0x00645, 0x00300,
+	0x00644, 0x0062D, 0x0064A, 0x00300, 0x00644, 0x0062D, 0x00649, 0x00300,
+	0x00644, 0x0062C, 0x0062C, 0x00300, 0x00644, 0x0062C, 0x0062C, 0x00300,
+	0x00644, 0x0062E, 0x00645, 0x00300, 0x00644, 0x0062E, 0x00645, 0x00300,
+	0x00644, 0x00645, 0x0062D, 0x00300, 0x00644, 0x00645, 0x0062D, 0x00300,
+	0x00645, 0x0062D, 0x0062C, 0x00300, 0x00645, 0x0062D, 0x00645, 0x00300,
+	0x00645, 0x0062D, 0x0064A, 0x00300, 0x00645, 0x0062C, 0x0062D, 0x00300,
+	0x00645, 0x0062C, 0x00645, 0x00300, 0x00645, 0x0062E, 0x0062C, 0x00300,
+	0x00645, 0x0062E, 0x00645, 0x00300, 0x00645, 0x0062C, 0x0062E, 0x00300,
+	0x00647, 0x00645, 0x0062C, 0x00300, 0x00647, 0x00645, 0x00645, 0x00300,
+	0x00646, 0x0062D, 0x00645, 0x00300, 0x00646, 0x0062D, 0x00649, 0x00300,
+	0x00646, 0x0062C, 0x00645, 0x00300, 0x00646, 0x0062C, 0x00645, 0x00300,
+	0x00646, 0x0062C, 0x00649, 0x00300, 0x00646, 0x00645, 0x0064A, 0x00300,
+	0x00646, 0x00645, 0x00649, 0x00300, 0x0064A, 0x00645, 0x00645, 0x00300,
+	0x0064A, 0x00645, 0x00645, 0x00300, 0x00628, 0x0062E, 0x0064A, 0x00300,
+	0x0062A, 0x0062C, 0x0064A, 0x00300, 0x0062A, 0x0062C, 0x00649, 0x00300,
+	0x0062A, 0x0062E, 0x0064A, 0x00300, 0x0062A, 0x0062E, 0x00649, 0x00300,
+	0x0062A, 0x00645, 0x0064A, 0x00300, 0x0062A, 0x00645, 0x00649, 0x00300,
+	0x0062C, 0x00645, 0x0064A, 0x00300, 0x0062C, 0x0062D, 0x00649, 0x00300,
+	0x0062C, 0x00645, 0x00649, 0x00300, 0x00633, 0x0062E, 0x00649, 0x00300,
+	0x00635, 0x0062D, 0x0064A, 0x00300, 0x00634, 0x0062D, 0x0064A, 0x00300,
+	0x00636, 0x0062D, 0x0064A, 0x00300, 0x00644, 0x0062C, 0x0064A, 0x00300,
+	0x00644, 0x00645, 0x0064A, 0x00300, 0x0064A, 0x0062D, 0x0064A, 0x00300,
+	0x0064A, 0x0062C, 0x0064A, 0x00300, 0x0064A, 0x00645, 0x0064A, 0x00300,
+	0x00645, 0x00645, 0x0064A, 0x00300, 0x00642, 0x00645, 0x0064A, 0x00300,
+	0x00646, 0x0062D, 0x0064A, 0x00300, 0x00642, 0x00645, 0x0062D, 0x00300,
+	0x00644, 0x0062D, 0x00645, 0x00300, 0x00639, 0x00645, 0x0064A, 0x00300,
+	0x00643, 0x00645, 0x0064A, 0x00300, 0x00646, 0x0062C, 0x0062D, 0x00300,
+	0x00645, 0x0062E, 0x0064A, 0x00300, 0x00644, 0x0062C, 0x00645, 0x00300,
+	0x00643, 0x00645, 0x00645, 0x00300, 0x00644, 0x0062C, 0x00645, 0x00300,
+	0x00646, 0x0062C, 0x0062D, 0x00300, 0x0062C, 0x0062D, 0x0064A, 0x00300,
+	0x0062D, 0x0062C, 0x0064A, 0x00300, 0x00645, 0x0062C, 0x0064A, 0x00300,
+	0x00641, 0x00645, 0x0064A, 0x00300, 0x00628, 0x0062D, 0x0064A, 0x00300,
+	0x00643, 0x00645, 0x00645, 0x00300, 0x00639, 0x0062C, 0x00645, 0x00300,
+	0x00635, 0x00645, 0x00645, 0x00300, 0x00633, 0x0062E, 0x0064A, 0x00300,
+	0x00646, 0x0062C, 0x0064A, 0x00300, 0x00635, 0x00644, 0x006D2, 0x00300,
+	0x00642, 0x00644, 0x006D2, 0x00400, 0x00627, 0x00644, 0x00644, 0x00647,
+	0x00400, 0x00627, 0x00643, 0x00628, 0x00631, 0x00400, 0x00645, 0x0062D,
+	0x00645, 0x0062F, 0x00400, 0x00635, 0x00644, 0x00639, 0x00645, 0x00400,
+	0x00631, 0x00633, 0x00648, 0x00644, 0x00400, 0x00639, 0x00644, 0x0064A,
+	0x00647, 0x00400, 0x00648, 0x00633, 0x00644, 0x00645, 0x00300, 0x00635,
+	0x00644, 0x00649, 0x01200, 0x00635, 0x00644, 0x00649, 0x00020, 0x00627,
+	0x00644, 0x00644, 0x00647, 0x00020, 0x00639, 0x00644, 0x0064A, 0x00647,
+	0x00020, 0x00648, 0x00633, 0x00644, 0x00645, 0x00800, 0x0062C, 0x00644,
+	0x00020, 0x0062C, 0x00644, 0x00627, 0x00644, 0x00647, 0x00400, 0x00631,
+	0x006CC, 0x00627, 0x00644, 0x00100, 0x0002C, 0x00100, 0x03001, 0x00100,
+	0x03002, 0x00100, 0x0003A, 0x00100, 0x0003B, 0x00100, 0x00021, 0x00100,
+	0x0003F, 0x00100, 0x03016, 0x00100, 0x03017, 0x00300, 0x0002E, 0x0002E,
+	0x0002E, 0x00200, 0x0002E, 0x0002E, 0x00100, 0x02014, 0x00100, 0x02013,
+	0x00100, 0x0005F, 0x00100, 0x0005F, 0x00100, 0x00028, 0x00100, 0x00029,
+	0x00100, 0x0007B, 0x00100, 0x0007D, 0x00100, 0x03014, 0x00100, 0x03015,
+	0x00100, 0x03010, 0x00100, 0x03011, 0x00100, 0x0300A, 0x00100, 0x0300B,
+	0x00100, 0x03008, 0x00100, 0x03009, 0x00100, 0x0300C, 0x00100, 0x0300D,
+	0x00100, 0x0300E, 0x00100, 0x0300F, 0x00100, 0x0005B, 0x00100, 0x0005D,
+	0x00200, 0x00020, 0x00305, 0x00200, 0x00020, 0x00305, 0x00200, 0x00020,
+	0x00305, 0x00200, 0x00020, 0x00305, 0x00100, 0x0005F, 0x00100, 0x0005F,
+	0x00100, 0x0005F, 0x00100, 0x0002C, 0x00100, 0x03001, 0x00100, 0x0002E,
+	0x00100, 0x0003B, 0x00100, 0x0003A, 0x00100, 0x0003F, 0x00100, 0x00021,
+	0x00100, 0x02014, 0x00100, 0x00028, 0x00100, 0x00029, 0x00100, 0x0007B,
+	0x00100, 0x0007D, 0x00100, 0x03014, 0x00100, 0x03015, 0x00100, 0x00023,
+	0x00100, 0x00026, 0x00100, 0x0002A, 0x00100, 0x0002B, 0x00100, 0x0002D,
+	0x00100, 0x0003C, 0x00100, 0x0003E, 0x00100, 0x0003D, 0x00100, 0x0005C,
+	0x00100, 0x00024, 0x00100, 0x00025, 0x00100, 0x00040, 0x00200, 0x00020,
+	0x0064B, 0x00200, 0x00640, 0x0064B, 0x00200, 0x00020, 0x0064C, 0x00200,
+	0x00020, 0x0064D, 0x00200, 0x00020, 0x0064E, 0x00200, 0x00640, 0x0064E,
+	0x00200, 0x00020, 0x0064F, 0x00200, 0x00640, 0x0064F, 0x00200, 0x00020,
+	0x00650, 0x00200, 0x00640, 0x00650, 0x00200, 0x00020, 0x00651, 0x00200,
+	0x00640, 0x00651, 0x00200, 0x00020, 0x00652, 0x00200, 0x00640, 0x00652,
+	0x00100, 0x00621, 0x00200, 0x00627, 0x00653, 0x00200, 0x00627, 0x00653,
+	0x00200, 0x00627, 0x00654, 0x00200, 0x00627, 0x00654, 0x00200, 0x00648,
+	0x00654, 0x00200, 0x00648, 0x00654, 0x00200, 0x00627, 0x00655, 0x00200,
+	0x00627, 0x00655, 0x00200, 0x0064A, 0x00654, 0x00200, 0x0064A, 0x00654,
+	0x00200, 0x0064A, 0x00654, 0x00200, 0x0064A, 0x00654, 0x00100, 0x00627,
+	0x00100, 0x00627, 0x00100, 0x00628, 0x00100, 0x00628, 0x00100, 0x00628,
+	0x00100, 0x00628, 0x00100, 0x00629, 0x00100, 0x00629, 0x00100, 0x0062A,
+	0x00100, 0x0062A, 0x00100, 0x0062A, 0x00100, 0x0062A, 0x00100, 0x0062B,
+	0x00100, 0x0062B, 0x00100, 0x0062B, 0x00100, 0x0062B, 0x00100, 0x0062C,
+	0x00100, 0x0062C, 0x00100, 0x0062C, 0x00100, 0x0062C, 0x00100, 0x0062D,
+	0x00100, 0x0062D, 0x00100, 0x0062D, 0x00100, 0x0062D, 0x00100, 0x0062E,
+	0x00100, 0x0062E, 0x00100, 0x0062E, 0x00100, 0x0062E, 0x00100, 0x0062F,
+	0x00100, 0x0062F, 0x00100, 0x00630, 0x00100, 0x00630, 0x00100, 0x00631,
+	0x00100, 0x00631, 0x00100, 0x00632, 0x00100, 0x00632, 0x00100, 0x00633,
+	0x00100, 0x00633, 0x00100, 0x00633, 0x00100, 0x00633, 0x00100, 0x00634,
+	0x00100, 0x00634, 0x00100, 0x00634, 0x00100, 0x00634, 0x00100, 0x00635,
+	0x00100, 0x00635, 0x00100, 0x00635, 0x00100, 0x00635, 0x00100, 0x00636,
+	0x00100, 0x00636, 0x00100, 0x00636, 0x00100, 0x00636, 0x00100, 0x00637,
+	0x00100, 0x00637, 0x00100, 0x00637, 0x00100, 0x00637, 0x00100, 0x00638,
+	0x00100, 0x00638, 0x00100, 0x00638, 0x00100, 0x00638, 0x00100, 0x00639,
+	0x00100, 0x00639, 0x00100, 0x00639, 0x00100, 0x00639, 0x00100, 0x0063A,
+	0x00100, 0x0063A, 0x00100, 0x0063A, 0x00100, 0x0063A, 0x00100, 0x00641,
+	0x00100, 0x00641, 0x00100, 0x00641, 0x00100, 0x00641, 0x00100, 0x00642,
+	0x00100, 0x00642, 0x00100, 0x00642, 0x00100, 0x00642, 0x00100, 0x00643,
+	0x00100, 0x00643, 0x00100, 0x00643, 0x00100, 0x00643, 0x00100, 0x00644,
+	0x00100, 0x00644, 0x00100, 0x00644, 0x00100, 0x00644, 0x00100, 0x00645,
+	0x00100, 0x00645, 0x00100, 0x00645, 0x00100, 0x00645, 0x00100, 0x00646,
+	0x00100, 0x00646, 0x00100, 0x00646, 0x00100, 0x00646, 0x00100, 0x00647,
+	0x00100, 0x00647, 0x00100, 0x00647, 0x00100, 0x00647, 0x00100, 0x00648,
+	0x00100, 0x00648, 0x00100, 0x00649, 0x00100, 0x00649, 0x00100, 0x0064A,
+	0x00100, 0x0064A, 0x00100, 0x0064A, 0x00100, 0x0064A, 0x00300, 0x00644,
+	0x00627, 0x00653, 0x00300, 0x00644, 0x00627, 0x00653, 0x00300, 0x00644,
+	0x00627, 0x00654, 0x00300, 0x00644, 0x00627, 0x00654, 0x00300, 0x00644,
+	0x00627, 0x00655, 0x00300, 0x00644, 0x00627, 0x00655, 0x00200, 0x00644,
+	0x00627, 0x00200, 0x00644, 0x00627, 0x00100, 0x00021, 0x00100, 0x00022,
+	0x00100, 0x00023, 0x00100, 0x00024, 0x00100, 0x00025, 0x00100, 0x00026,
+	0x00100, 0x00027, 0x00100, 0x00028, 0x00100, 0x00029, 0x00100, 0x0002A,
+	0x00100, 0x0002B, 0x00100, 0x0002C, 0x00100, 0x0002D, 0x00100, 0x0002E,
+	0x00100, 0x0002F, 0x00100, 0x00030, 0x00100, 0x00031, 0x00100, 0x00032,
+	0x00100, 0x00033, 0x00100, 0x00034, 0x00100, 0x00035, 0x00100, 0x00036,
+	0x00100, 0x00037, 0x00100, 0x00038, 0x00100, 0x00039, 0x00100, 0x0003A,
+	0x00100, 0x0003B, 0x00100, 0x0003C, 0x00100, 0x0003D, 0x00100, 0x0003E,
+	0x00100, 0x0003F, 0x00100, 0x00040, 0x00100, 0x00041, 0x00100, 0x00042,
+	0x00100, 0x00043, 0x00100, 0x00044, 0x00100, 0x00045, 0x00100, 0x00046,
+	0x00100, 0x00047, 0x00100, 0x00048, 0x00100, 0x00049, 0x00100, 0x0004A,
+	0x00100, 0x0004B, 0x00100, 0x0004C, 0x00100, 0x0004D, 0x00100, 0x0004E,
+	0x00100, 0x0004F, 0x00100, 0x00050, 0x00100, 0x00051, 0x00100, 0x00052,
+	0x00100, 0x00053, 0x00100, 0x00054, 0x00100, 0x00055, 0x00100, 0x00056,
+	0x00100, 0x00057, 0x00100, 0x00058, 0x00100, 0x00059, 0x00100, 0x0005A,
+	0x00100, 0x0005B, 0x00100, 0x0005C, 0x00100, 0x0005D, 0x00100, 0x0005E,
+	0x00100, 0x0005F, 0x00100, 0x00060, 0x00100, 0x00061, 0x00100, 0x00062,
+	0x00100, 0x00063, 0x00100, 0x00064, 0x00100, 0x00065, 0x00100, 0x00066,
+	0x00100, 0x00067, 0x00100, 0x00068, 0x00100, 0x00069, 0x00100, 0x0006A,
+	0x00100, 0x0006B, 0x00100, 0x0006C, 0x00100, 0x0006D, 0x00100, 0x0006E,
+	0x00100, 0x0006F, 0x00100, 0x00070, 0x00100, 0x00071, 0x00100, 0x00072,
+	0x00100, 0x00073, 0x00100, 0x00074, 0x00100, 0x00075, 0x00100, 0x00076,
+	0x00100, 0x00077, 0x00100, 0x00078, 0x00100, 0x00079, 0x00100, 0x0007A,
+	0x00100, 0x0007B, 0x00100, 0x0007C, 0x00100, 0x0007D, 0x00100, 0x0007E,
+	0x00100, 0x02985, 0x00100, 0x02986, 0x00100, 0x03002, 0x00100, 0x0300C,
+	0x00100, 0x0300D, 0x00100, 0x03001, 0x00100, 0x030FB, 0x00100, 0x030F2,
+	0x00100, 0x030A1, 0x00100, 0x030A3, 0x00100, 0x030A5, 0x00100, 0x030A7,
+	0x00100, 0x030A9, 0x00100, 0x030E3, 0x00100, 0x030E5, 0x00100, 0x030E7,
+	0x00100, 0x030C3, 0x00100, 0x030FC, 0x00100, 0x030A2, 0x00100, 0x030A4,
+	0x00100, 0x030A6, 0x00100, 0x030A8, 0x00100, 0x030AA, 0x00100, 0x030AB,
+	0x00100, 0x030AD, 0x00100, 0x030AF, 0x00100, 0x030B1, 0x00100, 0x030B3,
+	0x00100, 0x030B5, 0x00100, 0x030B7, 0x00100, 0x030B9, 0x00100, 0x030BB,
+	0x00100, 0x030BD, 0x00100, 0x030BF, 0x00100, 0x030C1, 0x00100, 0x030C4,
+	0x00100, 0x030C6, 0x00100, 0x030C8, 0x00100, 0x030CA, 0x00100, 0x030CB,
+	0x00100, 0x030CC, 0x00100, 0x030CD, 0x00100, 0x030CE, 0x00100, 0x030CF,
+	0x00100, 0x030D2, 0x00100, 0x030D5, 0x00100, 0x030D8, 0x00100, 0x030DB,
+	0x00100, 0x030DE, 0x00100, 0x030DF, 0x00100, 0x030E0, 0x00100, 0x030E1,
+	0x00100, 0x030E2, 0x00100, 0x030E4, 0x00100, 0x030E6, 0x00100, 0x030E8,
+	0x00100, 0x030E9, 0x00100, 0x030EA, 0x00100, 0x030EB, 0x00100, 0x030EC,
+	0x00100, 0x030ED, 0x00100, 0x030EF, 0x00100, 0x030F3, 0x00100, 0x03099,
+	0x00100, 0x0309A, 0x00100, 0x01160, 0x00100, 0x01100, 0x00100, 0x01101,
+	0x00100, 0x011AA, 0x00100, 0x01102, 0x00100, 0x011AC, 0x00100, 0x011AD,
+	0x00100, 0x01103, 0x00100, 0x01104, 0x00100, 0x01105, 0x00100, 0x011B0,
+	0x00100, 0x011B1, 0x00100, 0x011B2, 0x00100, 0x011B3, 0x00100, 0x011B4,
+	0x00100, 0x011B5, 0x00100, 0x0111A, 0x00100, 0x01106, 0x00100, 0x01107,
+	0x00100, 0x01108, 0x00100, 0x01121, 0x00100, 0x01109, 0x00100, 0x0110A,
+	0x00100, 0x0110B, 0x00100, 0x0110C, 0x00100, 0x0110D, 0x00100, 0x0110E,
+	0x00100, 0x0110F, 0x00100, 0x01110, 0x00100, 0x01111, 0x00100, 0x01112,
+	0x00100, 0x01161, 0x00100, 0x01162, 0x00100, 0x01163, 0x00100, 0x01164,
+	0x00100, 0x01165, 0x00100, 0x01166, 0x00100, 0x01167, 0x00100, 0x01168,
+	0x00100, 0x01169, 0x00100, 0x0116A, 0x00100, 0x0116B, 0x00100, 0x0116C,
+	0x00100, 0x0116D, 0x00100, 0x0116E, 0x00100, 0x0116F, 0x00100, 0x01170,
+	0x00100, 0x01171, 0x00100, 0x01172, 0x00100, 0x01173, 0x00100, 0x01174,
+	0x00100, 0x01175, 0x00100, 0x000A2, 0x00100, 0x000A3, 0x00100, 0x000AC,
+	0x00200, 0x00020, 0x00304, 0x00100, 0x000A6, 0x00100, 0x000A5, 0x00100,
+	0x020A9, 0x00100, 0x02502, 0x00100, 0x02190, 0x00100, 0x02191, 0x00100,
+	0x02192, 0x00100, 0x02193, 0x00100, 0x025A0, 0x00100, 0x025CB, 0x00100,
+	0x002D0, 0x00100, 0x002D1, 0x00100, 0x000E6, 0x00100, 0x00299, 0x00100,
+	0x00253, 0x00100, 0x002A3, 0x00100, 0x0AB66, 0x00100, 0x002A5, 0x00100,
+	0x002A4, 0x00100, 0x00256, 0x00100, 0x00257, 0x00100, 0x01D91, 0x00100,
+	0x00258, 0x00100, 0x0025E, 0x00100, 0x002A9, 0x00100, 0x00264, 0x00100,
+	0x00262, 0x00100, 0x00260, 0x00100, 0x0029B, 0x00100, 0x00127, 0x00100,
+	0x0029C, 0x00100, 0x00267, 0x00100, 0x00284, 0x00100, 0x002AA, 0x00100,
+	0x002AB, 0x00100, 0x0026C, 0x00100, 0x1DF04, 0x00100, 0x0A78E, 0x00100,
+	0x0026E, 0x00100, 0x1DF05, 0x00100, 0x0028E, 0x00100, 0x1DF06, 0x00100,
+	0x000F8, 0x00100, 0x00276, 0x00100, 0x00277, 0x00100, 0x00071, 0x00100,
+	0x0027A, 0x00100, 0x1DF08, 0x00100, 0x0027D, 0x00100, 0x0027E, 0x00100,
+	0x00280, 0x00100, 0x002A8, 0x00100, 0x002A6, 0x00100, 0x0AB67, 0x00100,
+	0x002A7, 0x00100, 0x00288, 0x00100, 0x02C71, 0x00100, 0x0028F, 0x00100,
+	0x002A1, 0x00100, 0x002A2, 0x00100, 0x00298, 0x00100, 0x001C0, 0x00100,
+	0x001C1, 0x00100, 0x001C2, 0x00100, 0x1DF0A, 0x00100, 0x1DF1E, 0x00002,
+	0x11099, 0x110BA, 0x00002, 0x1109B, 0x110BA, 0x00002, 0x110A5, 0x110BA,
+	0x00002, 0x11131, 0x11127, 0x00002, 0x11132, 0x11127, 0x00002, 0x11347,
+	0x1133E, 0x00002, 0x11347, 0x11357, 0x00002, 0x114B9, 0x114BA, 0x00002,
+	0x114B9, 0x114B0, 0x00002, 0x114B9, 0x114BD, 0x00002, 0x115B8, 0x115AF,
+	0x00002, 0x115B9, 0x115AF, 0x00002, 0x11935, 0x11930, 0x00002, 0x1D157,
+	0x1D165, 0x00002, 0x1D158, 0x1D165, 0x00003, 0x1D158, 0x1D165, 0x1D16E,
+	0x00003, 0x1D158, 0x1D165, 0x1D16F, 0x00003, 0x1D158, 0x1D165, 0x1D170,
+	0x00003, 0x1D158, 0x1D165, 0x1D171, 0x00003, 0x1D158, 0x1D165, 0x1D172,
+	0x00002, 0x1D1B9, 0x1D165, 0x00002, 0x1D1BA, 0x1D165, 0x00003, 0x1D1B9,
+	0x1D165, 0x1D16E, 0x00003, 0x1D1BA, 0x1D165, 0x1D16E, 0x00003, 0x1D1B9,
+	0x1D165, 0x1D16F, 0x00003, 0x1D1BA, 0x1D165, 0x1D16F, 0x00100, 0x00041,
+	0x00100, 0x00042, 0x00100, 0x00043, 0x00100, 0x00044, 0x00100, 0x00045,
+	0x00100, 0x00046, 0x00100, 0x00047, 0x00100, 0x00048, 0x00100, 0x00049,
+	0x00100, 0x0004A, 0x00100, 0x0004B, 0x00100, 0x0004C, 0x00100, 0x0004D,
+	0x00100, 0x0004E, 0x00100, 0x0004F, 0x00100, 0x00050, 0x00100, 0x00051,
+	0x00100, 0x00052, 0x00100, 0x00053, 0x00100, 0x00054, 0x00100, 0x00055,
+	0x00100, 0x00056, 0x00100, 0x00057, 0x00100, 0x00058, 0x00100, 0x00059,
+	0x00100, 0x0005A, 0x00100, 0x00061, 0x00100, 0x00062, 0x00100, 0x00063,
+	0x00100, 0x00064, 0x00100, 0x00065, 0x00100, 0x00066, 0x00100, 0x00067,
+	0x00100, 0x00068, 0x00100, 0x00069, 0x00100, 0x0006A, 0x00100, 0x0006B,
+	0x00100, 0x0006C, 0x00100, 0x0006D, 0x00100, 0x0006E, 0x00100, 0x0006F,
+	0x00100, 0x00070, 0x00100, 0x00071, 0x00100, 0x00072, 0x00100, 0x00073,
+	0x00100, 0x00074, 0x00100, 0x00075, 0x00100, 0x00076, 0x00100, 0x00077,
+	0x00100, 0x00078, 0x00100, 0x00079, 0x00100, 0x0007A, 0x00100, 0x00041,
+	0x00100, 0x00042, 0x00100, 0x00043, 0x00100, 0x00044, 0x00100, 0x00045,
+	0x00100, 0x00046, 0x00100, 0x00047, 0x00100, 0x00048, 0x00100, 0x00049,
+	0x00100, 0x0004A, 0x00100, 0x0004B, 0x00100, 0x0004C, 0x00100, 0x0004D,
+	0x00100, 0x0004E, 0x00100, 0x0004F, 0x00100, 0x00050, 0x00100, 0x00051,
+	0x00100, 0x00052, 0x00100, 0x00053, 0x00100, 0x00054, 0x00100, 0x00055,
+	0x00100, 0x00056, 0x00100, 0x00057, 0x00100, 0x00058, 0x00100, 0x00059,
+	0x00100, 0x0005A, 0x00100, 0x00061, 0x00100, 0x00062, 0x00100, 0x00063,
+	0x00100, 0x00064, 0x00100, 0x00065, 0x00100, 0x00066, 0x00100, 0x00067,
+	0x00100, 0x00069, 0x00100, 0x0006A, 0x00100, 0x0006B, 0x00100, 0x0006C,
+	0x00100, 0x0006D, 0x00100, 0x0006E, 0x00100, 0x0006F, 0x00100, 0x00070,
+	0x00100, 0x00071, 0x00100, 0x00072, 0x00100, 0x00073, 0x00100, 0x00074,
+	0x00100, 0x00075, 0x00100, 0x00076, 0x00100, 0x00077, 0x00100, 0x00078,
+	0x00100, 0x00079, 0x00100, 0x0007A, 0x00100, 0x00041, 0x00100, 0x00042,
+	0x00100, 0x00043, 0x00100, 0x00044, 0x00100, 0x00045, 0x00100, 0x00046,
+	0x00100, 0x00047, 0x00100, 0x00048, 0x00100, 0x00049, 0x00100, 0x0004A,
+	0x00100, 0x0004B, 0x00100, 0x0004C, 0x00100, 0x0004D, 0x00100, 0x0004E,
+	0x00100, 0x0004F, 0x00100, 0x00050, 0x00100, 0x00051, 0x00100, 0x00052,
+	0x00100, 0x00053, 0x00100, 0x00054, 0x00100, 0x00055, 0x00100, 0x00056,
+	0x00100, 0x00057, 0x00100, 0x00058, 0x00100, 0x00059, 0x00100, 0x0005A,
+	0x00100, 0x00061, 0x00100, 0x00062, 0x00100, 0x00063, 0x00100, 0x00064,
+	0x00100, 0x00065, 0x00100, 0x00066, 0x00100, 0x00067, 0x00100, 0x00068,
+	0x00100, 0x00069, 0x00100, 0x0006A, 0x00100, 0x0006B, 0x00100, 0x0006C,
+	0x00100, 0x0006D, 0x00100, 0x0006E, 0x00100, 0x0006F, 0x00100, 0x00070,
+	0x00100, 0x00071, 0x00100, 0x00072, 0x00100, 0x00073, 0x00100, 0x00074,
+	0x00100, 0x00075, 0x00100, 0x00076, 0x00100, 0x00077, 0x00100, 0x00078,
+	0x00100, 0x00079, 0x00100, 0x0007A, 0x00100, 0x00041, 0x00100, 0x00043,
+	0x00100, 0x00044, 0x00100, 0x00047, 0x00100, 0x0004A, 0x00100, 0x0004B,
+	0x00100, 0x0004E, 0x00100, 0x0004F, 0x00100, 0x00050, 0x00100, 0x00051,
+	0x00100, 0x00053, 0x00100, 0x00054, 0x00100, 0x00055, 0x00100, 0x00056,
+	0x00100, 0x00057, 0x00100, 0x00058, 0x00100, 0x00059, 0x00100, 0x0005A,
+	0x00100, 0x00061, 0x00100, 0x00062, 0x00100, 0x00063, 0x00100, 0x00064,
+	0x00100, 0x00066, 0x00100, 0x00068, 0x00100, 0x00069, 0x00100, 0x0006A,
+	0x00100, 0x0006B, 0x00100, 0x0006C, 0x00100, 0x0006D, 0x00100, 0x0006E,
+	0x00100, 0x00070, 0x00100, 0x00071, 0x00100, 0x00072, 0x00100, 0x00073,
+	0x00100, 0x00074, 0x00100, 0x00075, 0x00100, 0x00076, 0x00100, 0x00077,
+	0x00100, 0x00078, 0x00100, 0x00079, 0x00100, 0x0007A, 0x00100, 0x00041,
+	0x00100, 0x00042, 0x00100, 0x00043, 0x00100, 0x00044, 0x00100, 0x00045,
+	0x00100, 0x00046, 0x00100, 0x00047, 0x00100, 0x00048, 0x00100, 0x00049,
+	0x00100, 0x0004A, 0x00100, 0x0004B, 0x00100, 0x0004C, 0x00100, 0x0004D,
+	0x00100, 0x0004E, 0x00100, 0x0004F, 0x00100, 0x00050, 0x00100, 0x00051,
+	0x00100, 0x00052, 0x00100, 0x00053, 0x00100, 0x00054, 0x00100, 0x00055,
+	0x00100, 0x00056, 0x00100, 0x00057, 0x00100, 0x00058, 0x00100, 0x00059,
+	0x00100, 0x0005A, 0x00100, 0x00061, 0x00100, 0x00062, 0x00100, 0x00063,
+	0x00100, 0x00064, 0x00100, 0x00065, 0x00100, 0x00066, 0x00100, 0x00067,
+	0x00100, 0x00068, 0x00100, 0x00069, 0x00100, 0x0006A, 0x00100, 0x0006B,
+	0x00100, 0x0006C, 0x00100, 0x0006D, 0x00100, 0x0006E, 0x00100, 0x0006F,
+	0x00100, 0x00070, 0x00100, 0x00071, 0x00100, 0x00072, 0x00100, 0x00073,
+	0x00100, 0x00074, 0x00100, 0x00075, 0x00100, 0x00076, 0x00100, 0x00077,
+	0x00100, 0x00078, 0x00100, 0x00079, 0x00100, 0x0007A, 0x00100, 0x00041,
+	0x00100, 0x00042, 0x00100, 0x00044, 0x00100, 0x00045, 0x00100, 0x00046,
+	0x00100, 0x00047, 0x00100, 0x0004A, 0x00100, 0x0004B, 0x00100, 0x0004C,
+	0x00100, 0x0004D, 0x00100, 0x0004E, 0x00100, 0x0004F, 0x00100, 0x00050,
+	0x00100, 0x00051, 0x00100, 0x00053, 0x00100, 0x00054, 0x00100, 0x00055,
+	0x00100, 0x00056, 0x00100, 0x00057, 0x00100, 0x00058, 0x00100, 0x00059,
+	0x00100, 0x00061, 0x00100, 0x00062, 0x00100, 0x00063, 0x00100, 0x00064,
+	0x00100, 0x00065, 0x00100, 0x00066, 0x00100, 0x00067, 0x00100, 0x00068,
+	0x00100, 0x00069, 0x00100, 0x0006A, 0x00100, 0x0006B, 0x00100, 0x0006C,
+	0x00100, 0x0006D, 0x00100, 0x0006E, 0x00100, 0x0006F, 0x00100, 0x00070,
+	0x00100, 0x00071, 0x00100, 0x00072, 0x00100, 0x00073, 0x00100, 0x00074,
+	0x00100, 0x00075, 0x00100, 0x00076, 0x00100, 0x00077, 0x00100, 0x00078,
+	0x00100, 0x00079, 0x00100, 0x0007A, 0x00100, 0x00041, 0x00100, 0x00042,
+	0x00100, 0x00044, 0x00100, 0x00045, 0x00100, 0x00046, 0x00100, 0x00047,
+	0x00100, 0x00049, 0x00100, 0x0004A, 0x00100, 0x0004B, 0x00100, 0x0004C,
+	0x00100, 0x0004D, 0x00100, 0x0004F, 0x00100, 0x00053, 0x00100, 0x00054,
+	0x00100, 0x00055, 0x00100, 0x00056, 0x00100, 0x00057, 0x00100, 0x00058,
+	0x00100, 0x00059, 0x00100, 0x00061, 0x00100, 0x00062, 0x00100, 0x00063,
+	0x00100, 0x00064, 0x00100, 0x00065, 0x00100, 0x00066, 0x00100, 0x00067,
+	0x00100, 0x00068, 0x00100, 0x00069, 0x00100, 0x0006A, 0x00100, 0x0006B,
+	0x00100, 0x0006C, 0x00100, 0x0006D, 0x00100, 0x0006E, 0x00100, 0x0006F,
+	0x00100, 0x00070, 0x00100, 0x00071, 0x00100, 0x00072, 0x00100, 0x00073,
+	0x00100, 0x00074, 0x00100, 0x00075, 0x00100, 0x00076, 0x00100, 0x00077,
+	0x00100, 0x00078, 0x00100, 0x00079, 0x00100, 0x0007A, 0x00100, 0x00041,
+	0x00100, 0x00042, 0x00100, 0x00043, 0x00100, 0x00044, 0x00100, 0x00045,
+	0x00100, 0x00046, 0x00100, 0x00047, 0x00100, 0x00048, 0x00100, 0x00049,
+	0x00100, 0x0004A, 0x00100, 0x0004B, 0x00100, 0x0004C, 0x00100, 0x0004D,
+	0x00100, 0x0004E, 0x00100, 0x0004F, 0x00100, 0x00050, 0x00100, 0x00051,
+	0x00100, 0x00052, 0x00100, 0x00053, 0x00100, 0x00054, 0x00100, 0x00055,
+	0x00100, 0x00056, 0x00100, 0x00057, 0x00100, 0x00058, 0x00100, 0x00059,
+	0x00100, 0x0005A, 0x00100, 0x00061, 0x00100, 0x00062, 0x00100, 0x00063,
+	0x00100, 0x00064, 0x00100, 0x00065, 0x00100, 0x00066, 0x00100, 0x00067,
+	0x00100, 0x00068, 0x00100, 0x00069, 0x00100, 0x0006A, 0x00100, 0x0006B,
+	0x00100, 0x0006C, 0x00100, 0x0006D, 0x00100, 0x0006E, 0x00100, 0x0006F,
+	0x00100, 0x00070, 0x00100, 0x00071, 0x00100, 0x00072, 0x00100, 0x00073,
+	0x00100, 0x00074, 0x00100, 0x00075, 0x00100, 0x00076, 0x00100, 0x00077,
+	0x00100, 0x00078, 0x00100, 0x00079, 0x00100, 0x0007A, 0x00100, 0x00041,
+	0x00100, 0x00042, 0x00100, 0x00043, 0x00100, 0x00044, 0x00100, 0x00045,
+	0x00100, 0x00046, 0x00100, 0x00047, 0x00100, 0x00048, 0x00100, 0x00049,
+	0x00100, 0x0004A, 0x00100, 0x0004B, 0x00100, 0x0004C, 0x00100, 0x0004D,
+	0x00100, 0x0004E, 0x00100, 0x0004F, 0x00100, 0x00050, 0x00100, 0x00051,
+	0x00100, 0x00052, 0x00100, 0x00053, 0x00100, 0x00054, 0x00100, 0x00055,
+	0x00100, 0x00056, 0x00100, 0x00057, 0x00100, 0x00058, 0x00100, 0x00059,
+	0x00100, 0x0005A, 0x00100, 0x00061, 0x00100, 0x00062, 0x00100, 0x00063,
+	0x00100, 0x00064, 0x00100, 0x00065, 0x00100, 0x00066, 0x00100, 0x00067,
+	0x00100, 0x00068, 0x00100, 0x00069, 0x00100, 0x0006A, 0x00100, 0x0006B,
+	0x00100, 0x0006C, 0x00100, 0x0006D, 0x00100, 0x0006E, 0x00100, 0x0006F,
+	0x00100, 0x00070, 0x00100, 0x00071, 0x00100, 0x00072, 0x00100, 0x00073,
+	0x00100, 0x00074, 0x00100, 0x00075, 0x00100, 0x00076, 0x00100, 0x00077,
+	0x00100, 0x00078, 0x00100, 0x00079, 0x00100, 0x0007A, 0x00100, 0x00041,
+	0x00100, 0x00042, 0x00100, 0x00043, 0x00100, 0x00044, 0x00100, 0x00045,
+	0x00100, 0x00046, 0x00100, 0x00047, 0x00100, 0x00048, 0x00100, 0x00049,
+	0x00100, 0x0004A, 0x00100, 0x0004B, 0x00100, 0x0004C, 0x00100, 0x0004D,
+	0x00100, 0x0004E, 0x00100, 0x0004F, 0x00100, 0x00050, 0x00100, 0x00051,
+	0x00100, 0x00052, 0x00100, 0x00053, 0x00100, 0x00054, 0x00100, 0x00055,
+	0x00100, 0x00056, 0x00100, 0x00057, 0x00100, 0x00058, 0x00100, 0x00059,
+	0x00100, 0x0005A, 0x00100, 0x00061, 0x00100, 0x00062, 0x00100, 0x00063,
+	0x00100, 0x00064, 0x00100, 0x00065, 0x00100, 0x00066, 0x00100, 0x00067,
+	0x00100, 0x00068, 0x00100, 0x00069, 0x00100, 0x0006A, 0x00100, 0x0006B,
+	0x00100, 0x0006C, 0x00100, 0x0006D, 0x00100, 0x0006E, 0x00100, 0x0006F,
+	0x00100, 0x00070, 0x00100, 0x00071, 0x00100, 0x00072, 0x00100, 0x00073,
+	0x00100, 0x00074, 0x00100, 0x00075, 0x00100, 0x00076, 0x00100, 0x00077,
+	0x00100, 0x00078, 0x00100, 0x00079, 0x00100, 0x0007A, 0x00100, 0x00041,
+	0x00100, 0x00042, 0x00100, 0x00043, 0x00100, 0x00044, 0x00100, 0x00045,
+	0x00100, 0x00046, 0x00100, 0x00047, 0x00100, 0x00048, 0x00100, 0x00049,
+	0x00100, 0x0004A, 0x00100, 0x0004B, 0x00100, 0x0004C, 0x00100, 0x0004D,
+	0x00100, 0x0004E, 0x00100, 0x0004F, 0x00100, 0x00050, 0x00100, 0x00051,
+	0x00100, 0x00052, 0x00100, 0x00053, 0x00100, 0x00054, 0x00100, 0x00055,
+	0x00100, 0x00056, 0x00100, 0x00057, 0x00100, 0x00058, 0x00100, 0x00059,
+	0x00100, 0x0005A, 0x00100, 0x00061, 0x00100, 0x00062, 0x00100, 0x00063,
+	0x00100, 0x00064, 0x00100, 0x00065, 0x00100, 0x00066, 0x00100, 0x00067,
+	0x00100, 0x00068, 0x00100, 0x00069, 0x00100, 0x0006A, 0x00100, 0x0006B,
+	0x00100, 0x0006C, 0x00100, 0x0006D, 0x00100, 0x0006E, 0x00100, 0x0006F,
+	0x00100, 0x00070, 0x00100, 0x00071, 0x00100, 0x00072, 0x00100, 0x00073,
+	0x00100, 0x00074, 0x00100, 0x00075, 0x00100, 0x00076, 0x00100, 0x00077,
+	0x00100, 0x00078, 0x00100, 0x00079, 0x00100, 0x0007A, 0x00100, 0x00041,
+	0x00100, 0x00042, 0x00100, 0x00043, 0x00100, 0x00044, 0x00100, 0x00045,
+	0x00100, 0x00046, 0x00100, 0x00047, 0x00100, 0x00048, 0x00100, 0x00049,
+	0x00100, 0x0004A, 0x00100, 0x0004B, 0x00100, 0x0004C, 0x00100, 0x0004D,
+	0x00100, 0x0004E, 0x00100, 0x0004F, 0x00100, 0x00050, 0x00100, 0x00051,
+	0x00100, 0x00052, 0x00100, 0x00053, 0x00100, 0x00054, 0x00100, 0x00055,
+	0x00100, 0x00056, 0x00100, 0x00057, 0x00100, 0x00058, 0x00100, 0x00059,
+	0x00100, 0x0005A, 0x00100, 0x00061, 0x00100, 0x00062, 0x00100, 0x00063,
+	0x00100, 0x00064, 0x00100, 0x00065, 0x00100, 0x00066, 0x00100, 0x00067,
+	0x00100, 0x00068, 0x00100, 0x00069, 0x00100, 0x0006A, 0x00100, 0x0006B,
+	0x00100, 0x0006C, 0x00100, 0x0006D, 0x00100, 0x0006E, 0x00100, 0x0006F,
+	0x00100, 0x00070, 0x00100, 0x00071, 0x00100, 0x00072, 0x00100, 0x00073,
+	0x00100, 0x00074, 0x00100, 0x00075, 0x00100, 0x00076, 0x00100, 0x00077,
+	0x00100, 0x00078, 0x00100, 0x00079, 0x00100, 0x0007A, 0x00100, 0x00041,
+	0x00100, 0x00042, 0x00100, 0x00043, 0x00100, 0x00044, 0x00100, 0x00045,
+	0x00100, 0x00046, 0x00100, 0x00047, 0x00100, 0x00048, 0x00100, 0x00049,
+	0x00100, 0x0004A, 0x00100, 0x0004B, 0x00100, 0x0004C, 0x00100, 0x0004D,
+	0x00100, 0x0004E, 0x00100, 0x0004F, 0x00100, 0x00050, 0x00100, 0x00051,
+	0x00100, 0x00052, 0x00100, 0x00053, 0x00100, 0x00054, 0x00100, 0x00055,
+	0x00100, 0x00056, 0x00100, 0x00057, 0x00100, 0x00058, 0x00100, 0x00059,
+	0x00100, 0x0005A, 0x00100, 0x00061, 0x00100, 0x00062, 0x00100, 0x00063,
+	0x00100, 0x00064, 0x00100, 0x00065, 0x00100, 0x00066, 0x00100, 0x00067,
+	0x00100, 0x00068, 0x00100, 0x00069, 0x00100, 0x0006A, 0x00100, 0x0006B,
+	0x00100, 0x0006C, 0x00100, 0x0006D, 0x00100, 0x0006E, 0x00100, 0x0006F,
+	0x00100, 0x00070, 0x00100, 0x00071, 0x00100, 0x00072, 0x00100, 0x00073,
+	0x00100, 0x00074, 0x00100, 0x00075, 0x00100, 0x00076, 0x00100, 0x00077,
+	0x00100, 0x00078, 0x00100, 0x00079, 0x00100, 0x0007A, 0x00100, 0x00131,
+	0x00100, 0x00237, 0x00100, 0x00391, 0x00100, 0x00392, 0x00100, 0x00393,
+	0x00100, 0x00394, 0x00100, 0x00395, 0x00100, 0x00396, 0x00100, 0x00397,
+	0x00100, 0x00398, 0x00100, 0x00399, 0x00100, 0x0039A, 0x00100, 0x0039B,
+	0x00100, 0x0039C, 0x00100, 0x0039D, 0x00100, 0x0039E, 0x00100, 0x0039F,
+	0x00100, 0x003A0, 0x00100, 0x003A1, 0x00100, 0x00398, 0x00100, 0x003A3,
+	0x00100, 0x003A4, 0x00100, 0x003A5, 0x00100, 0x003A6, 0x00100, 0x003A7,
+	0x00100, 0x003A8, 0x00100, 0x003A9, 0x00100, 0x02207, 0x00100, 0x003B1,
+	0x00100, 0x003B2, 0x00100, 0x003B3, 0x00100, 0x003B4, 0x00100, 0x003B5,
+	0x00100, 0x003B6, 0x00100, 0x003B7, 0x00100, 0x003B8, 0x00100, 0x003B9,
+	0x00100, 0x003BA, 0x00100, 0x003BB, 0x00100, 0x003BC, 0x00100, 0x003BD,
+	0x00100, 0x003BE, 0x00100, 0x003BF, 0x00100, 0x003C0, 0x00100, 0x003C1,
+	0x00100, 0x003C2, 0x00100, 0x003C3, 0x00100, 0x003C4, 0x00100, 0x003C5,
+	0x00100, 0x003C6, 0x00100, 0x003C7, 0x00100, 0x003C8, 0x00100, 0x003C9,
+	0x00100, 0x02202, 0x00100, 0x003B5, 0x00100, 0x003B8, 0x00100, 0x003BA,
+	0x00100, 0x003C6, 0x00100, 0x003C1, 0x00100, 0x003C0, 0x00100, 0x00391,
+	0x00100, 0x00392, 0x00100, 0x00393, 0x00100, 0x00394, 0x00100, 0x00395,
+	0x00100, 0x00396, 0x00100, 0x00397, 0x00100, 0x00398, 0x00100, 0x00399,
+	0x00100, 0x0039A, 0x00100, 0x0039B, 0x00100, 0x0039C, 0x00100, 0x0039D,
+	0x00100, 0x0039E, 0x00100, 0x0039F, 0x00100, 0x003A0, 0x00100, 0x003A1,
+	0x00100, 0x00398, 0x00100, 0x003A3, 0x00100, 0x003A4, 0x00100, 0x003A5,
+	0x00100, 0x003A6, 0x00100, 0x003A7, 0x00100, 0x003A8, 0x00100, 0x003A9,
+	0x00100, 0x02207, 0x00100, 0x003B1, 0x00100, 0x003B2, 0x00100, 0x003B3,
+	0x00100, 0x003B4, 0x00100, 0x003B5, 0x00100, 0x003B6, 0x00100, 0x003B7,
+	0x00100, 0x003B8, 0x00100, 0x003B9, 0x00100, 0x003BA, 0x00100, 0x003BB,
+	0x00100, 0x003BC, 0x00100, 0x003BD, 0x00100, 0x003BE, 0x00100, 0x003BF,
+	0x00100, 0x003C0, 0x00100, 0x003C1, 0x00100, 0x003C2, 0x00100, 0x003C3,
+	0x00100, 0x003C4, 0x00100, 0x003C5, 0x00100, 0x003C6, 0x00100, 0x003C7,
+	0x00100, 0x003C8, 0x00100, 0x003C9, 0x00100, 0x02202, 0x00100, 0x003B5,
+	0x00100, 0x003B8, 0x00100, 0x003BA, 0x00100, 0x003C6, 0x00100, 0x003C1,
+	0x00100, 0x003C0, 0x00100, 0x00391, 0x00100, 0x00392, 0x00100, 0x00393,
+	0x00100, 0x00394, 0x00100, 0x00395, 0x00100, 0x00396, 0x00100, 0x00397,
+	0x00100, 0x00398, 0x00100, 0x00399, 0x00100, 0x0039A, 0x00100, 0x0039B,
+	0x00100, 0x0039C, 0x00100, 0x0039D, 0x00100, 0x0039E, 0x00100, 0x0039F,
+	0x00100, 0x003A0, 0x00100, 0x003A1, 0x00100, 0x00398, 0x00100, 0x003A3,
+	0x00100, 0x003A4, 0x00100, 0x003A5, 0x00100, 0x003A6, 0x00100, 0x003A7,
+	0x00100, 0x003A8, 0x00100, 0x003A9, 0x00100, 0x02207, 0x00100, 0x003B1,
+	0x00100, 0x003B2, 0x00100, 0x003B3, 0x00100, 0x003B4, 0x00100, 0x003B5,
+	0x00100, 0x003B6, 0x00100, 0x003B7, 0x00100, 0x003B8, 0x00100, 0x003B9,
+	0x00100, 0x003BA, 0x00100, 0x003BB, 0x00100, 0x003BC, 0x00100, 0x003BD,
+	0x00100, 0x003BE, 0x00100, 0x003BF, 0x00100, 0x003C0, 0x00100, 0x003C1,
+	0x00100, 0x003C2, 0x00100, 0x003C3, 0x00100, 0x003C4, 0x00100, 0x003C5,
+	0x00100, 0x003C6, 0x00100, 0x003C7, 0x00100, 0x003C8, 0x00100, 0x003C9,
+	0x00100, 0x02202, 0x00100, 0x003B5, 0x00100, 0x003B8, 0x00100, 0x003BA,
+	0x00100, 0x003C6, 0x00100, 0x003C1, 0x00100, 0x003C0, 0x00100, 0x00391,
+	0x00100, 0x00392, 0x00100, 0x00393, 0x00100, 0x00394, 0x00100, 0x00395,
+	0x00100, 0x00396, 0x00100, 0x00397, 0x00100, 0x00398, 0x00100, 0x00399,
+	0x00100, 0x0039A, 0x00100, 0x0039B, 0x00100, 0x0039C, 0x00100, 0x0039D,
+	0x00100, 0x0039E, 0x00100, 0x0039F, 0x00100, 0x003A0, 0x00100, 0x003A1,
+	0x00100, 0x00398, 0x00100, 0x003A3, 0x00100, 0x003A4, 0x00100, 0x003A5,
+	0x00100, 0x003A6, 0x00100, 0x003A7, 0x00100, 0x003A8, 0x00100, 0x003A9,
+	0x00100, 0x02207, 0x00100, 0x003B1, 0x00100, 0x003B2, 0x00100, 0x003B3,
+	0x00100, 0x003B4, 0x00100, 0x003B5, 0x00100, 0x003B6, 0x00100, 0x003B7,
+	0x00100, 0x003B8, 0x00100, 0x003B9, 0x00100, 0x003BA, 0x00100, 0x003BB,
+	0x00100, 0x003BC, 0x00100, 0x003BD, 0x00100, 0x003BE, 0x00100, 0x003BF,
+	0x00100, 0x003C0, 0x00100, 0x003C1, 0x00100, 0x003C2, 0x00100, 0x003C3,
+	0x00100, 0x003C4, 0x00100, 0x003C5, 0x00100, 0x003C6, 0x00100, 0x003C7,
+	0x00100, 0x003C8, 0x00100, 0x003C9, 0x00100, 0x02202, 0x00100, 0x003B5,
+	0x00100, 0x003B8, 0x00100, 0x003BA, 0x00100, 0x003C6, 0x00100, 0x003C1,
+	0x00100, 0x003C0, 0x00100, 0x00391, 0x00100, 0x00392, 0x00100, 0x00393,
+	0x00100, 0x00394, 0x00100, 0x00395, 0x00100, 0x00396, 0x00100, 0x00397,
+	0x00100, 0x00398, 0x00100, 0x00399, 0x00100, 0x0039A, 0x00100, 0x0039B,
+	0x00100, 0x0039C, 0x00100, 0x0039D, 0x00100, 0x0039E, 0x00100, 0x0039F,
+	0x00100, 0x003A0, 0x00100, 0x003A1, 0x00100, 0x00398, 0x00100, 0x003A3,
+	0x00100, 0x003A4, 0x00100, 0x003A5, 0x00100, 0x003A6, 0x00100, 0x003A7,
+	0x00100, 0x003A8, 0x00100, 0x003A9, 0x00100, 0x02207, 0x00100, 0x003B1,
+	0x00100, 0x003B2, 0x00100, 0x003B3, 0x00100, 0x003B4, 0x00100, 0x003B5,
+	0x00100, 0x003B6, 0x00100, 0x003B7, 0x00100, 0x003B8, 0x00100, 0x003B9,
+	0x00100, 0x003BA, 0x00100, 0x003BB, 0x00100, 0x003BC, 0x00100, 0x003BD,
+	0x00100, 0x003BE, 0x00100, 0x003BF, 0x00100, 0x003C0, 0x00100, 0x003C1,
+	0x00100, 0x003C2, 0x00100, 0x003C3, 0x00100, 0x003C4, 0x00100, 0x003C5,
+	0x00100, 0x003C6, 0x00100, 0x003C7, 0x00100, 0x003C8, 0x00100, 0x003C9,
+	0x00100, 0x02202, 0x00100, 0x003B5, 0x00100, 0x003B8, 0x00100, 0x003BA,
+	0x00100, 0x003C6, 0x00100, 0x003C1, 0x00100, 0x003C0, 0x00100, 0x003DC,
+	0x00100, 0x003DD, 0x00100, 0x00030, 0x00100, 0x00031, 0x00100, 0x00032,
+	0x00100, 0x00033, 0x00100, 0x00034, 0x00100, 0x00035, 0x00100, 0x00036,
+	0x00100, 0x00037, 0x00100, 0x00038, 0x00100, 0x00039, 0x00100, 0x00030,
+	0x00100, 0x00031, 0x00100, 0x00032, 0x00100, 0x00033, 0x00100, 0x00034,
+	0x00100, 0x00035, 0x00100, 0x00036, 0x00100, 0x00037, 0x00100, 0x00038,
+	0x00100, 0x00039, 0x00100, 0x00030, 0x00100, 0x00031, 0x00100, 0x00032,
+	0x00100, 0x00033, 0x00100, 0x00034, 0x00100, 0x00035, 0x00100, 0x00036,
+	0x00100, 0x00037, 0x00100, 0x00038, 0x00100, 0x00039, 0x00100, 0x00030,
+	0x00100, 0x00031, 0x00100, 0x00032, 0x00100, 0x00033, 0x00100, 0x00034,
+	0x00100, 0x00035, 0x00100, 0x00036, 0x00100, 0x00037, 0x00100, 0x00038,
+	0x00100, 0x00039, 0x00100, 0x00030, 0x00100, 0x00031, 0x00100, 0x00032,
+	0x00100, 0x00033, 0x00100, 0x00034, 0x00100, 0x00035, 0x00100, 0x00036,
+	0x00100, 0x00037, 0x00100, 0x00038, 0x00100, 0x00039, 0x00100, 0x00627,
+	0x00100, 0x00628, 0x00100, 0x0062C, 0x00100, 0x0062F, 0x00100, 0x00648,
+	0x00100, 0x00632, 0x00100, 0x0062D, 0x00100, 0x00637, 0x00100, 0x0064A,
+	0x00100, 0x00643, 0x00100, 0x00644, 0x00100, 0x00645, 0x00100, 0x00646,
+	0x00100, 0x00633, 0x00100, 0x00639, 0x00100, 0x00641, 0x00100, 0x00635,
+	0x00100, 0x00642, 0x00100, 0x00631, 0x00100, 0x00634, 0x00100, 0x0062A,
+	0x00100, 0x0062B, 0x00100, 0x0062E, 0x00100, 0x00630, 0x00100, 0x00636,
+	0x00100, 0x00638, 0x00100, 0x0063A, 0x00100, 0x0066E, 0x00100, 0x006BA,
+	0x00100, 0x006A1, 0x00100, 0x0066F, 0x00100, 0x00628, 0x00100, 0x0062C,
+	0x00100, 0x00647, 0x00100, 0x0062D, 0x00100, 0x0064A, 0x00100, 0x00643,
+	0x00100, 0x00644, 0x00100, 0x00645, 0x00100, 0x00646, 0x00100, 0x00633,
+	0x00100, 0x00639, 0x00100, 0x00641, 0x00100, 0x00635, 0x00100, 0x00642,
+	0x00100, 0x00634, 0x00100, 0x0062A, 0x00100, 0x0062B, 0x00100, 0x0062E,
+	0x00100, 0x00636, 0x00100, 0x0063A, 0x00100, 0x0062C, 0x00100, 0x0062D,
+	0x00100, 0x0064A, 0x00100, 0x00644, 0x00100, 0x00646, 0x00100, 0x00633,
+	0x00100, 0x00639, 0x00100, 0x00635, 0x00100, 0x00642, 0x00100, 0x00634,
+	0x00100, 0x0062E, 0x00100, 0x00636, 0x00100, 0x0063A, 0x00100, 0x006BA,
+	0x00100, 0x0066F, 0x00100, 0x00628, 0x00100, 0x0062C, 0x00100, 0x00647,
+	0x00100, 0x0062D, 0x00100, 0x00637, 0x00100, 0x0064A, 0x00100, 0x00643,
+	0x00100, 0x00645, 0x00100, 0x00646, 0x00100, 0x00633, 0x00100, 0x00639,
+	0x00100, 0x00641, 0x00100, 0x00635, 0x00100, 0x00642, 0x00100, 0x00634,
+	0x00100, 0x0062A, 0x00100, 0x0062B, 0x00100, 0x0062E, 0x00100, 0x00636,
+	0x00100, 0x00638, 0x00100, 0x0063A, 0x00100, 0x0066E, 0x00100, 0x006A1,
+	0x00100, 0x00627, 0x00100, 0x00628, 0x00100, 0x0062C, 0x00100, 0x0062F,
+	0x00100, 0x00647, 0x00100, 0x00648, 0x00100, 0x00632, 0x00100, 0x0062D,
+	0x00100, 0x00637, 0x00100, 0x0064A, 0x00100, 0x00644, 0x00100, 0x00645,
+	0x00100, 0x00646, 0x00100, 0x00633, 0x00100, 0x00639, 0x00100, 0x00641,
+	0x00100, 0x00635, 0x00100, 0x00642, 0x00100, 0x00631, 0x00100, 0x00634,
+	0x00100, 0x0062A, 0x00100, 0x0062B, 0x00100, 0x0062E, 0x00100, 0x00630,
+	0x00100, 0x00636, 0x00100, 0x00638, 0x00100, 0x0063A, 0x00100, 0x00628,
+	0x00100, 0x0062C, 0x00100, 0x0062F, 0x00100, 0x00648, 0x00100, 0x00632,
+	0x00100, 0x0062D, 0x00100, 0x00637, 0x00100, 0x0064A, 0x00100, 0x00644,
+	0x00100, 0x00645, 0x00100, 0x00646, 0x00100, 0x00633, 0x00100, 0x00639,
+	0x00100, 0x00641, 0x00100, 0x00635, 0x00100, 0x00642, 0x00100, 0x00631,
+	0x00100, 0x00634, 0x00100, 0x0062A, 0x00100, 0x0062B, 0x00100, 0x0062E,
+	0x00100, 0x00630, 0x00100, 0x00636, 0x00100, 0x00638, 0x00100, 0x0063A,
+	0x00200, 0x00030, 0x0002E, 0x00200, 0x00030, 0x0002C, 0x00200, 0x00031,
+	0x0002C, 0x00200, 0x00032, 0x0002C, 0x00200, 0x00033, 0x0002C, 0x00200,
+	0x00034, 0x0002C, 0x00200, 0x00035, 0x0002C, 0x00200, 0x00036, 0x0002C,
+	0x00200, 0x00037, 0x0002C, 0x00200, 0x00038, 0x0002C, 0x00200, 0x00039,
+	0x0002C, 0x00300, 0x00028, 0x00041, 0x00029, 0x00300, 0x00028, 0x00042,
+	0x00029, 0x00300, 0x00028, 0x00043, 0x00029, 0x00300, 0x00028, 0x00044,
+	0x00029, 0x00300, 0x00028, 0x00045, 0x00029, 0x00300, 0x00028, 0x00046,
+	0x00029, 0x00300, 0x00028, 0x00047, 0x00029, 0x00300, 0x00028, 0x00048,
+	0x00029, 0x00300, 0x00028, 0x00049, 0x00029, 0x00300, 0x00028, 0x0004A,
+	0x00029, 0x00300, 0x00028, 0x0004B, 0x00029, 0x00300, 0x00028, 0x0004C,
+	0x00029, 0x00300, 0x00028, 0x0004D, 0x00029, 0x00300, 0x00028, 0x0004E,
+	0x00029, 0x00300, 0x00028, 0x0004F, 0x00029, 0x00300, 0x00028, 0x00050,
+	0x00029, 0x00300, 0x00028, 0x00051, 0x00029, 0x00300, 0x00028, 0x00052,
+	0x00029, 0x00300, 0x00028, 0x00053, 0x00029, 0x00300, 0x00028, 0x00054,
+	0x00029, 0x00300, 0x00028, 0x00055, 0x00029, 0x00300, 0x00028, 0x00056,
+	0x00029, 0x00300, 0x00028, 0x00057, 0x00029, 0x00300, 0x00028, 0x00058,
+	0x00029, 0x00300, 0x00028, 0x00059, 0x00029, 0x00300, 0x00028, 0x0005A,
+	0x00029, 0x00300, 0x03014, 0x00053, 0x03015, 0x00100, 0x00043, 0x00100,
+	0x00052, 0x00200, 0x00043, 0x00044, 0x00200, 0x00057, 0x0005A, 0x00100,
+	0x00041, 0x00100, 0x00042, 0x00100, 0x00043, 0x00100, 0x00044, 0x00100,
+	0x00045, 0x00100, 0x00046, 0x00100, 0x00047, 0x00100, 0x00048, 0x00100,
+	0x00049, 0x00100, 0x0004A, 0x00100, 0x0004B, 0x00100, 0x0004C, 0x00100,
+	0x0004D, 0x00100, 0x0004E, 0x00100, 0x0004F, 0x00100, 0x00050, 0x00100,
+	0x00051, 0x00100, 0x00052, 0x00100, 0x00053, 0x00100, 0x00054, 0x00100,
+	0x00055, 0x00100, 0x00056, 0x00100, 0x00057, 0x00100, 0x00058, 0x00100,
+	0x00059, 0x00100, 0x0005A, 0x00200, 0x00048, 0x00056, 0x00200, 0x0004D,
+	0x00056, 0x00200, 0x00053, 0x00044, 0x00200, 0x00053, 0x00053, 0x00300,
+	0x00050, 0x00050, 0x00056, 0x00200, 0x00057, 0x00043, 0x00200, 0x0004D,
+	0x00043, 0x00200, 0x0004D, 0x00044, 0x00200, 0x0004D, 0x00052, 0x00200,
+	0x00044, 0x0004A, 0x00200, 0x0307B, 0x0304B, 0x00200, 0x030B3, 0x030B3,
+	0x00100, 0x030B5, 0x00100, 0x0624B, 0x00100, 0x05B57, 0x00100, 0x053CC,
+	0x00200, 0x030C6, 0x03099, 0x00100, 0x04E8C, 0x00100, 0x0591A, 0x00100,
+	0x089E3, 0x00100, 0x05929, 0x00100, 0x04EA4, 0x00100, 0x06620, 0x00100,
+	0x07121, 0x00100, 0x06599, 0x00100, 0x0524D, 0x00100, 0x05F8C, 0x00100,
+	0x0518D, 0x00100, 0x065B0, 0x00100, 0x0521D, 0x00100, 0x07D42, 0x00100,
+	0x0751F, 0x00100, 0x08CA9, 0x00100, 0x058F0, 0x00100, 0x05439, 0x00100,
+	0x06F14, 0x00100, 0x06295, 0x00100, 0x06355, 0x00100, 0x04E00, 0x00100,
+	0x04E09, 0x00100, 0x0904A, 0x00100, 0x05DE6, 0x00100, 0x04E2D, 0x00100,
+	0x053F3, 0x00100, 0x06307, 0x00100, 0x08D70, 0x00100, 0x06253, 0x00100,
+	0x07981, 0x00100, 0x07A7A, 0x00100, 0x05408, 0x00100, 0x06E80, 0x00100,
+	0x06709, 0x00100, 0x06708, 0x00100, 0x07533, 0x00100, 0x05272, 0x00100,
+	0x055B6, 0x00100, 0x0914D, 0x00300, 0x03014, 0x0672C, 0x03015, 0x00300,
+	0x03014, 0x04E09, 0x03015, 0x00300, 0x03014, 0x04E8C, 0x03015, 0x00300,
+	0x03014, 0x05B89, 0x03015, 0x00300, 0x03014, 0x070B9, 0x03015, 0x00300,
+	0x03014, 0x06253, 0x03015, 0x00300, 0x03014, 0x076D7, 0x03015, 0x00300,
+	0x03014, 0x052DD, 0x03015, 0x00300, 0x03014, 0x06557, 0x03015, 0x00100,
+	0x05F97, 0x00100, 0x053EF, 0x00100, 0x00030, 0x00100, 0x00031, 0x00100,
+	0x00032, 0x00100, 0x00033, 0x00100, 0x00034, 0x00100, 0x00035, 0x00100,
+	0x00036, 0x00100, 0x00037, 0x00100, 0x00038, 0x00100, 0x00039, 0x00001,
+	0x04E3D, 0x00001, 0x04E38, 0x00001, 0x04E41, 0x00001, 0x20122, 0x00001,
+	0x04F60, 0x00001, 0x04FAE, 0x00001, 0x04FBB, 0x00001, 0x05002, 0x00001,
+	0x0507A, 0x00001, 0x05099, 0x00001, 0x050E7, 0x00001, 0x050CF, 0x00001,
+	0x0349E, 0x00001, 0x2063A, 0x00001, 0x0514D, 0x00001, 0x05154, 0x00001,
+	0x05164, 0x00001, 0x05177, 0x00001, 0x2051C, 0x00001, 0x034B9, 0x00001,
+	0x05167, 0x00001, 0x0518D, 0x00001, 0x2054B, 0x00001, 0x05197, 0x00001,
+	0x051A4, 0x00001, 0x04ECC, 0x00001, 0x051AC, 0x00001, 0x051B5, 0x00001,
+	0x291DF, 0x00001, 0x051F5, 0x00001, 0x05203, 0x00001, 0x034DF, 0x00001,
+	0x0523B, 0x00001, 0x05246, 0x00001, 0x05272, 0x00001, 0x05277, 0x00001,
+	0x03515, 0x00001, 0x052C7, 0x00001, 0x052C9, 0x00001, 0x052E4, 0x00001,
+	0x052FA, 0x00001, 0x05305, 0x00001, 0x05306, 0x00001, 0x05317, 0x00001,
+	0x05349, 0x00001, 0x05351, 0x00001, 0x0535A, 0x00001, 0x05373, 0x00001,
+	0x0537D, 0x00001, 0x0537F, 0x00001, 0x0537F, 0x00001, 0x0537F, 0x00001,
+	0x20A2C, 0x00001, 0x07070, 0x00001, 0x053CA, 0x00001, 0x053DF, 0x00001,
+	0x20B63, 0x00001, 0x053EB, 0x00001, 0x053F1, 0x00001, 0x05406, 0x00001,
+	0x0549E, 0x00001, 0x05438, 0x00001, 0x05448, 0x00001, 0x05468, 0x00001,
+	0x054A2, 0x00001, 0x054F6, 0x00001, 0x05510, 0x00001, 0x05553, 0x00001,
+	0x05563, 0x00001, 0x05584, 0x00001, 0x05584, 0x00001, 0x05599, 0x00001,
+	0x055AB, 0x00001, 0x055B3, 0x00001, 0x055C2, 0x00001, 0x05716, 0x00001,
+	0x05606, 0x00001, 0x05717, 0x00001, 0x05651, 0x00001, 0x05674, 0x00001,
+	0x05207, 0x00001, 0x058EE, 0x00001, 0x057CE, 0x00001, 0x057F4, 0x00001,
+	0x0580D, 0x00001, 0x0578B, 0x00001, 0x05832, 0x00001, 0x05831, 0x00001,
+	0x058AC, 0x00001, 0x214E4, 0x00001, 0x058F2, 0x00001, 0x058F7, 0x00001,
+	0x05906, 0x00001, 0x0591A, 0x00001, 0x05922, 0x00001, 0x05962, 0x00001,
+	0x216A8, 0x00001, 0x216EA, 0x00001, 0x059EC, 0x00001, 0x05A1B, 0x00001,
+	0x05A27, 0x00001, 0x059D8, 0x00001, 0x05A66, 0x00001, 0x036EE, 0x00001,
+	0x036FC, 0x00001, 0x05B08, 0x00001, 0x05B3E, 0x00001, 0x05B3E, 0x00001,
+	0x219C8, 0x00001, 0x05BC3, 0x00001, 0x05BD8, 0x00001, 0x05BE7, 0x00001,
+	0x05BF3, 0x00001, 0x21B18, 0x00001, 0x05BFF, 0x00001, 0x05C06, 0x00001,
+	0x05F53, 0x00001, 0x05C22, 0x00001, 0x03781, 0x00001, 0x05C60, 0x00001,
+	0x05C6E, 0x00001, 0x05CC0, 0x00001, 0x05C8D, 0x00001, 0x21DE4, 0x00001,
+	0x05D43, 0x00001, 0x21DE6, 0x00001, 0x05D6E, 0x00001, 0x05D6B, 0x00001,
+	0x05D7C, 0x00001, 0x05DE1, 0x00001, 0x05DE2, 0x00001, 0x0382F, 0x00001,
+	0x05DFD, 0x00001, 0x05E28, 0x00001, 0x05E3D, 0x00001, 0x05E69, 0x00001,
+	0x03862, 0x00001, 0x22183, 0x00001, 0x0387C, 0x00001, 0x05EB0, 0x00001,
+	0x05EB3, 0x00001, 0x05EB6, 0x00001, 0x05ECA, 0x00001, 0x2A392, 0x00001,
+	0x05EFE, 0x00001, 0x22331, 0x00001, 0x22331, 0x00001, 0x08201, 0x00001,
+	0x05F22, 0x00001, 0x05F22, 0x00001, 0x038C7, 0x00001, 0x232B8, 0x00001,
+	0x261DA, 0x00001, 0x05F62, 0x00001, 0x05F6B, 0x00001, 0x038E3, 0x00001,
+	0x05F9A, 0x00001, 0x05FCD, 0x00001, 0x05FD7, 0x00001, 0x05FF9, 0x00001,
+	0x06081, 0x00001, 0x0393A, 0x00001, 0x0391C, 0x00001, 0x06094, 0x00001,
+	0x226D4, 0x00001, 0x060C7, 0x00001, 0x06148, 0x00001, 0x0614C, 0x00001,
+	0x0614E, 0x00001, 0x0614C, 0x00001, 0x0617A, 0x00001, 0x0618E, 0x00001,
+	0x061B2, 0x00001, 0x061A4, 0x00001, 0x061AF, 0x00001, 0x061DE, 0x00001,
+	0x061F2, 0x00001, 0x061F6, 0x00001, 0x06210, 0x00001, 0x0621B, 0x00001,
+	0x0625D, 0x00001, 0x062B1, 0x00001, 0x062D4, 0x00001, 0x06350, 0x00001,
+	0x22B0C, 0x00001, 0x0633D, 0x00001, 0x062FC, 0x00001, 0x06368, 0x00001,
+	0x06383, 0x00001, 0x063E4, 0x00001, 0x22BF1, 0x00001, 0x06422, 0x00001,
+	0x063C5, 0x00001, 0x063A9, 0x00001, 0x03A2E, 0x00001, 0x06469, 0x00001,
+	0x0647E, 0x00001, 0x0649D, 0x00001, 0x06477, 0x00001, 0x03A6C, 0x00001,
+	0x0654F, 0x00001, 0x0656C, 0x00001, 0x2300A, 0x00001, 0x065E3, 0x00001,
+	0x066F8, 0x00001, 0x06649, 0x00001, 0x03B19, 0x00001, 0x06691, 0x00001,
+	0x03B08, 0x00001, 0x03AE4, 0x00001, 0x05192, 0x00001, 0x05195, 0x00001,
+	0x06700, 0x00001, 0x0669C, 0x00001, 0x080AD, 0x00001, 0x043D9, 0x00001,
+	0x06717, 0x00001, 0x0671B, 0x00001, 0x06721, 0x00001, 0x0675E, 0x00001,
+	0x06753, 0x00001, 0x233C3, 0x00001, 0x03B49, 0x00001, 0x067FA, 0x00001,
+	0x06785, 0x00001, 0x06852, 0x00001, 0x06885, 0x00001, 0x2346D, 0x00001,
+	0x0688E, 0x00001, 0x0681F, 0x00001, 0x06914, 0x00001, 0x03B9D, 0x00001,
+	0x06942, 0x00001, 0x069A3, 0x00001, 0x069EA, 0x00001, 0x06AA8, 0x00001,
+	0x236A3, 0x00001, 0x06ADB, 0x00001, 0x03C18, 0x00001, 0x06B21, 0x00001,
+	0x238A7, 0x00001, 0x06B54, 0x00001, 0x03C4E, 0x00001, 0x06B72, 0x00001,
+	0x06B9F, 0x00001, 0x06BBA, 0x00001, 0x06BBB, 0x00001, 0x23A8D, 0x00001,
+	0x21D0B, 0x00001, 0x23AFA, 0x00001, 0x06C4E, 0x00001, 0x23CBC, 0x00001,
+	0x06CBF, 0x00001, 0x06CCD, 0x00001, 0x06C67, 0x00001, 0x06D16, 0x00001,
+	0x06D3E, 0x00001, 0x06D77, 0x00001, 0x06D41, 0x00001, 0x06D69, 0x00001,
+	0x06D78, 0x00001, 0x06D85, 0x00001, 0x23D1E, 0x00001, 0x06D34, 0x00001,
+	0x06E2F, 0x00001, 0x06E6E, 0x00001, 0x03D33, 0x00001, 0x06ECB, 0x00001,
+	0x06EC7, 0x00001, 0x23ED1, 0x00001, 0x06DF9, 0x00001, 0x06F6E, 0x00001,
+	0x23F5E, 0x00001, 0x23F8E, 0x00001, 0x06FC6, 0x00001, 0x07039, 0x00001,
+	0x0701E, 0x00001, 0x0701B, 0x00001, 0x03D96, 0x00001, 0x0704A, 0x00001,
+	0x0707D, 0x00001, 0x07077, 0x00001, 0x070AD, 0x00001, 0x20525, 0x00001,
+	0x07145, 0x00001, 0x24263, 0x00001, 0x0719C, 0x00001, 0x243AB, 0x00001,
+	0x07228, 0x00001, 0x07235, 0x00001, 0x07250, 0x00001, 0x24608, 0x00001,
+	0x07280, 0x00001, 0x07295, 0x00001, 0x24735, 0x00001, 0x24814, 0x00001,
+	0x0737A, 0x00001, 0x0738B, 0x00001, 0x03EAC, 0x00001, 0x073A5, 0x00001,
+	0x03EB8, 0x00001, 0x03EB8, 0x00001, 0x07447, 0x00001, 0x0745C, 0x00001,
+	0x07471, 0x00001, 0x07485, 0x00001, 0x074CA, 0x00001, 0x03F1B, 0x00001,
+	0x07524, 0x00001, 0x24C36, 0x00001, 0x0753E, 0x00001, 0x24C92, 0x00001,
+	0x07570, 0x00001, 0x2219F, 0x00001, 0x07610, 0x00001, 0x24FA1, 0x00001,
+	0x24FB8, 0x00001, 0x25044, 0x00001, 0x03FFC, 0x00001, 0x04008, 0x00001,
+	0x076F4, 0x00001, 0x250F3, 0x00001, 0x250F2, 0x00001, 0x25119, 0x00001,
+	0x25133, 0x00001, 0x0771E, 0x00001, 0x0771F, 0x00001, 0x0771F, 0x00001,
+	0x0774A, 0x00001, 0x04039, 0x00001, 0x0778B, 0x00001, 0x04046, 0x00001,
+	0x04096, 0x00001, 0x2541D, 0x00001, 0x0784E, 0x00001, 0x0788C, 0x00001,
+	0x078CC, 0x00001, 0x040E3, 0x00001, 0x25626, 0x00001, 0x07956, 0x00001,
+	0x2569A, 0x00001, 0x256C5, 0x00001, 0x0798F, 0x00001, 0x079EB, 0x00001,
+	0x0412F, 0x00001, 0x07A40, 0x00001, 0x07A4A, 0x00001, 0x07A4F, 0x00001,
+	0x2597C, 0x00001, 0x25AA7, 0x00001, 0x25AA7, 0x00001, 0x07AEE, 0x00001,
+	0x04202, 0x00001, 0x25BAB, 0x00001, 0x07BC6, 0x00001, 0x07BC9, 0x00001,
+	0x04227, 0x00001, 0x25C80, 0x00001, 0x07CD2, 0x00001, 0x042A0, 0x00001,
+	0x07CE8, 0x00001, 0x07CE3, 0x00001, 0x07D00, 0x00001, 0x25F86, 0x00001,
+	0x07D63, 0x00001, 0x04301, 0x00001, 0x07DC7, 0x00001, 0x07E02, 0x00001,
+	0x07E45, 0x00001, 0x04334, 0x00001, 0x26228, 0x00001, 0x26247, 0x00001,
+	0x04359, 0x00001, 0x262D9, 0x00001, 0x07F7A, 0x00001, 0x2633E, 0x00001,
+	0x07F95, 0x00001, 0x07FFA, 0x00001, 0x08005, 0x00001, 0x264DA, 0x00001,
+	0x26523, 0x00001, 0x08060, 0x00001, 0x265A8, 0x00001, 0x08070, 0x00001,
+	0x2335F, 0x00001, 0x043D5, 0x00001, 0x080B2, 0x00001, 0x08103, 0x00001,
+	0x0440B, 0x00001, 0x0813E, 0x00001, 0x05AB5, 0x00001, 0x267A7, 0x00001,
+	0x267B5, 0x00001, 0x23393, 0x00001, 0x2339C, 0x00001, 0x08201, 0x00001,
+	0x08204, 0x00001, 0x08F9E, 0x00001, 0x0446B, 0x00001, 0x08291, 0x00001,
+	0x0828B, 0x00001, 0x0829D, 0x00001, 0x052B3, 0x00001, 0x082B1, 0x00001,
+	0x082B3, 0x00001, 0x082BD, 0x00001, 0x082E6, 0x00001, 0x26B3C, 0x00001,
+	0x082E5, 0x00001, 0x0831D, 0x00001, 0x08363, 0x00001, 0x083AD, 0x00001,
+	0x08323, 0x00001, 0x083BD, 0x00001, 0x083E7, 0x00001, 0x08457, 0x00001,
+	0x08353, 0x00001, 0x083CA, 0x00001, 0x083CC, 0x00001, 0x083DC, 0x00001,
+	0x26C36, 0x00001, 0x26D6B, 0x00001, 0x26CD5, 0x00001, 0x0452B, 0x00001,
+	0x084F1, 0x00001, 0x084F3, 0x00001, 0x08516, 0x00001, 0x273CA, 0x00001,
+	0x08564, 0x00001, 0x26F2C, 0x00001, 0x0455D, 0x00001, 0x04561, 0x00001,
+	0x26FB1, 0x00001, 0x270D2, 0x00001, 0x0456B, 0x00001, 0x08650, 0x00001,
+	0x0865C, 0x00001, 0x08667, 0x00001, 0x08669, 0x00001, 0x086A9, 0x00001,
+	0x08688, 0x00001, 0x0870E, 0x00001, 0x086E2, 0x00001, 0x08779, 0x00001,
+	0x08728, 0x00001, 0x0876B, 0x00001, 0x08786, 0x00001, 0x045D7, 0x00001,
+	0x087E1, 0x00001, 0x08801, 0x00001, 0x045F9, 0x00001, 0x08860, 0x00001,
+	0x08863, 0x00001, 0x27667, 0x00001, 0x088D7, 0x00001, 0x088DE, 0x00001,
+	0x04635, 0x00001, 0x088FA, 0x00001, 0x034BB, 0x00001, 0x278AE, 0x00001,
+	0x27966, 0x00001, 0x046BE, 0x00001, 0x046C7, 0x00001, 0x08AA0, 0x00001,
+	0x08AED, 0x00001, 0x08B8A, 0x00001, 0x08C55, 0x00001, 0x27CA8, 0x00001,
+	0x08CAB, 0x00001, 0x08CC1, 0x00001, 0x08D1B, 0x00001, 0x08D77, 0x00001,
+	0x27F2F, 0x00001, 0x20804, 0x00001, 0x08DCB, 0x00001, 0x08DBC, 0x00001,
+	0x08DF0, 0x00001, 0x208DE, 0x00001, 0x08ED4, 0x00001, 0x08F38, 0x00001,
+	0x285D2, 0x00001, 0x285ED, 0x00001, 0x09094, 0x00001, 0x090F1, 0x00001,
+	0x09111, 0x00001, 0x2872E, 0x00001, 0x0911B, 0x00001, 0x09238, 0x00001,
+	0x092D7, 0x00001, 0x092D8, 0x00001, 0x0927C, 0x00001, 0x093F9, 0x00001,
+	0x09415, 0x00001, 0x28BFA, 0x00001, 0x0958B, 0x00001, 0x04995, 0x00001,
+	0x095B7, 0x00001, 0x28D77, 0x00001, 0x049E6, 0x00001, 0x096C3, 0x00001,
+	0x05DB2, 0x00001, 0x09723, 0x00001, 0x29145, 0x00001, 0x2921A, 0x00001,
+	0x04A6E, 0x00001, 0x04A76, 0x00001, 0x097E0, 0x00001, 0x2940A, 0x00001,
+	0x04AB2, 0x00001, 0x29496, 0x00001, 0x0980B, 0x00001, 0x0980B, 0x00001,
+	0x09829, 0x00001, 0x295B6, 0x00001, 0x098E2, 0x00001, 0x04B33, 0x00001,
+	0x09929, 0x00001, 0x099A7, 0x00001, 0x099C2, 0x00001, 0x099FE, 0x00001,
+	0x04BCE, 0x00001, 0x29B30, 0x00001, 0x09B12, 0x00001, 0x09C40, 0x00001,
+	0x09CFD, 0x00001, 0x04CCE, 0x00001, 0x04CED, 0x00001, 0x09D67, 0x00001,
+	0x2A0CE, 0x00001, 0x04CF8, 0x00001, 0x2A105, 0x00001, 0x2A20E, 0x00001,
+	0x2A291, 0x00001, 0x09EBB, 0x00001, 0x04D56, 0x00001, 0x09EF9, 0x00001,
+	0x09EFE, 0x00001, 0x09F05, 0x00001, 0x09F0F, 0x00001, 0x09F16, 0x00001,
+	0x09F3B, 0x00001, 0x2A600,
+};
+
+
+const char32_t
+NORM_compositions [941][3] =
+{
+	{	0x0003C, 0x00338, 0x0226E	},
+	{	0x0003D, 0x00338, 0x02260	},
+	{	0x0003E, 0x00338, 0x0226F	},
+	{	0x00041, 0x00300, 0x000C0	},
+	{	0x00041, 0x00301, 0x000C1	},
+	{	0x00041, 0x00302, 0x000C2	},
+	{	0x00041, 0x00303, 0x000C3	},
+	{	0x00041, 0x00304, 0x00100	},
+	{	0x00041, 0x00306, 0x00102	},
+	{	0x00041, 0x00307, 0x00226	},
+	{	0x00041, 0x00308, 0x000C4	},
+	{	0x00041, 0x00309, 0x01EA2	},
+	{	0x00041, 0x0030A, 0x000C5	},
+	{	0x00041, 0x0030C, 0x001CD	},
+	{	0x00041, 0x0030F, 0x00200	},
+	{	0x00041, 0x00311, 0x00202	},
+	{	0x00041, 0x00323, 0x01EA0	},
+	{	0x00041, 0x00325, 0x01E00	},
+	{	0x00041, 0x00328, 0x00104	},
+	{	0x00042, 0x00307, 0x01E02	},
+	{	0x00042, 0x00323, 0x01E04	},
+	{	0x00042, 0x00331, 0x01E06	},
+	{	0x00043, 0x00301, 0x00106	},
+	{	0x00043, 0x00302, 0x00108	},
+	{	0x00043, 0x00307, 0x0010A	},
+	{	0x00043, 0x0030C, 0x0010C	},
+	{	0x00043, 0x00327, 0x000C7	},
+	{	0x00044, 0x00307, 0x01E0A	},
+	{	0x00044, 0x0030C, 0x0010E	},
+	{	0x00044, 0x00323, 0x01E0C	},
+	{	0x00044, 0x00327, 0x01E10	},
+	{	0x00044, 0x0032D, 0x01E12	},
+	{	0x00044, 0x00331, 0x01E0E	},
+	{	0x00045, 0x00300, 0x000C8	},
+	{	0x00045, 0x00301, 0x000C9	},
+	{	0x00045, 0x00302, 0x000CA	},
+	{	0x00045, 0x00303, 0x01EBC	},
+	{	0x00045, 0x00304, 0x00112	},
+	{	0x00045, 0x00306, 0x00114	},
+	{	0x00045, 0x00307, 0x00116	},
+	{	0x00045, 0x00308, 0x000CB	},
+	{	0x00045, 0x00309, 0x01EBA	},
+	{	0x00045, 0x0030C, 0x0011A	},
+	{	0x00045, 0x0030F, 0x00204	},
+	{	0x00045, 0x00311, 0x00206	},
+	{	0x00045, 0x00323, 0x01EB8	},
+	{	0x00045, 0x00327, 0x00228	},
+	{	0x00045, 0x00328, 0x00118	},
+	{	0x00045, 0x0032D, 0x01E18	},
+	{	0x00045, 0x00330, 0x01E1A	},
+	{	0x00046, 0x00307, 0x01E1E	},
+	{	0x00047, 0x00301, 0x001F4	},
+	{	0x00047, 0x00302, 0x0011C	},
+	{	0x00047, 0x00304, 0x01E20	},
+	{	0x00047, 0x00306, 0x0011E	},
+	{	0x00047, 0x00307, 0x00120	},
+	{	0x00047, 0x0030C, 0x001E6	},
+	{	0x00047, 0x00327, 0x00122	},
+	{	0x00048, 0x00302, 0x00124	},
+	{	0x00048, 0x00307, 0x01E22	},
+	{	0x00048, 0x00308, 0x01E26	},
+	{	0x00048, 0x0030C, 0x0021E	},
+	{	0x00048, 0x00323, 0x01E24	},
+	{	0x00048, 0x00327, 0x01E28	},
+	{	0x00048, 0x0032E, 0x01E2A	},
+	{	0x00049, 0x00300, 0x000CC	},
+	{	0x00049, 0x00301, 0x000CD	},
+	{	0x00049, 0x00302, 0x000CE	},
+	{	0x00049, 0x00303, 0x00128	},
+	{	0x00049, 0x00304, 0x0012A	},
+	{	0x00049, 0x00306, 0x0012C	},
+	{	0x00049, 0x00307, 0x00130	},
+	{	0x00049, 0x00308, 0x000CF	},
+	{	0x00049, 0x00309, 0x01EC8	},
+	{	0x00049, 0x0030C, 0x001CF	},
+	{	0x00049, 0x0030F, 0x00208	},
+	{	0x00049, 0x00311, 0x0020A	},
+	{	0x00049, 0x00323, 0x01ECA	},
+	{	0x00049, 0x00328, 0x0012E	},
+	{	0x00049, 0x00330, 0x01E2C	},
+	{	0x0004A, 0x00302, 0x00134	},
+	{	0x0004B, 0x00301, 0x01E30	},
+	{	0x0004B, 0x0030C, 0x001E8	},
+	{	0x0004B, 0x00323, 0x01E32	},
+	{	0x0004B, 0x00327, 0x00136	},
+	{	0x0004B, 0x00331, 0x01E34	},
+	{	0x0004C, 0x00301, 0x00139	},
+	{	0x0004C, 0x0030C, 0x0013D	},
+	{	0x0004C, 0x00323, 0x01E36	},
+	{	0x0004C, 0x00327, 0x0013B	},
+	{	0x0004C, 0x0032D, 0x01E3C	},
+	{	0x0004C, 0x00331, 0x01E3A	},
+	{	0x0004D, 0x00301, 0x01E3E	},
+	{	0x0004D, 0x00307, 0x01E40	},
+	{	0x0004D, 0x00323, 0x01E42	},
+	{	0x0004E, 0x00300, 0x001F8	},
+	{	0x0004E, 0x00301, 0x00143	},
+	{	0x0004E, 0x00303, 0x000D1	},
+	{	0x0004E, 0x00307, 0x01E44	},
+	{	0x0004E, 0x0030C, 0x00147	},
+	{	0x0004E, 0x00323, 0x01E46	},
+	{	0x0004E, 0x00327, 0x00145	},
+	{	0x0004E, 0x0032D, 0x01E4A	},
+	{	0x0004E, 0x00331, 0x01E48	},
+	{	0x0004F, 0x00300, 0x000D2	},
+	{	0x0004F, 0x00301, 0x000D3	},
+	{	0x0004F, 0x00302, 0x000D4	},
+	{	0x0004F, 0x00303, 0x000D5	},
+	{	0x0004F, 0x00304, 0x0014C	},
+	{	0x0004F, 0x00306, 0x0014E	},
+	{	0x0004F, 0x00307, 0x0022E	},
+	{	0x0004F, 0x00308, 0x000D6	},
+	{	0x0004F, 0x00309, 0x01ECE	},
+	{	0x0004F, 0x0030B, 0x00150	},
+	{	0x0004F, 0x0030C, 0x001D1	},
+	{	0x0004F, 0x0030F, 0x0020C	},
+	{	0x0004F, 0x00311, 0x0020E	},
+	{	0x0004F, 0x0031B, 0x001A0	},
+	{	0x0004F, 0x00323, 0x01ECC	},
+	{	0x0004F, 0x00328, 0x001EA	},
+	{	0x00050, 0x00301, 0x01E54	},
+	{	0x00050, 0x00307, 0x01E56	},
+	{	0x00052, 0x00301, 0x00154	},
+	{	0x00052, 0x00307, 0x01E58	},
+	{	0x00052, 0x0030C, 0x00158	},
+	{	0x00052, 0x0030F, 0x00210	},
+	{	0x00052, 0x00311, 0x00212	},
+	{	0x00052, 0x00323, 0x01E5A	},
+	{	0x00052, 0x00327, 0x00156	},
+	{	0x00052, 0x00331, 0x01E5E	},
+	{	0x00053, 0x00301, 0x0015A	},
+	{	0x00053, 0x00302, 0x0015C	},
+	{	0x00053, 0x00307, 0x01E60	},
+	{	0x00053, 0x0030C, 0x00160	},
+	{	0x00053, 0x00323, 0x01E62	},
+	{	0x00053, 0x00326, 0x00218	},
+	{	0x00053, 0x00327, 0x0015E	},
+	{	0x00054, 0x00307, 0x01E6A	},
+	{	0x00054, 0x0030C, 0x00164	},
+	{	0x00054, 0x00323, 0x01E6C	},
+	{	0x00054, 0x00326, 0x0021A	},
+	{	0x00054, 0x00327, 0x00162	},
+	{	0x00054, 0x0032D, 0x01E70	},
+	{	0x00054, 0x00331, 0x01E6E	},
+	{	0x00055, 0x00300, 0x000D9	},
+	{	0x00055, 0x00301, 0x000DA	},
+	{	0x00055, 0x00302, 0x000DB	},
+	{	0x00055, 0x00303, 0x00168	},
+	{	0x00055, 0x00304, 0x0016A	},
+	{	0x00055, 0x00306, 0x0016C	},
+	{	0x00055, 0x00308, 0x000DC	},
+	{	0x00055, 0x00309, 0x01EE6	},
+	{	0x00055, 0x0030A, 0x0016E	},
+	{	0x00055, 0x0030B, 0x00170	},
+	{	0x00055, 0x0030C, 0x001D3	},
+	{	0x00055, 0x0030F, 0x00214	},
+	{	0x00055, 0x00311, 0x00216	},
+	{	0x00055, 0x0031B, 0x001AF	},
+	{	0x00055, 0x00323, 0x01EE4	},
+	{	0x00055, 0x00324, 0x01E72	},
+	{	0x00055, 0x00328, 0x00172	},
+	{	0x00055, 0x0032D, 0x01E76	},
+	{	0x00055, 0x00330, 0x01E74	},
+	{	0x00056, 0x00303, 0x01E7C	},
+	{	0x00056, 0x00323, 0x01E7E	},
+	{	0x00057, 0x00300, 0x01E80	},
+	{	0x00057, 0x00301, 0x01E82	},
+	{	0x00057, 0x00302, 0x00174	},
+	{	0x00057, 0x00307, 0x01E86	},
+	{	0x00057, 0x00308, 0x01E84	},
+	{	0x00057, 0x00323, 0x01E88	},
+	{	0x00058, 0x00307, 0x01E8A	},
+	{	0x00058, 0x00308, 0x01E8C	},
+	{	0x00059, 0x00300, 0x01EF2	},
+	{	0x00059, 0x00301, 0x000DD	},
+	{	0x00059, 0x00302, 0x00176	},
+	{	0x00059, 0x00303, 0x01EF8	},
+	{	0x00059, 0x00304, 0x00232	},
+	{	0x00059, 0x00307, 0x01E8E	},
+	{	0x00059, 0x00308, 0x00178	},
+	{	0x00059, 0x00309, 0x01EF6	},
+	{	0x00059, 0x00323, 0x01EF4	},
+	{	0x0005A, 0x00301, 0x00179	},
+	{	0x0005A, 0x00302, 0x01E90	},
+	{	0x0005A, 0x00307, 0x0017B	},
+	{	0x0005A, 0x0030C, 0x0017D	},
+	{	0x0005A, 0x00323, 0x01E92	},
+	{	0x0005A, 0x00331, 0x01E94	},
+	{	0x00061, 0x00300, 0x000E0	},
+	{	0x00061, 0x00301, 0x000E1	},
+	{	0x00061, 0x00302, 0x000E2	},
+	{	0x00061, 0x00303, 0x000E3	},
+	{	0x00061, 0x00304, 0x00101	},
+	{	0x00061, 0x00306, 0x00103	},
+	{	0x00061, 0x00307, 0x00227	},
+	{	0x00061, 0x00308, 0x000E4	},
+	{	0x00061, 0x00309, 0x01EA3	},
+	{	0x00061, 0x0030A, 0x000E5	},
+	{	0x00061, 0x0030C, 0x001CE	},
+	{	0x00061, 0x0030F, 0x00201	},
+	{	0x00061, 0x00311, 0x00203	},
+	{	0x00061, 0x00323, 0x01EA1	},
+	{	0x00061, 0x00325, 0x01E01	},
+	{	0x00061, 0x00328, 0x00105	},
+	{	0x00062, 0x00307, 0x01E03	},
+	{	0x00062, 0x00323, 0x01E05	},
+	{	0x00062, 0x00331, 0x01E07	},
+	{	0x00063, 0x00301, 0x00107	},
+	{	0x00063, 0x00302, 0x00109	},
+	{	0x00063, 0x00307, 0x0010B	},
+	{	0x00063, 0x0030C, 0x0010D	},
+	{	0x00063, 0x00327, 0x000E7	},
+	{	0x00064, 0x00307, 0x01E0B	},
+	{	0x00064, 0x0030C, 0x0010F	},
+	{	0x00064, 0x00323, 0x01E0D	},
+	{	0x00064, 0x00327, 0x01E11	},
+	{	0x00064, 0x0032D, 0x01E13	},
+	{	0x00064, 0x00331, 0x01E0F	},
+	{	0x00065, 0x00300, 0x000E8	},
+	{	0x00065, 0x00301, 0x000E9	},
+	{	0x00065, 0x00302, 0x000EA	},
+	{	0x00065, 0x00303, 0x01EBD	},
+	{	0x00065, 0x00304, 0x00113	},
+	{	0x00065, 0x00306, 0x00115	},
+	{	0x00065, 0x00307, 0x00117	},
+	{	0x00065, 0x00308, 0x000EB	},
+	{	0x00065, 0x00309, 0x01EBB	},
+	{	0x00065, 0x0030C, 0x0011B	},
+	{	0x00065, 0x0030F, 0x00205	},
+	{	0x00065, 0x00311, 0x00207	},
+	{	0x00065, 0x00323, 0x01EB9	},
+	{	0x00065, 0x00327, 0x00229	},
+	{	0x00065, 0x00328, 0x00119	},
+	{	0x00065, 0x0032D, 0x01E19	},
+	{	0x00065, 0x00330, 0x01E1B	},
+	{	0x00066, 0x00307, 0x01E1F	},
+	{	0x00067, 0x00301, 0x001F5	},
+	{	0x00067, 0x00302, 0x0011D	},
+	{	0x00067, 0x00304, 0x01E21	},
+	{	0x00067, 0x00306, 0x0011F	},
+	{	0x00067, 0x00307, 0x00121	},
+	{	0x00067, 0x0030C, 0x001E7	},
+	{	0x00067, 0x00327, 0x00123	},
+	{	0x00068, 0x00302, 0x00125	},
+	{	0x00068, 0x00307, 0x01E23	},
+	{	0x00068, 0x00308, 0x01E27	},
+	{	0x00068, 0x0030C, 0x0021F	},
+	{	0x00068, 0x00323, 0x01E25	},
+	{	0x00068, 0x00327, 0x01E29	},
+	{	0x00068, 0x0032E, 0x01E2B	},
+	{	0x00068, 0x00331, 0x01E96	},
+	{	0x00069, 0x00300, 0x000EC	},
+	{	0x00069, 0x00301, 0x000ED	},
+	{	0x00069, 0x00302, 0x000EE	},
+	{	0x00069, 0x00303, 0x00129	},
+	{	0x00069, 0x00304, 0x0012B	},
+	{	0x00069, 0x00306, 0x0012D	},
+	{	0x00069, 0x00308, 0x000EF	},
+	{	0x00069, 0x00309, 0x01EC9	},
+	{	0x00069, 0x0030C, 0x001D0	},
+	{	0x00069, 0x0030F, 0x00209	},
+	{	0x00069, 0x00311, 0x0020B	},
+	{	0x00069, 0x00323, 0x01ECB	},
+	{	0x00069, 0x00328, 0x0012F	},
+	{	0x00069, 0x00330, 0x01E2D	},
+	{	0x0006A, 0x00302, 0x00135	},
+	{	0x0006A, 0x0030C, 0x001F0	},
+	{	0x0006B, 0x00301, 0x01E31	},
+	{	0x0006B, 0x0030C, 0x001E9	},
+	{	0x0006B, 0x00323, 0x01E33	},
+	{	0x0006B, 0x00327, 0x00137	},
+	{	0x0006B, 0x00331, 0x01E35	},
+	{	0x0006C, 0x00301, 0x0013A	},
+	{	0x0006C, 0x0030C, 0x0013E	},
+	{	0x0006C, 0x00323, 0x01E37	},
+	{	0x0006C, 0x00327, 0x0013C	},
+	{	0x0006C, 0x0032D, 0x01E3D	},
+	{	0x0006C, 0x00331, 0x01E3B	},
+	{	0x0006D, 0x00301, 0x01E3F	},
+	{	0x0006D, 0x00307, 0x01E41	},
+	{	0x0006D, 0x00323, 0x01E43	},
+	{	0x0006E, 0x00300, 0x001F9	},
+	{	0x0006E, 0x00301, 0x00144	},
+	{	0x0006E, 0x00303, 0x000F1	},
+	{	0x0006E, 0x00307, 0x01E45	},
+	{	0x0006E, 0x0030C, 0x00148	},
+	{	0x0006E, 0x00323, 0x01E47	},
+	{	0x0006E, 0x00327, 0x00146	},
+	{	0x0006E, 0x0032D, 0x01E4B	},
+	{	0x0006E, 0x00331, 0x01E49	},
+	{	0x0006F, 0x00300, 0x000F2	},
+	{	0x0006F, 0x00301, 0x000F3	},
+	{	0x0006F, 0x00302, 0x000F4	},
+	{	0x0006F, 0x00303, 0x000F5	},
+	{	0x0006F, 0x00304, 0x0014D	},
+	{	0x0006F, 0x00306, 0x0014F	},
+	{	0x0006F, 0x00307, 0x0022F	},
+	{	0x0006F, 0x00308, 0x000F6	},
+	{	0x0006F, 0x00309, 0x01ECF	},
+	{	0x0006F, 0x0030B, 0x00151	},
+	{	0x0006F, 0x0030C, 0x001D2	},
+	{	0x0006F, 0x0030F, 0x0020D	},
+	{	0x0006F, 0x00311, 0x0020F	},
+	{	0x0006F, 0x0031B, 0x001A1	},
+	{	0x0006F, 0x00323, 0x01ECD	},
+	{	0x0006F, 0x00328, 0x001EB	},
+	{	0x00070, 0x00301, 0x01E55	},
+	{	0x00070, 0x00307, 0x01E57	},
+	{	0x00072, 0x00301, 0x00155	},
+	{	0x00072, 0x00307, 0x01E59	},
+	{	0x00072, 0x0030C, 0x00159	},
+	{	0x00072, 0x0030F, 0x00211	},
+	{	0x00072, 0x00311, 0x00213	},
+	{	0x00072, 0x00323, 0x01E5B	},
+	{	0x00072, 0x00327, 0x00157	},
+	{	0x00072, 0x00331, 0x01E5F	},
+	{	0x00073, 0x00301, 0x0015B	},
+	{	0x00073, 0x00302, 0x0015D	},
+	{	0x00073, 0x00307, 0x01E61	},
+	{	0x00073, 0x0030C, 0x00161	},
+	{	0x00073, 0x00323, 0x01E63	},
+	{	0x00073, 0x00326, 0x00219	},
+	{	0x00073, 0x00327, 0x0015F	},
+	{	0x00074, 0x00307, 0x01E6B	},
+	{	0x00074, 0x00308, 0x01E97	},
+	{	0x00074, 0x0030C, 0x00165	},
+	{	0x00074, 0x00323, 0x01E6D	},
+	{	0x00074, 0x00326, 0x0021B	},
+	{	0x00074, 0x00327, 0x00163	},
+	{	0x00074, 0x0032D, 0x01E71	},
+	{	0x00074, 0x00331, 0x01E6F	},
+	{	0x00075, 0x00300, 0x000F9	},
+	{	0x00075, 0x00301, 0x000FA	},
+	{	0x00075, 0x00302, 0x000FB	},
+	{	0x00075, 0x00303, 0x00169	},
+	{	0x00075, 0x00304, 0x0016B	},
+	{	0x00075, 0x00306, 0x0016D	},
+	{	0x00075, 0x00308, 0x000FC	},
+	{	0x00075, 0x00309, 0x01EE7	},
+	{	0x00075, 0x0030A, 0x0016F	},
+	{	0x00075, 0x0030B, 0x00171	},
+	{	0x00075, 0x0030C, 0x001D4	},
+	{	0x00075, 0x0030F, 0x00215	},
+	{	0x00075, 0x00311, 0x00217	},
+	{	0x00075, 0x0031B, 0x001B0	},
+	{	0x00075, 0x00323, 0x01EE5	},
+	{	0x00075, 0x00324, 0x01E73	},
+	{	0x00075, 0x00328, 0x00173	},
+	{	0x00075, 0x0032D, 0x01E77	},
+	{	0x00075, 0x00330, 0x01E75	},
+	{	0x00076, 0x00303, 0x01E7D	},
+	{	0x00076, 0x00323, 0x01E7F	},
+	{	0x00077, 0x00300, 0x01E81	},
+	{	0x00077, 0x00301, 0x01E83	},
+	{	0x00077, 0x00302, 0x00175	},
+	{	0x00077, 0x00307, 0x01E87	},
+	{	0x00077, 0x00308, 0x01E85	},
+	{	0x00077, 0x0030A, 0x01E98	},
+	{	0x00077, 0x00323, 0x01E89	},
+	{	0x00078, 0x00307, 0x01E8B	},
+	{	0x00078, 0x00308, 0x01E8D	},
+	{	0x00079, 0x00300, 0x01EF3	},
+	{	0x00079, 0x00301, 0x000FD	},
+	{	0x00079, 0x00302, 0x00177	},
+	{	0x00079, 0x00303, 0x01EF9	},
+	{	0x00079, 0x00304, 0x00233	},
+	{	0x00079, 0x00307, 0x01E8F	},
+	{	0x00079, 0x00308, 0x000FF	},
+	{	0x00079, 0x00309, 0x01EF7	},
+	{	0x00079, 0x0030A, 0x01E99	},
+	{	0x00079, 0x00323, 0x01EF5	},
+	{	0x0007A, 0x00301, 0x0017A	},
+	{	0x0007A, 0x00302, 0x01E91	},
+	{	0x0007A, 0x00307, 0x0017C	},
+	{	0x0007A, 0x0030C, 0x0017E	},
+	{	0x0007A, 0x00323, 0x01E93	},
+	{	0x0007A, 0x00331, 0x01E95	},
+	{	0x000A8, 0x00300, 0x01FED	},
+	{	0x000A8, 0x00301, 0x00385	},
+	{	0x000A8, 0x00342, 0x01FC1	},
+	{	0x000C2, 0x00300, 0x01EA6	},
+	{	0x000C2, 0x00301, 0x01EA4	},
+	{	0x000C2, 0x00303, 0x01EAA	},
+	{	0x000C2, 0x00309, 0x01EA8	},
+	{	0x000C4, 0x00304, 0x001DE	},
+	{	0x000C5, 0x00301, 0x001FA	},
+	{	0x000C6, 0x00301, 0x001FC	},
+	{	0x000C6, 0x00304, 0x001E2	},
+	{	0x000C7, 0x00301, 0x01E08	},
+	{	0x000CA, 0x00300, 0x01EC0	},
+	{	0x000CA, 0x00301, 0x01EBE	},
+	{	0x000CA, 0x00303, 0x01EC4	},
+	{	0x000CA, 0x00309, 0x01EC2	},
+	{	0x000CF, 0x00301, 0x01E2E	},
+	{	0x000D4, 0x00300, 0x01ED2	},
+	{	0x000D4, 0x00301, 0x01ED0	},
+	{	0x000D4, 0x00303, 0x01ED6	},
+	{	0x000D4, 0x00309, 0x01ED4	},
+	{	0x000D5, 0x00301, 0x01E4C	},
+	{	0x000D5, 0x00304, 0x0022C	},
+	{	0x000D5, 0x00308, 0x01E4E	},
+	{	0x000D6, 0x00304, 0x0022A	},
+	{	0x000D8, 0x00301, 0x001FE	},
+	{	0x000DC, 0x00300, 0x001DB	},
+	{	0x000DC, 0x00301, 0x001D7	},
+	{	0x000DC, 0x00304, 0x001D5	},
+	{	0x000DC, 0x0030C, 0x001D9	},
+	{	0x000E2, 0x00300, 0x01EA7	},
+	{	0x000E2, 0x00301, 0x01EA5	},
+	{	0x000E2, 0x00303, 0x01EAB	},
+	{	0x000E2, 0x00309, 0x01EA9	},
+	{	0x000E4, 0x00304, 0x001DF	},
+	{	0x000E5, 0x00301, 0x001FB	},
+	{	0x000E6, 0x00301, 0x001FD	},
+	{	0x000E6, 0x00304, 0x001E3	},
+	{	0x000E7, 0x00301, 0x01E09	},
+	{	0x000EA, 0x00300, 0x01EC1	},
+	{	0x000EA, 0x00301, 0x01EBF	},
+	{	0x000EA, 0x00303, 0x01EC5	},
+	{	0x000EA, 0x00309, 0x01EC3	},
+	{	0x000EF, 0x00301, 0x01E2F	},
+	{	0x000F4, 0x00300, 0x01ED3	},
+	{	0x000F4, 0x00301, 0x01ED1	},
+	{	0x000F4, 0x00303, 0x01ED7	},
+	{	0x000F4, 0x00309, 0x01ED5	},
+	{	0x000F5, 0x00301, 0x01E4D	},
+	{	0x000F5, 0x00304, 0x0022D	},
+	{	0x000F5, 0x00308, 0x01E4F	},
+	{	0x000F6, 0x00304, 0x0022B	},
+	{	0x000F8, 0x00301, 0x001FF	},
+	{	0x000FC, 0x00300, 0x001DC	},
+	{	0x000FC, 0x00301, 0x001D8	},
+	{	0x000FC, 0x00304, 0x001D6	},
+	{	0x000FC, 0x0030C, 0x001DA	},
+	{	0x00102, 0x00300, 0x01EB0	},
+	{	0x00102, 0x00301, 0x01EAE	},
+	{	0x00102, 0x00303, 0x01EB4	},
+	{	0x00102, 0x00309, 0x01EB2	},
+	{	0x00103, 0x00300, 0x01EB1	},
+	{	0x00103, 0x00301, 0x01EAF	},
+	{	0x00103, 0x00303, 0x01EB5	},
+	{	0x00103, 0x00309, 0x01EB3	},
+	{	0x00112, 0x00300, 0x01E14	},
+	{	0x00112, 0x00301, 0x01E16	},
+	{	0x00113, 0x00300, 0x01E15	},
+	{	0x00113, 0x00301, 0x01E17	},
+	{	0x0014C, 0x00300, 0x01E50	},
+	{	0x0014C, 0x00301, 0x01E52	},
+	{	0x0014D, 0x00300, 0x01E51	},
+	{	0x0014D, 0x00301, 0x01E53	},
+	{	0x0015A, 0x00307, 0x01E64	},
+	{	0x0015B, 0x00307, 0x01E65	},
+	{	0x00160, 0x00307, 0x01E66	},
+	{	0x00161, 0x00307, 0x01E67	},
+	{	0x00168, 0x00301, 0x01E78	},
+	{	0x00169, 0x00301, 0x01E79	},
+	{	0x0016A, 0x00308, 0x01E7A	},
+	{	0x0016B, 0x00308, 0x01E7B	},
+	{	0x0017F, 0x00307, 0x01E9B	},
+	{	0x001A0, 0x00300, 0x01EDC	},
+	{	0x001A0, 0x00301, 0x01EDA	},
+	{	0x001A0, 0x00303, 0x01EE0	},
+	{	0x001A0, 0x00309, 0x01EDE	},
+	{	0x001A0, 0x00323, 0x01EE2	},
+	{	0x001A1, 0x00300, 0x01EDD	},
+	{	0x001A1, 0x00301, 0x01EDB	},
+	{	0x001A1, 0x00303, 0x01EE1	},
+	{	0x001A1, 0x00309, 0x01EDF	},
+	{	0x001A1, 0x00323, 0x01EE3	},
+	{	0x001AF, 0x00300, 0x01EEA	},
+	{	0x001AF, 0x00301, 0x01EE8	},
+	{	0x001AF, 0x00303, 0x01EEE	},
+	{	0x001AF, 0x00309, 0x01EEC	},
+	{	0x001AF, 0x00323, 0x01EF0	},
+	{	0x001B0, 0x00300, 0x01EEB	},
+	{	0x001B0, 0x00301, 0x01EE9	},
+	{	0x001B0, 0x00303, 0x01EEF	},
+	{	0x001B0, 0x00309, 0x01EED	},
+	{	0x001B0, 0x00323, 0x01EF1	},
+	{	0x001B7, 0x0030C, 0x001EE	},
+	{	0x001EA, 0x00304, 0x001EC	},
+	{	0x001EB, 0x00304, 0x001ED	},
+	{	0x00226, 0x00304, 0x001E0	},
+	{	0x00227, 0x00304, 0x001E1	},
+	{	0x00228, 0x00306, 0x01E1C	},
+	{	0x00229, 0x00306, 0x01E1D	},
+	{	0x0022E, 0x00304, 0x00230	},
+	{	0x0022F, 0x00304, 0x00231	},
+	{	0x00292, 0x0030C, 0x001EF	},
+	{	0x00391, 0x00300, 0x01FBA	},
+	{	0x00391, 0x00301, 0x00386	},
+	{	0x00391, 0x00304, 0x01FB9	},
+	{	0x00391, 0x00306, 0x01FB8	},
+	{	0x00391, 0x00313, 0x01F08	},
+	{	0x00391, 0x00314, 0x01F09	},
+	{	0x00391, 0x00345, 0x01FBC	},
+	{	0x00395, 0x00300, 0x01FC8	},
+	{	0x00395, 0x00301, 0x00388	},
+	{	0x00395, 0x00313, 0x01F18	},
+	{	0x00395, 0x00314, 0x01F19	},
+	{	0x00397, 0x00300, 0x01FCA	},
+	{	0x00397, 0x00301, 0x00389	},
+	{	0x00397, 0x00313, 0x01F28	},
+	{	0x00397, 0x00314, 0x01F29	},
+	{	0x00397, 0x00345, 0x01FCC	},
+	{	0x00399, 0x00300, 0x01FDA	},
+	{	0x00399, 0x00301, 0x0038A	},
+	{	0x00399, 0x00304, 0x01FD9	},
+	{	0x00399, 0x00306, 0x01FD8	},
+	{	0x00399, 0x00308, 0x003AA	},
+	{	0x00399, 0x00313, 0x01F38	},
+	{	0x00399, 0x00314, 0x01F39	},
+	{	0x0039F, 0x00300, 0x01FF8	},
+	{	0x0039F, 0x00301, 0x0038C	},
+	{	0x0039F, 0x00313, 0x01F48	},
+	{	0x0039F, 0x00314, 0x01F49	},
+	{	0x003A1, 0x00314, 0x01FEC	},
+	{	0x003A5, 0x00300, 0x01FEA	},
+	{	0x003A5, 0x00301, 0x0038E	},
+	{	0x003A5, 0x00304, 0x01FE9	},
+	{	0x003A5, 0x00306, 0x01FE8	},
+	{	0x003A5, 0x00308, 0x003AB	},
+	{	0x003A5, 0x00314, 0x01F59	},
+	{	0x003A9, 0x00300, 0x01FFA	},
+	{	0x003A9, 0x00301, 0x0038F	},
+	{	0x003A9, 0x00313, 0x01F68	},
+	{	0x003A9, 0x00314, 0x01F69	},
+	{	0x003A9, 0x00345, 0x01FFC	},
+	{	0x003AC, 0x00345, 0x01FB4	},
+	{	0x003AE, 0x00345, 0x01FC4	},
+	{	0x003B1, 0x00300, 0x01F70	},
+	{	0x003B1, 0x00301, 0x003AC	},
+	{	0x003B1, 0x00304, 0x01FB1	},
+	{	0x003B1, 0x00306, 0x01FB0	},
+	{	0x003B1, 0x00313, 0x01F00	},
+	{	0x003B1, 0x00314, 0x01F01	},
+	{	0x003B1, 0x00342, 0x01FB6	},
+	{	0x003B1, 0x00345, 0x01FB3	},
+	{	0x003B5, 0x00300, 0x01F72	},
+	{	0x003B5, 0x00301, 0x003AD	},
+	{	0x003B5, 0x00313, 0x01F10	},
+	{	0x003B5, 0x00314, 0x01F11	},
+	{	0x003B7, 0x00300, 0x01F74	},
+	{	0x003B7, 0x00301, 0x003AE	},
+	{	0x003B7, 0x00313, 0x01F20	},
+	{	0x003B7, 0x00314, 0x01F21	},
+	{	0x003B7, 0x00342, 0x01FC6	},
+	{	0x003B7, 0x00345, 0x01FC3	},
+	{	0x003B9, 0x00300, 0x01F76	},
+	{	0x003B9, 0x00301, 0x003AF	},
+	{	0x003B9, 0x00304, 0x01FD1	},
+	{	0x003B9, 0x00306, 0x01FD0	},
+	{	0x003B9, 0x00308, 0x003CA	},
+	{	0x003B9, 0x00313, 0x01F30	},
+	{	0x003B9, 0x00314, 0x01F31	},
+	{	0x003B9, 0x00342, 0x01FD6	},
+	{	0x003BF, 0x00300, 0x01F78	},
+	{	0x003BF, 0x00301, 0x003CC	},
+	{	0x003BF, 0x00313, 0x01F40	},
+	{	0x003BF, 0x00314, 0x01F41	},
+	{	0x003C1, 0x00313, 0x01FE4	},
+	{	0x003C1, 0x00314, 0x01FE5	},
+	{	0x003C5, 0x00300, 0x01F7A	},
+	{	0x003C5, 0x00301, 0x003CD	},
+	{	0x003C5, 0x00304, 0x01FE1	},
+	{	0x003C5, 0x00306, 0x01FE0	},
+	{	0x003C5, 0x00308, 0x003CB	},
+	{	0x003C5, 0x00313, 0x01F50	},
+	{	0x003C5, 0x00314, 0x01F51	},
+	{	0x003C5, 0x00342, 0x01FE6	},
+	{	0x003C9, 0x00300, 0x01F7C	},
+	{	0x003C9, 0x00301, 0x003CE	},
+	{	0x003C9, 0x00313, 0x01F60	},
+	{	0x003C9, 0x00314, 0x01F61	},
+	{	0x003C9, 0x00342, 0x01FF6	},
+	{	0x003C9, 0x00345, 0x01FF3	},
+	{	0x003CA, 0x00300, 0x01FD2	},
+	{	0x003CA, 0x00301, 0x00390	},
+	{	0x003CA, 0x00342, 0x01FD7	},
+	{	0x003CB, 0x00300, 0x01FE2	},
+	{	0x003CB, 0x00301, 0x003B0	},
+	{	0x003CB, 0x00342, 0x01FE7	},
+	{	0x003CE, 0x00345, 0x01FF4	},
+	{	0x003D2, 0x00301, 0x003D3	},
+	{	0x003D2, 0x00308, 0x003D4	},
+	{	0x00406, 0x00308, 0x00407	},
+	{	0x00410, 0x00306, 0x004D0	},
+	{	0x00410, 0x00308, 0x004D2	},
+	{	0x00413, 0x00301, 0x00403	},
+	{	0x00415, 0x00300, 0x00400	},
+	{	0x00415, 0x00306, 0x004D6	},
+	{	0x00415, 0x00308, 0x00401	},
+	{	0x00416, 0x00306, 0x004C1	},
+	{	0x00416, 0x00308, 0x004DC	},
+	{	0x00417, 0x00308, 0x004DE	},
+	{	0x00418, 0x00300, 0x0040D	},
+	{	0x00418, 0x00304, 0x004E2	},
+	{	0x00418, 0x00306, 0x00419	},
+	{	0x00418, 0x00308, 0x004E4	},
+	{	0x0041A, 0x00301, 0x0040C	},
+	{	0x0041E, 0x00308, 0x004E6	},
+	{	0x00423, 0x00304, 0x004EE	},
+	{	0x00423, 0x00306, 0x0040E	},
+	{	0x00423, 0x00308, 0x004F0	},
+	{	0x00423, 0x0030B, 0x004F2	},
+	{	0x00427, 0x00308, 0x004F4	},
+	{	0x0042B, 0x00308, 0x004F8	},
+	{	0x0042D, 0x00308, 0x004EC	},
+	{	0x00430, 0x00306, 0x004D1	},
+	{	0x00430, 0x00308, 0x004D3	},
+	{	0x00433, 0x00301, 0x00453	},
+	{	0x00435, 0x00300, 0x00450	},
+	{	0x00435, 0x00306, 0x004D7	},
+	{	0x00435, 0x00308, 0x00451	},
+	{	0x00436, 0x00306, 0x004C2	},
+	{	0x00436, 0x00308, 0x004DD	},
+	{	0x00437, 0x00308, 0x004DF	},
+	{	0x00438, 0x00300, 0x0045D	},
+	{	0x00438, 0x00304, 0x004E3	},
+	{	0x00438, 0x00306, 0x00439	},
+	{	0x00438, 0x00308, 0x004E5	},
+	{	0x0043A, 0x00301, 0x0045C	},
+	{	0x0043E, 0x00308, 0x004E7	},
+	{	0x00443, 0x00304, 0x004EF	},
+	{	0x00443, 0x00306, 0x0045E	},
+	{	0x00443, 0x00308, 0x004F1	},
+	{	0x00443, 0x0030B, 0x004F3	},
+	{	0x00447, 0x00308, 0x004F5	},
+	{	0x0044B, 0x00308, 0x004F9	},
+	{	0x0044D, 0x00308, 0x004ED	},
+	{	0x00456, 0x00308, 0x00457	},
+	{	0x00474, 0x0030F, 0x00476	},
+	{	0x00475, 0x0030F, 0x00477	},
+	{	0x004D8, 0x00308, 0x004DA	},
+	{	0x004D9, 0x00308, 0x004DB	},
+	{	0x004E8, 0x00308, 0x004EA	},
+	{	0x004E9, 0x00308, 0x004EB	},
+	{	0x00627, 0x00653, 0x00622	},
+	{	0x00627, 0x00654, 0x00623	},
+	{	0x00627, 0x00655, 0x00625	},
+	{	0x00648, 0x00654, 0x00624	},
+	{	0x0064A, 0x00654, 0x00626	},
+	{	0x006C1, 0x00654, 0x006C2	},
+	{	0x006D2, 0x00654, 0x006D3	},
+	{	0x006D5, 0x00654, 0x006C0	},
+	{	0x00928, 0x0093C, 0x00929	},
+	{	0x00930, 0x0093C, 0x00931	},
+	{	0x00933, 0x0093C, 0x00934	},
+	{	0x009C7, 0x009BE, 0x009CB	},
+	{	0x009C7, 0x009D7, 0x009CC	},
+	{	0x00B47, 0x00B3E, 0x00B4B	},
+	{	0x00B47, 0x00B56, 0x00B48	},
+	{	0x00B47, 0x00B57, 0x00B4C	},
+	{	0x00B92, 0x00BD7, 0x00B94	},
+	{	0x00BC6, 0x00BBE, 0x00BCA	},
+	{	0x00BC6, 0x00BD7, 0x00BCC	},
+	{	0x00BC7, 0x00BBE, 0x00BCB	},
+	{	0x00C46, 0x00C56, 0x00C48	},
+	{	0x00CBF, 0x00CD5, 0x00CC0	},
+	{	0x00CC6, 0x00CC2, 0x00CCA	},
+	{	0x00CC6, 0x00CD5, 0x00CC7	},
+	{	0x00CC6, 0x00CD6, 0x00CC8	},
+	{	0x00CCA, 0x00CD5, 0x00CCB	},
+	{	0x00D46, 0x00D3E, 0x00D4A	},
+	{	0x00D46, 0x00D57, 0x00D4C	},
+	{	0x00D47, 0x00D3E, 0x00D4B	},
+	{	0x00DD9, 0x00DCA, 0x00DDA	},
+	{	0x00DD9, 0x00DCF, 0x00DDC	},
+	{	0x00DD9, 0x00DDF, 0x00DDE	},
+	{	0x00DDC, 0x00DCA, 0x00DDD	},
+	{	0x01025, 0x0102E, 0x01026	},
+	{	0x01B05, 0x01B35, 0x01B06	},
+	{	0x01B07, 0x01B35, 0x01B08	},
+	{	0x01B09, 0x01B35, 0x01B0A	},
+	{	0x01B0B, 0x01B35, 0x01B0C	},
+	{	0x01B0D, 0x01B35, 0x01B0E	},
+	{	0x01B11, 0x01B35, 0x01B12	},
+	{	0x01B3A, 0x01B35, 0x01B3B	},
+	{	0x01B3C, 0x01B35, 0x01B3D	},
+	{	0x01B3E, 0x01B35, 0x01B40	},
+	{	0x01B3F, 0x01B35, 0x01B41	},
+	{	0x01B42, 0x01B35, 0x01B43	},
+	{	0x01E36, 0x00304, 0x01E38	},
+	{	0x01E37, 0x00304, 0x01E39	},
+	{	0x01E5A, 0x00304, 0x01E5C	},
+	{	0x01E5B, 0x00304, 0x01E5D	},
+	{	0x01E62, 0x00307, 0x01E68	},
+	{	0x01E63, 0x00307, 0x01E69	},
+	{	0x01EA0, 0x00302, 0x01EAC	},
+	{	0x01EA0, 0x00306, 0x01EB6	},
+	{	0x01EA1, 0x00302, 0x01EAD	},
+	{	0x01EA1, 0x00306, 0x01EB7	},
+	{	0x01EB8, 0x00302, 0x01EC6	},
+	{	0x01EB9, 0x00302, 0x01EC7	},
+	{	0x01ECC, 0x00302, 0x01ED8	},
+	{	0x01ECD, 0x00302, 0x01ED9	},
+	{	0x01F00, 0x00300, 0x01F02	},
+	{	0x01F00, 0x00301, 0x01F04	},
+	{	0x01F00, 0x00342, 0x01F06	},
+	{	0x01F00, 0x00345, 0x01F80	},
+	{	0x01F01, 0x00300, 0x01F03	},
+	{	0x01F01, 0x00301, 0x01F05	},
+	{	0x01F01, 0x00342, 0x01F07	},
+	{	0x01F01, 0x00345, 0x01F81	},
+	{	0x01F02, 0x00345, 0x01F82	},
+	{	0x01F03, 0x00345, 0x01F83	},
+	{	0x01F04, 0x00345, 0x01F84	},
+	{	0x01F05, 0x00345, 0x01F85	},
+	{	0x01F06, 0x00345, 0x01F86	},
+	{	0x01F07, 0x00345, 0x01F87	},
+	{	0x01F08, 0x00300, 0x01F0A	},
+	{	0x01F08, 0x00301, 0x01F0C	},
+	{	0x01F08, 0x00342, 0x01F0E	},
+	{	0x01F08, 0x00345, 0x01F88	},
+	{	0x01F09, 0x00300, 0x01F0B	},
+	{	0x01F09, 0x00301, 0x01F0D	},
+	{	0x01F09, 0x00342, 0x01F0F	},
+	{	0x01F09, 0x00345, 0x01F89	},
+	{	0x01F0A, 0x00345, 0x01F8A	},
+	{	0x01F0B, 0x00345, 0x01F8B	},
+	{	0x01F0C, 0x00345, 0x01F8C	},
+	{	0x01F0D, 0x00345, 0x01F8D	},
+	{	0x01F0E, 0x00345, 0x01F8E	},
+	{	0x01F0F, 0x00345, 0x01F8F	},
+	{	0x01F10, 0x00300, 0x01F12	},
+	{	0x01F10, 0x00301, 0x01F14	},
+	{	0x01F11, 0x00300, 0x01F13	},
+	{	0x01F11, 0x00301, 0x01F15	},
+	{	0x01F18, 0x00300, 0x01F1A	},
+	{	0x01F18, 0x00301, 0x01F1C	},
+	{	0x01F19, 0x00300, 0x01F1B	},
+	{	0x01F19, 0x00301, 0x01F1D	},
+	{	0x01F20, 0x00300, 0x01F22	},
+	{	0x01F20, 0x00301, 0x01F24	},
+	{	0x01F20, 0x00342, 0x01F26	},
+	{	0x01F20, 0x00345, 0x01F90	},
+	{	0x01F21, 0x00300, 0x01F23	},
+	{	0x01F21, 0x00301, 0x01F25	},
+	{	0x01F21, 0x00342, 0x01F27	},
+	{	0x01F21, 0x00345, 0x01F91	},
+	{	0x01F22, 0x00345, 0x01F92	},
+	{	0x01F23, 0x00345, 0x01F93	},
+	{	0x01F24, 0x00345, 0x01F94	},
+	{	0x01F25, 0x00345, 0x01F95	},
+	{	0x01F26, 0x00345, 0x01F96	},
+	{	0x01F27, 0x00345, 0x01F97	},
+	{	0x01F28, 0x00300, 0x01F2A	},
+	{	0x01F28, 0x00301, 0x01F2C	},
+	{	0x01F28, 0x00342, 0x01F2E	},
+	{	0x01F28, 0x00345, 0x01F98	},
+	{	0x01F29, 0x00300, 0x01F2B	},
+	{	0x01F29, 0x00301, 0x01F2D	},
+	{	0x01F29, 0x00342, 0x01F2F	},
+	{	0x01F29, 0x00345, 0x01F99	},
+	{	0x01F2A, 0x00345, 0x01F9A	},
+	{	0x01F2B, 0x00345, 0x01F9B	},
+	{	0x01F2C, 0x00345, 0x01F9C	},
+	{	0x01F2D, 0x00345, 0x01F9D	},
+	{	0x01F2E, 0x00345, 0x01F9E	},
+	{	0x01F2F, 0x00345, 0x01F9F	},
+	{	0x01F30, 0x00300, 0x01F32	},
+	{	0x01F30, 0x00301, 0x01F34	},
+	{	0x01F30, 0x00342, 0x01F36	},
+	{	0x01F31, 0x00300, 0x01F33	},
+	{	0x01F31, 0x00301, 0x01F35	},
+	{	0x01F31, 0x00342, 0x01F37	},
+	{	0x01F38, 0x00300, 0x01F3A	},
+	{	0x01F38, 0x00301, 0x01F3C	},
+	{	0x01F38, 0x00342, 0x01F3E	},
+	{	0x01F39, 0x00300, 0x01F3B	},
+	{	0x01F39, 0x00301, 0x01F3D	},
+	{	0x01F39, 0x00342, 0x01F3F	},
+	{	0x01F40, 0x00300, 0x01F42	},
+	{	0x01F40, 0x00301, 0x01F44	},
+	{	0x01F41, 0x00300, 0x01F43	},
+	{	0x01F41, 0x00301, 0x01F45	},
+	{	0x01F48, 0x00300, 0x01F4A	},
+	{	0x01F48, 0x00301, 0x01F4C	},
+	{	0x01F49, 0x00300, 0x01F4B	},
+	{	0x01F49, 0x00301, 0x01F4D	},
+	{	0x01F50, 0x00300, 0x01F52	},
+	{	0x01F50, 0x00301, 0x01F54	},
+	{	0x01F50, 0x00342, 0x01F56	},
+	{	0x01F51, 0x00300, 0x01F53	},
+	{	0x01F51, 0x00301, 0x01F55	},
+	{	0x01F51, 0x00342, 0x01F57	},
+	{	0x01F59, 0x00300, 0x01F5B	},
+	{	0x01F59, 0x00301, 0x01F5D	},
+	{	0x01F59, 0x00342, 0x01F5F	},
+	{	0x01F60, 0x00300, 0x01F62	},
+	{	0x01F60, 0x00301, 0x01F64	},
+	{	0x01F60, 0x00342, 0x01F66	},
+	{	0x01F60, 0x00345, 0x01FA0	},
+	{	0x01F61, 0x00300, 0x01F63	},
+	{	0x01F61, 0x00301, 0x01F65	},
+	{	0x01F61, 0x00342, 0x01F67	},
+	{	0x01F61, 0x00345, 0x01FA1	},
+	{	0x01F62, 0x00345, 0x01FA2	},
+	{	0x01F63, 0x00345, 0x01FA3	},
+	{	0x01F64, 0x00345, 0x01FA4	},
+	{	0x01F65, 0x00345, 0x01FA5	},
+	{	0x01F66, 0x00345, 0x01FA6	},
+	{	0x01F67, 0x00345, 0x01FA7	},
+	{	0x01F68, 0x00300, 0x01F6A	},
+	{	0x01F68, 0x00301, 0x01F6C	},
+	{	0x01F68, 0x00342, 0x01F6E	},
+	{	0x01F68, 0x00345, 0x01FA8	},
+	{	0x01F69, 0x00300, 0x01F6B	},
+	{	0x01F69, 0x00301, 0x01F6D	},
+	{	0x01F69, 0x00342, 0x01F6F	},
+	{	0x01F69, 0x00345, 0x01FA9	},
+	{	0x01F6A, 0x00345, 0x01FAA	},
+	{	0x01F6B, 0x00345, 0x01FAB	},
+	{	0x01F6C, 0x00345, 0x01FAC	},
+	{	0x01F6D, 0x00345, 0x01FAD	},
+	{	0x01F6E, 0x00345, 0x01FAE	},
+	{	0x01F6F, 0x00345, 0x01FAF	},
+	{	0x01F70, 0x00345, 0x01FB2	},
+	{	0x01F74, 0x00345, 0x01FC2	},
+	{	0x01F7C, 0x00345, 0x01FF2	},
+	{	0x01FB6, 0x00345, 0x01FB7	},
+	{	0x01FBF, 0x00300, 0x01FCD	},
+	{	0x01FBF, 0x00301, 0x01FCE	},
+	{	0x01FBF, 0x00342, 0x01FCF	},
+	{	0x01FC6, 0x00345, 0x01FC7	},
+	{	0x01FF6, 0x00345, 0x01FF7	},
+	{	0x01FFE, 0x00300, 0x01FDD	},
+	{	0x01FFE, 0x00301, 0x01FDE	},
+	{	0x01FFE, 0x00342, 0x01FDF	},
+	{	0x02190, 0x00338, 0x0219A	},
+	{	0x02192, 0x00338, 0x0219B	},
+	{	0x02194, 0x00338, 0x021AE	},
+	{	0x021D0, 0x00338, 0x021CD	},
+	{	0x021D2, 0x00338, 0x021CF	},
+	{	0x021D4, 0x00338, 0x021CE	},
+	{	0x02203, 0x00338, 0x02204	},
+	{	0x02208, 0x00338, 0x02209	},
+	{	0x0220B, 0x00338, 0x0220C	},
+	{	0x02223, 0x00338, 0x02224	},
+	{	0x02225, 0x00338, 0x02226	},
+	{	0x0223C, 0x00338, 0x02241	},
+	{	0x02243, 0x00338, 0x02244	},
+	{	0x02245, 0x00338, 0x02247	},
+	{	0x02248, 0x00338, 0x02249	},
+	{	0x0224D, 0x00338, 0x0226D	},
+	{	0x02261, 0x00338, 0x02262	},
+	{	0x02264, 0x00338, 0x02270	},
+	{	0x02265, 0x00338, 0x02271	},
+	{	0x02272, 0x00338, 0x02274	},
+	{	0x02273, 0x00338, 0x02275	},
+	{	0x02276, 0x00338, 0x02278	},
+	{	0x02277, 0x00338, 0x02279	},
+	{	0x0227A, 0x00338, 0x02280	},
+	{	0x0227B, 0x00338, 0x02281	},
+	{	0x0227C, 0x00338, 0x022E0	},
+	{	0x0227D, 0x00338, 0x022E1	},
+	{	0x02282, 0x00338, 0x02284	},
+	{	0x02283, 0x00338, 0x02285	},
+	{	0x02286, 0x00338, 0x02288	},
+	{	0x02287, 0x00338, 0x02289	},
+	{	0x02291, 0x00338, 0x022E2	},
+	{	0x02292, 0x00338, 0x022E3	},
+	{	0x022A2, 0x00338, 0x022AC	},
+	{	0x022A8, 0x00338, 0x022AD	},
+	{	0x022A9, 0x00338, 0x022AE	},
+	{	0x022AB, 0x00338, 0x022AF	},
+	{	0x022B2, 0x00338, 0x022EA	},
+	{	0x022B3, 0x00338, 0x022EB	},
+	{	0x022B4, 0x00338, 0x022EC	},
+	{	0x022B5, 0x00338, 0x022ED	},
+	{	0x03046, 0x03099, 0x03094	},
+	{	0x0304B, 0x03099, 0x0304C	},
+	{	0x0304D, 0x03099, 0x0304E	},
+	{	0x0304F, 0x03099, 0x03050	},
+	{	0x03051, 0x03099, 0x03052	},
+	{	0x03053, 0x03099, 0x03054	},
+	{	0x03055, 0x03099, 0x03056	},
+	{	0x03057, 0x03099, 0x03058	},
+	{	0x03059, 0x03099, 0x0305A	},
+	{	0x0305B, 0x03099, 0x0305C	},
+	{	0x0305D, 0x03099, 0x0305E	},
+	{	0x0305F, 0x03099, 0x03060	},
+	{	0x03061, 0x03099, 0x03062	},
+	{	0x03064, 0x03099, 0x03065	},
+	{	0x03066, 0x03099, 0x03067	},
+	{	0x03068, 0x03099, 0x03069	},
+	{	0x0306F, 0x03099, 0x03070	},
+	{	0x0306F, 0x0309A, 0x03071	},
+	{	0x03072, 0x03099, 0x03073	},
+	{	0x03072, 0x0309A, 0x03074	},
+	{	0x03075, 0x03099, 0x03076	},
+	{	0x03075, 0x0309A, 0x03077	},
+	{	0x03078, 0x03099, 0x03079	},
+	{	0x03078, 0x0309A, 0x0307A	},
+	{	0x0307B, 0x03099, 0x0307C	},
+	{	0x0307B, 0x0309A, 0x0307D	},
+	{	0x0309D, 0x03099, 0x0309E	},
+	{	0x030A6, 0x03099, 0x030F4	},
+	{	0x030AB, 0x03099, 0x030AC	},
+	{	0x030AD, 0x03099, 0x030AE	},
+	{	0x030AF, 0x03099, 0x030B0	},
+	{	0x030B1, 0x03099, 0x030B2	},
+	{	0x030B3, 0x03099, 0x030B4	},
+	{	0x030B5, 0x03099, 0x030B6	},
+	{	0x030B7, 0x03099, 0x030B8	},
+	{	0x030B9, 0x03099, 0x030BA	},
+	{	0x030BB, 0x03099, 0x030BC	},
+	{	0x030BD, 0x03099, 0x030BE	},
+	{	0x030BF, 0x03099, 0x030C0	},
+	{	0x030C1, 0x03099, 0x030C2	},
+	{	0x030C4, 0x03099, 0x030C5	},
+	{	0x030C6, 0x03099, 0x030C7	},
+	{	0x030C8, 0x03099, 0x030C9	},
+	{	0x030CF, 0x03099, 0x030D0	},
+	{	0x030CF, 0x0309A, 0x030D1	},
+	{	0x030D2, 0x03099, 0x030D3	},
+	{	0x030D2, 0x0309A, 0x030D4	},
+	{	0x030D5, 0x03099, 0x030D6	},
+	{	0x030D5, 0x0309A, 0x030D7	},
+	{	0x030D8, 0x03099, 0x030D9	},
+	{	0x030D8, 0x0309A, 0x030DA	},
+	{	0x030DB, 0x03099, 0x030DC	},
+	{	0x030DB, 0x0309A, 0x030DD	},
+	{	0x030EF, 0x03099, 0x030F7	},
+	{	0x030F0, 0x03099, 0x030F8	},
+	{	0x030F1, 0x03099, 0x030F9	},
+	{	0x030F2, 0x03099, 0x030FA	},
+	{	0x030FD, 0x03099, 0x030FE	},
+	{	0x11099, 0x110BA, 0x1109A	},
+	{	0x1109B, 0x110BA, 0x1109C	},
+	{	0x110A5, 0x110BA, 0x110AB	},
+	{	0x11131, 0x11127, 0x1112E	},
+	{	0x11132, 0x11127, 0x1112F	},
+	{	0x11347, 0x1133E, 0x1134B	},
+	{	0x11347, 0x11357, 0x1134C	},
+	{	0x114B9, 0x114B0, 0x114BC	},
+	{	0x114B9, 0x114BA, 0x114BB	},
+	{	0x114B9, 0x114BD, 0x114BE	},
+	{	0x115B8, 0x115AF, 0x115BA	},
+	{	0x115B9, 0x115AF, 0x115BB	},
+	{	0x11935, 0x11930, 0x11938	},
+};
+
+
+const std::size_t
+NORM_composition_count = 941;
+
+
+/*------------------------------------------------------------------------------
+	Full case folding; see Case_Folding.
+*/
+
+static_assert (FOLD_block_bits == 8, "regenerate the case folding tables");
+
+const uint8_t
+FOLD_stage1 [4352] =
+{
+	0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x07, 0x06, 0x06, 0x08, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x09, 0x06, 0x0A, 0x0B,
+	0x06, 0x0C, 0x06, 0x06, 0x0D, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0E, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x0F, 0x10, 0x06, 0x06, 0x06, 0x11, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x12, 0x06, 0x06, 0x06, 0x13,
+	0x06, 0x06, 0x06, 0x06, 0x14, 0x15, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x16, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x17, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x18, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x19, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+	0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06, 0x06,
+};
+
+
+const uint16_t
+FOLD_stage2 [26][256] =
+{
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0001, 0x0003, 0x0005, 0x0007, 0x0009, 0x000B, 0x000D,
+		0x000F, 0x0011, 0x0013, 0x0015, 0x0017, 0x0019, 0x001B, 0x001D,
+		0x001F, 0x0021, 0x0023, 0x0025, 0x0027, 0x0029, 0x002B, 0x002D,
+		0x002F, 0x0031, 0x0033, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0035, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0037, 0x0039, 0x003B, 0x003D, 0x003F, 0x0041, 0x0043, 0x0045,
+		0x0047, 0x0049, 0x004B, 0x004D, 0x004F, 0x0051, 0x0053, 0x0055,
+		0x0057, 0x0059, 0x005B, 0x005D, 0x005F, 0x0061, 0x0063, 0x0000,
+		0x0065, 0x0067, 0x0069, 0x006B, 0x006D, 0x006F, 0x0071, 0x0073,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0076, 0x0000, 0x0078, 0x0000, 0x007A, 0x0000, 0x007C, 0x0000,
+		0x007E, 0x0000, 0x0080, 0x0000, 0x0082, 0x0000, 0x0084, 0x0000,
+		0x0086, 0x0000, 0x0088, 0x0000, 0x008A, 0x0000, 0x008C, 0x0000,
+		0x008E, 0x0000, 0x0090, 0x0000, 0x0092, 0x0000, 0x0094, 0x0000,
+		0x0096, 0x0000, 0x0098, 0x0000, 0x009A, 0x0000, 0x009C, 0x0000,
+		0x009E, 0x0000, 0x00A0, 0x0000, 0x00A2, 0x0000, 0x00A4, 0x0000,
+		0x00A6, 0x0000, 0x00A9, 0x0000, 0x00AB, 0x0000, 0x00AD, 0x0000,
+		0x0000, 0x00AF, 0x0000, 0x00B1, 0x0000, 0x00B3, 0x0000, 0x00B5,
+		0x0000, 0x00B7, 0x0000, 0x00B9, 0x0000, 0x00BB, 0x0000, 0x00BD,
+		0x0000, 0x00BF, 0x00C2, 0x0000, 0x00C4, 0x0000, 0x00C6, 0x0000,
+		0x00C8, 0x0000, 0x00CA, 0x0000, 0x00CC, 0x0000, 0x00CE, 0x0000,
+		0x00D0, 0x0000, 0x00D2, 0x0000, 0x00D4, 0x0000, 0x00D6, 0x0000,
+		0x00D8, 0x0000, 0x00DA, 0x0000, 0x00DC, 0x0000, 0x00DE, 0x0000,
+		0x00E0, 0x0000, 0x00E2, 0x0000, 0x00E4, 0x0000, 0x00E6, 0x0000,
+		0x00E8, 0x0000, 0x00EA, 0x0000, 0x00EC, 0x0000, 0x00EE, 0x0000,
+		0x00F0, 0x00F2, 0x0000, 0x00F4, 0x0000, 0x00F6, 0x0000, 0x00F8,
+		0x0000, 0x00FA, 0x00FC, 0x0000, 0x00FE, 0x0000, 0x0100, 0x0102,
+		0x0000, 0x0104, 0x0106, 0x0108, 0x0000, 0x0000, 0x010A, 0x010C,
+		0x010E, 0x0110, 0x0000, 0x0112, 0x0114, 0x0000, 0x0116, 0x0118,
+		0x011A, 0x0000, 0x0000, 0x0000, 0x011C, 0x011E, 0x0000, 0x0120,
+		0x0122, 0x0000, 0x0124, 0x0000, 0x0126, 0x0000, 0x0128, 0x012A,
+		0x0000, 0x012C, 0x0000, 0x0000, 0x012E, 0x0000, 0x0130, 0x0132,
+		0x0000, 0x0134, 0x0136, 0x0138, 0x0000, 0x013A, 0x0000, 0x013C,
+		0x013E, 0x0000, 0x0000, 0x0000, 0x0140, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0142, 0x0144, 0x0000, 0x0146,
+		0x0148, 0x0000, 0x014A, 0x014C, 0x0000, 0x014E, 0x0000, 0x0150,
+		0x0000, 0x0152, 0x0000, 0x0154, 0x0000, 0x0156, 0x0000, 0x0158,
+		0x0000, 0x015A, 0x0000, 0x015C, 0x0000, 0x0000, 0x015E, 0x0000,
+		0x0160, 0x0000, 0x0162, 0x0000, 0x0164, 0x0000, 0x0166, 0x0000,
+		0x0168, 0x0000, 0x016A, 0x0000, 0x016C, 0x0000, 0x016E, 0x0000,
+		0x0170, 0x0173, 0x0175, 0x0000, 0x0177, 0x0000, 0x0179, 0x017B,
+		0x017D, 0x0000, 0x017F, 0x0000, 0x0181, 0x0000, 0x0183, 0x0000,
+	},
+	{
+		0x0185, 0x0000, 0x0187, 0x0000, 0x0189, 0x0000, 0x018B, 0x0000,
+		0x018D, 0x0000, 0x018F, 0x0000, 0x0191, 0x0000, 0x0193, 0x0000,
+		0x0195, 0x0000, 0x0197, 0x0000, 0x0199, 0x0000, 0x019B, 0x0000,
+		0x019D, 0x0000, 0x019F, 0x0000, 0x01A1, 0x0000, 0x01A3, 0x0000,
+		0x01A5, 0x0000, 0x01A7, 0x0000, 0x01A9, 0x0000, 0x01AB, 0x0000,
+		0x01AD, 0x0000, 0x01AF, 0x0000, 0x01B1, 0x0000, 0x01B3, 0x0000,
+		0x01B5, 0x0000, 0x01B7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x01B9, 0x01BB, 0x0000, 0x01BD, 0x01BF, 0x0000,
+		0x0000, 0x01C1, 0x0000, 0x01C3, 0x01C5, 0x01C7, 0x01C9, 0x0000,
+		0x01CB, 0x0000, 0x01CD, 0x0000, 0x01CF, 0x0000, 0x01D1, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01D3, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x01D5, 0x0000, 0x01D7, 0x0000, 0x0000, 0x0000, 0x01D9, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01DB,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x01DD, 0x0000,
+		0x01DF, 0x01E1, 0x01E3, 0x0000, 0x01E5, 0x0000, 0x01E7, 0x01E9,
+		0x01EB, 0x01EF, 0x01F1, 0x01F3, 0x01F5, 0x01F7, 0x01F9, 0x01FB,
+		0x01FD, 0x01FF, 0x0201, 0x0203, 0x0205, 0x0207, 0x0209, 0x020B,
+		0x020D, 0x020F, 0x0000, 0x0211, 0x0213, 0x0215, 0x0217, 0x0219,
+		0x021B, 0x021D, 0x021F, 0x0221, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0223, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0227, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0229,
+		0x022B, 0x022D, 0x0000, 0x0000, 0x0000, 0x022F, 0x0231, 0x0000,
+		0x0233, 0x0000, 0x0235, 0x0000, 0x0237, 0x0000, 0x0239, 0x0000,
+		0x023B, 0x0000, 0x023D, 0x0000, 0x023F, 0x0000, 0x0241, 0x0000,
+		0x0243, 0x0000, 0x0245, 0x0000, 0x0247, 0x0000, 0x0249, 0x0000,
+		0x024B, 0x024D, 0x0000, 0x0000, 0x024F, 0x0251, 0x0000, 0x0253,
+		0x0000, 0x0255, 0x0257, 0x0000, 0x0000, 0x0259, 0x025B, 0x025D,
+	},
+	{
+		0x025F, 0x0261, 0x0263, 0x0265, 0x0267, 0x0269, 0x026B, 0x026D,
+		0x026F, 0x0271, 0x0273, 0x0275, 0x0277, 0x0279, 0x027B, 0x027D,
+		0x027F, 0x0281, 0x0283, 0x0285, 0x0287, 0x0289, 0x028B, 0x028D,
+		0x028F, 0x0291, 0x0293, 0x0295, 0x0297, 0x0299, 0x029B, 0x029D,
+		0x029F, 0x02A1, 0x02A3, 0x02A5, 0x02A7, 0x02A9, 0x02AB, 0x02AD,
+		0x02AF, 0x02B1, 0x02B3, 0x02B5, 0x02B7, 0x02B9, 0x02BB, 0x02BD,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x02BF, 0x0000, 0x02C1, 0x0000, 0x02C3, 0x0000, 0x02C5, 0x0000,
+		0x02C7, 0x0000, 0x02C9, 0x0000, 0x02CB, 0x0000, 0x02CD, 0x0000,
+		0x02CF, 0x0000, 0x02D1, 0x0000, 0x02D3, 0x0000, 0x02D5, 0x0000,
+		0x02D7, 0x0000, 0x02D9, 0x0000, 0x02DB, 0x0000, 0x02DD, 0x0000,
+		0x02DF, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x02E1, 0x0000, 0x02E3, 0x0000, 0x02E5, 0x0000,
+		0x02E7, 0x0000, 0x02E9, 0x0000, 0x02EB, 0x0000, 0x02ED, 0x0000,
+		0x02EF, 0x0000, 0x02F1, 0x0000, 0x02F3, 0x0000, 0x02F5, 0x0000,
+		0x02F7, 0x0000, 0x02F9, 0x0000, 0x02FB, 0x0000, 0x02FD, 0x0000,
+		0x02FF, 0x0000, 0x0301, 0x0000, 0x0303, 0x0000, 0x0305, 0x0000,
+		0x0307, 0x0000, 0x0309, 0x0000, 0x030B, 0x0000, 0x030D, 0x0000,
+		0x030F, 0x0000, 0x0311, 0x0000, 0x0313, 0x0000, 0x0315, 0x0000,
+		0x0317, 0x0319, 0x0000, 0x031B, 0x0000, 0x031D, 0x0000, 0x031F,
+		0x0000, 0x0321, 0x0000, 0x0323, 0x0000, 0x0325, 0x0000, 0x0000,
+		0x0327, 0x0000, 0x0329, 0x0000, 0x032B, 0x0000, 0x032D, 0x0000,
+		0x032F, 0x0000, 0x0331, 0x0000, 0x0333, 0x0000, 0x0335, 0x0000,
+		0x0337, 0x0000, 0x0339, 0x0000, 0x033B, 0x0000, 0x033D, 0x0000,
+		0x033F, 0x0000, 0x0341, 0x0000, 0x0343, 0x0000, 0x0345, 0x0000,
+		0x0347, 0x0000, 0x0349, 0x0000, 0x034B, 0x0000, 0x034D, 0x0000,
+		0x034F, 0x0000, 0x0351, 0x0000, 0x0353, 0x0000, 0x0355, 0x0000,
+	},
+	{
+		0x0357, 0x0000, 0x0359, 0x0000, 0x035B, 0x0000, 0x035D, 0x0000,
+		0x035F, 0x0000, 0x0361, 0x0000, 0x0363, 0x0000, 0x0365, 0x0000,
+		0x0367, 0x0000, 0x0369, 0x0000, 0x036B, 0x0000, 0x036D, 0x0000,
+		0x036F, 0x0000, 0x0371, 0x0000, 0x0373, 0x0000, 0x0375, 0x0000,
+		0x0377, 0x0000, 0x0379, 0x0000, 0x037B, 0x0000, 0x037D, 0x0000,
+		0x037F, 0x0000, 0x0381, 0x0000, 0x0383, 0x0000, 0x0385, 0x0000,
+		0x0000, 0x0387, 0x0389, 0x038B, 0x038D, 0x038F, 0x0391, 0x0393,
+		0x0395, 0x0397, 0x0399, 0x039B, 0x039D, 0x039F, 0x03A1, 0x03A3,
+		0x03A5, 0x03A7, 0x03A9, 0x03AB, 0x03AD, 0x03AF, 0x03B1, 0x03B3,
+		0x03B5, 0x03B7, 0x03B9, 0x03BB, 0x03BD, 0x03BF, 0x03C1, 0x03C3,
+		0x03C5, 0x03C7, 0x03C9, 0x03CB, 0x03CD, 0x03CF, 0x03D1, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x03D3,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x03D6, 0x03D8, 0x03DA, 0x03DC, 0x03DE, 0x03E0, 0x03E2, 0x03E4,
+		0x03E6, 0x03E8, 0x03EA, 0x03EC, 0x03EE, 0x03F0, 0x03F2, 0x03F4,
+		0x03F6, 0x03F8, 0x03FA, 0x03FC, 0x03FE, 0x0400, 0x0402, 0x0404,
+		0x0406, 0x0408, 0x040A, 0x040C, 0x040E, 0x0410, 0x0412, 0x0414,
+		0x0416, 0x0418, 0x041A, 0x041C, 0x041E, 0x0420, 0x0000, 0x0422,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0424, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0426, 0x0428, 0x042A, 0x042C, 0x042E, 0x0430, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0432, 0x0434, 0x0436, 0x0438, 0x043A, 0x043C, 0x043E, 0x0440,
+		0x0442, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0444, 0x0446, 0x0448, 0x044A, 0x044C, 0x044E, 0x0450, 0x0452,
+		0x0454, 0x0456, 0x0458, 0x045A, 0x045C, 0x045E, 0x0460, 0x0462,
+		0x0464, 0x0466, 0x0468, 0x046A, 0x046C, 0x046E, 0x0470, 0x0472,
+		0x0474, 0x0476, 0x0478, 0x047A, 0x047C, 0x047E, 0x0480, 0x0482,
+		0x0484, 0x0486, 0x0488, 0x048A, 0x048C, 0x048E, 0x0490, 0x0492,
+		0x0494, 0x0496, 0x0498, 0x0000, 0x0000, 0x049A, 0x049C, 0x049E,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x04A0, 0x0000, 0x04A2, 0x0000, 0x04A4, 0x0000, 0x04A6, 0x0000,
+		0x04A8, 0x0000, 0x04AA, 0x0000, 0x04AC, 0x0000, 0x04AE, 0x0000,
+		0x04B0, 0x0000, 0x04B2, 0x0000, 0x04B4, 0x0000, 0x04B6, 0x0000,
+		0x04B8, 0x0000, 0x04BA, 0x0000, 0x04BC, 0x0000, 0x04BE, 0x0000,
+		0x04C0, 0x0000, 0x04C2, 0x0000, 0x04C4, 0x0000, 0x04C6, 0x0000,
+		0x04C8, 0x0000, 0x04CA, 0x0000, 0x04CC, 0x0000, 0x04CE, 0x0000,
+		0x04D0, 0x0000, 0x04D2, 0x0000, 0x04D4, 0x0000, 0x04D6, 0x0000,
+		0x04D8, 0x0000, 0x04DA, 0x0000, 0x04DC, 0x0000, 0x04DE, 0x0000,
+		0x04E0, 0x0000, 0x04E2, 0x0000, 0x04E4, 0x0000, 0x04E6, 0x0000,
+		0x04E8, 0x0000, 0x04EA, 0x0000, 0x04EC, 0x0000, 0x04EE, 0x0000,
+		0x04F0, 0x0000, 0x04F2, 0x0000, 0x04F4, 0x0000, 0x04F6, 0x0000,
+		0x04F8, 0x0000, 0x04FA, 0x0000, 0x04FC, 0x0000, 0x04FE, 0x0000,
+		0x0500, 0x0000, 0x0502, 0x0000, 0x0504, 0x0000, 0x0506, 0x0000,
+		0x0508, 0x0000, 0x050A, 0x0000, 0x050C, 0x0000, 0x050E, 0x0000,
+		0x0510, 0x0000, 0x0512, 0x0000, 0x0514, 0x0000, 0x0516, 0x0000,
+		0x0518, 0x0000, 0x051A, 0x0000, 0x051C, 0x0000, 0x051E, 0x0000,
+		0x0520, 0x0000, 0x0522, 0x0000, 0x0524, 0x0000, 0x0526, 0x0000,
+		0x0528, 0x0000, 0x052A, 0x0000, 0x052C, 0x0000, 0x052E, 0x0000,
+		0x0530, 0x0000, 0x0532, 0x0000, 0x0534, 0x0000, 0x0536, 0x0539,
+		0x053C, 0x053F, 0x0542, 0x0545, 0x0000, 0x0000, 0x0547, 0x0000,
+		0x054A, 0x0000, 0x054C, 0x0000, 0x054E, 0x0000, 0x0550, 0x0000,
+		0x0552, 0x0000, 0x0554, 0x0000, 0x0556, 0x0000, 0x0558, 0x0000,
+		0x055A, 0x0000, 0x055C, 0x0000, 0x055E, 0x0000, 0x0560, 0x0000,
+		0x0562, 0x0000, 0x0564, 0x0000, 0x0566, 0x0000, 0x0568, 0x0000,
+		0x056A, 0x0000, 0x056C, 0x0000, 0x056E, 0x0000, 0x0570, 0x0000,
+		0x0572, 0x0000, 0x0574, 0x0000, 0x0576, 0x0000, 0x0578, 0x0000,
+		0x057A, 0x0000, 0x057C, 0x0000, 0x057E, 0x0000, 0x0580, 0x0000,
+		0x0582, 0x0000, 0x0584, 0x0000, 0x0586, 0x0000, 0x0588, 0x0000,
+		0x058A, 0x0000, 0x058C, 0x0000, 0x058E, 0x0000, 0x0590, 0x0000,
+		0x0592, 0x0000, 0x0594, 0x0000, 0x0596, 0x0000, 0x0598, 0x0000,
+		0x059A, 0x0000, 0x059C, 0x0000, 0x059E, 0x0000, 0x05A0, 0x0000,
+		0x05A2, 0x0000, 0x05A4, 0x0000, 0x05A6, 0x0000, 0x05A8, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x05AA, 0x05AC, 0x05AE, 0x05B0, 0x05B2, 0x05B4, 0x05B6, 0x05B8,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x05BA, 0x05BC, 0x05BE, 0x05C0, 0x05C2, 0x05C4, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x05C6, 0x05C8, 0x05CA, 0x05CC, 0x05CE, 0x05D0, 0x05D2, 0x05D4,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x05D6, 0x05D8, 0x05DA, 0x05DC, 0x05DE, 0x05E0, 0x05E2, 0x05E4,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x05E6, 0x05E8, 0x05EA, 0x05EC, 0x05EE, 0x05F0, 0x0000, 0x0000,
+		0x05F2, 0x0000, 0x05F5, 0x0000, 0x05F9, 0x0000, 0x05FD, 0x0000,
+		0x0000, 0x0601, 0x0000, 0x0603, 0x0000, 0x0605, 0x0000, 0x0607,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0609, 0x060B, 0x060D, 0x060F, 0x0611, 0x0613, 0x0615, 0x0617,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0619, 0x061C, 0x061F, 0x0622, 0x0625, 0x0628, 0x062B, 0x062E,
+		0x0631, 0x0634, 0x0637, 0x063A, 0x063D, 0x0640, 0x0643, 0x0646,
+		0x0649, 0x064C, 0x064F, 0x0652, 0x0655, 0x0658, 0x065B, 0x065E,
+		0x0661, 0x0664, 0x0667, 0x066A, 0x066D, 0x0670, 0x0673, 0x0676,
+		0x0679, 0x067C, 0x067F, 0x0682, 0x0685, 0x0688, 0x068B, 0x068E,
+		0x0691, 0x0694, 0x0697, 0x069A, 0x069D, 0x06A0, 0x06A3, 0x06A6,
+		0x0000, 0x0000, 0x06A9, 0x06AC, 0x06AF, 0x0000, 0x06B2, 0x06B5,
+		0x06B9, 0x06BB, 0x06BD, 0x06BF, 0x06C1, 0x0000, 0x06C4, 0x0000,
+		0x0000, 0x0000, 0x06C6, 0x06C9, 0x06CC, 0x0000, 0x06CF, 0x06D2,
+		0x06D6, 0x06D8, 0x06DA, 0x06DC, 0x06DE, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x06E1, 0x06E5, 0x0000, 0x0000, 0x06E9, 0x06EC,
+		0x06F0, 0x06F2, 0x06F4, 0x06F6, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x06F8, 0x06FC, 0x0700, 0x0000, 0x0703, 0x0706,
+		0x070A, 0x070C, 0x070E, 0x0710, 0x0712, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0714, 0x0717, 0x071A, 0x0000, 0x071D, 0x0720,
+		0x0724, 0x0726, 0x0728, 0x072A, 0x072C, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x072F, 0x0000,
+		0x0000, 0x0000, 0x0731, 0x0733, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0735, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0737, 0x0739, 0x073B, 0x073D, 0x073F, 0x0741, 0x0743, 0x0745,
+		0x0747, 0x0749, 0x074B, 0x074D, 0x074F, 0x0751, 0x0753, 0x0755,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0757, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0759, 0x075B,
+		0x075D, 0x075F, 0x0761, 0x0763, 0x0765, 0x0767, 0x0769, 0x076B,
+		0x076D, 0x076F, 0x0771, 0x0773, 0x0775, 0x0777, 0x0779, 0x077B,
+		0x077D, 0x077F, 0x0781, 0x0783, 0x0785, 0x0787, 0x0789, 0x078B,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x078D, 0x078F, 0x0791, 0x0793, 0x0795, 0x0797, 0x0799, 0x079B,
+		0x079D, 0x079F, 0x07A1, 0x07A3, 0x07A5, 0x07A7, 0x07A9, 0x07AB,
+		0x07AD, 0x07AF, 0x07B1, 0x07B3, 0x07B5, 0x07B7, 0x07B9, 0x07BB,
+		0x07BD, 0x07BF, 0x07C1, 0x07C3, 0x07C5, 0x07C7, 0x07C9, 0x07CB,
+		0x07CD, 0x07CF, 0x07D1, 0x07D3, 0x07D5, 0x07D7, 0x07D9, 0x07DB,
+		0x07DD, 0x07DF, 0x07E1, 0x07E3, 0x07E5, 0x07E7, 0x07E9, 0x07EB,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x07ED, 0x0000, 0x07EF, 0x07F1, 0x07F3, 0x0000, 0x0000, 0x07F5,
+		0x0000, 0x07F7, 0x0000, 0x07F9, 0x0000, 0x07FB, 0x07FD, 0x07FF,
+		0x0801, 0x0000, 0x0803, 0x0000, 0x0000, 0x0805, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0807, 0x0809,
+		0x080B, 0x0000, 0x080D, 0x0000, 0x080F, 0x0000, 0x0811, 0x0000,
+		0x0813, 0x0000, 0x0815, 0x0000, 0x0817, 0x0000, 0x0819, 0x0000,
+		0x081B, 0x0000, 0x081D, 0x0000, 0x081F, 0x0000, 0x0821, 0x0000,
+		0x0823, 0x0000, 0x0825, 0x0000, 0x0827, 0x0000, 0x0829, 0x0000,
+		0x082B, 0x0000, 0x082D, 0x0000, 0x082F, 0x0000, 0x0831, 0x0000,
+		0x0833, 0x0000, 0x0835, 0x0000, 0x0837, 0x0000, 0x0839, 0x0000,
+		0x083B, 0x0000, 0x083D, 0x0000, 0x083F, 0x0000, 0x0841, 0x0000,
+		0x0843, 0x0000, 0x0845, 0x0000, 0x0847, 0x0000, 0x0849, 0x0000,
+		0x084B, 0x0000, 0x084D, 0x0000, 0x084F, 0x0000, 0x0851, 0x0000,
+		0x0853, 0x0000, 0x0855, 0x0000, 0x0857, 0x0000, 0x0859, 0x0000,
+		0x085B, 0x0000, 0x085D, 0x0000, 0x085F, 0x0000, 0x0861, 0x0000,
+		0x0863, 0x0000, 0x0865, 0x0000, 0x0867, 0x0000, 0x0869, 0x0000,
+		0x086B, 0x0000, 0x086D, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x086F, 0x0000, 0x0871, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0873, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0875, 0x0000, 0x0877, 0x0000, 0x0879, 0x0000, 0x087B, 0x0000,
+		0x087D, 0x0000, 0x087F, 0x0000, 0x0881, 0x0000, 0x0883, 0x0000,
+		0x0885, 0x0000, 0x0887, 0x0000, 0x0889, 0x0000, 0x088B, 0x0000,
+		0x088D, 0x0000, 0x088F, 0x0000, 0x0891, 0x0000, 0x0893, 0x0000,
+		0x0895, 0x0000, 0x0897, 0x0000, 0x0899, 0x0000, 0x089B, 0x0000,
+		0x089D, 0x0000, 0x089F, 0x0000, 0x08A1, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x08A3, 0x0000, 0x08A5, 0x0000, 0x08A7, 0x0000, 0x08A9, 0x0000,
+		0x08AB, 0x0000, 0x08AD, 0x0000, 0x08AF, 0x0000, 0x08B1, 0x0000,
+		0x08B3, 0x0000, 0x08B5, 0x0000, 0x08B7, 0x0000, 0x08B9, 0x0000,
+		0x08BB, 0x0000, 0x08BD, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x08BF, 0x0000, 0x08C1, 0x0000, 0x08C3, 0x0000,
+		0x08C5, 0x0000, 0x08C7, 0x0000, 0x08C9, 0x0000, 0x08CB, 0x0000,
+		0x0000, 0x0000, 0x08CD, 0x0000, 0x08CF, 0x0000, 0x08D1, 0x0000,
+		0x08D3, 0x0000, 0x08D5, 0x0000, 0x08D7, 0x0000, 0x08D9, 0x0000,
+		0x08DB, 0x0000, 0x08DD, 0x0000, 0x08DF, 0x0000, 0x08E1, 0x0000,
+		0x08E3, 0x0000, 0x08E5, 0x0000, 0x08E7, 0x0000, 0x08E9, 0x0000,
+		0x08EB, 0x0000, 0x08ED, 0x0000, 0x08EF, 0x0000, 0x08F1, 0x0000,
+		0x08F3, 0x0000, 0x08F5, 0x0000, 0x08F7, 0x0000, 0x08F9, 0x0000,
+		0x08FB, 0x0000, 0x08FD, 0x0000, 0x08FF, 0x0000, 0x0901, 0x0000,
+		0x0903, 0x0000, 0x0905, 0x0000, 0x0907, 0x0000, 0x0909, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x090B, 0x0000, 0x090D, 0x0000, 0x090F, 0x0911, 0x0000,
+		0x0913, 0x0000, 0x0915, 0x0000, 0x0917, 0x0000, 0x0919, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x091B, 0x0000, 0x091D, 0x0000, 0x0000,
+		0x091F, 0x0000, 0x0921, 0x0000, 0x0000, 0x0000, 0x0923, 0x0000,
+		0x0925, 0x0000, 0x0927, 0x0000, 0x0929, 0x0000, 0x092B, 0x0000,
+		0x092D, 0x0000, 0x092F, 0x0000, 0x0931, 0x0000, 0x0933, 0x0000,
+		0x0935, 0x0000, 0x0937, 0x0939, 0x093B, 0x093D, 0x093F, 0x0000,
+		0x0941, 0x0943, 0x0945, 0x0947, 0x0949, 0x0000, 0x094B, 0x0000,
+		0x094D, 0x0000, 0x094F, 0x0000, 0x0951, 0x0000, 0x0953, 0x0000,
+		0x0955, 0x0000, 0x0957, 0x0000, 0x0959, 0x095B, 0x095D, 0x095F,
+		0x0000, 0x0961, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0963, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0965, 0x0000,
+		0x0967, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0969, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x096B, 0x096D, 0x096F, 0x0971, 0x0973, 0x0975, 0x0977, 0x0979,
+		0x097B, 0x097D, 0x097F, 0x0981, 0x0983, 0x0985, 0x0987, 0x0989,
+		0x098B, 0x098D, 0x098F, 0x0991, 0x0993, 0x0995, 0x0997, 0x0999,
+		0x099B, 0x099D, 0x099F, 0x09A1, 0x09A3, 0x09A5, 0x09A7, 0x09A9,
+		0x09AB, 0x09AD, 0x09AF, 0x09B1, 0x09B3, 0x09B5, 0x09B7, 0x09B9,
+		0x09BB, 0x09BD, 0x09BF, 0x09C1, 0x09C3, 0x09C5, 0x09C7, 0x09C9,
+		0x09CB, 0x09CD, 0x09CF, 0x09D1, 0x09D3, 0x09D5, 0x09D7, 0x09D9,
+		0x09DB, 0x09DD, 0x09DF, 0x09E1, 0x09E3, 0x09E5, 0x09E7, 0x09E9,
+		0x09EB, 0x09ED, 0x09EF, 0x09F1, 0x09F3, 0x09F5, 0x09F7, 0x09F9,
+		0x09FB, 0x09FD, 0x09FF, 0x0A01, 0x0A03, 0x0A05, 0x0A07, 0x0A09,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0A0B, 0x0A0E, 0x0A11, 0x0A14, 0x0A18, 0x0A1C, 0x0A1F, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0A22, 0x0A25, 0x0A28, 0x0A2B, 0x0A2E,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0A31, 0x0A33, 0x0A35, 0x0A37, 0x0A39, 0x0A3B, 0x0A3D,
+		0x0A3F, 0x0A41, 0x0A43, 0x0A45, 0x0A47, 0x0A49, 0x0A4B, 0x0A4D,
+		0x0A4F, 0x0A51, 0x0A53, 0x0A55, 0x0A57, 0x0A59, 0x0A5B, 0x0A5D,
+		0x0A5F, 0x0A61, 0x0A63, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0A65, 0x0A67, 0x0A69, 0x0A6B, 0x0A6D, 0x0A6F, 0x0A71, 0x0A73,
+		0x0A75, 0x0A77, 0x0A79, 0x0A7B, 0x0A7D, 0x0A7F, 0x0A81, 0x0A83,
+		0x0A85, 0x0A87, 0x0A89, 0x0A8B, 0x0A8D, 0x0A8F, 0x0A91, 0x0A93,
+		0x0A95, 0x0A97, 0x0A99, 0x0A9B, 0x0A9D, 0x0A9F, 0x0AA1, 0x0AA3,
+		0x0AA5, 0x0AA7, 0x0AA9, 0x0AAB, 0x0AAD, 0x0AAF, 0x0AB1, 0x0AB3,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0AB5, 0x0AB7, 0x0AB9, 0x0ABB, 0x0ABD, 0x0ABF, 0x0AC1, 0x0AC3,
+		0x0AC5, 0x0AC7, 0x0AC9, 0x0ACB, 0x0ACD, 0x0ACF, 0x0AD1, 0x0AD3,
+		0x0AD5, 0x0AD7, 0x0AD9, 0x0ADB, 0x0ADD, 0x0ADF, 0x0AE1, 0x0AE3,
+		0x0AE5, 0x0AE7, 0x0AE9, 0x0AEB, 0x0AED, 0x0AEF, 0x0AF1, 0x0AF3,
+		0x0AF5, 0x0AF7, 0x0AF9, 0x0AFB, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0AFD, 0x0AFF, 0x0B01, 0x0B03, 0x0B05, 0x0B07, 0x0B09, 0x0B0B,
+		0x0B0D, 0x0B0F, 0x0B11, 0x0000, 0x0B13, 0x0B15, 0x0B17, 0x0B19,
+		0x0B1B, 0x0B1D, 0x0B1F, 0x0B21, 0x0B23, 0x0B25, 0x0B27, 0x0B29,
+		0x0B2B, 0x0B2D, 0x0B2F, 0x0000, 0x0B31, 0x0B33, 0x0B35, 0x0B37,
+		0x0B39, 0x0B3B, 0x0B3D, 0x0000, 0x0B3F, 0x0B41, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0B43, 0x0B45, 0x0B47, 0x0B49, 0x0B4B, 0x0B4D, 0x0B4F, 0x0B51,
+		0x0B53, 0x0B55, 0x0B57, 0x0B59, 0x0B5B, 0x0B5D, 0x0B5F, 0x0B61,
+		0x0B63, 0x0B65, 0x0B67, 0x0B69, 0x0B6B, 0x0B6D, 0x0B6F, 0x0B71,
+		0x0B73, 0x0B75, 0x0B77, 0x0B79, 0x0B7B, 0x0B7D, 0x0B7F, 0x0B81,
+		0x0B83, 0x0B85, 0x0B87, 0x0B89, 0x0B8B, 0x0B8D, 0x0B8F, 0x0B91,
+		0x0B93, 0x0B95, 0x0B97, 0x0B99, 0x0B9B, 0x0B9D, 0x0B9F, 0x0BA1,
+		0x0BA3, 0x0BA5, 0x0BA7, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0BA9, 0x0BAB, 0x0BAD, 0x0BAF, 0x0BB1, 0x0BB3, 0x0BB5, 0x0BB7,
+		0x0BB9, 0x0BBB, 0x0BBD, 0x0BBF, 0x0BC1, 0x0BC3, 0x0BC5, 0x0BC7,
+		0x0BC9, 0x0BCB, 0x0BCD, 0x0BCF, 0x0BD1, 0x0BD3, 0x0BD5, 0x0BD7,
+		0x0BD9, 0x0BDB, 0x0BDD, 0x0BDF, 0x0BE1, 0x0BE3, 0x0BE5, 0x0BE7,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0BE9, 0x0BEB, 0x0BED, 0x0BEF, 0x0BF1, 0x0BF3, 0x0BF5, 0x0BF7,
+		0x0BF9, 0x0BFB, 0x0BFD, 0x0BFF, 0x0C01, 0x0C03, 0x0C05, 0x0C07,
+		0x0C09, 0x0C0B, 0x0C0D, 0x0C0F, 0x0C11, 0x0C13, 0x0C15, 0x0C17,
+		0x0C19, 0x0C1B, 0x0C1D, 0x0C1F, 0x0C21, 0x0C23, 0x0C25, 0x0C27,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+	{
+		0x0C29, 0x0C2B, 0x0C2D, 0x0C2F, 0x0C31, 0x0C33, 0x0C35, 0x0C37,
+		0x0C39, 0x0C3B, 0x0C3D, 0x0C3F, 0x0C41, 0x0C43, 0x0C45, 0x0C47,
+		0x0C49, 0x0C4B, 0x0C4D, 0x0C4F, 0x0C51, 0x0C53, 0x0C55, 0x0C57,
+		0x0C59, 0x0C5B, 0x0C5D, 0x0C5F, 0x0C61, 0x0C63, 0x0C65, 0x0C67,
+		0x0C69, 0x0C6B, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+		0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+	},
+};
+
+
+const char32_t
+FOLD_mappings [3181] =
+{
+	0x00000, 0x00001, 0x00061, 0x00001, 0x00062, 0x00001, 0x00063, 0x00001,
+	0x00064, 0x00001, 0x00065, 0x00001, 0x00066, 0x00001, 0x00067, 0x00001,
+	0x00068, 0x00001, 0x00069, 0x00001, 0x0006A, 0x00001, 0x0006B, 0x00001,
+	0x0006C, 0x00001, 0x0006D, 0x00001, 0x0006E, 0x00001, 0x0006F, 0x00001,
+	0x00070, 0x00001, 0x00071, 0x00001, 0x00072, 0x00001, 0x00073, 0x00001,
+	0x00074, 0x00001, 0x00075, 0x00001, 0x00076, 0x00001, 0x00077, 0x00001,
+	0x00078, 0x00001, 0x00079, 0x00001, 0x0007A, 0x00001, 0x003BC, 0x00001,
+	0x000E0, 0x00001, 0x000E1, 0x00001, 0x000E2, 0x00001, 0x000E3, 0x00001,
+	0x000E4, 0x00001, 0x000E5, 0x00001, 0x000E6, 0x00001, 0x000E7, 0x00001,
+	0x000E8, 0x00001, 0x000E9, 0x00001, 0x000EA, 0x00001, 0x000EB, 0x00001,
+	0x000EC, 0x00001, 0x000ED, 0x00001, 0x000EE, 0x00001, 0x000EF, 0x00001,
+	0x000F0, 0x00001, 0x000F1, 0x00001, 0x000F2, 0x00001, 0x000F3, 0x00001,
+	0x000F4, 0x00001, 0x000F5, 0x00001, 0x000F6, 0x00001, 0x000F8, 0x00001,
+	0x000F9, 0x00001, 0x000FA, 0x00001, 0x000FB, 0x00001, 0x000FC, 0x00001,
+	0x000FD, 0x00001, 0x000FE, 0x00002, 0x00073, 0x00073, 0x00001, 0x00101,
+	0x00001, 0x00103, 0x00001, 0x00105, 0x00001, 0x00107, 0x00001, 0x00109,
+	0x00001, 0x0010B, 0x00001, 0x0010D, 0x00001, 0x0010F, 0x00001, 0x00111,
+	0x00001, 0x00113, 0x00001, 0x00115, 0x00001, 0x00117, 0x00001, 0x00119,
+	0x00001, 0x0011B, 0x00001, 0x0011D, 0x00001, 0x0011F, 0x00001, 0x00121,
+	0x00001, 0x00123, 0x00001, 0x00125, 0x00001, 0x00127, 0x00001, 0x00129,
+	0x00001, 0x0012B, 0x00001, 0x0012D, 0x00001, 0x0012F, 0x00002, 0x00069,
+	0x00307, 0x00001, 0x00133, 0x00001, 0x00135, 0x00001, 0x00137, 0x00001,
+	0x0013A, 0x00001, 0x0013C, 0x00001, 0x0013E, 0x00001, 0x00140, 0x00001,
+	0x00142, 0x00001, 0x00144, 0x00001, 0x00146, 0x00001, 0x00148, 0x00002,
+	0x002BC, 0x0006E, 0x00001, 0x0014B, 0x00001, 0x0014D, 0x00001, 0x0014F,
+	0x00001, 0x00151, 0x00001, 0x00153, 0x00001, 0x00155, 0x00001, 0x00157,
+	0x00001, 0x00159, 0x00001, 0x0015B, 0x00001, 0x0015D, 0x00001, 0x0015F,
+	0x00001, 0x00161, 0x00001, 0x00163, 0x00001, 0x00165, 0x00001, 0x00167,
+	0x00001, 0x00169, 0x00001, 0x0016B, 0x00001, 0x0016D, 0x00001, 0x0016F,
+	0x00001, 0x00171, 0x00001, 0x00173, 0x00001, 0x00175, 0x00001, 0x00177,
+	0x00001, 0x000FF, 0x00001, 0x0017A, 0x00001, 0x0017C, 0x00001, 0x0017E,
+	0x00001, 0x00073, 0x00001, 0x00253, 0x00001, 0x00183, 0x00001, 0x00185,
+	0x00001, 0x00254, 0x00001, 0x00188, 0x00001, 0x00256, 0x00001, 0x00257,
+	0x00001, 0x0018C, 0x00001, 0x001DD, 0x00001, 0x00259, 0x00001, 0x0025B,
+	0x00001, 0x00192, 0x00001, 0x00260, 0x00001, 0x00263, 0x00001, 0x00269,
+	0x00001, 0x00268, 0x00001, 0x00199, 0x00001, 0x0026F, 0x00001, 0x00272,
+	0x00001, 0x00275, 0x00001, 0x001A1, 0x00001, 0x001A3, 0x00001, 0x001A5,
+	0x00001, 0x00280, 0x00001, 0x001A8, 0x00001, 0x00283, 0x00001, 0x001AD,
+	0x00001, 0x00288, 0x00001, 0x001B0, 0x00001, 0x0028A, 0x00001, 0x0028B,
+	0x00001, 0x001B4, 0x00001, 0x001B6, 0x00001, 0x00292, 0x00001, 0x001B9,
+	0x00001, 0x001BD, 0x00001, 0x001C6, 0x00001, 0x001C6, 0x00001, 0x001C9,
+	0x00001, 0x001C9, 0x00001, 0x001CC, 0x00001, 0x001CC, 0x00001, 0x001CE,
+	0x00001, 0x001D0, 0x00001, 0x001D2, 0x00001, 0x001D4, 0x00001, 0x001D6,
+	0x00001, 0x001D8, 0x00001, 0x001DA, 0x00001, 0x001DC, 0x00001, 0x001DF,
+	0x00001, 0x001E1, 0x00001, 0x001E3, 0x00001, 0x001E5, 0x00001, 0x001E7,
+	0x00001, 0x001E9, 0x00001, 0x001EB, 0x00001, 0x001ED, 0x00001, 0x001EF,
+	0x00002, 0x0006A, 0x0030C, 0x00001, 0x001F3, 0x00001, 0x001F3, 0x00001,
+	0x001F5, 0x00001, 0x00195, 0x00001, 0x001BF, 0x00001, 0x001F9, 0x00001,
+	0x001FB, 0x00001, 0x001FD, 0x00001, 0x001FF, 0x00001, 0x00201, 0x00001,
+	0x00203, 0x00001, 0x00205, 0x00001, 0x00207, 0x00001, 0x00209, 0x00001,
+	0x0020B, 0x00001, 0x0020D, 0x00001, 0x0020F, 0x00001, 0x00211, 0x00001,
+	0x00213, 0x00001, 0x00215, 0x00001, 0x00217, 0x00001, 0x00219, 0x00001,
+	0x0021B, 0x00001, 0x0021D, 0x00001, 0x0021F, 0x00001, 0x0019E, 0x00001,
+	0x00223, 0x00001, 0x00225, 0x00001, 0x00227, 0x00001, 0x00229, 0x00001,
+	0x0022B, 0x00001, 0x0022D, 0x00001, 0x0022F, 0x00001, 0x00231, 0x00001,
+	0x00233, 0x00001, 0x02C65, 0x00001, 0x0023C, 0x00001, 0x0019A, 0x00001,
+	0x02C66, 0x00001, 0x00242, 0x00001, 0x00180, 0x00001, 0x00289, 0x00001,
+	0x0028C, 0x00001, 0x00247, 0x00001, 0x00249, 0x00001, 0x0024B, 0x00001,
+	0x0024D, 0x00001, 0x0024F, 0x00001, 0x003B9, 0x00001, 0x00371, 0x00001,
+	0x00373, 0x00001, 0x00377, 0x00001, 0x003F3, 0x00001, 0x003AC, 0x00001,
+	0x003AD, 0x00001, 0x003AE, 0x00001, 0x003AF, 0x00001, 0x003CC, 0x00001,
+	0x003CD, 0x00001, 0x003CE, 0x00003, 0x003B9, 0x00308, 0x00301, 0x00001,
+	0x003B1, 0x00001, 0x003B2, 0x00001, 0x003B3, 0x00001, 0x003B4, 0x00001,
+	0x003B5, 0x00001, 0x003B6, 0x00001, 0x003B7, 0x00001, 0x003B8, 0x00001,
+	0x003B9, 0x00001, 0x003BA, 0x00001, 0x003BB, 0x00001, 0x003BC, 0x00001,
+	0x003BD, 0x00001, 0x003BE, 0x00001, 0x003BF, 0x00001, 0x003C0, 0x00001,
+	0x003C1, 0x00001, 0x003C3, 0x00001, 0x003C4, 0x00001, 0x003C5, 0x00001,
+	0x003C6, 0x00001, 0x003C7, 0x00001, 0x003C8, 0x00001, 0x003C9, 0x00001,
+	0x003CA, 0x00001, 0x003CB, 0x00003, 0x003C5, 0x00308, 0x00301, 0x00001,
+	0x003C3, 0x00001, 0x003D7, 0x00001, 0x003B2, 0x00001, 0x003B8, 0x00001,
+	0x003C6, 0x00001, 0x003C0, 0x00001, 0x003D9, 0x00001, 0x003DB, 0x00001,
+	0x003DD, 0x00001, 0x003DF, 0x00001, 0x003E1, 0x00001, 0x003E3, 0x00001,
+	0x003E5, 0x00001, 0x003E7, 0x00001, 0x003E9, 0x00001, 0x003EB, 0x00001,
+	0x003ED, 0x00001, 0x003EF, 0x00001, 0x003BA, 0x00001, 0x003C1, 0x00001,
+	0x003B8, 0x00001, 0x003B5, 0x00001, 0x003F8, 0x00001, 0x003F2, 0x00001,
+	0x003FB, 0x00001, 0x0037B, 0x00001, 0x0037C, 0x00001, 0x0037D, 0x00001,
+	0x00450, 0x00001, 0x00451, 0x00001, 0x00452, 0x00001, 0x00453, 0x00001,
+	0x00454, 0x00001, 0x00455, 0x00001, 0x00456, 0x00001, 0x00457, 0x00001,
+	0x00458, 0x00001, 0x00459, 0x00001, 0x0045A, 0x00001, 0x0045B, 0x00001,
+	0x0045C, 0x00001, 0x0045D, 0x00001, 0x0045E, 0x00001, 0x0045F, 0x00001,
+	0x00430, 0x00001, 0x00431, 0x00001, 0x00432, 0x00001, 0x00433, 0x00001,
+	0x00434, 0x00001, 0x00435, 0x00001, 0x00436, 0x00001, 0x00437, 0x00001,
+	0x00438, 0x00001, 0x00439, 0x00001, 0x0043A, 0x00001, 0x0043B, 0x00001,
+	0x0043C, 0x00001, 0x0043D, 0x00001, 0x0043E, 0x00001, 0x0043F, 0x00001,
+	0x00440, 0x00001, 0x00441, 0x00001, 0x00442, 0x00001, 0x00443, 0x00001,
+	0x00444, 0x00001, 0x00445, 0x00001, 0x00446, 0x00001, 0x00447, 0x00001,
+	0x00448, 0x00001, 0x00449, 0x00001, 0x0044A, 0x00001, 0x0044B, 0x00001,
+	0x0044C, 0x00001, 0x0044D, 0x00001, 0x0044E, 0x00001, 0x0044F, 0x00001,
+	0x00461, 0x00001, 0x00463, 0x00001, 0x00465, 0x00001, 0x00467, 0x00001,
+	0x00469, 0x00001, 0x0046B, 0x00001, 0x0046D, 0x00001, 0x0046F, 0x00001,
+	0x00471, 0x00001, 0x00473, 0x00001, 0x00475, 0x00001, 0x00477, 0x00001,
+	0x00479, 0x00001, 0x0047B, 0x00001, 0x0047D, 0x00001, 0x0047F, 0x00001,
+	0x00481, 0x00001, 0x0048B, 0x00001, 0x0048D, 0x00001, 0x0048F, 0x00001,
+	0x00491, 0x00001, 0x00493, 0x00001, 0x00495, 0x00001, 0x00497, 0x00001,
+	0x00499, 0x00001, 0x0049B, 0x00001, 0x0049D, 0x00001, 0x0049F, 0x00001,
+	0x004A1, 0x00001, 0x004A3, 0x00001, 0x004A5, 0x00001, 0x004A7, 0x00001,
+	0x004A9, 0x00001, 0x004AB, 0x00001, 0x004AD, 0x00001, 0x004AF, 0x00001,
+	0x004B1, 0x00001, 0x004B3, 0x00001, 0x004B5, 0x00001, 0x004B7, 0x00001,
+	0x004B9, 0x00001, 0x004BB, 0x00001, 0x004BD, 0x00001, 0x004BF, 0x00001,
+	0x004CF, 0x00001, 0x004C2, 0x00001, 0x004C4, 0x00001, 0x004C6, 0x00001,
+	0x004C8, 0x00001, 0x004CA, 0x00001, 0x004CC, 0x00001, 0x004CE, 0x00001,
+	0x004D1, 0x00001, 0x004D3, 0x00001, 0x004D5, 0x00001, 0x004D7, 0x00001,
+	0x004D9, 0x00001, 0x004DB, 0x00001, 0x004DD, 0x00001, 0x004DF, 0x00001,
+	0x004E1, 0x00001, 0x004E3, 0x00001, 0x004E5, 0x00001, 0x004E7, 0x00001,
+	0x004E9, 0x00001, 0x004EB, 0x00001, 0x004ED, 0x00001, 0x004EF, 0x00001,
+	0x004F1, 0x00001, 0x004F3, 0x00001, 0x004F5, 0x00001, 0x004F7, 0x00001,
+	0x004F9, 0x00001, 0x004FB, 0x00001, 0x004FD, 0x00001, 0x004FF, 0x00001,
+	0x00501, 0x00001, 0x00503, 0x00001, 0x00505, 0x00001, 0x00507, 0x00001,
+	0x00509, 0x00001, 0x0050B, 0x00001, 0x0050D, 0x00001, 0x0050F, 0x00001,
+	0x00511, 0x00001, 0x00513, 0x00001, 0x00515, 0x00001, 0x00517, 0x00001,
+	0x00519, 0x00001, 0x0051B, 0x00001, 0x0051D, 0x00001, 0x0051F, 0x00001,
+	0x00521, 0x00001, 0x00523, 0x00001, 0x00525, 0x00001, 0x00527, 0x00001,
+	0x00529, 0x00001, 0x0052B, 0x00001, 0x0052D, 0x00001, 0x0052F, 0x00001,
+	0x00561, 0x00001, 0x00562, 0x00001, 0x00563, 0x00001, 0x00564, 0x00001,
+	0x00565, 0x00001, 0x00566, 0x00001, 0x00567, 0x00001, 0x00568, 0x00001,
+	0x00569, 0x00001, 0x0056A, 0x00001, 0x0056B, 0x00001, 0x0056C, 0x00001,
+	0x0056D, 0x00001, 0x0056E, 0x00001, 0x0056F, 0x00001, 0x00570, 0x00001,
+	0x00571, 0x00001, 0x00572, 0x00001, 0x00573, 0x00001, 0x00574, 0x00001,
+	0x00575, 0x00001, 0x00576, 0x00001, 0x00577, 0x00001, 0x00578, 0x00001,
+	0x00579, 0x00001, 0x0057A, 0x00001, 0x0057B, 0x00001, 0x0057C, 0x00001,
+	0x0057D, 0x00001, 0x0057E, 0x00001, 0x0057F, 0x00001, 0x00580, 0x00001,
+	0x00581, 0x00001, 0x00582, 0x00001, 0x00583, 0x00001, 0x00584, 0x00001,
+	0x00585, 0x00001, 0x00586, 0x00002, 0x00565, 0x00582, 0x00001, 0x02D00,
+	0x00001, 0x02D01, 0x00001, 0x02D02, 0x00001, 0x02D03, 0x00001, 0x02D04,
+	0x00001, 0x02D05, 0x00001, 0x02D06, 0x00001, 0x02D07, 0x00001, 0x02D08,
+	0x00001, 0x02D09, 0x00001, 0x02D0A, 0x00001, 0x02D0B, 0x00001, 0x02D0C,
+	0x00001, 0x02D0D, 0x00001, 0x02D0E, 0x00001, 0x02D0F, 0x00001, 0x02D10,
+	0x00001, 0x02D11, 0x00001, 0x02D12, 0x00001, 0x02D13, 0x00001, 0x02D14,
+	0x00001, 0x02D15, 0x00001, 0x02D16, 0x00001, 0x02D17, 0x00001, 0x02D18,
+	0x00001, 0x02D19, 0x00001, 0x02D1A, 0x00001, 0x02D1B, 0x00001, 0x02D1C,
+	0x00001, 0x02D1D, 0x00001, 0x02D1E, 0x00001, 0x02D1F, 0x00001, 0x02D20,
+	0x00001, 0x02D21, 0x00001, 0x02D22, 0x00001, 0x02D23, 0x00001, 0x02D24,
+	0x00001, 0x02D25, 0x00001, 0x02D27, 0x00001, 0x02D2D, 0x00001, 0x013F0,
+	0x00001, 0x013F1, 0x00001, 0x013F2, 0x00001, 0x013F3, 0x00001, 0x013F4,
+	0x00001, 0x013F5, 0x00001, 0x00432, 0x00001, 0x00434, 0x00001, 0x0043E,
+	0x00001, 0x00441, 0x00001, 0x00442, 0x00001, 0x00442, 0x00001, 0x0044A,
+	0x00001, 0x00463, 0x00001, 0x0A64B, 0x00001, 0x010D0, 0x00001, 0x010D1,
+	0x00001, 0x010D2, 0x00001, 0x010D3, 0x00001, 0x010D4, 0x00001, 0x010D5,
+	0x00001, 0x010D6, 0x00001, 0x010D7, 0x00001, 0x010D8, 0x00001, 0x010D9,
+	0x00001, 0x010DA, 0x00001, 0x010DB, 0x00001, 0x010DC, 0x00001, 0x010DD,
+	0x00001, 0x010DE, 0x00001, 0x010DF, 0x00001, 0x010E0, 0x00001, 0x010E1,
+	0x00001, 0x010E2, 0x00001, 0x010E3, 0x00001, 0x010E4, 0x00001, 0x010E5,
+	0x00001, 0x010E6, 0x00001, 0x010E7, 0x00001, 0x010E8, 0x00001, 0x010E9,
+	0x00001, 0x010EA, 0x00001, 0x010EB, 0x00001, 0x010EC, 0x00001, 0x010ED,
+	0x00001, 0x010EE, 0x00001, 0x010EF, 0x00001, 0x010F0, 0x00001, 0x010F1,
+	0x00001, 0x010F2, 0x00001, 0x010F3, 0x00001, 0x010F4, 0x00001, 0x010F5,
+	0x00001, 0x010F6, 0x00001, 0x010F7, 0x00001, 0x010F8, 0x00001, 0x010F9,
+	0x00001, 0x010FA, 0x00001, 0x010FD, 0x00001, 0x010FE, 0x00001, 0x010FF,
+	0x00001, 0x01E01, 0x00001, 0x01E03, 0x00001, 0x01E05, 0x00001, 0x01E07,
+	0x00001, 0x01E09, 0x00001, 0x01E0B, 0x00001, 0x01E0D, 0x00001, 0x01E0F,
+	0x00001, 0x01E11, 0x00001, 0x01E13, 0x00001, 0x01E15, 0x00001, 0x01E17,
+	0x00001, 0x01E19, 0x00001, 0x01E1B, 0x00001, 0x01E1D, 0x00001, 0x01E1F,
+	0x00001, 0x01E21, 0x00001, 0x01E23, 0x00001, 0x01E25, 0x00001, 0x01E27,
+	0x00001, 0x01E29, 0x00001, 0x01E2B, 0x00001, 0x01E2D, 0x00001, 0x01E2F,
+	0x00001, 0x01E31, 0x00001, 0x01E33, 0x00001, 0x01E35, 0x00001, 0x01E37,
+	0x00001, 0x01E39, 0x00001, 0x01E3B, 0x00001, 0x01E3D, 0x00001, 0x01E3F,
+	0x00001, 0x01E41, 0x00001, 0x01E43, 0x00001, 0x01E45, 0x00001, 0x01E47,
+	0x00001, 0x01E49, 0x00001, 0x01E4B, 0x00001, 0x01E4D, 0x00001, 0x01E4F,
+	0x00001, 0x01E51, 0x00001, 0x01E53, 0x00001, 0x01E55, 0x00001, 0x01E57,
+	0x00001, 0x01E59, 0x00001, 0x01E5B, 0x00001, 0x01E5D, 0x00001, 0x01E5F,
+	0x00001, 0x01E61, 0x00001, 0x01E63, 0x00001, 0x01E65, 0x00001, 0x01E67,
+	0x00001, 0x01E69, 0x00001, 0x01E6B, 0x00001, 0x01E6D, 0x00001, 0x01E6F,
+	0x00001, 0x01E71, 0x00001, 0x01E73, 0x00001, 0x01E75, 0x00001, 0x01E77,
+	0x00001, 0x01E79, 0x00001, 0x01E7B, 0x00001, 0x01E7D, 0x00001, 0x01E7F,
+	0x00001, 0x01E81, 0x00001, 0x01E83, 0x00001, 0x01E85, 0x00001, 0x01E87,
+	0x00001, 0x01E89, 0x00001, 0x01E8B, 0x00001, 0x01E8D, 0x00001, 0x01E8F,
+	0x00001, 0x01E91, 0x00001, 0x01E93, 0x00001, 0x01E95, 0x00002, 0x00068,
+	0x00331, 0x00002, 0x00074, 0x00308, 0x00002, 0x00077, 0x0030A, 0x00002,
+	0x00079, 0x0030A, 0x00002, 0x00061, 0x002BE, 0x00001, 0x01E61, 0x00002,
+	0x00073, 0x00073, 0x00001, 0x01EA1, 0x00001, 0x01EA3, 0x00001, 0x01EA5,
+	0x00001, 0x01EA7, 0x00001, 0x01EA9, 0x00001, 0x01EAB, 0x00001, 0x01EAD,
+	0x00001, 0x01EAF, 0x00001, 0x01EB1, 0x00001, 0x01EB3, 0x00001, 0x01EB5,
+	0x00001, 0x01EB7, 0x00001, 0x01EB9, 0x00001, 0x01EBB, 0x00001, 0x01EBD,
+	0x00001, 0x01EBF, 0x00001, 0x01EC1, 0x00001, 0x01EC3, 0x00001, 0x01EC5,
+	0x00001, 0x01EC7, 0x00001, 0x01EC9, 0x00001, 0x01ECB, 0x00001, 0x01ECD,
+	0x00001, 0x01ECF, 0x00001, 0x01ED1, 0x00001, 0x01ED3, 0x00001, 0x01ED5,
+	0x00001, 0x01ED7, 0x00001, 0x01ED9, 0x00001, 0x01EDB, 0x00001, 0x01EDD,
+	0x00001, 0x01EDF, 0x00001, 0x01EE1, 0x00001, 0x01EE3, 0x00001, 0x01EE5,
+	0x00001, 0x01EE7, 0x00001, 0x01EE9, 0x00001, 0x01EEB, 0x00001, 0x01EED,
+	0x00001, 0x01EEF, 0x00001, 0x01EF1, 0x00001, 0x01EF3, 0x00001, 0x01EF5,
+	0x00001, 0x01EF7, 0x00001, 0x01EF9, 0x00001, 0x01EFB, 0x00001, 0x01EFD,
+	0x00001, 0x01EFF, 0x00001, 0x01F00, 0x00001, 0x01F01, 0x00001, 0x01F02,
+	0x00001, 0x01F03, 0x00001, 0x01F04, 0x00001, 0x01F05, 0x00001, 0x01F06,
+	0x00001, 0x01F07, 0x00001, 0x01F10, 0x00001, 0x01F11, 0x00001, 0x01F12,
+	0x00001, 0x01F13, 0x00001, 0x01F14, 0x00001, 0x01F15, 0x00001, 0x01F20,
+	0x00001, 0x01F21, 0x00001, 0x01F22, 0x00001, 0x01F23, 0x00001, 0x01F24,
+	0x00001, 0x01F25, 0x00001, 0x01F26, 0x00001, 0x01F27, 0x00001, 0x01F30,
+	0x00001, 0x01F31, 0x00001, 0x01F32, 0x00001, 0x01F33, 0x00001, 0x01F34,
+	0x00001, 0x01F35, 0x00001, 0x01F36, 0x00001, 0x01F37, 0x00001, 0x01F40,
+	0x00001, 0x01F41, 0x00001, 0x01F42, 0x00001, 0x01F43, 0x00001, 0x01F44,
+	0x00001, 0x01F45, 0x00002, 0x003C5, 0x00313, 0x00003, 0x003C5, 0x00313,
+	0x00300, 0x00003, 0x003C5, 0x00313, 0x00301, 0x00003, 0x003C5, 0x00313,
+	0x00342, 0x00001, 0x01F51, 0x00001, 0x01F53, 0x00001, 0x01F55, 0x00001,
+	0x01F57, 0x00001, 0x01F60, 0x00001, 0x01F61, 0x00001, 0x01F62, 0x00001,
+	0x01F63, 0x00001, 0x01F64, 0x00001, 0x01F65, 0x00001, 0x01F66, 0x00001,
+	0x01F67, 0x00002, 0x01F00, 0x003B9, 0x00002, 0x01F01, 0x003B9, 0x00002,
+	0x01F02, 0x003B9, 0x00002, 0x01F03, 0x003B9, 0x00002, 0x01F04, 0x003B9,
+	0x00002, 0x01F05, 0x003B9, 0x00002, 0x01F06, 0x003B9, 0x00002, 0x01F07,
+	0x003B9, 0x00002, 0x01F00, 0x003B9, 0x00002, 0x01F01, 0x003B9, 0x00002,
+	0x01F02, 0x003B9, 0x00002, 0x01F03, 0x003B9, 0x00002, 0x01F04, 0x003B9,
+	0x00002, 0x01F05, 0x003B9, 0x00002, 0x01F06, 0x003B9, 0x00002, 0x01F07,
+	0x003B9, 0x00002, 0x01F20, 0x003B9, 0x00002, 0x01F21, 0x003B9, 0x00002,
+	0x01F22, 0x003B9, 0x00002, 0x01F23, 0x003B9, 0x00002, 0x01F24, 0x003B9,
+	0x00002, 0x01F25, 0x003B9, 0x00002, 0x01F26, 0x003B9, 0x00002, 0x01F27,
+	0x003B9, 0x00002, 0x01F20, 0x003B9, 0x00002, 0x01F21, 0x003B9, 0x00002,
+	0x01F22, 0x003B9, 0x00002, 0x01F23, 0x003B9, 0x00002, 0x01F24, 0x003B9,
+	0x00002, 0x01F25, 0x003B9, 0x00002, 0x01F26, 0x003B9, 0x00002, 0x01F27,
+	0x003B9, 0x00002, 0x01F60, 0x003B9, 0x00002, 0x01F61, 0x003B9, 0x00002,
+	0x01F62, 0x003B9, 0x00002, 0x01F63, 0x003B9, 0x00002, 0x01F64, 0x003B9,
+	0x00002, 0x01F65, 0x003B9, 0x00002, 0x01F66, 0x003B9, 0x00002, 0x01F67,
+	0x003B9, 0x00002, 0x01F60, 0x003B9, 0x00002, 0x01F61, 0x003B9, 0x00002,
+	0x01F62, 0x003B9, 0x00002, 0x01F63, 0x003B9, 0x00002, 0x01F64, 0x003B9,
+	0x00002, 0x01F65, 0x003B9, 0x00002, 0x01F66, 0x003B9, 0x00002, 0x01F67,
+	0x003B9, 0x00002, 0x01F70, 0x003B9, 0x00002, 0x003B1, 0x003B9, 0x00002,
+	0x003AC, 0x003B9, 0x00002, 0x003B1, 0x00342, 0x00003, 0x003B1, 0x00342,
+	0x003B9, 0x00001, 0x01FB0, 0x00001, 0x01FB1, 0x00001, 0x01F70, 0x00001,
+	0x01F71, 0x00002, 0x003B1, 0x003B9, 0x00001, 0x003B9, 0x00002, 0x01F74,
+	0x003B9, 0x00002, 0x003B7, 0x003B9, 0x00002, 0x003AE, 0x003B9, 0x00002,
+	0x003B7, 0x00342, 0x00003, 0x003B7, 0x00342, 0x003B9, 0x00001, 0x01F72,
+	0x00001, 0x01F73, 0x00001, 0x01F74, 0x00001, 0x01F75, 0x00002, 0x003B7,
+	0x003B9, 0x00003, 0x003B9, 0x00308, 0x00300, 0x00003, 0x003B9, 0x00308,
+	0x00301, 0x00002, 0x003B9, 0x00342, 0x00003, 0x003B9, 0x00308, 0x00342,
+	0x00001, 0x01FD0, 0x00001, 0x01FD1, 0x00001, 0x01F76, 0x00001, 0x01F77,
+	0x00003, 0x003C5, 0x00308, 0x00300, 0x00003, 0x003C5, 0x00308, 0x00301,
+	0x00002, 0x003C1, 0x00313, 0x00002, 0x003C5, 0x00342, 0x00003, 0x003C5,
+	0x00308, 0x00342, 0x00001, 0x01FE0, 0x00001, 0x01FE1, 0x00001, 0x01F7A,
+	0x00001, 0x01F7B, 0x00001, 0x01FE5, 0x00002, 0x01F7C, 0x003B9, 0x00002,
+	0x003C9, 0x003B9, 0x00002, 0x003CE, 0x003B9, 0x00002, 0x003C9, 0x00342,
+	0x00003, 0x003C9, 0x00342, 0x003B9, 0x00001, 0x01F78, 0x00001, 0x01F79,
+	0x00001, 0x01F7C, 0x00001, 0x01F7D, 0x00002, 0x003C9, 0x003B9, 0x00001,
+	0x003C9, 0x00001, 0x0006B, 0x00001, 0x000E5, 0x00001, 0x0214E, 0x00001,
+	0x02170, 0x00001, 0x02171, 0x00001, 0x02172, 0x00001, 0x02173, 0x00001,
+	0x02174, 0x00001, 0x02175, 0x00001, 0x02176, 0x00001, 0x02177, 0x00001,
+	0x02178, 0x00001, 0x02179, 0x00001, 0x0217A, 0x00001, 0x0217B, 0x00001,
+	0x0217C, 0x00001, 0x0217D, 0x00001, 0x0217E, 0x00001, 0x0217F, 0x00001,
+	0x02184, 0x00001, 0x024D0, 0x00001, 0x024D1, 0x00001, 0x024D2, 0x00001,
+	0x024D3, 0x00001, 0x024D4, 0x00001, 0x024D5, 0x00001, 0x024D6, 0x00001,
+	0x024D7, 0x00001, 0x024D8, 0x00001, 0x024D9, 0x00001, 0x024DA, 0x00001,
+	0x024DB, 0x00001, 0x024DC, 0x00001, 0x024DD, 0x00001, 0x024DE, 0x00001,
+	0x024DF, 0x00001, 0x024E0, 0x00001, 0x024E1, 0x00001, 0x024E2, 0x00001,
+	0x024E3, 0x00001, 0x024E4, 0x00001, 0x024E5, 0x00001, 0x024E6, 0x00001,
+	0x024E7, 0x00001, 0x024E8, 0x00001, 0x024E9, 0x00001, 0x02C30, 0x00001,
+	0x02C31, 0x00001, 0x02C32, 0x00001, 0x02C33, 0x00001, 0x02C34, 0x00001,
+	0x02C35, 0x00001, 0x02C36, 0x00001, 0x02C37, 0x00001, 0x02C38, 0x00001,
+	0x02C39, 0x00001, 0x02C3A, 0x00001, 0x02C3B, 0x00001, 0x02C3C, 0x00001,
+	0x02C3D, 0x00001, 0x02C3E, 0x00001, 0x02C3F, 0x00001, 0x02C40, 0x00001,
+	0x02C41, 0x00001, 0x02C42, 0x00001, 0x02C43, 0x00001, 0x02C44, 0x00001,
+	0x02C45, 0x00001, 0x02C46, 0x00001, 0x02C47, 0x00001, 0x02C48, 0x00001,
+	0x02C49, 0x00001, 0x02C4A, 0x00001, 0x02C4B, 0x00001, 0x02C4C, 0x00001,
+	0x02C4D, 0x00001, 0x02C4E, 0x00001, 0x02C4F, 0x00001, 0x02C50, 0x00001,
+	0x02C51, 0x00001, 0x02C52, 0x00001, 0x02C53, 0x00001, 0x02C54, 0x00001,
+	0x02C55, 0x00001, 0x02C56, 0x00001, 0x02C57, 0x00001, 0x02C58, 0x00001,
+	0x02C59, 0x00001, 0x02C5A, 0x00001, 0x02C5B, 0x00001, 0x02C5C, 0x00001,
+	0x02C5D, 0x00001, 0x02C5E, 0x00001, 0x02C5F, 0x00001, 0x02C61, 0x00001,
+	0x0026B, 0x00001, 0x01D7D, 0x00001, 0x0027D, 0x00001, 0x02C68, 0x00001,
+	0x02C6A, 0x00001, 0x02C6C, 0x00001, 0x00251, 0x00001, 0x00271, 0x00001,
+	0x00250, 0x00001, 0x00252, 0x00001, 0x02C73, 0x00001, 0x02C76, 0x00001,
+	0x0023F, 0x00001, 0x00240, 0x00001, 0x02C81, 0x00001, 0x02C83, 0x00001,
+	0x02C85, 0x00001, 0x02C87, 0x00001, 0x02C89, 0x00001, 0x02C8B, 0x00001,
+	0x02C8D, 0x00001, 0x02C8F, 0x00001, 0x02C91, 0x00001, 0x02C93, 0x00001,
+	0x02C95, 0x00001, 0x02C97, 0x00001, 0x02C99, 0x00001, 0x02C9B, 0x00001,
+	0x02C9D, 0x00001, 0x02C9F, 0x00001, 0x02CA1, 0x00001, 0x02CA3, 0x00001,
+	0x02CA5, 0x00001, 0x02CA7, 0x00001, 0x02CA9, 0x00001, 0x02CAB, 0x00001,
+	0x02CAD, 0x00001, 0x02CAF, 0x00001, 0x02CB1, 0x00001, 0x02CB3, 0x00001,
+	0x02CB5, 0x00001, 0x02CB7, 0x00001, 0x02CB9, 0x00001, 0x02CBB, 0x00001,
+	0x02CBD, 0x00001, 0x02CBF, 0x00001, 0x02CC1, 0x00001, 0x02CC3, 0x00001,
+	0x02CC5, 0x00001, 0x02CC7, 0x00001, 0x02CC9, 0x00001, 0x02CCB, 0x00001,
+	0x02CCD, 0x00001, 0x02CCF, 0x00001, 0x02CD1, 0x00001, 0x02CD3, 0x00001,
+	0x02CD5, 0x00001, 0x02CD7, 0x00001, 0x02CD9, 0x00001, 0x02CDB, 0x00001,
+	0x02CDD, 0x00001, 0x02CDF, 0x00001, 0x02CE1, 0x00001, 0x02CE3, 0x00001,
+	0x02CEC, 0x00001, 0x02CEE, 0x00001, 0x02CF3, 0x00001, 0x0A641, 0x00001,
+	0x0A643, 0x00001, 0x0A645, 0x00001, 0x0A647, 0x00001, 0x0A649, 0x00001,
+	0x0A64B, 0x00001, 0x0A64D, 0x00001, 0x0A64F, 0x00001, 0x0A651, 0x00001,
+	0x0A653, 0x00001, 0x0A655, 0x00001, 0x0A657, 0x00001, 0x0A659, 0x00001,
+	0x0A65B, 0x00001, 0x0A65D, 0x00001, 0x0A65F, 0x00001, 0x0A661, 0x00001,
+	0x0A663, 0x00001, 0x0A665, 0x00001, 0x0A667, 0x00001, 0x0A669, 0x00001,
+	0x0A66B, 0x00001, 0x0A66D, 0x00001, 0x0A681, 0x00001, 0x0A683, 0x00001,
+	0x0A685, 0x00001, 0x0A687, 0x00001, 0x0A689, 0x00001, 0x0A68B, 0x00001,
+	0x0A68D, 0x00001, 0x0A68F, 0x00001, 0x0A691, 0x00001, 0x0A693, 0x00001,
+	0x0A695, 0x00001, 0x0A697, 0x00001, 0x0A699, 0x00001, 0x0A69B, 0x00001,
+	0x0A723, 0x00001, 0x0A725, 0x00001, 0x0A727, 0x00001, 0x0A729, 0x00001,
+	0x0A72B, 0x00001, 0x0A72D, 0x00001, 0x0A72F, 0x00001, 0x0A733, 0x00001,
+	0x0A735, 0x00001, 0x0A737, 0x00001, 0x0A739, 0x00001, 0x0A73B, 0x00001,
+	0x0A73D, 0x00001, 0x0A73F, 0x00001, 0x0A741, 0x00001, 0x0A743, 0x00001,
+	0x0A745, 0x00001, 0x0A747, 0x00001, 0x0A749, 0x00001, 0x0A74B, 0x00001,
+	0x0A74D, 0x00001, 0x0A74F, 0x00001, 0x0A751, 0x00001, 0x0A753, 0x00001,
+	0x0A755, 0x00001, 0x0A757, 0x00001, 0x0A759, 0x00001, 0x0A75B, 0x00001,
+	0x0A75D, 0x00001, 0x0A75F, 0x00001, 0x0A761, 0x00001, 0x0A763, 0x00001,
+	0x0A765, 0x00001, 0x0A767, 0x00001, 0x0A769, 0x00001, 0x0A76B, 0x00001,
+	0x0A76D, 0x00001, 0x0A76F, 0x00001, 0x0A77A, 0x00001, 0x0A77C, 0x00001,
+	0x01D79, 0x00001, 0x0A77F, 0x00001, 0x0A781, 0x00001, 0x0A783, 0x00001,
+	0x0A785, 0x00001, 0x0A787, 0x00001, 0x0A78C, 0x00001, 0x00265, 0x00001,
+	0x0A791, 0x00001, 0x0A793, 0x00001, 0x0A797, 0x00001, 0x0A799, 0x00001,
+	0x0A79B, 0x00001, 0x0A79D, 0x00001, 0x0A79F, 0x00001, 0x0A7A1, 0x00001,
+	0x0A7A3, 0x00001, 0x0A7A5, 0x00001, 0x0A7A7, 0x00001, 0x0A7A9, 0x00001,
+	0x00266, 0x00001, 0x0025C, 0x00001, 0x00261, 0x00001, 0x0026C, 0x00001,
+	0x0026A, 0x00001, 0x0029E, 0x00001, 0x00287, 0x00001, 0x0029D, 0x00001,
+	0x0AB53, 0x00001, 0x0A7B5, 0x00001, 0x0A7B7, 0x00001, 0x0A7B9, 0x00001,
+	0x0A7BB, 0x00001, 0x0A7BD, 0x00001, 0x0A7BF, 0x00001, 0x0A7C1, 0x00001,
+	0x0A7C3, 0x00001, 0x0A794, 0x00001, 0x00282, 0x00001, 0x01D8E, 0x00001,
+	0x0A7C8, 0x00001, 0x0A7CA, 0x00001, 0x0A7D1, 0x00001, 0x0A7D7, 0x00001,
+	0x0A7D9, 0x00001, 0x0A7F6, 0x00001, 0x013A0, 0x00001, 0x013A1, 0x00001,
+	0x013A2, 0x00001, 0x013A3, 0x00001, 0x013A4, 0x00001, 0x013A5, 0x00001,
+	0x013A6, 0x00001, 0x013A7, 0x00001, 0x013A8, 0x00001, 0x013A9, 0x00001,
+	0x013AA, 0x00001, 0x013AB, 0x00001, 0x013AC, 0x00001, 0x013AD, 0x00001,
+	0x013AE, 0x00001, 0x013AF, 0x00001, 0x013B0, 0x00001, 0x013B1, 0x00001,
+	0x013B2, 0x00001, 0x013B3, 0x00001, 0x013B4, 0x00001, 0x013B5, 0x00001,
+	0x013B6, 0x00001, 0x013B7, 0x00001, 0x013B8, 0x00001, 0x013B9, 0x00001,
+	0x013BA, 0x00001, 0x013BB, 0x00001, 0x013BC, 0x00001, 0x013BD, 0x00001,
+	0x013BE, 0x00001, 0x013BF, 0x00001, 0x013C0, 0x00001, 0x013C1, 0x00001,
+	0x013C2, 0x00001, 0x013C3, 0x00001, 0x013C4, 0x00001, 0x013C5, 0x00001,
+	0x013C6, 0x00001, 0x013C7, 0x00001, 0x013C8, 0x00001, 0x013C9, 0x00001,
+	0x013CA, 0x00001, 0x013CB, 0x00001, 0x013CC, 0x00001, 0x013CD, 0x00001,
+	0x013CE, 0x00001, 0x013CF, 0x00001, 0x013D0, 0x00001, 0x013D1, 0x00001,
+	0x013D2, 0x00001, 0x013D3, 0x00001, 0x013D4, 0x00001, 0x013D5, 0x00001,
+	0x013D6, 0x00001, 0x013D7, 0x00001, 0x013D8, 0x00001, 0x013D9, 0x00001,
+	0x013DA, 0x00001, 0x013DB, 0x00001, 0x013DC, 0x00001, 0x013DD, 0x00001,
+	0x013DE, 0x00001, 0x013DF, 0x00001, 0x013E0, 0x00001, 0x013E1, 0x00001,
+	0x013E2, 0x00001, 0x013E3, 0x00001, 0x013E4, 0x00001, 0x013E5, 0x00001,
+	0x013E6, 0x00001, 0x013E7, 0x00001, 0x013E8, 0x00001, 0x013E9, 0x00001,
+	0x013EA, 0x00001, 0x013EB, 0x00001, 0x013EC, 0x00001, 0x013ED, 0x00001,
+	0x013EE, 0x00001, 0x013EF, 0x00002, 0x00066, 0x00066, 0x00002, 0x00066,
+	0x00069, 0x00002, 0x00066, 0x0006C, 0x00003, 0x00066, 0x00066, 0x00069,
+	0x00003, 0x00066, 0x00066, 0x0006C, 0x00002, 0x00073, 0x00074, 0x00002,
+	0x00073, 0x00074, 0x00002, 0x00574, 0x00576, 0x00002, 0x00574, 0x00565,
+	0x00002, 0x00574, 0x0056B, 0x00002, 0x0057E, 0x00576, 0x00002, 0x00574,
+	0x0056D, 0x00001, 0x0FF41, 0x00001, 0x0FF42, 0x00001, 0x0FF43, 0x00001,
+	0x0FF44, 0x00001, 0x0FF45, 0x00001, 0x0FF46, 0x00001, 0x0FF47, 0x00001,
+	0x0FF48, 0x00001, 0x0FF49, 0x00001, 0x0FF4A, 0x00001, 0x0FF4B, 0x00001,
+	0x0FF4C, 0x00001, 0x0FF4D, 0x00001, 0x0FF4E, 0x00001, 0x0FF4F, 0x00001,
+	0x0FF50, 0x00001, 0x0FF51, 0x00001, 0x0FF52, 0x00001, 0x0FF53, 0x00001,
+	0x0FF54, 0x00001, 0x0FF55, 0x00001, 0x0FF56, 0x00001, 0x0FF57, 0x00001,
+	0x0FF58, 0x00001, 0x0FF59, 0x00001, 0x0FF5A, 0x00001, 0x10428, 0x00001,
+	0x10429, 0x00001, 0x1042A, 0x00001, 0x1042B, 0x00001, 0x1042C, 0x00001,
+	0x1042D, 0x00001, 0x1042E, 0x00001, 0x1042F, 0x00001, 0x10430, 0x00001,
+	0x10431, 0x00001, 0x10432, 0x00001, 0x10433, 0x00001, 0x10434, 0x00001,
+	0x10435, 0x00001, 0x10436, 0x00001, 0x10437, 0x00001, 0x10438, 0x00001,
+	0x10439, 0x00001, 0x1043A, 0x00001, 0x1043B, 0x00001, 0x1043C, 0x00001,
+	0x1043D, 0x00001, 0x1043E, 0x00001, 0x1043F, 0x00001, 0x10440, 0x00001,
+	0x10441, 0x00001, 0x10442, 0x00001, 0x10443, 0x00001, 0x10444, 0x00001,
+	0x10445, 0x00001, 0x10446, 0x00001, 0x10447, 0x00001, 0x10448, 0x00001,
+	0x10449, 0x00001, 0x1044A, 0x00001, 0x1044B, 0x00001, 0x1044C, 0x00001,
+	0x1044D, 0x00001, 0x1044E, 0x00001, 0x1044F, 0x00001, 0x104D8, 0x00001,
+	0x104D9, 0x00001, 0x104DA, 0x00001, 0x104DB, 0x00001, 0x104DC, 0x00001,
+	0x104DD, 0x00001, 0x104DE, 0x00001, 0x104DF, 0x00001, 0x104E0, 0x00001,
+	0x104E1, 0x00001, 0x104E2, 0x00001, 0x104E3, 0x00001, 0x104E4, 0x00001,
+	0x104E5, 0x00001, 0x104E6, 0x00001, 0x104E7, 0x00001, 0x104E8, 0x00001,
+	0x104E9, 0x00001, 0x104EA, 0x00001, 0x104EB, 0x00001, 0x104EC, 0x00001,
+	0x104ED, 0x00001, 0x104EE, 0x00001, 0x104EF, 0x00001, 0x104F0, 0x00001,
+	0x104F1, 0x00001, 0x104F2, 0x00001, 0x104F3, 0x00001, 0x104F4, 0x00001,
+	0x104F5, 0x00001, 0x104F6, 0x00001, 0x104F7, 0x00001, 0x104F8, 0x00001,
+	0x104F9, 0x00001, 0x104FA, 0x00001, 0x104FB, 0x00001, 0x10597, 0x00001,
+	0x10598, 0x00001, 0x10599, 0x00001, 0x1059A, 0x00001, 0x1059B, 0x00001,
+	0x1059C, 0x00001, 0x1059D, 0x00001, 0x1059E, 0x00001, 0x1059F, 0x00001,
+	0x105A0, 0x00001, 0x105A1, 0x00001, 0x105A3, 0x00001, 0x105A4, 0x00001,
+	0x105A5, 0x00001, 0x105A6, 0x00001, 0x105A7, 0x00001, 0x105A8, 0x00001,
+	0x105A9, 0x00001, 0x105AA, 0x00001, 0x105AB, 0x00001, 0x105AC, 0x00001,
+	0x105AD, 0x00001, 0x105AE, 0x00001, 0x105AF, 0x00001, 0x105B0, 0x00001,
+	0x105B1, 0x00001, 0x105B3, 0x00001, 0x105B4, 0x00001, 0x105B5, 0x00001,
+	0x105B6, 0x00001, 0x105B7, 0x00001, 0x105B8, 0x00001, 0x105B9, 0x00001,
+	0x105BB, 0x00001, 0x105BC, 0x00001, 0x10CC0, 0x00001, 0x10CC1, 0x00001,
+	0x10CC2, 0x00001, 0x10CC3, 0x00001, 0x10CC4, 0x00001, 0x10CC5, 0x00001,
+	0x10CC6, 0x00001, 0x10CC7, 0x00001, 0x10CC8, 0x00001, 0x10CC9, 0x00001,
+	0x10CCA, 0x00001, 0x10CCB, 0x00001, 0x10CCC, 0x00001, 0x10CCD, 0x00001,
+	0x10CCE, 0x00001, 0x10CCF, 0x00001, 0x10CD0, 0x00001, 0x10CD1, 0x00001,
+	0x10CD2, 0x00001, 0x10CD3, 0x00001, 0x10CD4, 0x00001, 0x10CD5, 0x00001,
+	0x10CD6, 0x00001, 0x10CD7, 0x00001, 0x10CD8, 0x00001, 0x10CD9, 0x00001,
+	0x10CDA, 0x00001, 0x10CDB, 0x00001, 0x10CDC, 0x00001, 0x10CDD, 0x00001,
+	0x10CDE, 0x00001, 0x10CDF, 0x00001, 0x10CE0, 0x00001, 0x10CE1, 0x00001,
+	0x10CE2, 0x00001, 0x10CE3, 0x00001, 0x10CE4, 0x00001, 0x10CE5, 0x00001,
+	0x10CE6, 0x00001, 0x10CE7, 0x00001, 0x10CE8, 0x00001, 0x10CE9, 0x00001,
+	0x10CEA, 0x00001, 0x10CEB, 0x00001, 0x10CEC, 0x00001, 0x10CED, 0x00001,
+	0x10CEE, 0x00001, 0x10CEF, 0x00001, 0x10CF0, 0x00001, 0x10CF1, 0x00001,
+	0x10CF2, 0x00001, 0x118C0, 0x00001, 0x118C1, 0x00001, 0x118C2, 0x00001,
+	0x118C3, 0x00001, 0x118C4, 0x00001, 0x118C5, 0x00001, 0x118C6, 0x00001,
+	0x118C7, 0x00001, 0x118C8, 0x00001, 0x118C9, 0x00001, 0x118CA, 0x00001,
+	0x118CB, 0x00001, 0x118CC, 0x00001, 0x118CD, 0x00001, 0x118CE, 0x00001,
+	0x118CF, 0x00001, 0x118D0, 0x00001, 0x118D1, 0x00001, 0x118D2, 0x00001,
+	0x118D3, 0x00001, 0x118D4, 0x00001, 0x118D5, 0x00001, 0x118D6, 0x00001,
+	0x118D7, 0x00001, 0x118D8, 0x00001, 0x118D9, 0x00001, 0x118DA, 0x00001,
+	0x118DB, 0x00001, 0x118DC, 0x00001, 0x118DD, 0x00001, 0x118DE, 0x00001,
+	0x118DF, 0x00001, 0x16E60, 0x00001, 0x16E61, 0x00001, 0x16E62, 0x00001,
+	0x16E63, 0x00001, 0x16E64, 0x00001, 0x16E65, 0x00001, 0x16E66, 0x00001,
+	0x16E67, 0x00001, 0x16E68, 0x00001, 0x16E69, 0x00001, 0x16E6A, 0x00001,
+	0x16E6B, 0x00001, 0x16E6C, 0x00001, 0x16E6D, 0x00001, 0x16E6E, 0x00001,
+	0x16E6F, 0x00001, 0x16E70, 0x00001, 0x16E71, 0x00001, 0x16E72, 0x00001,
+	0x16E73, 0x00001, 0x16E74, 0x00001, 0x16E75, 0x00001, 0x16E76, 0x00001,
+	0x16E77, 0x00001, 0x16E78, 0x00001, 0x16E79, 0x00001, 0x16E7A, 0x00001,
+	0x16E7B, 0x00001, 0x16E7C, 0x00001, 0x16E7D, 0x00001, 0x16E7E, 0x00001,
+	0x16E7F, 0x00001, 0x1E922, 0x00001, 0x1E923, 0x00001, 0x1E924, 0x00001,
+	0x1E925, 0x00001, 0x1E926, 0x00001, 0x1E927, 0x00001, 0x1E928, 0x00001,
+	0x1E929, 0x00001, 0x1E92A, 0x00001, 0x1E92B, 0x00001, 0x1E92C, 0x00001,
+	0x1E92D, 0x00001, 0x1E92E, 0x00001, 0x1E92F, 0x00001, 0x1E930, 0x00001,
+	0x1E931, 0x00001, 0x1E932, 0x00001, 0x1E933, 0x00001, 0x1E934, 0x00001,
+	0x1E935, 0x00001, 0x1E936, 0x00001, 0x1E937, 0x00001, 0x1E938, 0x00001,
+	0x1E939, 0x00001, 0x1E93A, 0x00001, 0x1E93B, 0x00001, 0x1E93C, 0x00001,
+	0x1E93D, 0x00001, 0x1E93E, 0x00001, 0x1E93F, 0x00001, 0x1E940, 0x00001,
+	0x1E941, 0x00001, 0x1E942, 0x00001, 0x1E943,
+};
+
+
+/*----------------------------------------------------------------------------*/
+
+}	//	namespace uc
+
+LUL_end_v_namespace
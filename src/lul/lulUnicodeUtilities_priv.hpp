@@ -15,16 +15,21 @@
 
 
 //	std
+#include <algorithm>
+#include <cstddef>
 #include <string>
 #include <string_view>
+#include <type_traits>
 
 
 //	lul
 #include <Lucena-Utilities/lulConfig.hpp>
 #include <Lucena-Utilities/lulTypes.hpp>
+#include <Lucena-Utilities/lulUnicodeLiterals.hpp>
 #include <Lucena-Utilities/lulUtilities.hpp>
 
 #include "lulConfig_priv.hpp"
+#include "lulUnicodeKernels_priv.hpp"
 
 
 LUL_begin_v_namespace
@@ -36,49 +41,109 @@ namespace uc {
 	Constants
 */
 
-const char32_t			CODE_POINT_replacement				(0x0000FFFDu);
+//	The number of low bits of a code point that select its entry within a
+//	block of the display width tables.
+const std::size_t		WIDTH_block_bits					(8);
+
+//	Likewise, for the grapheme cluster break tables.
+const std::size_t		GRAPHEME_block_bits					(8);
+
+//	Likewise, for the normalization tables.
+const std::size_t		NORM_class_block_bits				(7);
+const std::size_t		NORM_decomposition_block_bits		(7);
+
+//	Likewise, for the case folding tables.
+const std::size_t		FOLD_block_bits						(8);
+
+//	Normalization quick check values; a code point whose flags are all clear
+//	is Yes for every normalization form. These must match the NORM_QC_*
+//	values in tools/lulGenerateUnicodeTables.py.
+const uint8_t			NORM_QC_nfd_no						(0x01u);
+const uint8_t			NORM_QC_nfkd_no						(0x02u);
+const uint8_t			NORM_QC_nfc_no						(0x04u);
+const uint8_t			NORM_QC_nfc_maybe					(0x08u);
+const uint8_t			NORM_QC_nfkc_no						(0x10u);
+const uint8_t			NORM_QC_nfkc_maybe					(0x20u);
+
+//	Hangul syllables are composed and decomposed arithmetically; see
+//	section 3.12 of the Unicode Standard.
+const char32_t			HANGUL_s_base						(0xAC00u);
+const char32_t			HANGUL_l_base						(0x1100u);
+const char32_t			HANGUL_v_base						(0x1161u);
+const char32_t			HANGUL_t_base						(0x11A7u);
+const char32_t			HANGUL_l_count						(19);
+const char32_t			HANGUL_v_count						(21);
+const char32_t			HANGUL_t_count						(28);
+const char32_t			HANGUL_s_count						(11172);
 
 
 /*------------------------------------------------------------------------------
-	Conversion Types
-
-	Select same for 8-bit <-> 8-bit or 16-/32-bit <-> 16-/32-bit conversions.
-	Select narrower for 16-/32-bit -> 8-bit conversions.
-	Select wider for 8-bit -> 16-/32-bit conversions.
-
-	Note that we treat 16- and 32-bit strings equivalently because of the
-	peculiarity of Unicode character encoding and its effect on string size.
+	Grapheme_Cluster_Break property values, as defined by UAX #29, plus
+	Extended_Pictographic, which is only ever assigned to code points that
+	would otherwise be Other. The order must match GRAPHEME_VALUES in
+	tools/lulGenerateUnicodeTables.py.
 */
 
-typedef enum
+enum class GraphemeBreak : uint8_t
 {
-	USTRING_CONV_same = 1,
-	USTRING_CONV_narrower,
-	USTRING_CONV_wider
-} UstringConv;
+	Other,
+	CR,
+	LF,
+	Control,
+	Extend,
+	ZWJ,
+	Regional_Indicator,
+	Prepend,
+	SpacingMark,
+	L,
+	V,
+	T,
+	LV,
+	LVT,
+	Extended_Pictographic
+};
 
 
 /*------------------------------------------------------------------------------
-	Declarations
+	Tables
+
+	These are defined in lulUnicodeUtilities_priv.cpp, where they are
+	documented; they are shared with anything else that needs to pick apart
+	UTF-8 sequences by hand, such as the stream decoders.
 */
 
-bool UTF_Decode (
-	std::wstring_view		in_string,
-	std::size_t &			io_index,
-	char32_t &				out_code);
+extern const char32_t	UTF8_code_point_range [4][2];
+extern const uint8_t	UTF8_count_trail_bytes [256];
 
-bool UTF_Decode (
-	std::string_view		in_string,
-	std::size_t &			io_index,
-	char32_t &				out_code);
+//	These are generated into lulUnicodeTables_priv.cpp by
+//	tools/lulGenerateUnicodeTables.py; use the inline accessors below
+//	(Code_Point_Width, Grapheme_Break_Property, and so on) to read them.
+extern const uint8_t	WIDTH_stage1 [0x00110000u >> WIDTH_block_bits];
+extern const uint8_t	WIDTH_stage2 [][(1u << WIDTH_block_bits) / 4];
+
+extern const uint8_t	GRAPHEME_stage1 [0x00110000u >> GRAPHEME_block_bits];
+extern const uint8_t	GRAPHEME_stage2 [][(1u << GRAPHEME_block_bits) / 2];
+
+extern const uint8_t	NORM_classes [][2];
+extern const uint8_t	NORM_class_stage1 [0x00110000u >> NORM_class_block_bits];
+extern const uint8_t	NORM_class_stage2 [][1u << NORM_class_block_bits];
+extern const uint8_t	NORM_decomposition_stage1 [0x00110000u >> NORM_decomposition_block_bits];
+extern const uint16_t	NORM_decomposition_stage2 [][1u << NORM_decomposition_block_bits];
+extern const char32_t	NORM_decompositions [];
+extern const char32_t	NORM_compositions [][3];
+extern const std::size_t	NORM_composition_count;
+
+extern const uint8_t	FOLD_stage1 [0x00110000u >> FOLD_block_bits];
+extern const uint16_t	FOLD_stage2 [][1u << FOLD_block_bits];
+extern const char32_t	FOLD_mappings [];
 
-bool UTF_Decode (
-	std::u16string_view		in_string,
-	std::size_t &			io_index,
-	char32_t &				out_code);
+
+/*------------------------------------------------------------------------------
+	Declarations
+*/
 
 bool UTF_Decode (
-	std::u32string_view		in_string,
+	std::wstring_view		in_string,
 	std::size_t &			io_index,
 	char32_t &				out_code);
 
@@ -98,72 +163,8 @@ size_t UTF_Encode (
 	char32_t				in_code,
 	std::u32string &		io_string);
 
-
-/*------------------------------------------------------------------------------
-	Estimate how much space to reserve in the destination string in order to
-	contain the converted source string. out_string is expected to be a UTF-8
-	string type (such as a std::string or a u8string, or a U8String wrapper),
-	while in_string can be any UTF-16 or UTF-32 encoded C-string.
-
-	The estimates are very rough, but should still be good enough to prevent
-	unnecessary memory churn. The basic assumption is that a string likely made
-	of all ASCII characters will map one-to-one, while any other string will
-	require around three UTF-8 characters to represent each code point in the
-	original.
-*/
-
-template <typename T, typename U>
-void Ustring_Reserve_Narrow (
-	const T in_string,
-	U & out_string)
-{
-	auto len = in_string.size();
-	
-	out_string.clear();
-
-	if (0 == len) return;
-
-	out_string.reserve ((*((unsigned char *) &in_string [0]) < 0x80) ? len : (3 * len));
-}
-
-//	Instantiate known usages. Note that (wchar_t *) will map to one of these.
-//template void Ustring_Reserve_Narrow (const char16_t *, std::size_t, U8String &);
-//template void Ustring_Reserve_Narrow (const char32_t *, std::size_t, U8String &);
-
-
-/*------------------------------------------------------------------------------
-	Estimate how much space to reserve in the destination string in order to
-	contain the converted source string. out_string is expected to be a UTF-16
-	or UTF-32 string type (either a std::wstring, a u16string, or a u32string,
-	or a wrapper such as U16String, U32String, or WString), while in_string can
-	be any UTF-8 encoded string. Note that we don’t bother estimating for
-	32-to-16 or 16-to-32 conversions since the vast majority of real strings
-	will simply map one-to-one.
-
-	The estimates are very rough, but should still be good enough to prevent
-	unnecessary memory churn. The basic assumption is that a string likely made
-	of all ASCII characters will map one-to-one, while any other string will
-	require around half as many wide chars as there were UTF-8 chars.
-*/
-
-template <typename T, typename U>
-void Ustring_Reserve_Wide (
-	const T in_string,
-	U & out_string)
-{
-	auto len = in_string.size();
-	
-	out_string.clear();
-
-	if (0 == len) return;
-
-	out_string.reserve ((*((unsigned char *) &in_string [0]) < 0x80) ? len : (len >> 1));
-}
-
-//	Instantiate known usages.
-//template void Ustring_Reserve_Wide (const char *, std::size_t, WString &);
-//template void Ustring_Reserve_Wide (const char *, std::size_t, U16String &);
-//template void Ustring_Reserve_Wide (const char *, std::size_t, U32String &);
+inline int Code_Point_Width (
+	char32_t				cp);
 
 
 /*------------------------------------------------------------------------------
@@ -171,46 +172,29 @@ void Ustring_Reserve_Wide (
 	functions, such as a std::string or std::string_view, to a Unicode-encoded 
 	std::basic_string, presumably with a different char-type. An invalid source 
 	character is converted to a Unicode replacement character and causes the 
-	function to return false; otherwise, true is returned. Note that 
-	in_conv_type is used as a small optimization to determine how much space to 
-	allocate for out_string.
+	function to return false; otherwise, true is returned. The exact length of
+	the result is counted up front, so it is allocated only once.
 */
 
 template <typename R, typename T>
 R
 To_Ustring (
 	const T &				in_string,
-	UstringConv				in_conv_type,
 	bool *					out_clean)
 {
 	if (out_clean) *out_clean = true;
 
 
-	//	Allocate our return string on the stack, and reserve space for it
-	//	based on a conservative estimate.
+	//	Allocate our return string on the stack, and reserve exactly the space
+	//	that the converted string will occupy.
 	auto nrv = R{};
 	auto len = in_string.size();
 
-	switch (in_conv_type)
-	{
-		case USTRING_CONV_narrower:
-		{
-			Ustring_Reserve_Narrow (in_string, nrv);
-			break;
-		}
+	nrv.reserve (UTF_Length_As <typename R::value_type> (in_string));
 
-		case USTRING_CONV_wider:
-		{
-			Ustring_Reserve_Wide (in_string, nrv);
-			break;
-		}
 
-		default:
-		{
-			nrv.reserve (len);
-			break;
-		}
-	}
+	using char_type = typename T::value_type;
+	auto view = std::basic_string_view <char_type> {in_string.data(), len};
 
 
 	//	Note that index is automatically advanced by UTF_Decode
@@ -218,6 +202,24 @@ To_Ustring (
 
 	while (index < len)
 	{
+		//	ASCII is encoded the same way in every UTF, so runs of it can be
+		//	copied over wholesale instead of being decoded and re-encoded.
+		if (static_cast <std::make_unsigned_t <char_type>> (view [index]) < 0x80u)
+		{
+			auto run = ASCII_Prefix (view.substr (index));
+			auto out_index = nrv.size();
+
+			nrv.resize (out_index + run);
+
+			std::transform (view.begin() + index, view.begin() + index + run,
+				nrv.begin() + out_index,
+				[] (char_type c) { return static_cast <typename R::value_type> (c); });
+
+			index += run;
+
+			continue;
+		}
+
 		char32_t code_point;
 
 		if (UTF_Decode (in_string, index, code_point))
@@ -243,154 +245,228 @@ To_Ustring (
 
 
 /*------------------------------------------------------------------------------
-	Everything after this is an inline function.
-*/
-
-/*------------------------------------------------------------------------------
-	Return true if the code point lies in the Basic Multilingual Plane (BMP)
-	[U+0, U+FFFF].
+	Return the number of terminal cells taken up by a Unicode-encoded string,
+	or -1 if it contains anything that isn’t printable. As with To_Ustring,
+	an invalid sequence is treated as a Unicode replacement character, which
+	takes up a single cell. Printable ASCII is by far the common case, so it
+	skips the decoder and the tables altogether.
 */
 
-inline bool Is_In_BMP (
-	char32_t				cp)
+template <typename T>
+std::ptrdiff_t
+UTF_Width (
+	const T &				in_string)
 {
-	return (cp < 0x00010000u);
+	using char_type = typename T::value_type;
+
+	std::ptrdiff_t nrv = 0;
+	auto len = in_string.size();
+
+
+	//	Note that index is automatically advanced by UTF_Decode
+	std::size_t index = 0;
+
+	while (index < len)
+	{
+		auto unit = static_cast <std::make_unsigned_t <char_type>> (in_string [index]);
+
+		if ((unit >= 0x20u) and (unit < 0x7Fu))
+		{
+			++nrv;
+			++index;
+
+			continue;
+		}
+
+		char32_t code_point;
+		auto width = UTF_Decode (in_string, index, code_point) ?
+			Code_Point_Width (code_point) : 1;
+
+		if (width < 0) return -1;
+
+		nrv += width;
+	}
+
+
+	return nrv;
 }
 
 
 /*------------------------------------------------------------------------------
-	Unicode noncharacters are code points within the Unicode range that are
-	never used in character encoding. These values may have special meanings in
-	other contexts (e.g., 0xfffe is used as the Byte Order Marker (BOM)).
+	Everything after this is an inline function.
+*/
 
-	Code points that are noncharacters include:
-		- the last two code points on each plane (U+__FFFE, U+__FFFF)
-		- [U+FDD0, U+FDEF]
+/*------------------------------------------------------------------------------
+	Return the number of terminal cells taken up by the code point: 0 for
+	combining marks and other zero-width characters, 2 for East Asian Wide
+	and Fullwidth characters, 1 for everything else, and -1 for control
+	characters and anything that isn’t a character at all. Code points
+	beyond U+10FFFF are not printable, either.
 */
 
-inline bool Is_Nonchar (
+inline int Code_Point_Width (
 	char32_t				cp)
 {
-	return (
-		(cp >= 0xFDD0u) &&
-		((cp <= 0xFDEFu) || ((cp & 0xFFFEu) == 0xFFFEu)) &&
-		(cp <= 0x10FFFFu));
+	if (cp > 0x10FFFFu) return -1;
+
+	auto block = WIDTH_stage1 [cp >> WIDTH_block_bits];
+	auto packed = WIDTH_stage2 [block][(cp & ((1u << WIDTH_block_bits) - 1)) >> 2];
+	auto width = (packed >> ((cp & 3u) * 2)) & 3u;
+
+	return (3u == width) ? -1 : static_cast <int> (width);
 }
 
 
 /*------------------------------------------------------------------------------
-	Code points that are not valid characters include:
-		- single surrogate code points [U+D800, U+DFFF]
-		- the last two code points on each plane (U+__FFFE, U+__FFFF)
-		- [U+FDD0, U+FDEF]
-		- values outside the Unicode range [U+0000, U+10FFFF]
+	Return the Grapheme_Cluster_Break property of the code point. The tables
+	record every Hangul syllable as LVT; the LV syllables are the ones that
+	have no trailing consonant, which is to say every 28th one, starting with
+	U+AC00.
 */
 
-inline bool Is_Char (
+inline GraphemeBreak Grapheme_Break_Property (
 	char32_t				cp)
 {
-	return (
-		(cp < 0xD800u) ||
-		((cp > 0xDFFFu) &&
-		(cp <= 0x10FFFFu) &&
-		!Is_Nonchar (cp)));
-}
+	if (cp > 0x10FFFFu) return GraphemeBreak::Other;
 
+	if ((cp >= 0xAC00u) and (cp <= 0xD7A3u) and (0 == ((cp - 0xAC00u) % 28)))
+	{
+		return GraphemeBreak::LV;
+	}
 
-/*------------------------------------------------------------------------------
-	Unicode surrogates are in the range [U+D800, U+DFFF].
-*/
+	auto block = GRAPHEME_stage1 [cp >> GRAPHEME_block_bits];
+	auto packed = GRAPHEME_stage2 [block][(cp & ((1u << GRAPHEME_block_bits) - 1)) >> 1];
 
-template <typename CHAR_T>
-inline bool Is_Surrogate (
-	CHAR_T					cp)
-{
-	return ((static_cast <uint32_t> (cp) & 0xFFFFF800u) == 0x0000D800u);
+	return static_cast <GraphemeBreak> ((packed >> ((cp & 1u) * 4)) & 0x0Fu);
 }
 
 
 /*------------------------------------------------------------------------------
-	Unicode lead surrogates are in the range [U+D800, U+DBFF].
+	Return the Canonical_Combining_Class of the code point in out_ccc, and
+	its NORM_QC_* flags in out_qc. Code points beyond U+10FFFF are treated as
+	starters that never need normalizing; they can only come from UTF-32
+	input, and are replaced by the decoder long before they get here.
 */
 
-template <typename CHAR_T>
-inline bool Is_Lead_Surrogate (
-	CHAR_T					cp)
+inline void Normalization_Properties (
+	char32_t				cp,
+	uint8_t &				out_ccc,
+	uint8_t &				out_qc)
 {
-	return ((static_cast <uint32_t> (cp) & 0xFFFFFC00u) == 0x0000D800u);
-}
+	if (cp > 0x10FFFFu)
+	{
+		out_ccc = 0;
+		out_qc = 0;
 
+		return;
+	}
 
-/*------------------------------------------------------------------------------
-	Unicode trail surrogates are in the range [U+DC00, U+DFFF].
-*/
+	auto block = NORM_class_stage1 [cp >> NORM_class_block_bits];
+	auto props = NORM_classes [NORM_class_stage2 [block]
+		[cp & ((1u << NORM_class_block_bits) - 1)]];
 
-template <typename CHAR_T>
-inline bool Is_Trail_Surrogate (
-	CHAR_T					cp)
-{
-	return ((static_cast <uint32_t> (cp) & 0xFFFFFC00u) == 0x0000DC00u);
+	out_ccc = props [0];
+	out_qc = props [1];
 }
 
 
 /*------------------------------------------------------------------------------
-	ASCII bytes are in the range [0x00, 0x7F].
+	Return the full canonical or compatibility decomposition of the code
+	point, or an empty view if it has none of that kind. Hangul syllables
+	are not covered; see HANGUL_s_base.
 */
 
-inline bool UTF8_Is_ASCII (
-	uint8_t					b)
+inline std::u32string_view Decomposition (
+	char32_t				cp,
+	bool					in_compatible)
 {
-	return ((b & 0x80) == 0x00);
-}
+	if (cp > 0x10FFFFu) return {};
 
+	auto block = NORM_decomposition_stage1 [cp >> NORM_decomposition_block_bits];
+	auto index = NORM_decomposition_stage2 [block]
+		[cp & ((1u << NORM_decomposition_block_bits) - 1)];
 
-/*------------------------------------------------------------------------------
-	UTF-8 lead bytes are in the range [0xC0, 0xFD].
-*/
+	if (0 == index) return {};
 
-inline bool UTF8_Is_Lead_Byte (
-	uint8_t					b)
-{
-	return ((b ^ 0x3E) > 0xC1);
+	auto header = NORM_decompositions [index];
+	auto canonical_size = static_cast <std::size_t> (header & 0xFFu);
+	auto compatible_size = static_cast <std::size_t> ((header >> 8) & 0xFFu);
+	auto data = &NORM_decompositions [index + 1];
+
+	if (in_compatible and compatible_size)
+	{
+		return {data + canonical_size, compatible_size};
+	}
+
+	return {data, canonical_size};
 }
 
 
 /*------------------------------------------------------------------------------
-	UTF-8 trail bytes are in the range [0x80, 0xBF].
+	Return the primary composite of the pair of code points, or 0 if they
+	don’t compose.
 */
 
-inline bool UTF8_Is_Trail_Byte (
-	uint8_t					b)
+inline char32_t Composition (
+	char32_t				in_first,
+	char32_t				in_second)
 {
-	return (b & 0xC0) == 0x80;
-}
+	//	LV syllables are made from a leading consonant and a vowel, and LVT
+	//	syllables from an LV syllable and a trailing consonant.
+	if ((in_first - HANGUL_l_base) < HANGUL_l_count)
+	{
+		if ((in_second - HANGUL_v_base) < HANGUL_v_count)
+		{
+			return HANGUL_s_base + ((in_first - HANGUL_l_base) * HANGUL_v_count +
+				(in_second - HANGUL_v_base)) * HANGUL_t_count;
+		}
+
+		return 0;
+	}
 
+	if (((in_first - HANGUL_s_base) < HANGUL_s_count) and
+		(0 == ((in_first - HANGUL_s_base) % HANGUL_t_count)))
+	{
+		if (((in_second - HANGUL_t_base) - 1) < (HANGUL_t_count - 1))
+		{
+			return in_first + (in_second - HANGUL_t_base);
+		}
 
-/*------------------------------------------------------------------------------
-	Mask off the part of a lead byte that doesn’t actually contain encoded
-	information. tc is the number of trail bytes.
-*/
+		return 0;
+	}
 
-inline char32_t UTF8_Decode_Lead_Byte (
-	uint8_t					b,
-	std::size_t				tc)
-{
-	return (b & ((1 << (6 - tc)) - 1));
+	auto end = NORM_compositions + NORM_composition_count;
+	auto found = std::lower_bound (NORM_compositions, end, in_first,
+		[in_second] (const char32_t (& entry) [3], char32_t first)
+		{
+			return (entry [0] < first) or ((entry [0] == first) and (entry [1] < in_second));
+		});
+
+	if ((found != end) and ((*found) [0] == in_first) and ((*found) [1] == in_second))
+	{
+		return (*found) [2];
+	}
+
+	return 0;
 }
 
 
 /*------------------------------------------------------------------------------
-	Mask off the part of a trail byte that doesn’t actually contain encoded
-	information; since all trail bytes have the form (b10xxxxxx), we mask out
-	the top two bits to get the real data. Slide the data already in cp over by
-	6 bits, and insert the new 6 bits of data from the trail byte.
+	Return the full case folding of the code point, which is at most 3 code
+	points long, or an empty view if the code point folds to itself.
 */
 
-inline char32_t UTF8_Decode_Trail_Byte (
-	uint8_t					b,
+inline std::u32string_view Case_Folding (
 	char32_t				cp)
 {
-	return (cp << 6) | (b & 0x3f);
+	if (cp > 0x10FFFFu) return {};
+
+	auto block = FOLD_stage1 [cp >> FOLD_block_bits];
+	auto index = FOLD_stage2 [block][cp & ((1u << FOLD_block_bits) - 1)];
+
+	if (0 == index) return {};
+
+	return {&FOLD_mappings [index + 1], static_cast <std::size_t> (FOLD_mappings [index])};
 }
 
 
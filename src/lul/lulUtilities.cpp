@@ -12,6 +12,8 @@
 
 
 //	std
+#include <algorithm>
+#include <atomic>
 #include <string>
 #include <string_view>
 
@@ -22,6 +24,7 @@
 #include <Lucena-Utilities/lulUtilities.hpp>
 
 #include "lulConfig_priv.hpp"
+#include "lulUnicodeKernels_priv.hpp"
 #include "lulUnicodeUtilities_priv.hpp"
 
 
@@ -38,6 +41,18 @@ void Append_With_Delimiter (
 std::string Generate_Target_Vec_String();
 
 
+/*------------------------------------------------------------------------------
+	Globals
+*/
+
+namespace {
+
+std::atomic <std::size_t> s_parallel_threshold {LUL_CONFIG_parallel_threshold};
+std::atomic <std::size_t> s_parallel_thread_limit {LUL_CONFIG_parallel_thread_limit};
+
+}	//	namespace
+
+
 /*------------------------------------------------------------------------------
 */
 
@@ -85,6 +100,50 @@ Get_Target_Vec_String()
 }
 
 
+/*------------------------------------------------------------------------------
+	The parallel processing settings may be changed at any time from any
+	thread; a change only affects calls made after it.
+*/
+
+std::size_t
+Get_Parallel_Threshold()
+{
+	return s_parallel_threshold.load (std::memory_order_relaxed);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+Set_Parallel_Threshold (
+	std::size_t				in_threshold)
+{
+	s_parallel_threshold.store (in_threshold, std::memory_order_relaxed);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+Get_Parallel_Thread_Limit()
+{
+	return s_parallel_thread_limit.load (std::memory_order_relaxed);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+void
+Set_Parallel_Thread_Limit (
+	std::size_t				in_thread_limit)
+{
+	s_parallel_thread_limit.store (in_thread_limit, std::memory_order_relaxed);
+}
+
+
 /*------------------------------------------------------------------------------
 */
 
@@ -93,8 +152,8 @@ UTF8_to_UTF16 (
 	std::string_view		in_string,
 	bool *					out_clean)
 {
-	auto nrv = U16String {uc::To_Ustring <std::u16string> (in_string,
-		uc::USTRING_CONV_wider, out_clean)};
+	auto nrv = U16String {uc::UTF8_Widen_To_Ustring <std::u16string> (in_string,
+		out_clean)};
 
 	return nrv;
 }
@@ -108,8 +167,8 @@ UTF8_to_UTF32 (
 	std::string_view		in_string,
 	bool *					out_clean)
 {
-	auto nrv = U32String {uc::To_Ustring <std::u32string> (in_string,
-		uc::USTRING_CONV_wider, out_clean)};
+	auto nrv = U32String {uc::UTF8_Widen_To_Ustring <std::u32string> (in_string,
+		out_clean)};
 	
 	return nrv;
 }
@@ -123,8 +182,8 @@ UTF8_to_Wide (
 	std::string_view		in_string,
 	bool *					out_clean)
 {
-	auto nrv = WString {uc::To_Ustring <std::wstring> (in_string,
-		uc::USTRING_CONV_wider, out_clean)};
+	auto nrv = WString {uc::UTF8_Widen_To_Ustring <std::wstring> (in_string,
+		out_clean)};
 	
 	return nrv;
 }
@@ -138,8 +197,7 @@ UTF16_to_UTF8 (
 	std::u16string_view		in_string,
 	bool *					out_clean)
 {
-	auto nrv = U8String {uc::To_Ustring <std::string> (in_string,
-		uc::USTRING_CONV_narrower, out_clean)};
+	auto nrv = U8String {uc::UTF_Narrow_To_Ustring (in_string, out_clean)};
 	
 	return nrv;
 }
@@ -154,7 +212,7 @@ UTF16_to_UTF32 (
 	bool *					out_clean)
 {
 	auto nrv = U32String {uc::To_Ustring <std::u32string> (in_string,
-		uc::USTRING_CONV_same, out_clean)};
+		out_clean)};
 	
 	return nrv;
 }
@@ -169,7 +227,7 @@ UTF16_to_Wide (
 	bool *					out_clean)
 {
 	auto nrv = WString {uc::To_Ustring <std::wstring> (in_string,
-		uc::USTRING_CONV_same, out_clean)};
+		out_clean)};
 	
 	return nrv;
 }
@@ -183,8 +241,7 @@ UTF32_to_UTF8 (
 	std::u32string_view		in_string,
 	bool *					out_clean)
 {
-	auto nrv = U8String {uc::To_Ustring <std::string> (in_string,
-		uc::USTRING_CONV_narrower, out_clean)};
+	auto nrv = U8String {uc::UTF_Narrow_To_Ustring (in_string, out_clean)};
 	
 	return nrv;
 }
@@ -199,7 +256,7 @@ UTF32_to_UTF16 (
 	bool *					out_clean)
 {
 	auto nrv = U16String {uc::To_Ustring <std::u16string> (in_string,
-		uc::USTRING_CONV_same, out_clean)};
+		out_clean)};
 	
 	return nrv;
 }
@@ -215,7 +272,7 @@ UTF32_to_Wide (
 {
 	#if LUL_TYPE_WCHAR_T_IS_16_BITS
 		auto nrv = WString {uc::To_Ustring <std::wstring> (in_string,
-			uc::USTRING_CONV_same, out_clean)};
+			out_clean)};
 	#else
 		//	We assume the incoming string is already valid Unicode.
 		if (out_clean) *out_clean = true;
@@ -231,23 +288,21 @@ UTF32_to_Wide (
 
 /*------------------------------------------------------------------------------
 	Verify that all the encoded sequences in the string are valid for Unicode.
+	The actual work is done by the validation kernel, which applies the same
+	rules as UTF_Decode but processes whole blocks at a time where vector
+	instructions are available.
 */
 
 bool
 Verify_String (
 	std::string_view		in_string)
 {
-	for (std::size_t i = 0; i < in_string.size(); ++i)
+	if (auto threads = uc::Parallel_Thread_Count (in_string.size()); threads > 1)
 	{
-		char32_t code_point;
-
-		if (!uc::UTF_Decode (in_string, i, code_point))
-		{
-			return false;
-		}
+		return uc::UTF8_Verify_Parallel (in_string, threads);
 	}
 
-	return true;
+	return uc::UTF8_Valid_Prefix (in_string) == in_string.size();
 }
 
 
@@ -260,11 +315,17 @@ bool
 Verify_String (
 	std::u16string_view		in_string)
 {
-	for (std::size_t i = 0; i < in_string.size(); ++i)
+	std::size_t i = 0;
+
+	while (i < in_string.size())
 	{
+		//	ASCII runs are always valid, so skip them in bulk; note that
+		//	UTF_Decode advances i on its own.
+		i += uc::ASCII_Prefix (in_string.substr (i));
+
 		char32_t code_point;
 
-		if (!uc::UTF_Decode (in_string, i, code_point))
+		if ((i < in_string.size()) and !uc::UTF_Decode (in_string, i, code_point))
 		{
 			return false;
 		}
@@ -294,6 +355,42 @@ Verify_String (
 }
 
 
+/*------------------------------------------------------------------------------
+	Return true if every code unit in the string is ASCII (i.e., below 0x80).
+	Such strings need no transcoding at all beyond widening or narrowing each
+	code unit, so this is a cheap way for callers to pick a fast path.
+*/
+
+bool
+Is_ASCII (
+	std::string_view		in_string)
+{
+	return uc::ASCII_Prefix (in_string) == in_string.size();
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+Is_ASCII (
+	std::u16string_view		in_string)
+{
+	return uc::ASCII_Prefix (in_string) == in_string.size();
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+bool
+Is_ASCII (
+	std::u32string_view		in_string)
+{
+	return uc::ASCII_Prefix (in_string) == in_string.size();
+}
+
+
 /*------------------------------------------------------------------------------
 */
 
@@ -302,8 +399,7 @@ Wide_to_UTF8 (
 	std::wstring_view		in_string,
 	bool *					out_clean)
 {
-	auto nrv = U8String {uc::To_Ustring <std::string> (in_string,
-		uc::USTRING_CONV_narrower, out_clean)};
+	auto nrv = U8String {uc::UTF_Narrow_To_Ustring (in_string, out_clean)};
 	
 	return nrv;
 }
@@ -321,7 +417,7 @@ Wide_to_UTF16 (
 	bool *					out_clean)
 {
 	auto nrv = U16String {uc::To_Ustring <std::u16string> (in_string,
-			uc::USTRING_CONV_same, out_clean)};
+		out_clean)};
 	
 	return nrv;
 }
@@ -339,12 +435,356 @@ Wide_to_UTF32 (
 	bool *					out_clean)
 {
 	auto nrv = U32String {uc::To_Ustring <std::u32string> (in_string,
-			uc::USTRING_CONV_same, out_clean)};
+		out_clean)};
 	
 	return nrv;
 }
 
 
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF8_to_Wide (
+	std::string_view		in_string,
+	stdproxy::span <wchar_t>	out_buffer)
+{
+	return uc::UTF8_Widen (in_string, out_buffer.data(),
+		static_cast <std::size_t> (out_buffer.size()));
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF8_to_UTF16 (
+	std::string_view		in_string,
+	stdproxy::span <char16_t>	out_buffer)
+{
+	return uc::UTF8_Widen (in_string, out_buffer.data(),
+		static_cast <std::size_t> (out_buffer.size()));
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF8_to_UTF32 (
+	std::string_view		in_string,
+	stdproxy::span <char32_t>	out_buffer)
+{
+	return uc::UTF8_Widen (in_string, out_buffer.data(),
+		static_cast <std::size_t> (out_buffer.size()));
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF16_to_Wide (
+	std::u16string_view		in_string,
+	stdproxy::span <wchar_t>	out_buffer)
+{
+	return uc::UTF_Convert (in_string, out_buffer.data(),
+		static_cast <std::size_t> (out_buffer.size()));
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF16_to_UTF8 (
+	std::u16string_view		in_string,
+	stdproxy::span <char>	out_buffer)
+{
+	return uc::UTF_Narrow (in_string, out_buffer.data(),
+		static_cast <std::size_t> (out_buffer.size()));
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF16_to_UTF32 (
+	std::u16string_view		in_string,
+	stdproxy::span <char32_t>	out_buffer)
+{
+	return uc::UTF_Convert (in_string, out_buffer.data(),
+		static_cast <std::size_t> (out_buffer.size()));
+}
+
+
+/*------------------------------------------------------------------------------
+	As with the allocating version, when wchar_t is 32 bits, we assume the
+	incoming string is already valid Unicode and copy as much as will fit.
+*/
+
+TranscodeResult
+UTF32_to_Wide (
+	std::u32string_view		in_string,
+	stdproxy::span <wchar_t>	out_buffer)
+{
+	#if LUL_TYPE_WCHAR_T_IS_16_BITS
+		return uc::UTF_Convert (in_string, out_buffer.data(),
+			static_cast <std::size_t> (out_buffer.size()));
+	#else
+		auto count = std::min (in_string.size(),
+			static_cast <std::size_t> (out_buffer.size()));
+
+		std::copy_n (reinterpret_cast <const wchar_t *> (in_string.data()),
+			count, out_buffer.data());
+
+		return TranscodeResult {count, count, TranscodeResult::npos};
+	#endif
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF32_to_UTF8 (
+	std::u32string_view		in_string,
+	stdproxy::span <char>	out_buffer)
+{
+	return uc::UTF_Narrow (in_string, out_buffer.data(),
+		static_cast <std::size_t> (out_buffer.size()));
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+UTF32_to_UTF16 (
+	std::u32string_view		in_string,
+	stdproxy::span <char16_t>	out_buffer)
+{
+	return uc::UTF_Convert (in_string, out_buffer.data(),
+		static_cast <std::size_t> (out_buffer.size()));
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+Wide_to_UTF8 (
+	std::wstring_view		in_string,
+	stdproxy::span <char>	out_buffer)
+{
+	return uc::UTF_Narrow (in_string, out_buffer.data(),
+		static_cast <std::size_t> (out_buffer.size()));
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+Wide_to_UTF16 (
+	std::wstring_view		in_string,
+	stdproxy::span <char16_t>	out_buffer)
+{
+	return uc::UTF_Convert (in_string, out_buffer.data(),
+		static_cast <std::size_t> (out_buffer.size()));
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+TranscodeResult
+Wide_to_UTF32 (
+	std::wstring_view		in_string,
+	stdproxy::span <char32_t>	out_buffer)
+{
+	return uc::UTF_Convert (in_string, out_buffer.data(),
+		static_cast <std::size_t> (out_buffer.size()));
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF8_Length_As_Wide (
+	std::string_view		in_string)
+{
+	return uc::UTF_Length_As <wchar_t> (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF8_Length_As_UTF16 (
+	std::string_view		in_string)
+{
+	return uc::UTF_Length_As <char16_t> (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF8_Length_As_UTF32 (
+	std::string_view		in_string)
+{
+	return uc::UTF_Length_As <char32_t> (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF16_Length_As_Wide (
+	std::u16string_view		in_string)
+{
+	return uc::UTF_Length_As <wchar_t> (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF16_Length_As_UTF8 (
+	std::u16string_view		in_string)
+{
+	return uc::UTF_Length_As <char> (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF16_Length_As_UTF32 (
+	std::u16string_view		in_string)
+{
+	return uc::UTF_Length_As <char32_t> (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF32_Length_As_Wide (
+	std::u32string_view		in_string)
+{
+	return uc::UTF_Length_As <wchar_t> (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF32_Length_As_UTF8 (
+	std::u32string_view		in_string)
+{
+	return uc::UTF_Length_As <char> (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+UTF32_Length_As_UTF16 (
+	std::u32string_view		in_string)
+{
+	return uc::UTF_Length_As <char16_t> (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+Wide_Length_As_UTF8 (
+	std::wstring_view		in_string)
+{
+	return uc::UTF_Length_As <char> (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+Wide_Length_As_UTF16 (
+	std::wstring_view		in_string)
+{
+	return uc::UTF_Length_As <char16_t> (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::size_t
+Wide_Length_As_UTF32 (
+	std::wstring_view		in_string)
+{
+	return uc::UTF_Length_As <char32_t> (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+int
+Char_Width (
+	char32_t				in_code)
+{
+	return uc::Code_Point_Width (in_code);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::ptrdiff_t
+String_Width (
+	std::string_view		in_string)
+{
+	return uc::UTF_Width (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::ptrdiff_t
+String_Width (
+	std::u16string_view		in_string)
+{
+	return uc::UTF_Width (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+std::ptrdiff_t
+String_Width (
+	std::u32string_view		in_string)
+{
+	return uc::UTF_Width (in_string);
+}
+
+
 /*----------------------------------------------------------------------------*/
 
 LUL_end_v_namespace
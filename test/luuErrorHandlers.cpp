@@ -0,0 +1,524 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“ErrorHandlers.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <atomic>
+#include <cctype>
+#include <chrono>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+
+//	gtest
+#include <gtest/gtest.h>
+
+
+//	lul
+#include <Lucena-Utilities/lulErrorHandlers.hpp>
+#include <Lucena-Utilities/lulTypes.hpp>
+
+
+//	luu
+#include "luuConfig_priv.hpp"
+
+
+/*------------------------------------------------------------------------------
+	Declarations
+*/
+
+using namespace std;
+using namespace LUL_;
+
+
+namespace {
+
+/*------------------------------------------------------------------------------
+	Collector
+
+	A target handler that tallies what it’s given. Summaries - overflow and
+	repeat counts - are tallied separately from everything else, along with
+	the counts they carry. A Status with k_code_gate waits in Post until the
+	gate is opened, which keeps an AsyncErrorHandler’s drain thread busy; a
+	Status with k_code_repost is posted back to _repost_to _reposts times.
+*/
+
+constexpr StatusCode	k_code_gate			{1000};
+constexpr StatusCode	k_code_repost		{1001};
+
+class Collector
+	:	public ErrorHandler
+{
+	public:
+		void Post (
+			Status					in_status) override
+		{
+			if (k_code_gate == in_status.Code())
+			{
+				_entered.store (true);
+
+				while (!_open.load()) this_thread::yield();
+			}
+
+			if (k_code_repost == in_status.Code())
+			{
+				for (int i = 0; i < _reposts; ++i)
+				{
+					_repost_to->Post (Status {2, 1, StaticMessage {"reposted"}});
+				}
+			}
+
+			if (_delay.count()) this_thread::sleep_for (_delay);
+
+			if ((STATUS_CODE_overflow == in_status.Code()) or
+				(STATUS_CODE_repeated == in_status.Code()))
+			{
+				auto message = string {in_status.Message()};
+				auto digits = message.find_first_of ("0123456789",
+					(STATUS_CODE_repeated == in_status.Code()) ? message.find (" repeated ") : 0);
+				auto lock = lock_guard <mutex> {_mutex};
+
+				_summaries.push_back (stoul (message.substr (digits)));
+				_summary_codes.push_back (in_status.Code());
+			}
+			else
+			{
+				_delivered.fetch_add (1);
+			}
+		}
+
+		void Flush() override
+		{
+			_flushes.fetch_add (1);
+		}
+
+		size_t Summary_Count (
+			StatusCode				in_code)
+		{
+			auto lock = lock_guard <mutex> {_mutex};
+			size_t nrv = 0;
+
+			for (auto code : _summary_codes) nrv += (code == in_code);
+
+			return nrv;
+		}
+
+		size_t Summary_Total()
+		{
+			auto lock = lock_guard <mutex> {_mutex};
+			size_t nrv = 0;
+
+			for (auto count : _summaries) nrv += count;
+
+			return nrv;
+		}
+
+		atomic <size_t>			_delivered {0};
+		atomic <size_t>			_flushes {0};
+		atomic <bool>			_entered {false};
+		atomic <bool>			_open {true};
+		chrono::microseconds	_delay {0};
+		ErrorHandler *			_repost_to {nullptr};
+		int						_reposts {0};
+
+	private:
+		mutex					_mutex;
+		vector <size_t>			_summaries;
+		vector <StatusCode>		_summary_codes;
+};
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+	Only the most recent in_depth posts per thread are kept, oldest first.
+*/
+
+GTEST_TEST (lulErrorHandlers, FlightRecorderKeepsRecentPosts)
+{
+	FlightRecorder recorder {4};
+
+	for (StatusCode code = 1; code <= 10; ++code)
+	{
+		recorder.Post (Status {1, code, "message " + to_string (code)});
+	}
+
+	ostringstream stream;
+
+	recorder.Dump (stream);
+
+	auto dump = stream.str();
+
+	EXPECT_EQ (dump.find ("message 6"), string::npos);
+	EXPECT_NE (dump.find ("(Domain: 1, Code: 7): message 7"), string::npos);
+	EXPECT_NE (dump.find ("(Domain: 1, Code: 10): message 10"), string::npos);
+	EXPECT_LT (dump.find ("message 7"), dump.find ("message 10"));
+}
+
+
+/*------------------------------------------------------------------------------
+	Dumping while another thread posts must only ever show whole records;
+	each message names its own code, so a record that was torn, and not
+	skipped, would show a mismatch. Run under ThreadSanitizer, this also
+	checks that there’s no data race between the two.
+*/
+
+GTEST_TEST (lulErrorHandlers, FlightRecorderDumpsWhilePosting)
+{
+	FlightRecorder recorder {8};
+	atomic <bool> stop {false};
+
+	thread poster {[&recorder, &stop] {
+		StatusCode code = 0;
+
+		while (!stop.load())
+		{
+			++code;
+			recorder.Post (Status {1, code, "message " + to_string (code) +
+				string (code % 120, '.')});
+		}
+	}};
+
+	for (int i = 0; i < 200; ++i)
+	{
+		ostringstream stream;
+
+		recorder.Dump (stream);
+
+		istringstream lines {stream.str()};
+		string line;
+
+		while (getline (lines, line))
+		{
+			auto code = line.find ("Code: ");
+
+			if (code == string::npos) continue;
+
+			code += 6;
+
+			auto number = line.substr (code, line.find (')', code) - code);
+			auto message = "): message " + number;
+			auto found = line.find (message);
+
+			EXPECT_NE (found, string::npos) << line;
+
+			if (found != string::npos)
+			{
+				EXPECT_FALSE (isdigit (static_cast <unsigned char> (
+					line [found + message.size()]))) << line;
+			}
+		}
+	}
+
+	stop.store (true);
+	poster.join();
+}
+
+
+/*------------------------------------------------------------------------------
+	Under load from several threads, every post is either delivered or
+	counted by Dropped; Block never drops anything, and Count reports exactly
+	what it dropped.
+*/
+
+GTEST_TEST (lulErrorHandlers, AsyncAccountsForEveryPost)
+{
+	constexpr int k_threads = 8;
+	constexpr int k_posts = 2000;
+
+	for (auto overflow : {AsyncErrorHandler::Overflow::Drop,
+		AsyncErrorHandler::Overflow::Count, AsyncErrorHandler::Overflow::Block})
+	{
+		auto collector = new Collector;
+
+		collector->_delay = chrono::microseconds {5};
+
+		AsyncErrorHandler handler {ErrorHandlerUnq {collector}, 16, overflow};
+		vector <thread> posters;
+
+		for (int t = 0; t < k_threads; ++t)
+		{
+			posters.emplace_back ([&handler] {
+				for (int i = 0; i < k_posts; ++i)
+				{
+					handler.Post (Status {1, 1, "message " + to_string (i)});
+				}
+			});
+		}
+
+		for (auto & poster : posters) poster.join();
+
+		handler.Flush();
+
+		EXPECT_EQ (collector->_delivered.load() + handler.Dropped(),
+			size_t {k_threads * k_posts});
+
+		switch (overflow)
+		{
+			case AsyncErrorHandler::Overflow::Drop:
+				EXPECT_EQ (collector->Summary_Count (STATUS_CODE_overflow), 0U);
+				break;
+
+			case AsyncErrorHandler::Overflow::Count:
+				EXPECT_EQ (collector->Summary_Total(), handler.Dropped());
+				break;
+
+			case AsyncErrorHandler::Overflow::Block:
+				EXPECT_EQ (handler.Dropped(), 0U);
+				break;
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	While the drain thread is held up, the queue fills, and the rest are
+	dropped; once it drains, they’re reported in a single post.
+*/
+
+GTEST_TEST (lulErrorHandlers, AsyncReportsDropsOncePerDrain)
+{
+	auto collector = new Collector;
+	AsyncErrorHandler handler {ErrorHandlerUnq {collector}, 2,
+		AsyncErrorHandler::Overflow::Count};
+
+	for (size_t round = 1; round <= 2; ++round)
+	{
+		collector->_entered.store (false);
+		collector->_open.store (false);
+		handler.Post (Status {1, k_code_gate, StaticMessage {"gate"}});
+
+		while (!collector->_entered.load()) this_thread::yield();
+
+		for (int i = 0; i < 7; ++i) handler.Post (Status {1, 1, StaticMessage {"x"}});
+
+		EXPECT_EQ (handler.Dropped(), 5 * round);
+
+		collector->_open.store (true);
+		handler.Flush();
+
+		EXPECT_EQ (collector->Summary_Count (STATUS_CODE_overflow), round);
+		EXPECT_EQ (collector->Summary_Total(), 5 * round);
+		EXPECT_EQ (collector->_delivered.load(), 3 * round);
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+GTEST_TEST (lulErrorHandlers, AsyncFlushDeliversEverythingPostedBeforeIt)
+{
+	auto collector = new Collector;
+	AsyncErrorHandler handler {ErrorHandlerUnq {collector}, 64,
+		AsyncErrorHandler::Overflow::Block};
+
+	for (size_t i = 1; i <= 1000; ++i)
+	{
+		handler.Post (Status {1, 1, StaticMessage {"x"}});
+
+		if (0 == (i % 250))
+		{
+			auto flushes = collector->_flushes.load();
+
+			handler.Flush();
+
+			EXPECT_EQ (collector->_delivered.load(), i);
+			EXPECT_GT (collector->_flushes.load(), flushes);
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	The target posting back into a full queue from the drain thread can’t
+	block, as only the drain thread could make room, so the extra posts are
+	dropped and counted instead, even with Overflow::Block.
+*/
+
+GTEST_TEST (lulErrorHandlers, AsyncDropsPostsFromTheDrainThread)
+{
+	auto collector = new Collector;
+	AsyncErrorHandler handler {ErrorHandlerUnq {collector}, 2,
+		AsyncErrorHandler::Overflow::Block};
+
+	collector->_repost_to = &handler;
+	collector->_reposts = 3;
+
+	handler.Post (Status {1, k_code_repost, StaticMessage {"repost"}});
+	handler.Flush();
+
+	EXPECT_EQ (handler.Dropped(), 1U);
+	EXPECT_EQ (collector->_delivered.load(), 3U);
+	EXPECT_EQ (collector->Summary_Total(), 1U);
+}
+
+
+/*------------------------------------------------------------------------------
+	The first occurrence of a kind always goes through, even with the
+	smallest possible burst.
+*/
+
+GTEST_TEST (lulErrorHandlers, ThrottledPassesFirstOccurrence)
+{
+	auto collector = new Collector;
+	ThrottledErrorHandler handler {ErrorHandlerUnq {collector}, 1, chrono::hours {1}};
+
+	handler.Post (Status {1, 1, StaticMessage {"first"}, "file", "function", 1});
+	EXPECT_EQ (collector->_delivered.load(), 1U);
+
+	handler.Post (Status {1, 1, StaticMessage {"again"}, "file", "function", 1});
+	EXPECT_EQ (collector->_delivered.load(), 1U);
+
+	handler.Post (Status {1, 1, StaticMessage {"elsewhere"}, "file", "function", 2});
+	EXPECT_EQ (collector->_delivered.load(), 2U);
+}
+
+
+/*------------------------------------------------------------------------------
+	Only the burst goes through at first; after a little more than one
+	interval, one more does. The interval is long enough that scheduling
+	delays of up to 70 ms don’t change the outcome.
+*/
+
+GTEST_TEST (lulErrorHandlers, ThrottledLimitsToBurstThenOnePerInterval)
+{
+	auto collector = new Collector;
+	ThrottledErrorHandler handler {ErrorHandlerUnq {collector}, 2,
+		chrono::milliseconds {100}};
+
+	for (int i = 0; i < 50; ++i)
+	{
+		handler.Post (Status {1, 1, StaticMessage {"storm"}, "file", "function", 1});
+	}
+
+	EXPECT_EQ (collector->_delivered.load(), 2U);
+
+	this_thread::sleep_for (chrono::milliseconds {130});
+
+	for (int i = 0; i < 50; ++i)
+	{
+		handler.Post (Status {1, 1, StaticMessage {"storm"}, "file", "function", 1});
+	}
+
+	EXPECT_EQ (collector->_delivered.load(), 3U);
+	EXPECT_EQ (collector->Summary_Count (STATUS_CODE_repeated), 1U);
+	EXPECT_EQ (collector->Summary_Total(), 48U);
+}
+
+
+/*------------------------------------------------------------------------------
+	Every post is either delivered or accounted for by a repeat count, once
+	Flush has posted the counts still pending.
+*/
+
+GTEST_TEST (lulErrorHandlers, ThrottledAccountsForEveryPost)
+{
+	constexpr int k_threads = 8;
+	constexpr int k_posts = 20000;
+
+	auto collector = new Collector;
+	ThrottledErrorHandler handler {ErrorHandlerUnq {collector}, 4,
+		chrono::milliseconds {1}};
+	vector <thread> posters;
+
+	for (int t = 0; t < k_threads; ++t)
+	{
+		posters.emplace_back ([&handler, t] {
+			for (int i = 0; i < k_posts; ++i)
+			{
+				handler.Post (Status {1, static_cast <StatusCode> (1 + (t % 2)),
+					StaticMessage {"storm"}, "file", "function", 1});
+			}
+		});
+	}
+
+	for (auto & poster : posters) poster.join();
+
+	handler.Flush();
+
+	EXPECT_EQ (collector->_delivered.load() + collector->Summary_Total(),
+		size_t {k_threads * k_posts});
+	EXPECT_LT (collector->_delivered.load(), size_t {k_threads * k_posts});
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+GTEST_TEST (lulErrorHandlers, ThrottledFlushPostsPendingCounts)
+{
+	auto collector = new Collector;
+	ThrottledErrorHandler handler {ErrorHandlerUnq {collector}, 1, chrono::hours {1}};
+
+	for (int i = 0; i < 5; ++i)
+	{
+		handler.Post (Status {1, 1, StaticMessage {"a"}, "file", "function", 1});
+		handler.Post (Status {1, 2, StaticMessage {"b"}, "file", "function", 2});
+	}
+
+	EXPECT_EQ (collector->Summary_Count (STATUS_CODE_repeated), 0U);
+
+	handler.Flush();
+
+	EXPECT_EQ (collector->Summary_Count (STATUS_CODE_repeated), 2U);
+	EXPECT_EQ (collector->Summary_Total(), 8U);
+	EXPECT_EQ (collector->_flushes.load(), 1U);
+
+	//	Nothing is reported twice.
+	handler.Flush();
+
+	EXPECT_EQ (collector->Summary_Count (STATUS_CODE_repeated), 2U);
+}
+
+
+/*------------------------------------------------------------------------------
+	With room for only two kinds, the first two are throttled, and the rest
+	pass through untouched.
+*/
+
+GTEST_TEST (lulErrorHandlers, ThrottledPassesKindsThatDontFit)
+{
+	auto collector = new Collector;
+	ThrottledErrorHandler handler {ErrorHandlerUnq {collector}, 1, chrono::hours {1}, 2};
+
+	for (int line = 1; line <= 5; ++line)
+	{
+		for (int i = 0; i < 3; ++i)
+		{
+			handler.Post (Status {1, 1, StaticMessage {"x"}, "file", "function", line});
+		}
+	}
+
+	EXPECT_EQ (collector->_delivered.load(), 2U + (3 * 3));
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+GTEST_TEST (lulErrorHandlers, ThrottledNeverThrottlesSuccesses)
+{
+	auto collector = new Collector;
+	ThrottledErrorHandler handler {ErrorHandlerUnq {collector}, 1, chrono::hours {1}};
+
+	for (int i = 0; i < 100; ++i) handler.Post (Status{});
+
+	handler.Flush();
+
+	EXPECT_EQ (collector->_delivered.load(), 100U);
+	EXPECT_EQ (collector->Summary_Count (STATUS_CODE_repeated), 0U);
+}
@@ -0,0 +1,65 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“Format.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <string>
+
+
+//	gtest
+#include <gtest/gtest.h>
+
+
+//	lul
+#include <Lucena-Utilities/lulFormat.hpp>
+
+
+//	luu
+#include "luuConfig_priv.hpp"
+
+
+/*------------------------------------------------------------------------------
+	Declarations
+*/
+
+using namespace std;
+using namespace LUL_;
+
+
+/*------------------------------------------------------------------------------
+	Escaped braces and stray braces aren’t placeholders.
+*/
+
+static_assert (Count_Placeholders ("") == 0);
+static_assert (Count_Placeholders ("{} of {}") == 2);
+static_assert (Count_Placeholders ("{{}} {{{}}}") == 1);
+static_assert (Count_Placeholders ("}{}{") == 1);
+
+
+GTEST_TEST (lulFormat, FormatsEachArgument)
+{
+	EXPECT_EQ (Format_String ("{} of {}: {{{}}}", 3, "four", 'x'), "3 of four: {x}");
+	EXPECT_EQ (Formatted_Size ("{}-{}", 10, 200), 6U);
+}
+
+
+/*------------------------------------------------------------------------------
+	A mismatched format is a programming error, caught in debug builds only.
+*/
+
+#if LUL_CONFIG_debug
+GTEST_TEST (lulFormatDeathTest, MismatchedArgumentsAssert)
+{
+	EXPECT_DEATH (Format_String ("{} and {}", 1), "");
+	EXPECT_DEATH (Format_String ("{}", 1, 2), "");
+}
+#endif
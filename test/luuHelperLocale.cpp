@@ -0,0 +1,155 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“HelperLocale.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <stdexcept>
+#include <string>
+
+
+//	gtest
+#include <gtest/gtest.h>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+#include <Lucena-Utilities/lulFeatureSetup.hpp>
+#include <Lucena-Utilities/details/lulHelperLocale.hpp>
+
+
+//	luu
+#include "luuConfig_priv.hpp"
+
+
+/*------------------------------------------------------------------------------
+	Declarations
+*/
+
+using namespace std;
+using namespace LUL_;
+using namespace LUL_::stdproxy::details;
+
+
+namespace {
+
+string
+Narrow (
+	const u16string &		in_string)
+{
+	string nrv;
+
+	__narrow_to_utf8 <16>{}.__append (nrv, in_string.data(),
+		in_string.data() + in_string.size());
+
+	return nrv;
+}
+
+
+string
+Narrow (
+	const u32string &		in_string)
+{
+	string nrv;
+
+	__narrow_to_utf8 <32>{}.__append (nrv, in_string.data(),
+		in_string.data() + in_string.size());
+
+	return nrv;
+}
+
+
+template <typename STRING>
+STRING
+Widen (
+	const string &			in_string)
+{
+	STRING nrv;
+
+	__widen_from_utf8 <8 * sizeof (typename STRING::value_type)>{}.__append (nrv,
+		in_string.data(), in_string.data() + in_string.size());
+
+	return nrv;
+}
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+	Long inputs cross chunk boundaries, so they are checked too.
+*/
+
+GTEST_TEST (lulHelperLocale, RoundTripsASCIIAndSupplementaryCharacters)
+{
+	const auto text = string {"path/to/file \xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80"};
+	const auto text16 = u16string {u"path/to/file é中\U0001F600"};
+	const auto text32 = u32string {U"path/to/file é中\U0001F600"};
+
+	EXPECT_EQ (Narrow (text16), text);
+	EXPECT_EQ (Narrow (text32), text);
+	EXPECT_EQ (Widen <u16string> (text), text16);
+	EXPECT_EQ (Widen <u32string> (text), text32);
+
+	string long_text;
+	u32string long_text32;
+
+	for (int i = 0; i < 200; ++i)
+	{
+		long_text += "ab\xF0\x9F\x98\x80";
+		long_text32 += U"ab\U0001F600";
+	}
+
+	EXPECT_EQ (Narrow (long_text32), long_text);
+	EXPECT_EQ (Widen <u32string> (long_text), long_text32);
+}
+
+
+/*------------------------------------------------------------------------------
+	File names may contain noncharacters, so they pass through unchanged, as
+	they do with std::codecvt.
+*/
+
+GTEST_TEST (lulHelperLocale, AcceptsNoncharacters)
+{
+	const auto text32 = u32string {U"a﷐b￿\U0001FFFE\U0010FFFFz"};
+	const auto text16 = u16string {u"a﷐b￿\U0001FFFE\U0010FFFFz"};
+	const auto text = string {"a\xEF\xB7\x90" "b\xEF\xBF\xBF\xF0\x9F\xBF\xBE\xF4\x8F\xBF\xBFz"};
+
+	EXPECT_EQ (Narrow (text32), text);
+	EXPECT_EQ (Narrow (text16), text);
+	EXPECT_EQ (Widen <u32string> (text), text32);
+	EXPECT_EQ (Widen <u16string> (text), text16);
+	EXPECT_EQ (Widen <u32string> ("\xEF\xB7\x90"), u32string (1, U'﷐'));
+
+	u32string many;
+
+	for (int i = 0; i < 300; ++i) many += U'￾';
+
+	EXPECT_EQ (Widen <u32string> (Narrow (many)), many);
+}
+
+
+/*------------------------------------------------------------------------------
+*/
+
+GTEST_TEST (lulHelperLocale, RejectsSurrogatesAndMalformedInput)
+{
+	EXPECT_THROW (Narrow (u16string (1, char16_t {0xD800})), runtime_error);
+	EXPECT_THROW (Narrow (u16string {u"ab"} + char16_t {0xDC00}), runtime_error);
+	EXPECT_THROW (Narrow (u32string (1, char32_t {0xDFFF})), runtime_error);
+	EXPECT_THROW (Narrow (u32string (1, char32_t {0x110000})), runtime_error);
+
+	EXPECT_THROW (Widen <u32string> ("\xED\xA0\x80"), runtime_error);
+	EXPECT_THROW (Widen <u32string> ("\xF4\x90\x80\x80"), runtime_error);
+	EXPECT_THROW (Widen <u32string> ("ab\xC0\x80"), runtime_error);
+	EXPECT_THROW (Widen <u16string> ("abc\xE2\x82"), runtime_error);
+	EXPECT_THROW (Widen <u32string> ("abc\xF0\x9F\x98"), runtime_error);
+}
@@ -0,0 +1,345 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“MemoryTypes.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <utility>
+
+
+//	gtest
+#include <gtest/gtest.h>
+
+
+//	lul
+#include <Lucena-Utilities/lulMemoryTypes.hpp>
+#include <Lucena-Utilities/lulTypes.hpp>
+
+
+//	luu
+#include "luuConfig_priv.hpp"
+
+
+/*------------------------------------------------------------------------------
+	Declarations
+*/
+
+using namespace std;
+using namespace LUL_;
+
+
+namespace {
+
+
+/*------------------------------------------------------------------------------
+	Helpers
+
+	The buffers handed to the wrappers belong to the tests, so the deleters
+	here only count their calls, except where noted; that way, the buffers
+	can still be checked after they have been released.
+*/
+
+//	Long enough not to be stored locally, so the wrapper really adopts it.
+constexpr char		k_long_text []						{"a foreign buffer that is too long to copy"};
+constexpr char		k_short_text []						{"short"};
+
+
+//	Stateless, so Adopt_String doesn’t have to store it.
+struct StaticCountingDeleter
+{
+	static inline int		s_count {0};
+
+	void					operator () (char *) const noexcept	{ ++s_count; }
+};
+
+
+//	Stateful, so Adopt_String moves it to the heap.
+struct CountingDeleter
+{
+	int *					_count;
+
+	void					operator () (char *) const noexcept	{ ++*_count; }
+};
+
+
+//	Stateful, and frees the buffer, as for one made with make_buffer.
+struct FreeingDeleter
+{
+	int *					_count;
+
+	void					operator () (char * in_data) const noexcept
+							{
+								++*_count;
+								::operator delete (in_data);
+							}
+};
+
+
+//	A copy of a literal, in storage the wrapper may not write to.
+template <size_t N>
+struct ForeignBuffer
+{
+							ForeignBuffer (
+								const char (&				in_text) [N])
+							{
+								memcpy (_data, in_text, N);
+							}
+
+	string_view				View() const noexcept	{ return {_data, N - 1}; }
+	size_t					size() const noexcept	{ return N - 1; }
+
+	char					_data [N];
+};
+
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+	The deleter runs once, when the last wrapper holding the buffer lets go of
+	it, and not when it is moved.
+*/
+
+GTEST_TEST (lulMemoryTypes, AdoptRunsStatelessDeleterOnce)
+{
+	ForeignBuffer	buffer {k_long_text};
+
+	StaticCountingDeleter::s_count = 0;
+
+	{
+		auto adopted = Adopt_String <U8String, StaticCountingDeleter> (
+			buffer._data, buffer.size());
+
+		EXPECT_EQ (adopted.Get_StringView().data(), buffer._data);
+
+		auto moved = std::move (adopted);
+		U8String	assigned;
+
+		assigned = std::move (moved);
+		EXPECT_EQ (assigned.Get_StringView().data(), buffer._data);
+		EXPECT_EQ (StaticCountingDeleter::s_count, 0);
+	}
+
+	EXPECT_EQ (StaticCountingDeleter::s_count, 1);
+	EXPECT_EQ (buffer.View(), k_long_text);
+}
+
+
+GTEST_TEST (lulMemoryTypes, AdoptRunsStatefulDeleterOnce)
+{
+	ForeignBuffer	buffer {k_long_text};
+	int				count {0};
+
+	{
+		auto adopted = Adopt_String <U8String> (buffer._data, buffer.size(),
+			CountingDeleter {&count});
+
+		EXPECT_EQ (adopted.Get_StringView(), k_long_text);
+		EXPECT_EQ (adopted.Get_StringView().data(), buffer._data);
+
+		auto moved = std::move (adopted);
+
+		EXPECT_EQ (count, 0);
+	}
+
+	EXPECT_EQ (count, 1);
+}
+
+
+/*------------------------------------------------------------------------------
+	A short buffer is copied into the wrapper, and released right away.
+*/
+
+GTEST_TEST (lulMemoryTypes, AdoptReleasesShortBufferAtOnce)
+{
+	ForeignBuffer	buffer {k_short_text};
+	int				count {0};
+
+	{
+		auto adopted = Adopt_String <U8String> (buffer._data, buffer.size(),
+			CountingDeleter {&count});
+
+		EXPECT_EQ (count, 1);
+		EXPECT_EQ (adopted.Get_StringView(), k_short_text);
+		EXPECT_NE (adopted.Get_StringView().data(), buffer._data);
+	}
+
+	EXPECT_EQ (count, 1);
+}
+
+
+/*------------------------------------------------------------------------------
+	The unique_ptr form takes the buffer, and its deleter, over from the
+	unique_ptr. ASan checks that buffers freed this way are freed just once.
+*/
+
+GTEST_TEST (lulMemoryTypes, AdoptTakesOverUniquePtr)
+{
+	int		count {0};
+
+	{
+		auto data = static_cast <char *> (::operator new (sizeof (k_long_text)));
+
+		memcpy (data, k_long_text, sizeof (k_long_text));
+
+		unique_ptr <char, FreeingDeleter>	owner {data, FreeingDeleter {&count}};
+		auto adopted = Adopt_String <U8String> (std::move (owner), sizeof (k_long_text) - 1);
+
+		EXPECT_FALSE (owner);
+		EXPECT_EQ (adopted.Get_StringView().data(), data);
+		EXPECT_STREQ (adopted.c_str(), k_long_text);
+		EXPECT_EQ (count, 0);
+	}
+
+	EXPECT_EQ (count, 1);
+
+	//	A Buffer from make_buffer, with its stateless raw_deleter.
+	auto buffer = make_buffer (sizeof (k_long_text));
+	auto data = buffer.get();
+
+	memcpy (data, k_long_text, sizeof (k_long_text));
+
+	auto adopted = Adopt_String <U8String> (std::move (buffer), sizeof (k_long_text) - 1);
+
+	EXPECT_EQ (adopted.Get_StringView().data(), data);
+	EXPECT_EQ (adopted.Get_StringView(), k_long_text);
+}
+
+
+/*------------------------------------------------------------------------------
+	Copying an adopted string copies the characters; the copy doesn’t hold on
+	to the buffer, so the deleter still runs when the original goes away.
+*/
+
+GTEST_TEST (lulMemoryTypes, CopyingAdoptedStringCopiesData)
+{
+	ForeignBuffer	buffer {k_long_text};
+	int				count {0};
+	U8String		copy;
+
+	{
+		auto adopted = Adopt_String <U8String> (buffer._data, buffer.size(),
+			CountingDeleter {&count});
+		U8String	constructed {adopted};
+
+		copy = adopted;
+
+		EXPECT_NE (constructed.Get_StringView().data(), buffer._data);
+		EXPECT_NE (copy.Get_StringView().data(), buffer._data);
+		EXPECT_EQ (constructed.Get_StringView(), k_long_text);
+
+		//	Our own strings are null-terminated, even if the buffer wasn’t.
+		EXPECT_STREQ (copy.c_str(), k_long_text);
+	}
+
+	EXPECT_EQ (count, 1);
+	EXPECT_EQ (copy.Get_StringView(), k_long_text);
+	EXPECT_EQ (buffer.View(), k_long_text);
+}
+
+
+/*------------------------------------------------------------------------------
+	Assigning to an adopted string releases the buffer, once, and never
+	writes to it, even when the new value would fit.
+*/
+
+GTEST_TEST (lulMemoryTypes, AssigningToAdoptedStringReleasesBuffer)
+{
+	ForeignBuffer	buffer {k_long_text};
+	int				count {0};
+
+	{
+		auto adopted = Adopt_String <U8String> (buffer._data, buffer.size(),
+			CountingDeleter {&count});
+
+		adopted = string_view ("x");
+		EXPECT_EQ (count, 1);
+		EXPECT_EQ (adopted.Get_StringView(), "x");
+
+		adopted = "a new value that is long enough to need the heap";
+		EXPECT_NE (adopted.Get_StringView().data(), buffer._data);
+		adopted = string ("another value that is long enough to need the heap");
+		EXPECT_EQ (adopted.Get_StringView(), "another value that is long enough to need the heap");
+	}
+
+	EXPECT_EQ (count, 1);
+	EXPECT_EQ (buffer.View(), k_long_text);
+
+	//	Assigning one adopted string to another copies, and releases only the
+	//	buffer that was replaced.
+	ForeignBuffer	other {k_long_text};
+	int				other_count {0};
+
+	{
+		auto target = Adopt_String <U8String> (buffer._data, buffer.size(),
+			CountingDeleter {&count});
+		auto source = Adopt_String <U8String> (other._data, other.size(),
+			CountingDeleter {&other_count});
+
+		target = source;
+		EXPECT_EQ (count, 2);
+		EXPECT_EQ (other_count, 0);
+		EXPECT_NE (target.Get_StringView().data(), other._data);
+	}
+
+	EXPECT_EQ (count, 2);
+	EXPECT_EQ (other_count, 1);
+	EXPECT_EQ (other.View(), k_long_text);
+}
+
+
+/*------------------------------------------------------------------------------
+	A borrowed string refers to the buffer without owning it, and nothing done
+	to the wrapper or its copies writes to it.
+*/
+
+GTEST_TEST (lulMemoryTypes, BorrowNeverWritesToBuffer)
+{
+	const ForeignBuffer	buffer {k_long_text};
+
+	{
+		auto borrowed = Borrow_String <U8String> (buffer._data, buffer.size());
+
+		EXPECT_EQ (borrowed.Get_StringView().data(), buffer._data);
+
+		auto copy = borrowed;
+		auto moved = std::move (borrowed);
+
+		EXPECT_NE (copy.Get_StringView().data(), buffer._data);
+		EXPECT_EQ (moved.Get_StringView().data(), buffer._data);
+
+		moved = "x";
+		copy = "a new value that is long enough to need the heap";
+		EXPECT_EQ (moved.Get_StringView(), "x");
+	}
+
+	EXPECT_EQ (buffer.View(), k_long_text);
+
+	//	The other wrappers behave the same way.
+	const u16string	wide (40, u'w');
+
+	{
+		auto borrowed = Borrow_String <U16String> (wide.data(), wide.size());
+		auto copy = borrowed;
+
+		EXPECT_EQ (borrowed.Get_StringView().data(), wide.data());
+		EXPECT_NE (copy.Get_StringView().data(), wide.data());
+		EXPECT_EQ (copy.Get_StringView(), wide);
+
+		borrowed = u"x";
+	}
+
+	EXPECT_EQ (wide, u16string (40, u'w'));
+}
@@ -0,0 +1,406 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“Normalization.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <array>
+#include <cstddef>
+#include <fstream>
+#include <set>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+
+//	gtest
+#include <gtest/gtest.h>
+
+
+//	lul
+#include <Lucena-Utilities/lulUtilities.hpp>
+
+
+//	luu
+#include "luuConfig_priv.hpp"
+
+
+/*------------------------------------------------------------------------------
+	Declarations
+*/
+
+using namespace std;
+using namespace LUL_;
+
+
+#ifndef LUU_TEST_DATA_DIR
+	#define LUU_TEST_DATA_DIR "test/data"
+#endif
+
+
+namespace {
+
+
+/*------------------------------------------------------------------------------
+	NormalizationTest.txt
+
+	Each line holds five columns - source, NFC, NFD, NFKC, and NFKD - each a
+	sequence of code points in hex. Lines are grouped into parts; Part 1
+	lists every code point that isn’t left alone by all four forms, though
+	in our trimmed copy, only those below k_part1_complete_below are all
+	there.
+*/
+
+constexpr char32_t	k_part1_complete_below				{0x0600};
+
+constexpr array <NormalizationForm, 4>	k_forms {
+	NormalizationForm::NFC,
+	NormalizationForm::NFD,
+	NormalizationForm::NFKC,
+	NormalizationForm::NFKD
+};
+
+enum Column
+{
+	k_source,
+	k_nfc,
+	k_nfd,
+	k_nfkc,
+	k_nfkd,
+	k_column_count
+};
+
+struct NormalizationCase
+{
+	int						_part;
+	size_t					_line;
+	array <u32string, k_column_count>	_columns;
+};
+
+
+u32string
+Parse_Column (
+	const string &			in_column)
+{
+	u32string		nrv;
+	istringstream	stream {in_column};
+	unsigned long	code_point;
+
+	while (stream >> hex >> code_point)
+		nrv.push_back (static_cast <char32_t> (code_point));
+
+	return nrv;
+}
+
+
+const vector <NormalizationCase> &
+Get_Cases()
+{
+	static const auto s_cases = []
+		{
+			vector <NormalizationCase>	nrv;
+			ifstream	file {LUU_TEST_DATA_DIR "/NormalizationTest.txt"};
+			string		line;
+			int			part {-1};
+			size_t		line_number {0};
+
+			while (getline (file, line))
+			{
+				++line_number;
+
+				if (line.empty() or ('#' == line.front())) continue;
+
+				if ('@' == line.front())
+				{
+					part = line [5] - '0';
+					continue;
+				}
+
+				NormalizationCase	test {part, line_number, {}};
+				istringstream		stream {line};
+
+				for (auto & column : test._columns)
+				{
+					string	text;
+
+					getline (stream, text, ';');
+					column = Parse_Column (text);
+				}
+
+				nrv.push_back (std::move (test));
+			}
+
+			return nrv;
+		}();
+
+	return s_cases;
+}
+
+
+//	The column that each form should produce from each column, as per the
+//	conformance invariants in the header of NormalizationTest.txt.
+Column
+Expected_Column (
+	NormalizationForm		in_form,
+	Column					in_column)
+{
+	auto compatibility = (k_nfkc == in_column) or (k_nfkd == in_column);
+
+	switch (in_form)
+	{
+		case NormalizationForm::NFC:	return compatibility ? k_nfkc : k_nfc;
+		case NormalizationForm::NFD:	return compatibility ? k_nfkd : k_nfd;
+		case NormalizationForm::NFKC:	return k_nfkc;
+		case NormalizationForm::NFKD:	return k_nfkd;
+	}
+
+	return k_source;
+}
+
+
+const char *
+Form_Name (
+	NormalizationForm		in_form)
+{
+	switch (in_form)
+	{
+		case NormalizationForm::NFC:	return "NFC";
+		case NormalizationForm::NFD:	return "NFD";
+		case NormalizationForm::NFKC:	return "NFKC";
+		case NormalizationForm::NFKD:	return "NFKD";
+	}
+
+	return "";
+}
+
+
+template <typename CHAR_T>
+basic_string <CHAR_T>
+Encode (
+	u32string_view			in_string)
+{
+	if constexpr (is_same_v <CHAR_T, char>)
+		return string (UTF32_to_UTF8 (in_string).Get_StringView());
+	else if constexpr (is_same_v <CHAR_T, char16_t>)
+		return u16string (UTF32_to_UTF16 (in_string).Get_StringView());
+	else
+		return u32string (in_string);
+}
+
+
+/*------------------------------------------------------------------------------
+	Check every case in every encoding. Is_Normalized must agree with
+	Normalize, and an input that is already normalized must come back as is.
+*/
+
+template <typename CHAR_T>
+void
+Check_Cases()
+{
+	auto & cases = Get_Cases();
+
+	ASSERT_FALSE (cases.empty()) << "couldn’t read " LUU_TEST_DATA_DIR "/NormalizationTest.txt";
+
+	size_t	failures {0};
+
+	for (auto & test : cases)
+	{
+		for (auto form : k_forms)
+		{
+			for (int column = k_source; column < k_column_count; ++column)
+			{
+				auto source = Encode <CHAR_T> (test._columns [column]);
+				auto expected = Encode <CHAR_T> (
+					test._columns [Expected_Column (form, Column (column))]);
+				basic_string <CHAR_T>	buffer;
+				auto result = Normalize (basic_string_view <CHAR_T> (source), form, buffer);
+
+				EXPECT_EQ (result, expected) << Form_Name (form) << " of column "
+					<< (column + 1) << " at line " << test._line;
+				EXPECT_EQ (Is_Normalized (basic_string_view <CHAR_T> (source), form),
+					source == expected) << Form_Name (form) << " of column "
+					<< (column + 1) << " at line " << test._line;
+
+				if ((source == expected) and !source.empty())
+					EXPECT_EQ (result.data(), source.data());
+
+				//	Don’t bury the first few failures under thousands more.
+				if (::testing::Test::HasFailure() and (++failures > 20)) return;
+			}
+		}
+	}
+}
+
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+	NormalizationTest.txt
+*/
+
+GTEST_TEST (lulNormalization, ReadsEveryPart)
+{
+	set <int>	parts;
+
+	for (auto & test : Get_Cases())
+		parts.insert (test._part);
+
+	EXPECT_EQ (parts, (set <int> {0, 1, 2, 3}));
+}
+
+
+GTEST_TEST (lulNormalization, ConformsInUTF8)
+{
+	Check_Cases <char>();
+}
+
+
+GTEST_TEST (lulNormalization, ConformsInUTF16)
+{
+	Check_Cases <char16_t>();
+}
+
+
+GTEST_TEST (lulNormalization, ConformsInUTF32)
+{
+	Check_Cases <char32_t>();
+}
+
+
+/*------------------------------------------------------------------------------
+	Code points that aren’t listed in Part 1 are left alone by every form.
+*/
+
+GTEST_TEST (lulNormalization, LeavesUnlistedCodePointsAlone)
+{
+	set <char32_t>	listed;
+
+	for (auto & test : Get_Cases())
+		if (1 == test._part) listed.insert (test._columns [k_source].front());
+
+	ASSERT_FALSE (listed.empty());
+
+	for (char32_t c = 0; c < k_part1_complete_below; ++c)
+	{
+		if (listed.count (c)) continue;
+
+		auto source = u32string (1, c);
+
+		for (auto form : k_forms)
+		{
+			u32string	buffer;
+
+			ASSERT_EQ (Normalize (source, form, buffer), source)
+				<< Form_Name (form) << " of U+" << hex << uint32_t (c);
+			ASSERT_TRUE (Is_Normalized (source, form))
+				<< Form_Name (form) << " of U+" << hex << uint32_t (c);
+		}
+	}
+}
+
+
+/*------------------------------------------------------------------------------
+	Invalid sequences are replaced, as with the string conversions, and the
+	result is normalized as if the replacement character had been there all
+	along.
+*/
+
+GTEST_TEST (lulNormalization, ReplacesInvalidSequences)
+{
+	string		buffer;
+
+	EXPECT_EQ (Normalize ("e\xCC\x81\xFF", NormalizationForm::NFC, buffer),
+		"\xC3\xA9\xEF\xBF\xBD");
+	EXPECT_FALSE (Is_Normalized ("a\xFF", NormalizationForm::NFD));
+
+	u16string	wide_buffer;
+
+	EXPECT_EQ (Normalize (u16string_view (u"e\u0301\xD800", 3), NormalizationForm::NFC,
+		wide_buffer), u"\u00E9\uFFFD");
+}
+
+
+/*------------------------------------------------------------------------------
+	Case Folding
+
+	Full case folding, without the Turkic mappings: dotless ı and dotted İ
+	stay distinct from i, final sigma folds like any other, and characters
+	that fold to more than one code point, like ß and ẞ, expand. Nothing is
+	normalized along the way.
+*/
+
+GTEST_TEST (lulCaseFolding, FoldsSpecialCases)
+{
+	EXPECT_EQ (Case_Fold ("Straße"), "strasse");
+	EXPECT_EQ (Case_Fold ("STRASSE"), "strasse");
+	EXPECT_EQ (Case_Fold (u8"ẞ"), "ss");
+	EXPECT_EQ (Case_Fold (u8"ﬃ"), "ffi");
+
+	//	Σ, σ, and final ς all fold to σ.
+	EXPECT_EQ (Case_Fold (u8"ΣΑΣ"), u8"σασ");
+	EXPECT_EQ (Case_Fold (u8"σας"), u8"σασ");
+
+	EXPECT_EQ (Case_Fold (u8"I"), "i");
+	EXPECT_EQ (Case_Fold (u8"İ"), u8"i̇");
+	EXPECT_EQ (Case_Fold (u8"ı"), u8"ı");
+
+	//	Signs that fold to letters, and a supplementary character.
+	EXPECT_EQ (Case_Fold (u8"KΩµ"), u8"kωμ");
+	EXPECT_EQ (Case_Fold (U"\U00010400"), U"\U00010428");
+	EXPECT_EQ (Case_Fold (u"\U00010400"), u"\U00010428");
+
+	//	Cherokee folds to the capitals, which are the older letters.
+	EXPECT_EQ (Case_Fold (u8"ꭰ"), u8"Ꭰ");
+
+	//	No normalization: é and e + U+0301 fold to themselves.
+	EXPECT_EQ (Case_Fold (u8"É"), u8"é");
+	EXPECT_EQ (Case_Fold (u8"E\u0301"), u8"e\u0301");
+
+	EXPECT_EQ (Case_Fold ("A\xFF"), "a\xEF\xBF\xBD");
+}
+
+
+/*------------------------------------------------------------------------------
+	Compare_Folded and Hash_Folded agree with comparing and hashing the folded
+	strings, including where one side expands, and whatever the encoding.
+*/
+
+GTEST_TEST (lulCaseFolding, ComparesAndHashesFolded)
+{
+	EXPECT_EQ (Compare_Folded ("Straße", "STRASSE"), 0);
+	EXPECT_EQ (Compare_Folded (u8"ẞ", "sS"), 0);
+	EXPECT_EQ (Compare_Folded (u8"ﬃ", "FFI"), 0);
+	EXPECT_EQ (Compare_Folded (u8"ΣΑΣ", u8"σας"), 0);
+	EXPECT_EQ (Compare_Folded (u"ΣΑΣ", u"σας"), 0);
+	EXPECT_EQ (Compare_Folded (U"ΣΑΣ", U"σας"), 0);
+
+	EXPECT_NE (Compare_Folded (u8"ı", "I"), 0);
+	EXPECT_NE (Compare_Folded (u8"İ", "i"), 0);
+	EXPECT_NE (Compare_Folded (u8"é", u8"e\u0301"), 0);
+
+	//	The order is that of the folded code points.
+	EXPECT_LT (Compare_Folded ("a", "B"), 0);
+	EXPECT_GT (Compare_Folded ("b", "A"), 0);
+	EXPECT_LT (Compare_Folded ("Stra", "STRASSE"), 0);
+	EXPECT_LT (Compare_Folded (u8"ßa", "SSB"), 0);
+	EXPECT_GT (Compare_Folded (u8"ß", "sr"), 0);
+	EXPECT_LT (Compare_Folded (u"�", u"\U00010400"), 0);
+
+	auto hash = Hash_Folded ("strasse");
+
+	EXPECT_EQ (Hash_Folded ("Straße"), hash);
+	EXPECT_EQ (Hash_Folded (u8"STRAẞSE"), Hash_Folded ("strassse"));
+	EXPECT_EQ (Hash_Folded (u"STRAßE"), hash);
+	EXPECT_EQ (Hash_Folded (U"STRAßE"), hash);
+	EXPECT_NE (Hash_Folded (u8"ı"), Hash_Folded ("i"));
+}
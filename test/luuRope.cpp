@@ -0,0 +1,355 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“Rope.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <atomic>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+
+//	gtest
+#include <gtest/gtest.h>
+
+
+//	lul
+#include <Lucena-Utilities/lulRope.hpp>
+
+
+//	luu
+#include "luuConfig_priv.hpp"
+
+
+/*------------------------------------------------------------------------------
+	Declarations
+*/
+
+using namespace std;
+using namespace LUL_;
+
+
+namespace {
+
+
+/*------------------------------------------------------------------------------
+	Helpers
+
+	The rope is compared against a std::string that has been put through the
+	same operations. Flatten, Copy, and the segments must all agree with it.
+*/
+
+string
+Segments_Of (
+	const U8Rope &			in_rope)
+{
+	string	nrv;
+
+	for (auto segment : in_rope.Get_Segments())
+	{
+		EXPECT_FALSE (segment.empty());
+		nrv.append (segment);
+	}
+
+	return nrv;
+}
+
+
+void
+Expect_Matches (
+	const U8Rope &			in_rope,
+	const string &			in_model)
+{
+	ASSERT_EQ (in_rope.size(), in_model.size());
+	EXPECT_EQ (in_rope.empty(), in_model.empty());
+
+	auto flat = in_rope.Flatten();
+
+	EXPECT_EQ (flat.Get_StringView(), in_model);
+	EXPECT_EQ (Segments_Of (in_rope), in_model);
+
+	string	visited;
+
+	in_rope.For_Each_Segment ([&visited] (string_view in_segment)
+		{ visited.append (in_segment); });
+	EXPECT_EQ (visited, in_model);
+
+	if (!in_model.empty())
+	{
+		EXPECT_EQ (in_rope.At (0), in_model.front());
+		EXPECT_EQ (in_rope.At (in_model.size() / 2), in_model [in_model.size() / 2]);
+		EXPECT_EQ (in_rope.At (in_model.size() - 1), in_model.back());
+	}
+}
+
+
+//	Random lowercase text, so misplaced bytes show up as mismatches.
+string
+Make_Text (
+	mt19937 &				io_engine,
+	size_t					in_size)
+{
+	string	nrv (in_size, '\0');
+
+	for (auto & c : nrv)
+		c = static_cast <char> ('a' + (io_engine() % 26));
+
+	return nrv;
+}
+
+
+constexpr size_t	k_model_steps						{2000};
+constexpr size_t	k_thread_count						{8};
+constexpr size_t	k_thread_appends					{500};
+
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+	Transcoding
+*/
+
+GTEST_TEST (lulRope, AppendsTranscodedText)
+{
+	U8Rope	rope;
+
+	rope.Append (u"é€\U0001F600");
+	rope.Append (U"é€\U0001F600");
+	rope.Append (L"é");
+	Expect_Matches (rope, "\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80"
+		"\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80" "\xC3\xA9");
+
+	//	A lone surrogate is replaced, not dropped.
+	U8Rope	replaced;
+
+	replaced.Append (u16string_view (u"a\xD800z", 3));
+	Expect_Matches (replaced, "a\xEF\xBF\xBDz");
+
+	//	Enough code points to fill several chunks, so some land at the end of
+	//	a chunk with less room than a sequence needs.
+	U8Rope	large;
+	string	model;
+	u16string	source;
+
+	for (size_t i = 0; i < 5000; ++i)
+	{
+		source += u"x€";
+		model += "x\xE2\x82\xAC";
+	}
+
+	large.Append ("?");
+	large.Append (u16string_view (source));
+	Expect_Matches (large, "?" + model);
+}
+
+
+/*------------------------------------------------------------------------------
+	Random edits, checked against a std::string after every step. The seed is
+	fixed, so a failure can be reproduced.
+*/
+
+GTEST_TEST (lulRope, MatchesStringModel)
+{
+	mt19937	engine {20180101};
+	U8Rope	rope;
+	string	model;
+
+	for (size_t step = 0; step < k_model_steps; ++step)
+	{
+		auto size = model.size();
+		auto pos = size ? engine() % (size + 1) : 0;
+		auto count = engine() % 200;
+
+		switch (engine() % 9)
+		{
+			case 0:
+			{
+				//	Mostly short appends, which extend the tail chunk; now and
+				//	then one long enough to need new chunks.
+				auto text = Make_Text (engine, (engine() % 16) ? count : 9000);
+
+				rope.Append (text);
+				model += text;
+				break;
+			}
+
+			case 1:
+			{
+				auto text = Make_Text (engine, count);
+
+				rope.Append (text.c_str());
+				model += text;
+				break;
+			}
+
+			case 2:
+			{
+				rope.Append (u"é");
+				model += "\xC3\xA9";
+				break;
+			}
+
+			case 3:
+			{
+				auto text = Make_Text (engine, count);
+
+				rope.Insert (pos, text);
+				model.insert (pos, text);
+				break;
+			}
+
+			case 4:
+			{
+				rope.Erase (pos, count);
+				model.erase (pos, count);
+				break;
+			}
+
+			case 5:
+			{
+				auto slice = rope.Slice (pos, count);
+
+				Expect_Matches (slice, model.substr (pos, count));
+
+				//	Appending to a slice must not show through in the rope.
+				slice.Append ("!");
+				break;
+			}
+
+			case 6:
+			{
+				auto copy = rope;
+
+				rope.Append (copy);
+				model += model;
+
+				//	Keep the model from growing without bound.
+				if (model.size() > 100000)
+				{
+					rope.Erase (0, model.size() / 2);
+					model.erase (0, model.size() / 2);
+				}
+				break;
+			}
+
+			case 7:
+			{
+				auto other = rope.Slice (pos, count);
+				auto where = engine() % (size + 1);
+
+				rope.Insert (where, other);
+				model.insert (where, model.substr (pos, count));
+				break;
+			}
+
+			case 8:
+			{
+				string	buffer (count, '\0');
+				auto copied = rope.Copy (pos, count, buffer.data());
+
+				buffer.resize (copied);
+				EXPECT_EQ (buffer, model.substr (pos, count));
+				break;
+			}
+		}
+
+		Expect_Matches (rope, model);
+
+		if (HasFailure())
+		{
+			ADD_FAILURE() << "at step " << step;
+			return;
+		}
+	}
+
+	rope.Clear();
+	Expect_Matches (rope, "");
+}
+
+
+/*------------------------------------------------------------------------------
+	Positions and counts past the end are clamped.
+*/
+
+GTEST_TEST (lulRope, ClampsPositions)
+{
+	U8Rope	rope ("hello");
+
+	EXPECT_EQ (rope.Slice (3, U8Rope::npos).Flatten().Get_StringView(), "lo");
+	EXPECT_TRUE (rope.Slice (10, 2).empty());
+
+	char	buffer [8] {};
+
+	EXPECT_EQ (rope.Copy (4, 10, buffer), 1U);
+	EXPECT_EQ (buffer [0], 'o');
+	EXPECT_EQ (rope.Copy (5, 10, buffer), 0U);
+
+	rope.Insert (100, string_view ("!"));
+	rope.Erase (100);
+	Expect_Matches (rope, "hello!");
+}
+
+
+/*------------------------------------------------------------------------------
+	Copies of a rope share its tail chunk, and each may try to extend it. Only
+	one can win; the others have to start a chunk of their own, and none of
+	them may see what the others wrote.
+*/
+
+GTEST_TEST (lulRope, CopiesAppendToSharedTailFromManyThreads)
+{
+	U8Rope	base;
+
+	base.Append ("shared");
+
+	vector <U8Rope>	copies (k_thread_count, base);
+	vector <thread>	threads;
+	atomic <bool>	go {false};
+
+	for (size_t i = 0; i < k_thread_count; ++i)
+	{
+		threads.emplace_back ([&go, &copies, i]
+			{
+				while (!go.load()) this_thread::yield();
+
+				auto text = string (1, static_cast <char> ('a' + i));
+
+				for (size_t n = 0; n < k_thread_appends; ++n)
+				{
+					if (n % 2)
+						copies [i].Append (text);
+					else
+						copies [i].Append (u16string (1, static_cast <char16_t> ('a' + i)));
+				}
+			});
+	}
+
+	go.store (true);
+
+	for (auto & t : threads)
+		t.join();
+
+	Expect_Matches (base, "shared");
+
+	for (size_t i = 0; i < k_thread_count; ++i)
+		Expect_Matches (copies [i], "shared" + string (k_thread_appends,
+			static_cast <char> ('a' + i)));
+
+	//	The base can still be appended to without disturbing the copies.
+	base.Append ("!");
+	Expect_Matches (base, "shared!");
+	Expect_Matches (copies [0], "shared" + string (k_thread_appends, 'a'));
+}
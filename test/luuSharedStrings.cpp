@@ -0,0 +1,71 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“SharedStrings.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <string>
+#include <type_traits>
+
+
+//	gtest
+#include <gtest/gtest.h>
+
+
+//	lul
+#include <Lucena-Utilities/lulTypes.hpp>
+
+
+//	luu
+#include "luuConfig_priv.hpp"
+
+
+/*------------------------------------------------------------------------------
+	Declarations
+*/
+
+using namespace std;
+using namespace LUL_;
+
+
+/*------------------------------------------------------------------------------
+	Shared strings can be made from standard strings, directly or by copy-
+	initialization, just as the plain wrappers can.
+*/
+
+static_assert (is_convertible_v <const string &, SharedU8String>);
+static_assert (is_convertible_v <const u16string &, SharedU16String>);
+static_assert (is_convertible_v <const u32string &, SharedU32String>);
+
+
+GTEST_TEST (lulSharedStrings, ConstructFromStandardStrings)
+{
+	auto text = string {"shared text"};
+	auto text16 = u16string {u"shared text"};
+	auto text32 = u32string {U"shared text"};
+
+	SharedU8String direct {text};
+	SharedU8String copied = text;
+	SharedU16String direct16 {text16};
+	SharedU16String copied16 = text16;
+	SharedU32String direct32 {text32};
+	SharedU32String copied32 = text32;
+
+	EXPECT_EQ (direct.Get_StringView(), text);
+	EXPECT_EQ (copied.Get_StringView(), text);
+	EXPECT_EQ (direct16.Get_StringView(), text16);
+	EXPECT_EQ (copied16.Get_StringView(), text16);
+	EXPECT_EQ (direct32.Get_StringView(), text32);
+	EXPECT_EQ (copied32.Get_StringView(), text32);
+
+	EXPECT_NE (direct.c_str(), text.c_str());
+	EXPECT_EQ (SharedU8String {string{}}.Get_StringView(), "");
+}
@@ -0,0 +1,282 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“Status.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+//	gtest
+#include <gtest/gtest.h>
+
+
+//	lul
+#include <Lucena-Utilities/lulTypes.hpp>
+
+
+//	luu
+#include "luuConfig_priv.hpp"
+
+
+/*------------------------------------------------------------------------------
+	Declarations
+*/
+
+using namespace std;
+using namespace LUL_;
+
+
+namespace {
+
+
+/*------------------------------------------------------------------------------
+	Helpers
+
+	Chained Status objects are made with copied messages so that every link
+	has a MessageBlock of its own.
+*/
+
+constexpr StringGroup	k_domain							{1};
+constexpr size_t		k_thread_count						{8};
+constexpr size_t		k_thread_rounds						{200};
+
+
+Status
+Make_Status (
+	StatusCode				in_code)
+{
+	return Status (k_domain, in_code, "status " + to_string (in_code));
+}
+
+
+Status
+Make_Chain (
+	StatusCode				in_first,
+	StatusCode				in_last)
+{
+	auto nrv = Make_Status (in_first);
+
+	for (auto code = in_first + 1; code <= in_last; ++code)
+		EXPECT_TRUE (nrv.Chain (Make_Status (code)));
+
+	return nrv;
+}
+
+
+//	The codes along the chain, in order, checking each message on the way.
+vector <StatusCode>
+Codes_Of (
+	const Status &			in_status)
+{
+	vector <StatusCode>	nrv;
+
+	if (in_status.Success()) return nrv;
+
+	for (auto link = &in_status; link; )
+	{
+		EXPECT_EQ (string (link->Message()), "status " + to_string (link->Code()));
+		nrv.push_back (link->Code());
+
+		auto next = link->Next();
+
+		link = next ? *next : nullptr;
+	}
+
+	return nrv;
+}
+
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+	Copies share the whole chain, down to the message text.
+*/
+
+GTEST_TEST (lulStatus, CopiesShareChain)
+{
+	auto original = Make_Chain (1, 3);
+	auto copy = original;
+
+	EXPECT_EQ (copy.Message(), original.Message());
+	ASSERT_TRUE (copy.Next());
+	ASSERT_TRUE (original.Next());
+	EXPECT_EQ (*copy.Next(), *original.Next());
+	EXPECT_EQ (Codes_Of (copy), (vector <StatusCode> {1, 2, 3}));
+
+	Status	assigned;
+
+	assigned = original;
+	EXPECT_EQ (*assigned.Next(), *original.Next());
+}
+
+
+/*------------------------------------------------------------------------------
+	Chain copies only the links it has to change, so the original doesn’t see
+	the new link, and the two still share what they have in common.
+*/
+
+GTEST_TEST (lulStatus, ChainOnCopyLeavesOriginal)
+{
+	auto original = Make_Chain (1, 2);
+	auto copy = original;
+
+	ASSERT_TRUE (copy.Chain (Make_Status (3)));
+
+	EXPECT_EQ (Codes_Of (original), (vector <StatusCode> {1, 2}));
+	EXPECT_EQ (Codes_Of (copy), (vector <StatusCode> {1, 2, 3}));
+	EXPECT_NE (*copy.Next(), *original.Next());
+
+	//	The head link was unshared; its message moved with it.
+	EXPECT_NE (copy.Message(), original.Message());
+	EXPECT_EQ (string (copy.Message()), string (original.Message()));
+
+	//	Chaining onto a link that is no longer shared doesn’t copy it again.
+	auto next = *copy.Next();
+
+	ASSERT_TRUE (copy.Chain (Make_Status (4)));
+	EXPECT_EQ (*copy.Next(), next);
+	EXPECT_EQ (Codes_Of (copy), (vector <StatusCode> {1, 2, 3, 4}));
+	EXPECT_EQ (Codes_Of (original), (vector <StatusCode> {1, 2}));
+}
+
+
+/*------------------------------------------------------------------------------
+	A success Status can’t be chained, but an error can be chained onto a
+	success, which takes it over.
+*/
+
+GTEST_TEST (lulStatus, ChainsOnlyErrors)
+{
+	auto status = Make_Status (1);
+
+	EXPECT_FALSE (status.Chain (Status()));
+	EXPECT_FALSE (status.Prepend (Status()));
+	EXPECT_FALSE (status.Next());
+
+	Status	success;
+
+	EXPECT_TRUE (success.Chain (Make_Chain (1, 2)));
+	EXPECT_EQ (Codes_Of (success), (vector <StatusCode> {1, 2}));
+
+	Status	prepended;
+
+	EXPECT_TRUE (prepended.Prepend (Make_Status (5)));
+	EXPECT_EQ (Codes_Of (prepended), (vector <StatusCode> {5}));
+}
+
+
+/*------------------------------------------------------------------------------
+	Prepend puts the new Status at the head of the chain, and doesn’t touch
+	the chain it was put in front of.
+*/
+
+GTEST_TEST (lulStatus, PrependOrder)
+{
+	auto status = Make_Chain (3, 4);
+	auto copy = status;
+
+	ASSERT_TRUE (status.Prepend (Make_Status (2)));
+	ASSERT_TRUE (status.Prepend (Make_Chain (0, 1)));
+
+	EXPECT_EQ (Codes_Of (status), (vector <StatusCode> {0, 1, 2, 3, 4}));
+	EXPECT_EQ (Codes_Of (copy), (vector <StatusCode> {3, 4}));
+
+	//	The old head is now fourth in the chain, and still shared with copy.
+	auto link = *(*(*status.Next())->Next())->Next();
+
+	EXPECT_EQ (link->Message(), copy.Message());
+}
+
+
+/*------------------------------------------------------------------------------
+	A moved-from Status reads as success, whichever way it was moved.
+*/
+
+GTEST_TEST (lulStatus, MovedFromIsSuccess)
+{
+	auto source = Make_Chain (1, 2);
+	auto moved = std::move (source);
+
+	EXPECT_TRUE (source.Success());
+	EXPECT_FALSE (source.Error());
+	EXPECT_EQ (source.Message(), nullptr);
+	EXPECT_EQ (source.Code(), STATUS_CODE_none);
+	EXPECT_EQ (source.Domain(), STRING_GROUP_messages);
+	EXPECT_FALSE (source.Next());
+	EXPECT_EQ (Codes_Of (moved), (vector <StatusCode> {1, 2}));
+
+	Status	assigned;
+
+	assigned = std::move (moved);
+	EXPECT_TRUE (moved.Success());
+	EXPECT_FALSE (moved.Next());
+	EXPECT_EQ (Codes_Of (assigned), (vector <StatusCode> {1, 2}));
+
+	//	A moved-from Status is still usable.
+	EXPECT_TRUE (moved.Chain (Make_Status (7)));
+	EXPECT_EQ (Codes_Of (moved), (vector <StatusCode> {7}));
+}
+
+
+/*------------------------------------------------------------------------------
+	Copies of a chain are read, extended, and destroyed on several threads at
+	once, while the original goes away on this one; whichever copy is last
+	frees the chain. This is mostly of interest under TSan and ASan.
+*/
+
+GTEST_TEST (lulStatus, ChainOutlivesCopiesOnOtherThreads)
+{
+	auto original = Make_Chain (1, 3);
+	vector <thread>	threads;
+	atomic <size_t>	ready {0};
+	atomic <bool>	go {false};
+
+	for (size_t i = 0; i < k_thread_count; ++i)
+	{
+		threads.emplace_back ([copy = original, &ready, &go] () mutable
+			{
+				++ready;
+				while (!go.load()) this_thread::yield();
+
+				for (size_t n = 0; n < k_thread_rounds; ++n)
+				{
+					auto local = copy;
+
+					EXPECT_EQ (Codes_Of (local), (vector <StatusCode> {1, 2, 3}));
+
+					if (n % 2)
+					{
+						EXPECT_TRUE (local.Chain (Make_Status (4)));
+						EXPECT_EQ (Codes_Of (local), (vector <StatusCode> {1, 2, 3, 4}));
+					}
+				}
+
+				copy = Status();
+			});
+	}
+
+	while (ready.load() < k_thread_count) this_thread::yield();
+
+	original = Status();
+	go.store (true);
+
+	for (auto & t : threads)
+		t.join();
+
+	EXPECT_TRUE (original.Success());
+}
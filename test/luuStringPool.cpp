@@ -0,0 +1,225 @@
+/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“StringPool.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <atomic>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+
+//	gtest
+#include <gtest/gtest.h>
+
+
+//	lul
+#include <Lucena-Utilities/lulTypes.hpp>
+
+
+//	luu
+#include "luuConfig_priv.hpp"
+
+
+/*------------------------------------------------------------------------------
+	Declarations
+*/
+
+using namespace std;
+using namespace LUL_;
+
+
+namespace {
+
+
+/*------------------------------------------------------------------------------
+	Constants
+
+	The pool is global, so each test interns strings with its own prefix, and
+	nothing one test does can satisfy a lookup in another.
+*/
+
+//	Larger than a quarter of the pool’s block size, so these are allocated
+//	on their own rather than carved out of a block.
+constexpr size_t		k_large_size						{5000};
+
+//	Enough strings that the shard tables have to grow.
+constexpr size_t		k_string_count						{4000};
+
+constexpr size_t		k_thread_count						{8};
+
+
+}	//	namespace
+
+
+/*------------------------------------------------------------------------------
+	Every overload hands back the same entry for the same text.
+*/
+
+GTEST_TEST (lulStringPool, OverloadsShareEntry)
+{
+	const char *	literal {"luuStringPool overloads"};
+	auto handle = Intern (literal);
+
+	ASSERT_FALSE (handle.empty());
+	EXPECT_EQ (Intern (string (literal)), handle);
+	EXPECT_EQ (Intern (string_view (literal)), handle);
+	EXPECT_EQ (Intern (U8String (literal)), handle);
+	EXPECT_EQ (Find_Interned (literal), handle);
+
+	//	Equal handles point at the very same bytes.
+	EXPECT_EQ (Intern (string (literal)).c_str(), handle.c_str());
+	EXPECT_NE (handle.c_str(), literal);
+	EXPECT_EQ (handle.Get_StringView(), literal);
+	EXPECT_EQ (handle.Hash(), Intern (U8String (literal)).Hash());
+
+	EXPECT_NE (Intern ("luuStringPool overloads!"), handle);
+}
+
+
+/*------------------------------------------------------------------------------
+	Find_Interned never adds anything.
+*/
+
+GTEST_TEST (lulStringPool, FindsOnlyInternedStrings)
+{
+	EXPECT_TRUE (Find_Interned ("luuStringPool never interned").empty());
+	EXPECT_TRUE (Find_Interned ("luuStringPool never interned").empty());
+
+	auto handle = Intern ("luuStringPool interned later");
+
+	EXPECT_EQ (Find_Interned ("luuStringPool interned later"), handle);
+
+	//	A prefix of an interned string isn’t interned.
+	EXPECT_TRUE (Find_Interned ("luuStringPool interned").empty());
+
+	//	Embedded nulls are part of the string.
+	auto with_null = string_view ("luuStringPool\0null", 18);
+
+	EXPECT_TRUE (Find_Interned (with_null).empty());
+	EXPECT_NE (Intern (with_null), Intern ("luuStringPool"));
+	EXPECT_EQ (Find_Interned (with_null).Get_StringView(), with_null);
+}
+
+
+/*------------------------------------------------------------------------------
+	The empty string is an empty handle, whichever way it’s spelled.
+*/
+
+GTEST_TEST (lulStringPool, EmptyStringIsEmptyHandle)
+{
+	EXPECT_TRUE (Intern ("").empty());
+	EXPECT_TRUE (Intern (static_cast <const char *> (nullptr)).empty());
+	EXPECT_TRUE (Intern (string()).empty());
+	EXPECT_TRUE (Intern (string_view()).empty());
+	EXPECT_TRUE (Intern (U8String()).empty());
+	EXPECT_TRUE (Find_Interned ("").empty());
+
+	InternedString	empty;
+
+	EXPECT_EQ (Intern (""), empty);
+	EXPECT_STREQ (empty.c_str(), "");
+	EXPECT_TRUE (empty.Get_StringView().empty());
+	EXPECT_EQ (empty.Hash(), 0U);
+}
+
+
+/*------------------------------------------------------------------------------
+	Large strings, and lots of small ones, are kept intact as the pool grows.
+*/
+
+GTEST_TEST (lulStringPool, KeepsLargeAndManyStrings)
+{
+	auto large = "luuStringPool large " + string (k_large_size, 'x');
+	auto other = "luuStringPool large " + string (k_large_size, 'y');
+	auto handle = Intern (large);
+
+	EXPECT_EQ (handle.Get_StringView(), large);
+	EXPECT_EQ (Intern (other).Get_StringView(), other);
+	EXPECT_EQ (Find_Interned (large), handle);
+	EXPECT_EQ (Intern (large).c_str(), handle.c_str());
+
+	vector <InternedString>	handles;
+
+	for (size_t i = 0; i < k_string_count; ++i)
+		handles.push_back (Intern ("luuStringPool many " + to_string (i)));
+
+	for (size_t i = 0; i < k_string_count; ++i)
+	{
+		auto text = "luuStringPool many " + to_string (i);
+
+		ASSERT_EQ (handles [i].Get_StringView(), text);
+		ASSERT_EQ (Find_Interned (text), handles [i]);
+	}
+
+	EXPECT_EQ (Find_Interned (large), handle);
+}
+
+
+/*------------------------------------------------------------------------------
+	Threads that race to intern the same strings all end up with the same
+	entries.
+*/
+
+GTEST_TEST (lulStringPool, InternsFromManyThreads)
+{
+	vector <vector <InternedString>>	results (k_thread_count);
+	vector <thread>	threads;
+	atomic <bool>	go {false};
+
+	for (size_t i = 0; i < k_thread_count; ++i)
+	{
+		threads.emplace_back ([&go, &results, i]
+			{
+				while (!go.load()) this_thread::yield();
+
+				auto & handles = results [i];
+
+				for (size_t n = 0; n < k_string_count; ++n)
+				{
+					//	Half the threads go backwards, so they meet in the
+					//	middle.
+					auto index = (i % 2) ? n : (k_string_count - 1 - n);
+					auto text = "luuStringPool threads " + to_string (index);
+
+					if (0 == (index % 100)) text += string (k_large_size, 'z');
+
+					handles.push_back (Intern (text));
+				}
+
+				if (i % 2) return;
+
+				vector <InternedString>	reversed (handles.rbegin(), handles.rend());
+
+				handles.swap (reversed);
+			});
+	}
+
+	go.store (true);
+
+	for (auto & t : threads)
+		t.join();
+
+	for (size_t n = 0; n < k_string_count; ++n)
+	{
+		auto text = "luuStringPool threads " + to_string (n);
+
+		if (0 == (n % 100)) text += string (k_large_size, 'z');
+
+		ASSERT_EQ (results [0][n].Get_StringView(), text);
+
+		for (size_t i = 1; i < k_thread_count; ++i)
+			ASSERT_EQ (results [i][n], results [0][n]) << "thread " << i << ", string " << n;
+	}
+}
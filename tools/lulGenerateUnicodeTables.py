@@ -0,0 +1,606 @@
+#!/usr/bin/env python3
+#-------------------------------------------------------------------------------
+#
+#	Lucena Utilities Library
+#	“GenerateUnicodeTables.py”
+#	Copyright © 2018 Lucena
+#	All Rights Reserved
+#
+#	This file is distributed under the University of Illinois Open Source
+#	License. See license/License.txt for details.
+#
+#	Generates src/lul/lulUnicodeTables_priv.cpp from the Unicode Character
+#	Database. Most properties come from Python’s unicodedata module; the
+#	rest are read from a copy of the UCD (e.g., an unzipped UCD.zip) whose
+#	version must match that of unicodedata. Run it from the root of the
+#	repository whenever the Unicode version needs to be bumped:
+#
+#		python3 tools/lulGenerateUnicodeTables.py path/to/UCD
+#
+#	The output is checked in, so none of this is needed to build the library.
+#
+#-------------------------------------------------------------------------------
+
+
+import os
+import re
+import sys
+import unicodedata
+
+
+OUTPUT_PATH = 'src/lul/lulUnicodeTables_priv.cpp'
+
+CODE_POINT_COUNT = 0x110000
+
+
+#-------------------------------------------------------------------------------
+#	Two-Stage Tables
+#
+#	Split the code space into blocks of 1 << block_bits code points, pack
+#	each block with pack_block, and share identical blocks. Returns the first
+#	stage, which maps each block to its index in the second stage, and the
+#	second stage itself.
+
+def Build_Stages (block_bits, pack_block):
+	block_size = 1 << block_bits
+	blocks = []
+	block_index = {}
+	stage1 = []
+
+	for base in range (0, CODE_POINT_COUNT, block_size):
+		packed = tuple (pack_block (base, block_size))
+
+		if packed not in block_index:
+			block_index [packed] = len (blocks)
+			blocks.append (packed)
+
+		stage1.append (block_index [packed])
+
+	assert len (blocks) <= 256
+
+	return stage1, blocks
+
+
+#-------------------------------------------------------------------------------
+#	Display Width
+#
+#	Widths follow Markus Kuhn’s reference wcwidth, updated for the current
+#	Unicode version: nonspacing and enclosing marks, format characters other
+#	than SOFT HYPHEN, and conjoining Hangul medial vowels and final consonants
+#	take up no cells; East Asian Wide and Fullwidth characters take up two;
+#	control characters, surrogates, and noncharacters are not printable.
+#	Unassigned code points in the blocks that the Unicode Standard reserves
+#	for CJK ideographs default to East Asian Wide, just as they do in
+#	EastAsianWidth.txt.
+
+WIDTH_BLOCK_BITS = 8
+
+#	Each width is packed into 2 bits, with 3 standing in for -1.
+WIDTH_NOT_PRINTABLE = 3
+
+DEFAULT_WIDE_RANGES = (
+	(0x3400, 0x4DBF),
+	(0x4E00, 0x9FFF),
+	(0xF900, 0xFAFF),
+	(0x20000, 0x2FFFD),
+	(0x30000, 0x3FFFD),
+)
+
+
+def Is_Nonchar (cp):
+	return (0xFDD0 <= cp <= 0xFDEF) or ((cp & 0xFFFE) == 0xFFFE)
+
+
+def Code_Point_Width (cp):
+	if cp == 0:
+		return 0
+
+	if (cp < 0x20) or (0x7F <= cp < 0xA0):
+		return WIDTH_NOT_PRINTABLE
+
+	if (0xD800 <= cp <= 0xDFFF) or Is_Nonchar (cp):
+		return WIDTH_NOT_PRINTABLE
+
+	ch = chr (cp)
+	category = unicodedata.category (ch)
+
+	if cp == 0x00AD:
+		return 1
+
+	if category in ('Mn', 'Me', 'Cf'):
+		return 0
+
+	if (0x1160 <= cp <= 0x11FF) or (0xD7B0 <= cp <= 0xD7FF):
+		return 0
+
+	if unicodedata.east_asian_width (ch) in ('W', 'F'):
+		return 2
+
+	if category == 'Cn':
+		for first, last in DEFAULT_WIDE_RANGES:
+			if first <= cp <= last:
+				return 2
+
+	return 1
+
+
+def Generate_Width_Tables ():
+	def Pack_Block (base, size):
+		for i in range (base, base + size, 4):
+			byte = 0
+
+			for j in range (4):
+				byte |= Code_Point_Width (i + j) << (j * 2)
+
+			yield byte
+
+	return Build_Stages (WIDTH_BLOCK_BITS, Pack_Block)
+
+
+#-------------------------------------------------------------------------------
+#	Grapheme Cluster Break
+#
+#	The Grapheme_Cluster_Break property, with Extended_Pictographic folded in
+#	as an extra value (every such code point is otherwise Other). The order
+#	of the values must match uc::GraphemeBreak. Hangul syllables are all
+#	stored as LVT, since the LV syllables recur every 28 code points and
+#	would otherwise defeat the block sharing; Grapheme_Break_Property sorts
+#	them out arithmetically.
+
+GRAPHEME_BLOCK_BITS = 8
+
+GRAPHEME_VALUES = (
+	'Other',
+	'CR',
+	'LF',
+	'Control',
+	'Extend',
+	'ZWJ',
+	'Regional_Indicator',
+	'Prepend',
+	'SpacingMark',
+	'L',
+	'V',
+	'T',
+	'LV',
+	'LVT',
+	'Extended_Pictographic',
+)
+
+HANGUL_SYLLABLES = (0xAC00, 0xD7A3)
+
+
+def Read_UCD_Property (path, values):
+	nrv = {}
+	line_pattern = re.compile (
+		r'^([0-9A-F]{4,6})(?:\.\.([0-9A-F]{4,6}))?\s*;\s*(\w+)')
+
+	with open (path, encoding = 'utf-8') as f:
+		for line in f:
+			match = line_pattern.match (line)
+
+			if match and match.group (3) in values:
+				first = int (match.group (1), 16)
+				last = int (match.group (2) or match.group (1), 16)
+
+				for cp in range (first, last + 1):
+					nrv [cp] = match.group (3)
+
+	return nrv
+
+
+def Generate_Grapheme_Tables (ucd_path):
+	gcb = Read_UCD_Property (
+		os.path.join (ucd_path, 'auxiliary', 'GraphemeBreakProperty.txt'),
+		GRAPHEME_VALUES)
+	pictographic = Read_UCD_Property (
+		os.path.join (ucd_path, 'emoji', 'emoji-data.txt'),
+		('Extended_Pictographic',))
+
+	for cp in pictographic:
+		assert gcb.get (cp, 'Other') == 'Other'
+		gcb [cp] = 'Extended_Pictographic'
+
+	for cp in range (HANGUL_SYLLABLES [0], HANGUL_SYLLABLES [1] + 1):
+		assert gcb [cp] in ('LV', 'LVT')
+		gcb [cp] = 'LVT'
+
+	def Pack_Block (base, size):
+		for i in range (base, base + size, 2):
+			low = GRAPHEME_VALUES.index (gcb.get (i, 'Other'))
+			high = GRAPHEME_VALUES.index (gcb.get (i + 1, 'Other'))
+
+			yield low | (high << 4)
+
+	return Build_Stages (GRAPHEME_BLOCK_BITS, Pack_Block)
+
+
+#-------------------------------------------------------------------------------
+#	Normalization
+#
+#	Each code point is assigned a property class, which records its
+#	Canonical_Combining_Class along with its quick check values for each of
+#	the four normalization forms; there are few enough distinct classes that
+#	the class can be looked up in a two-stage table of bytes. The values of
+#	the NORM_QC_* flags must match those in lulUnicodeUtilities_priv.hpp.
+#
+#	The full (i.e., recursively applied) decompositions are stored one after
+#	the other in a single array, indexed by a second two-stage table; index
+#	0 means that the code point has no decomposition. Each entry starts with
+#	a header that holds the length of the canonical decomposition in its low
+#	byte and the length of the compatibility decomposition in the next; the
+#	former is 0 if there is no canonical decomposition, and the latter is 0
+#	if the compatibility decomposition is the same as the canonical one.
+#
+#	The compositions are the canonical decompositions into a pair of code
+#	points, less those excluded from composition, sorted by pair.
+#
+#	Hangul syllables are handled arithmetically, so they appear in none of
+#	these tables (other than as the Hangul vowels and trailing consonants
+#	that might combine with a preceding syllable or leading consonant).
+
+NORM_CLASS_BLOCK_BITS = 7
+NORM_DECOMPOSITION_BLOCK_BITS = 7
+
+NORM_QC_NFD_NO = 0x01
+NORM_QC_NFKD_NO = 0x02
+NORM_QC_NFC_NO = 0x04
+NORM_QC_NFC_MAYBE = 0x08
+NORM_QC_NFKC_NO = 0x10
+NORM_QC_NFKC_MAYBE = 0x20
+
+HANGUL_VOWELS = (0x1161, 0x1175)
+HANGUL_TRAILING_CONSONANTS = (0x11A8, 0x11C2)
+
+
+def Is_Hangul_Syllable (cp):
+	return HANGUL_SYLLABLES [0] <= cp <= HANGUL_SYLLABLES [1]
+
+
+def Generate_Compositions ():
+	nrv = {}
+
+	for cp in range (CODE_POINT_COUNT):
+		ch = chr (cp)
+		mapping = unicodedata.decomposition (ch)
+
+		if mapping and not mapping.startswith ('<'):
+			pair = tuple (int (part, 16) for part in mapping.split())
+
+			if (len (pair) == 2) and (unicodedata.normalize ('NFC', ch) == ch):
+				nrv [pair] = cp
+
+	return nrv
+
+
+def Quick_Check (cp, second_code_points):
+	ch = chr (cp)
+	nrv = 0
+
+	if unicodedata.normalize ('NFD', ch) != ch:
+		nrv |= NORM_QC_NFD_NO
+
+	if unicodedata.normalize ('NFKD', ch) != ch:
+		nrv |= NORM_QC_NFKD_NO
+
+	if unicodedata.normalize ('NFC', ch) != ch:
+		nrv |= NORM_QC_NFC_NO
+	elif cp in second_code_points:
+		nrv |= NORM_QC_NFC_MAYBE
+
+	if unicodedata.normalize ('NFKC', ch) != ch:
+		nrv |= NORM_QC_NFKC_NO
+	elif cp in second_code_points:
+		nrv |= NORM_QC_NFKC_MAYBE
+
+	return nrv
+
+
+def Generate_Normalization_Tables ():
+	compositions = Generate_Compositions()
+
+	second_code_points = set (second for first, second in compositions)
+	second_code_points.update (range (HANGUL_VOWELS [0], HANGUL_VOWELS [1] + 1))
+	second_code_points.update (range (
+		HANGUL_TRAILING_CONSONANTS [0], HANGUL_TRAILING_CONSONANTS [1] + 1))
+
+	classes = []
+	class_index = {}
+	class_of = []
+	decomposition_index = []
+	decompositions = [0]
+
+	for cp in range (CODE_POINT_COUNT):
+		ch = chr (cp)
+		properties = (unicodedata.combining (ch), Quick_Check (cp, second_code_points))
+
+		if properties not in class_index:
+			class_index [properties] = len (classes)
+			classes.append (properties)
+
+		class_of.append (class_index [properties])
+
+		canonical = unicodedata.normalize ('NFD', ch)
+		compatible = unicodedata.normalize ('NFKD', ch)
+
+		if Is_Hangul_Syllable (cp) or ((canonical == ch) and (compatible == ch)):
+			decomposition_index.append (0)
+			continue
+
+		canonical = [ord (c) for c in canonical] if canonical != ch else []
+		compatible = [ord (c) for c in compatible] if compatible != unicodedata.normalize ('NFD', ch) else []
+
+		assert len (canonical) < 256 and len (compatible) < 256
+
+		decomposition_index.append (len (decompositions))
+		decompositions.append (len (canonical) | (len (compatible) << 8))
+		decompositions.extend (canonical)
+		decompositions.extend (compatible)
+
+	assert len (classes) <= 256
+	assert len (decompositions) <= 0x10000
+
+	class_stage1, class_blocks = Build_Stages (NORM_CLASS_BLOCK_BITS,
+		lambda base, size: class_of [base : base + size])
+	decomposition_stage1, decomposition_blocks = Build_Stages (
+		NORM_DECOMPOSITION_BLOCK_BITS,
+		lambda base, size: decomposition_index [base : base + size])
+
+	return {
+		'classes': classes,
+		'class_stage1': class_stage1,
+		'class_blocks': class_blocks,
+		'decomposition_stage1': decomposition_stage1,
+		'decomposition_blocks': decomposition_blocks,
+		'decompositions': decompositions,
+		'compositions': sorted (compositions.items()),
+	}
+
+
+#-------------------------------------------------------------------------------
+#	Case Folding
+#
+#	Full case folding (the C and F mappings from CaseFolding.txt), which is
+#	what Python’s str.casefold implements. The mappings are stored one after
+#	the other in a single array, each preceded by its length, and indexed by
+#	a two-stage table; index 0 means that the code point folds to itself.
+
+FOLD_BLOCK_BITS = 8
+
+
+def Generate_Folding_Tables ():
+	index = []
+	mappings = [0]
+
+	for cp in range (CODE_POINT_COUNT):
+		ch = chr (cp)
+		folded = ch.casefold() if not (0xD800 <= cp <= 0xDFFF) else ch
+
+		if folded == ch:
+			index.append (0)
+			continue
+
+		index.append (len (mappings))
+		mappings.append (len (folded))
+		mappings.extend (ord (c) for c in folded)
+
+	assert len (mappings) <= 0x10000
+
+	stage1, blocks = Build_Stages (FOLD_BLOCK_BITS,
+		lambda base, size: index [base : base + size])
+
+	return stage1, blocks, mappings
+
+
+#-------------------------------------------------------------------------------
+#	Output
+
+def Format_Values (values, digits = 2, per_line = 16, indent = '\t'):
+	lines = []
+
+	for i in range (0, len (values), per_line):
+		row = values [i : i + per_line]
+		lines.append (indent + ', '.join ('0x%0*X' % (digits, v) for v in row) + ',')
+
+	return '\n'.join (lines)
+
+
+def Format_Blocks (blocks, digits = 2, per_line = 16):
+	lines = []
+
+	for block in blocks:
+		lines.append ('\t{')
+		lines.append (Format_Values (block, digits, per_line, '\t\t'))
+		lines.append ('\t},')
+
+	return '\n'.join (lines)
+
+
+def Format_Table (type_name, name, dimensions, body):
+	return 'const %s\n%s %s =\n{\n%s\n};\n' % (
+		type_name, name, ''.join ('[%d]' % d for d in dimensions), body)
+
+
+def Width_Section ():
+	stage1, blocks = Generate_Width_Tables()
+	block_size = 1 << WIDTH_BLOCK_BITS
+
+	return '''/*------------------------------------------------------------------------------
+	Display width, as a two-stage lookup; see Code_Point_Width. The first
+	stage maps each block of %d code points to a block in the second stage,
+	and identical blocks are shared. Each second stage block packs 4 widths
+	into a byte, 2 bits apiece, with 3 meaning that the code point is not
+	printable.
+*/
+
+static_assert (WIDTH_block_bits == %d, "regenerate the width tables");
+
+%s
+
+%s''' % (
+		block_size,
+		WIDTH_BLOCK_BITS,
+		Format_Table ('uint8_t', 'WIDTH_stage1', [len (stage1)], Format_Values (stage1)),
+		Format_Table ('uint8_t', 'WIDTH_stage2', [len (blocks), block_size // 4],
+			Format_Blocks (blocks)))
+
+
+def Grapheme_Section (ucd_path):
+	stage1, blocks = Generate_Grapheme_Tables (ucd_path)
+	block_size = 1 << GRAPHEME_BLOCK_BITS
+
+	return '''/*------------------------------------------------------------------------------
+	Grapheme_Cluster_Break, as a two-stage lookup; see Grapheme_Break_Property.
+	This is laid out just like the width tables, except that each second
+	stage block packs 2 values into a byte, 4 bits apiece, low nybble first.
+*/
+
+static_assert (GRAPHEME_block_bits == %d, "regenerate the grapheme tables");
+
+%s
+
+%s''' % (
+		GRAPHEME_BLOCK_BITS,
+		Format_Table ('uint8_t', 'GRAPHEME_stage1', [len (stage1)], Format_Values (stage1)),
+		Format_Table ('uint8_t', 'GRAPHEME_stage2', [len (blocks), block_size // 2],
+			Format_Blocks (blocks)))
+
+
+def Normalization_Section ():
+	tables = Generate_Normalization_Tables()
+	classes = tables ['classes']
+	compositions = tables ['compositions']
+
+	class_lines = '\n'.join ('\t{\t%3d, 0x%02X\t},' % c for c in classes)
+	composition_lines = '\n'.join (
+		'\t{\t0x%05X, 0x%05X, 0x%05X\t},' % (first, second, composite)
+		for (first, second), composite in compositions)
+
+	return '''/*------------------------------------------------------------------------------
+	Normalization properties, decompositions, and compositions; see
+	Normalization_Properties, Decomposition, and Composition. Each property
+	class is a pair of {Canonical_Combining_Class, NORM_QC_* flags}.
+*/
+
+static_assert (NORM_class_block_bits == %d, "regenerate the normalization tables");
+static_assert (NORM_decomposition_block_bits == %d, "regenerate the normalization tables");
+
+%s
+
+%s
+
+%s
+
+%s
+
+%s
+
+%s
+
+%s
+
+const std::size_t
+NORM_composition_count = %d;
+''' % (
+		NORM_CLASS_BLOCK_BITS,
+		NORM_DECOMPOSITION_BLOCK_BITS,
+		Format_Table ('uint8_t', 'NORM_classes', [len (classes), 2], class_lines),
+		Format_Table ('uint8_t', 'NORM_class_stage1', [len (tables ['class_stage1'])],
+			Format_Values (tables ['class_stage1'])),
+		Format_Table ('uint8_t', 'NORM_class_stage2',
+			[len (tables ['class_blocks']), 1 << NORM_CLASS_BLOCK_BITS],
+			Format_Blocks (tables ['class_blocks'])),
+		Format_Table ('uint8_t', 'NORM_decomposition_stage1',
+			[len (tables ['decomposition_stage1'])],
+			Format_Values (tables ['decomposition_stage1'])),
+		Format_Table ('uint16_t', 'NORM_decomposition_stage2',
+			[len (tables ['decomposition_blocks']), 1 << NORM_DECOMPOSITION_BLOCK_BITS],
+			Format_Blocks (tables ['decomposition_blocks'], 4, 8)),
+		Format_Table ('char32_t', 'NORM_decompositions', [len (tables ['decompositions'])],
+			Format_Values (tables ['decompositions'], 5, 8)),
+		Format_Table ('char32_t', 'NORM_compositions', [len (compositions), 3],
+			composition_lines),
+		len (compositions))
+
+
+def Folding_Section ():
+	stage1, blocks, mappings = Generate_Folding_Tables()
+
+	return '''/*------------------------------------------------------------------------------
+	Full case folding; see Case_Folding.
+*/
+
+static_assert (FOLD_block_bits == %d, "regenerate the case folding tables");
+
+%s
+
+%s
+
+%s''' % (
+		FOLD_BLOCK_BITS,
+		Format_Table ('uint8_t', 'FOLD_stage1', [len (stage1)], Format_Values (stage1)),
+		Format_Table ('uint16_t', 'FOLD_stage2', [len (blocks), 1 << FOLD_BLOCK_BITS],
+			Format_Blocks (blocks, 4, 8)),
+		Format_Table ('char32_t', 'FOLD_mappings', [len (mappings)],
+			Format_Values (mappings, 5, 8)))
+
+
+def Write_Output (ucd_path):
+	sections = [
+		Width_Section(),
+		Grapheme_Section (ucd_path),
+		Normalization_Section(),
+		Folding_Section(),
+	]
+
+	text = '''/*------------------------------------------------------------------------------
+
+	Lucena Utilities Library
+	“UnicodeTables_priv.cpp”
+	Copyright © 2018 Lucena
+	All Rights Reserved
+
+	This file is distributed under the University of Illinois Open Source
+	License. See license/License.txt for details.
+
+	DO NOT EDIT. This file was generated by tools/lulGenerateUnicodeTables.py
+	from version %s of the Unicode Character Database.
+
+------------------------------------------------------------------------------*/
+
+
+//	std
+#include <cstddef>
+#include <cstdint>
+
+
+//	lul
+#include <Lucena-Utilities/lulConfig.hpp>
+
+#include "lulConfig_priv.hpp"
+#include "lulUnicodeUtilities_priv.hpp"
+
+
+LUL_begin_v_namespace
+
+namespace uc {
+
+
+%s
+
+/*----------------------------------------------------------------------------*/
+
+}	//	namespace uc
+
+LUL_end_v_namespace
+''' % (unicodedata.unidata_version, '\n\n'.join (sections))
+
+	with open (OUTPUT_PATH, 'w', encoding = 'utf-8') as f:
+		f.write (text)
+
+
+if __name__ == '__main__':
+	if len (sys.argv) != 2:
+		sys.exit ('usage: %s path/to/UCD' % sys.argv [0])
+
+	Write_Output (sys.argv [1])